@@ -25,6 +25,7 @@ namespace Force {
 
   class Generator;
   class AddressSolver;
+  class AddressingMode;
   class Instruction;
 
   /*!
@@ -43,6 +44,7 @@ namespace Force {
 
     ASSIGNMENT_OPERATOR_ABSENT(AddressSolutionFilter);
     virtual bool FilterSolutions(AddressSolver& rAddrSolver, const Instruction& rInstr, uint32& rRemainder) const = 0; //!< Solution filtering method interface.
+    virtual bool NeedsAllSolutions(const AddressSolver& rAddrSolver, const std::vector<AddressingMode* >& rModes) const { return true; } //!< Return whether the filter may need all solutions of the candidate modes, checked before solving.
     virtual void Setup(const Generator* pGen); //!< Setup the address solution filter.
   protected:
     AddressSolutionFilter(const AddressSolutionFilter& rOther) //!< Copy constructor.
@@ -69,6 +71,7 @@ namespace Force {
     const char* Type() const override { return "BaseDependencyFilter"; } //!< Return BaseDependencyFilter object type in string format.
 
     bool FilterSolutions(AddressSolver& rAddrSolver, const Instruction& rInstr, uint32& rRemainder) const override; //!< Filtering solutions based on register dependency.
+    bool NeedsAllSolutions(const AddressSolver& rAddrSolver, const std::vector<AddressingMode* >& rModes) const override; //!< Return whether a register dependency may be chosen.
     void Setup(const Generator* pGen) override; //!< Setup the address solution filter.
   protected:
     BaseDependencyFilter(const BaseDependencyFilter& rOther) //!< Copy constructor.
@@ -81,6 +84,7 @@ namespace Force {
   };
 
   class ConstraintSet;
+  class OperandStructure;
 
   /*!
     \class IndexDependencyFilter
@@ -97,6 +101,7 @@ namespace Force {
     const char* Type() const override { return "IndexDependencyFilter"; } //!< Return IndexDependencyFilter object type in string format.
 
     bool FilterSolutions(AddressSolver& rAddrSolver, const Instruction& rInstr, uint32& rRemainder) const override; //!< Filtering solutions indexd on register dependency.
+    bool NeedsAllSolutions(const AddressSolver& rAddrSolver, const std::vector<AddressingMode* >& rModes) const override; //!< Return whether a register dependency may be chosen.
     void Setup(const Generator* pGen) override; //!< Setup the address solution filter.
   protected:
     IndexDependencyFilter(const IndexDependencyFilter& rOther) //!< Copy constructor.
@@ -107,6 +112,7 @@ namespace Force {
   protected:
   private:
     const ConstraintSet* GetIndexDependenceConstraint(const AddressSolver& rAddrSolver, const Instruction& rInstr) const;
+    const OperandStructure* GetIndexOperandStructure(const AddressSolver& rAddrSolver) const; //!< Return the operand structure of the index operand.
 
   };
 
@@ -122,6 +128,7 @@ namespace Force {
     const char* Type() const override { return "SpAlignmentFilter"; } //!< Return SpAlignmentFilter object type in string format.
 
     bool FilterSolutions(AddressSolver& rAddrSolver, const Instruction& rInstr, uint32& rRemainder) const override; //!< Filtering solutions.
+    bool NeedsAllSolutions(const AddressSolver& rAddrSolver, const std::vector<AddressingMode* >& rModes) const override; //!< Return whether any of the modes uses SP as base.
     void Setup(const Generator* pGen) override; //!< Setup the address solution filter.
   protected:
     SpAlignmentFilter(const SpAlignmentFilter& rOther) : AddressSolutionFilter(rOther), mPreventHard(false), mUnalign(false) { } //!< Copy constructor.
@@ -46,10 +46,15 @@ namespace Force {
   protected:
     bool HasRepeatedRegisters(const OperandSolutionMap& rOprSolutions) const; //!< Return true if two or more operands use the same register.
     bool IsTargetAddressValidAndAligned(uint64 targetAddress) const; //!< Return true if the target address parameter is valid and aligned.
+    bool IsTargetAddressUsable(cuint64 targetAddress, const AddressTagging* pAddrTagging) const; //!< Return true if the target address, untagged if address tagging is given, is valid and aligned.
+    static uint32 TrialBatchSize() { return 16; } //!< Return the number of candidate operand tuples evaluated together. A trial solve draws this many values for every operand, so for the same seed the random stream after it differs from solving one trial at a time.
     OperandSolution* GetOperandSolution(const std::string& rOprRole, OperandSolutionMap* pOprSolutions) const; //!< Get the operand solution corresponding to the specified role.
     const ConstraintSet* GetAddressConstraint() const; //!< Return the address constraint.
     uint32 GetAlignShift() const; //!< Return the alignment shift.
     uint32 GetCpuId() const; //!< Return the CPU ID.
+  private:
+    bool SolveByInversion(OperandSolutionMap* pOprSolutions, uint64& rTargetAddress, const AddressTagging* pAddrTagging) const; //!< Solve for one operand analytically from the other operand values; return true if successful.
+    bool SolveByTrials(OperandSolutionMap* pOprSolutions, uint64& rTargetAddress, const AddressTagging* pAddrTagging) const; //!< Evaluate a batch of random operand values and keep the first yielding a valid target address; return true if successful.
   private:
     const ConstraintSet* mpAddressConstr; //!< Constraint specifying permissible target address values.
     cuint32 mAlignShift; //!< Address alignment shift amount.
@@ -89,8 +94,6 @@ namespace Force {
     ASSIGNMENT_OPERATOR_ABSENT(DivSolutionStrategy);
 
     bool Solve(OperandSolutionMap* pOprSolutions, uint64& rTargetAddress, const AddressTagging* pAddrTagging=nullptr) const override; //!< Solve for operand values and target address; return true if successful.
-  private:
-    uint64 ComputeTargetAddress(cuint64 dividend, cuint64 divisor) const; //!< Compute the target address given the operand values.
   private:
     cbool mSignedOperands; //!< True if operands are signed.
   };
@@ -16,6 +16,8 @@
 #ifndef Force_AddressSolver_H
 #define Force_AddressSolver_H
 
+#include <map>
+#include <utility>
 #include <vector>
 
 #include "Defines.h"
@@ -54,7 +56,8 @@ namespace Force {
     inline void SetRegisterValue(uint64 value) { mRegisterValue = value; } //!< Set register value.
     inline uint64 RegisterValue() const { return mRegisterValue; } //!< Return register value.
     inline void SetRegisterValue(const std::vector<uint64>& values) { mRegisterValues = values; } //!< Set large register values.
-    inline std::vector<uint64> RegisterValues() const { return mRegisterValues; } //!< Return large register values.
+    inline void SetRegisterValue(std::vector<uint64>&& values) { mRegisterValues = std::move(values); } //!< Set large register values, taking over the vector.
+    inline const std::vector<uint64>& RegisterValues() const { return mRegisterValues; } //!< Return large register values.
     inline uint32& VmTimeStampReference() const { return mVmTimeStamp; } //!< Return reference to the time stamp variable.
     void SetFree(bool isFree) { mFree = isFree; } //!< Set indication if the register is a free resource.
     bool IsFree() const { return mFree; } //!< Return if the register is a free resource.
@@ -115,10 +118,12 @@ namespace Force {
     void SetBaseValue(uint64 value) { SetRegisterValue(value); } //!< Set base value.
     inline uint64 BaseValue() const { return mRegisterValue; } //!< Return base value.
     void SetBaseValue(const std::vector<uint64>& values) { SetRegisterValue(values); } //!< Set base values for large register.
-    inline std::vector<uint64> BaseValues() const { return mRegisterValues; } //!< Return base values for large register.
+    inline const std::vector<uint64>& BaseValues() const { return mRegisterValues; } //!< Return base values for large register.
     uint64 TargetAddress() const { return mTargetAddress; } //!< Return target address.
-    virtual ~AddressingMode() { } //!< Destructor.
+    virtual ~AddressingMode(); //!< Destructor.
     virtual bool BaseValueUsable(uint64 baseValue, const AddressSolvingShared* pAddrSolShared) const; //!< Check if base value is usable.
+    virtual void PrepareSolve(const AddressSolvingShared& rShared) { } //!< Compute the target constraints Solve() chooses from, without choosing, so modes can be prepared on several threads.
+    void ClearPrepared(); //!< Discard the target constraints computed by PrepareSolve().
     virtual bool Solve(const AddressSolvingShared& rShared) { return false; } //!< Solve for address.
     virtual bool SolveFree(const AddressSolvingShared& rShared) { return false; } //!< Solve for address.
     virtual bool HasOffset() const { return false; } //!< Return false for has-offset query by default.
@@ -136,10 +141,19 @@ namespace Force {
     AddressingMode(const AddressingMode& rOther); //!< Copy constructor.
     bool SolveWithValue(uint64 value, const AddressSolvingShared& rShared, const ConstraintSet* pTargetConstr, uint64& rTargetAddr) const; //!< Solve address with value given.
     bool SolveWithBase(cuint64 baseValue, const AddressSolvingShared& rShared, const BaseOffsetConstraint& rBaseOffsetConstr, const ConstraintSet* pTargetConstr, uint64& rTargetAddr) const; //!< Solve address with base value given.
+    const ConstraintSet* PrepareWithValue(uint64 value, const AddressSolvingShared& rShared, const ConstraintSet* pTargetConstr); //!< Compute and keep the constraint SolveWithValue() chooses from.
+    void PrepareWithBase(cuint64 baseValue, const AddressSolvingShared& rShared, const BaseOffsetConstraint& rBaseOffsetConstr, const ConstraintSet* pTargetConstr); //!< Compute and keep the constraint SolveWithBase() chooses from.
+    bool AreElementAddressesUsable(const std::vector<uint64>& rElemAddresses, const AddressSolvingShared& rShared, const ConstraintSet* pTargetConstr) const; //!< Return true if the vector element target addresses are aligned and the union of their ranges is usable; pTargetConstr applies to the first element only.
   protected:
     mutable uint64 mTargetAddress; //!< Target address.
   private:
     virtual bool ChooseTargetAddress(const AddressSolvingShared& rShared, ConstraintSet& rConstrSet, uint64& rTargetAddr) const; //!< Select target address from constrained set of possibilities.
+    void GetValueConstraint(uint64 value, const AddressSolvingShared& rShared, const ConstraintSet* pTargetConstr, ConstraintSet& rValueConstr) const; //!< Compute the aligned and shifted constraint SolveWithValue() chooses from.
+    void GetBaseTargetConstraint(cuint64 baseValue, const AddressSolvingShared& rShared, const BaseOffsetConstraint& rBaseOffsetConstr, const ConstraintSet* pTargetConstr, ConstraintSet& rTargetAddrConstr) const; //!< Compute the constraint SolveWithBase() chooses from.
+    const ConstraintSet* FindPrepared(uint64 value, const AddressSolvingShared& rShared, const ConstraintSet* pTargetConstr) const; //!< Return the prepared constraint for the value and target constraint if it is still valid, nullptr otherwise.
+  private:
+    std::map<std::pair<uint64, const ConstraintSet*>, ConstraintSet*> mPreparedConstraints; //!< Constraints computed by PrepareSolve(), keyed by target or base value and target constraint.
+    uint32 mPreparedTimeStamp; //!< VM constraint time stamp of the prepared constraints.
   };
 
   /*!
@@ -231,6 +245,7 @@ namespace Force {
     ~BaseOffsetMode() { } //!< Destructor.
 
     bool BaseValueUsable(uint64 baseValue, const AddressSolvingShared* pAddrSolShared) const override { return true; } //!< Check if base value is usable.
+    void PrepareSolve(const AddressSolvingShared& rShared) override; //!< Compute the target constraint Solve() chooses from.
     bool Solve(const AddressSolvingShared& rShared) override; //!< Solve for address.
     bool SolveFree(const AddressSolvingShared& rShared) override; //!< Solve for address with free base register.
     bool HasOffset() const override { return true; } //!< Return true for has-offset query.
@@ -240,6 +255,8 @@ namespace Force {
     bool SolveOffsetHasConstraint(const AddressSolvingShared* rShared);//! Solve address when offset and base are not free.
   protected:
     BaseOffsetMode(const BaseOffsetMode& rOther) : AddressingMode(rOther) { } //!< Copy constructor.
+  private:
+    bool IsOffsetShift() const; //!< Return whether the offset is scaled by shifting rather than by multiplying.
   };
 
   /*!
@@ -372,6 +389,7 @@ namespace Force {
 
     Object* Clone() const override { return new BaseIndexExtendMode(*this); } //!< Return a cloned Object of the same type and same contents as the Object being cloned.
     const char* Type() const override { return "BaseIndexExtendMode"; } //!< Return a string describing the actual type of the Object.
+    void PrepareSolve(const AddressSolvingShared& rShared) override; //!< Compute the target constraints Solve() chooses from.
     bool Solve(const AddressSolvingShared& rShared) override; //!< Solve for address.
     bool SolveFree(const AddressSolvingShared& rShared) override; //!< Solve for address.
     AddressSolvingShared* AddressSolvingSharedInstance() const override; //!< Return correct AddressSolvingShared object for the base-index addressing mode.
@@ -379,6 +397,7 @@ namespace Force {
     COPY_CONSTRUCTOR_DEFAULT(BaseIndexExtendMode);
 
     void SolveWithAmountBit(const BaseIndexSolvingShared& rSharedBI, uint32 amountBit); //!< Solve with amount bit specified.
+    void PrepareWithAmountBit(const BaseIndexSolvingShared& rSharedBI, uint32 amountBit); //!< Prepare solving with amount bit specified.
     void CreateFreeBaseIndexSolutionWithAmount(const BaseIndexSolvingShared& rBaseIndexShared, const AddressingRegister& rIndexChoice, const uint64 index_value, uint32 amountBit) ; //!< Create solution for a specified index choice when base register is free.
     void SolveTargetHasConstraint(const BaseIndexSolvingShared& rSharedBI, uint32 amountBit);
   private:
@@ -413,7 +432,7 @@ namespace Force {
     void SolveFreeStrideFree(const VectorStridedSolvingShared& rStridedShared, const AddressingRegister& rStrideChoice); //!< Create solution for a specified stride choice when base and stride registers are free.
     void SolveFreeStrideFixed(const VectorStridedSolvingShared& rStridedShared, const AddressingRegister& rStrideChoice); //!< Create solution for a specified stride choice when base register is free and stride register is fixed.
     bool AreTargetAddressesUsable(const VectorStridedSolvingShared& rStridedShared, cuint64 baseVal, cuint64 strideVal); //!< Return true if the target address generated by the base and stride values satisfy all constraints.
-    bool IsTargetAddressUsable(const VectorStridedSolvingShared& rStridedShared, cuint64 targetAddr, const ConstraintSet* pTargetConstr); //!< Return true if the specified target address satisfies all constraints.
+    void CalculateElementAddresses(const VectorStridedSolvingShared& rStridedShared, cuint64 baseVal, cuint64 strideVal, std::vector<uint64>& rElemAddresses) const; //!< Calculate the target addresses of all elements from the base and stride values.
   };
 
   class VectorIndexedSolvingShared;
@@ -449,7 +468,7 @@ namespace Force {
     const Register* Index() const; //!< Return pointer to first index register.
     void IndexValuesForChoice(const AddressingMultiRegister& rAddressingReg, std::vector<uint64>& rIndexRegValues) const; //!< Return index register values for the specified index solution.
     bool AreTargetAddressesUsable(const VectorIndexedSolvingShared& rIndexedShared, cuint64 baseVal, const std::vector<uint64>& rIndexRegValues, const ConstraintSet* pTargetConstr); //!< Return true if the target address generated by the base and index values satisfy all constraints.
-    bool IsTargetAddressUsable(const VectorIndexedSolvingShared& rIndexedShared, cuint64 targetAddr, const ConstraintSet* pTargetConstr); //!< Return true if the specified target address satisfies all constraints.
+    void CalculateElementAddresses(const VectorIndexedSolvingShared& rIndexedShared, cuint64 baseVal, const std::vector<uint64>& rIndexRegValues, std::vector<uint64>& rElemAddresses) const; //!< Calculate the target addresses of all elements from the base and index values.
     uint64 GetElementCountForRegister(const vector<uint64>& rRegValues, cuint64 elemSize) const;
   private:
     MultiRegisterIndexSolution* mpChosenIndexSolution; //!< Pointer to the chosen solution
@@ -468,6 +487,7 @@ namespace Force {
 
     Object* Clone() const override { return new BaseIndexAmountBitExtendMode(*this); } //!< Return a cloned Object of the same type and same contents as the Object being cloned.
     const char* Type() const override { return "BaseIndexAmountBitExtendMode"; } //!< Return a string describing the actual type of the Object.
+    void PrepareSolve(const AddressSolvingShared& rShared) override; //!< Compute the target constraints Solve() chooses from.
     bool Solve(const AddressSolvingShared& rShared) override; //!< Solve for address.
     AddressSolvingShared* AddressSolvingSharedInstance() const override; //!< Return correct AddressSolvingShared object for the addressing mode.
     void SetOperandResults(const AddressSolvingShared& rShared, RegisterOperand& rBaseOperand) const override; //!< Update operands to reflect chosen solution.
@@ -572,7 +592,12 @@ namespace Force {
     bool GetUsableRegisters(const Generator& gen, const RegisterOperand* pRegOperand, vector<Register*>& rUsableRegisters) const; //!< Get a vector of usable registers from the choices for a given Register Operand
     bool GetRegisterChoiceCombinations(const Generator& gen, Instruction& instr, std::vector<AddressingMode* >& rRegChoiceCombos) const; //!< Get an AddressingMode instance for each register choice combination.
     const AddressingMode* SolveWithModes(const Generator& gen, const Instruction& instr, const std::vector<AddressingMode* >& rModes); //!< Solve for each of the specified modes and then choose one of the solutions.
+    bool ShouldSolveLazily(const Generator& gen, const std::vector<AddressingMode* >& rModes) const; //!< Return true if lazy solving is enabled and no solution filter needs all solutions.
+    void SolveLazily(const Generator& gen, const Instruction& instr, const std::vector<AddressingMode* >& rModes); //!< Solve the modes in weighted random order until a usable solution is found.
+    void PrepareModes(const std::vector<AddressingMode* >& rModes) const; //!< Prepare solving the modes on the worker pool, if enabled.
+    bool SolveMode(AddressingMode& rMode) const; //!< Solve for the specified mode.
     void ChooseSolution(const Generator& rGen, const Instruction& rInstr); //!< Choose from viable solutions.
+    void ApplySolutionFilters(const Generator& rGen, const Instruction& rInstr); //!< Apply the solution filters and update the chosen solution accordingly.
     bool UpdateSolution(); //!< Update current solution.
     bool IsRegisterUsable(const Register* regPtr, cbool hasIss) const; //!< Return true if register can be used.
   protected:
@@ -583,7 +608,8 @@ namespace Force {
     std::vector<AddressingMode* > mSolutionChoices; //!< Solution choices.
     std::vector<AddressingMode* > mFilteredChoices; //!< Filtered choices.
   private:
-    bool ShouldEnableAddressShortage(const Instruction& instr) const; //!< Indicate whether there is a potential shortage of base register choices with valid addresses.
+    bool ShouldEnableAddressShortage(const Instruction& instr, uint32 solutionCount) const; //!< Indicate whether there is a potential shortage of base register choices with valid addresses.
+    void UpdateAddressShortage(const Generator& gen, const Instruction& instr, uint32 solutionCount) const; //!< Enable address shortage generator mode if appropriate.
   };
 
   /*!
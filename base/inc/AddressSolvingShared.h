@@ -63,6 +63,7 @@ namespace Force {
     inline uint32 VmTimeStamp() const { return mVmTimeStamp; } //!< Return VM constraint update time stamp.
     inline bool IsInstruction() const { return mIsInstruction; } //!< Return whether the access is instruction.
     void ApplyVirtualUsableConstraint(ConstraintSet* constrSet, uint32& rTimeStamp) const; //!< Apply virtual usable constraint to specified constraint.
+    void CommitVirtualUsableConstraint() const; //!< Commit cached updates of the virtual usable constraint, so that ApplyVirtualUsableConstraint() can be called from several threads at once.
     inline const ConstraintSet* TargetConstraint() const { return mpTargetConstraint; } //!< Return pointer to target constraint.
     const ConstraintSet* PcConstraint() const { return mpPcConstraint; } //!< Return PC spacing constraint.
     VmMapper* GetVmMapper() const { return mpVmMapper; } //!< Return pointer to VmMapper object.
@@ -75,11 +76,13 @@ namespace Force {
     virtual uint64 FreeOffset(AddressingMode* pAddrMode) const {return 0;} //!< Return free offset value, if applicable.
     bool OperandConflict(const Register* pReg) const; //!< Check if the register is in conflict with previously generated operands.
     bool MapTargetAddressRange(uint64 targetAddress, uint32& rTimeStamp) const; //!< Maps the target address range to a physical address range. Returns false if the mapped-to physical address range is unusable.
+    bool MapTargetAddressRanges(const std::vector<uint64>& rTargetAddresses, uint32& rTimeStamp) const; //!< Maps the target address ranges, merging adjoining ranges into spans mapped at once. Returns false if any mapped-to physical address range is unusable.
     std::vector<ConstraintSet*> TargetListConstraint() const {return mpTargetListConstraint;} //!< Return vector of Target list constraint.
   protected:
     const ConstraintSet* GetAllocatedConstraint(ERegisterType regType) const; //!< Get allocated constraint of register indices.
     virtual const ConstraintSet* GetPcSpaceConstraint() const; //!< Get proper PC space constraint.
-    bool ReVerifyTargetAddressRange(uint64 targetAddress) const; //!< Verify target address range again when necessary.
+    bool ReVerifyTargetAddressRange(uint64 targetAddress, uint64 size) const; //!< Verify target address range again when necessary.
+    bool MapTargetAddressSpan(uint64 targetAddress, uint64 size, uint32& rTimeStamp) const; //!< Maps an address span of the specified size. Returns false if the mapped-to physical address range is unusable.
   protected:
     Generator* mpGenerator; //!< Pointer to the generator object.
     Instruction* mpInstruction; //!< Pointer to the instruction object.
@@ -32,6 +32,7 @@ namespace Force {
     std::list<EMemBankType> MemoryBankTypes() const override; //!< Return all memory bank types.
     std::list<EVmRegimeType> VmRegimeTypes() const override; //!< Return all applicable virtual memory regime types.
     void SetupSimAPIs() override; //!< Setup simulator APIs.
+    void SetupGeneratorTemplate() const override; //!< Load architecture data and create the template Generator, if not done yet.
   protected:
     GenAgent* InstantiateGenAgent(EGenAgentType agentType) const override; //!< Instantiate a GenAgent object based on the ArchInfo type and the passed in agentType parameter.
     void AssignGenAgents(Generator* pGen) const override; //!< Assign GenAgents to the Generator.
@@ -91,6 +91,7 @@ namespace Force {
     virtual PhysicalPageManager* InstantiatePhysicalPageManager(EMemBankType bankType, MemoryTraitsManager* pMemTraitsManager) const { return nullptr; } //!< Instantiate a PhysicalPageManager object based on the ArchInfo type.
     virtual MemoryTraitsRegistry* InstantiateMemoryTraitsRegistry() const { return nullptr; } //!< Instantiate a MemoryTraitsRegistry object based on the ArchInfo type.
     virtual void SetupSimAPIs() { } //!< Setup simulator APIs.
+    virtual void SetupGeneratorTemplate() const { } //!< Load architecture data shared by all Generators of this type.
   protected:
     explicit ArchInfo(const std::string& name);
     virtual Generator* InstantiateGenerator() const { return nullptr; } //!< Instantiate a generator object based on the ArchInfo type.
@@ -109,6 +110,7 @@ namespace Force {
   protected:
     std::string mName; //!< Architecture name
     mutable Generator* mpGeneratorTemplate; //!< Pointer to the first Generator of this architecture created, used as template to create subsequent generators;
+    mutable bool mTemplateHandedOut; //!< Whether the template Generator has been handed out as the first Generator created.
     mutable InstructionSet* mpInstructionSet; //!< Pointer to the instruction-set container shared by all Generators of the same type.
     mutable PagingInfo* mpPagingInfo; //!< Pointer to the paging info container shared by all Generators of the same type.
     SimAPI* mpSimAPI; //!< Pointer to the SimAPI object shared by all Generators of the same type.
@@ -147,6 +149,7 @@ namespace Force {
     const ArchInfo* DefaultArchInfo() const { return mpDefaultArchInfo; } //!< Return default ArchInfo object.
     ArchInfo* DefaultArchInfo() { return mpDefaultArchInfo; } //!< Return mutable default ArchInfo object.
     void SetupSimAPIs(); //!< Setup various APIs for simulators.
+    void SetupGeneratorTemplates(); //!< Load architecture data for all ArchInfo objects ahead of generator creation.
   private:
     Architectures();  //!< Constructor, private.
     ~Architectures(); //!< Destructor, private.
@@ -0,0 +1,130 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef Force_BinaryImage_H
+#define Force_BinaryImage_H
+
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Defines.h"
+
+namespace Force {
+
+  /*!
+    \struct BinaryImageHeader
+    \brief Header at the start of a binary image file, followed by the head text.
+  */
+  struct BinaryImageHeader {
+    char mMagic[8]; //!< Image magic string.
+    uint32 mVersion; //!< Image format version.
+    uint32 mByteOrder; //!< 0x01020304 as written by the host, telling the byte order of the header, the tables and the register values.
+    uint32 mHeadSize; //!< Size of the head text following the header.
+    uint32 mSectionCount; //!< Number of entries in the section table.
+    uint32 mRegisterCount; //!< Number of entries in the register table.
+    uint32 mMemoryBank; //!< Memory bank of the sections.
+    uint64 mSectionTableOffset; //!< File offset of the section table.
+    uint64 mRegisterTableOffset; //!< File offset of the register table.
+    uint64 mFileSize; //!< Size of the image file.
+    uint64 mEntryPoint; //!< Entry point of the test, zero if not known.
+  };
+
+  /*!
+    \struct BinaryImageSection
+    \brief Section table entry of a binary image file.
+  */
+  struct BinaryImageSection {
+    uint64 mAddress; //!< Start address of the memory section.
+    uint64 mDataOffset; //!< File offset of the section data, lowest address first.
+    uint64 mSize; //!< Size of the section data in bytes.
+    uint32 mType; //!< 'I' for instructions, 'D' for data.
+    uint32 mReserved; //!< Reserved, zero.
+  };
+
+  /*!
+    \struct BinaryImageRegister
+    \brief Register table entry of a binary image file, either a thread info value or a register value.
+  */
+  struct BinaryImageRegister {
+    uint64 mNameOffset; //!< File offset of the name.
+    uint64 mValuesOffset; //!< File offset of the 64-bit value units, in the order they are printed in text format.
+    uint32 mThreadId; //!< Thread ID.
+    uint32 mFlag; //!< 'V' for thread info, 'R' for registers.
+    uint32 mNameSize; //!< Size of the name.
+    uint32 mValueCount; //!< Number of value units.
+    uint32 mValueSize; //!< Size of each value unit in bytes.
+    uint32 mReserved; //!< Reserved, zero.
+  };
+
+  /*!
+    \class BinaryImageWriter
+    \brief write payloads of a binary image file as they are appended, then the tables and the header on close.
+  */
+  class BinaryImageWriter {
+  public:
+    BinaryImageWriter() : mImageFile(), mPath(), mOffset(0), mHeadSize(0), mMemoryBank(0), mEntryPoint(0), mSections(), mRegisters() { } //!< Constructor
+    ~BinaryImageWriter() { } //!< Destructor
+    ASSIGNMENT_OPERATOR_ABSENT(BinaryImageWriter);
+    COPY_CONSTRUCTOR_ABSENT(BinaryImageWriter);
+    void Open(const std::string& imageFile, const std::string& head); //!< Create the image file and write the head text.
+    void SetMemoryBank(uint32 memBank) { mMemoryBank = memBank; } //!< Set the memory bank of the sections.
+    void SetEntryPoint(uint64 entryPoint) { mEntryPoint = entryPoint; } //!< Set the entry point of the test.
+    void AppendSection(char type, uint64 address, uint64 size, const uint8* data); //!< Append a memory section.
+    void AppendRegister(uint32 threadId, char flag, const std::string& name, const std::vector<uint64>& values, uint32 valueSize); //!< Append a thread info or register value.
+    void Close(); //!< Write the tables and the header, then close the image file.
+  private:
+    uint64 WritePayload(const void* pData, uint64 size); //!< Write the payload at the next 8 byte aligned offset and return that offset.
+  private:
+    std::ofstream mImageFile; //!< image file output stream.
+    std::string mPath; //!< Path of the image file.
+    uint64 mOffset; //!< Current offset in the image file.
+    uint32 mHeadSize; //!< Size of the head text.
+    uint32 mMemoryBank; //!< Memory bank of the sections.
+    uint64 mEntryPoint; //!< Entry point of the test.
+    std::vector<BinaryImageSection> mSections; //!< Section table.
+    std::vector<BinaryImageRegister> mRegisters; //!< Register table.
+  };
+
+  /*!
+    \class BinaryImageFile
+    \brief a binary image file mapped read-only, with the tables and payloads read in place from the mapping.
+
+    Used by the generator to load memory and register images, and by fpix to hand the memory sections of an image
+    to the simulator without parsing an ELF file.
+  */
+  class BinaryImageFile {
+  public:
+    BinaryImageFile() : mPath(), mpMapping(nullptr), mMappedSize(0) { } //!< Constructor
+    ~BinaryImageFile(); //!< Destructor, unmap the image file.
+    ASSIGNMENT_OPERATOR_ABSENT(BinaryImageFile);
+    COPY_CONSTRUCTOR_ABSENT(BinaryImageFile);
+    bool IsLoaded(const std::string& imageFile) const { return (mpMapping != nullptr) and (mPath == imageFile); } //!< Return true if the image file is loaded.
+    void Load(const std::string& imageFile); //!< Map the image file, failing if it is not a binary image of the current version.
+    void Unload(); //!< Unmap the image file.
+    const BinaryImageHeader* Header() const { return reinterpret_cast<const BinaryImageHeader*>(mpMapping); } //!< Return the image header.
+    const BinaryImageSection* Sections() const; //!< Return the section table.
+    const BinaryImageRegister* Registers() const; //!< Return the register table.
+    const uint8* Payload(uint64 offset, uint64 size) const; //!< Return a pointer to size bytes at offset, failing if they lie outside of the file.
+    static bool IsBinaryImage(const std::string& imageFile); //!< Return true if the file starts with the binary image magic string.
+  private:
+    std::string mPath; //!< Path of the loaded image file.
+    uint8* mpMapping; //!< Start of the mapped image file.
+    uint64 mMappedSize; //!< Number of bytes mapped.
+  };
+
+}
+
+#endif
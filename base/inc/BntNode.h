@@ -24,11 +24,13 @@
 
 namespace Force {
 
+  class ConstraintSet;
   class Generator;
   class SimplePeState;
   class ResourcePeState;
   class ResourcePeStateStack;
   class Instruction;
+  class MemoryFootprint;
 
   /*!
     \class BntNode
@@ -55,6 +57,7 @@ namespace Force {
     uint64 TakenPath() const; //!< Return taken path starting address.
     uint64 NotTakenPath() const; //!< Return not taken path starting address.
     void PreserveNotTakenPath(Generator* pGen); //!< Preserve the not-taken path.
+    bool IsRetirable(const std::vector<const ConstraintSet* >& rFreeConstraints, uint64 minSpace) const; //!< Return whether the not-taken path can no longer be generated, given the free memory of each memory bank and the minimum space of a path, so processing the node would only restore its PE state.
     bool PathsSame() const { return (mBranchTarget == mNextPC); } //!< Return whether the branch target and next PC are the same.
     SimplePeState* GetPeState() const { return mpPeState; } //!< Return pointer to PE state object.
     void UpdateAccurateState(Generator* pGen, uint32 instrBytes); //!< Update accurate state.
@@ -71,9 +74,10 @@ namespace Force {
     virtual void UnreserveTakenPath(Generator* pGen); //!< Unreserve the taken path.
     virtual void RecordExecution(const Instruction* pInstr) { } //!< Record execution on a Bnt
     virtual bool ExecutionIsOverflow() { return false; } //!< whether execution on a bnt is overflow
+    virtual void AccountMemoryFootprint(MemoryFootprint& rFootprint) const; //!< Account the node and its saved states to the memory footprint.
   protected:
-    BntNode() : mBranchTarget(0), mNextPC(0), mAttributes(0), mId(0),mSequenceName(), mBntFunction(), mpPeState(nullptr) { } //!< Default constructor.
-    BntNode(const BntNode& rOther) : mBranchTarget(0), mNextPC(0), mAttributes(0),mId(0), mSequenceName(), mBntFunction(), mpPeState(nullptr) { } //!< Copy constructor.
+    BntNode() : mBranchTarget(0), mNextPC(0), mAttributes(0), mId(0),mSequenceName(), mBntFunction(), mpPeState(nullptr), mNotTakenPa(0), mNotTakenBank(0), mNotTakenPaValid(false) { } //!< Default constructor.
+    BntNode(const BntNode& rOther) : mBranchTarget(0), mNextPC(0), mAttributes(0),mId(0), mSequenceName(), mBntFunction(), mpPeState(nullptr), mNotTakenPa(0), mNotTakenBank(0), mNotTakenPaValid(false) { } //!< Copy constructor.
     void SetBoolAttribute(EBntAttributeType attrType, bool setIt); //!< Set BNT boolean attribute.
     void SavePeState(Generator* pGen); //!< Save necessary PE states.
   protected:
@@ -85,6 +89,9 @@ namespace Force {
     std::string mSequenceName;  //!< bnt sequence name
     std::string mBntFunction; //!< bnt function
     SimplePeState* mpPeState; //!< Pointer to PE state object.
+    uint64 mNotTakenPa; //!< Physical address of the not-taken path when it was preserved.
+    uint32 mNotTakenBank; //!< Memory bank of the not-taken path when it was preserved.
+    bool mNotTakenPaValid; //!< Whether the not-taken path physical address is valid.
   };
 
    /*!
@@ -105,6 +112,7 @@ namespace Force {
     void UnreserveTakenPath(Generator* pGen) override; //!< Unreserve the taken path.
     void RecordExecution(const Instruction* pInstr) override; //!< Record execution on a Bnt
     bool ExecutionIsOverflow() override; //!< whether execution on a bnt is overflow
+    void AccountMemoryFootprint(MemoryFootprint& rFootprint) const override; //!< Account the node, its saved states and its resource PE states to the memory footprint.
 
     ASSIGNMENT_OPERATOR_ABSENT(SpeculativeBntNode);
   protected:
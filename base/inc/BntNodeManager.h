@@ -24,6 +24,9 @@
 namespace Force {
 
   class BntNode;
+  class ConstraintSet;
+  class Generator;
+  class MemoryFootprint;
 
   /*!
     \class BntNodeManager
@@ -42,6 +45,9 @@ namespace Force {
     void SwapBntNodes(std::vector<BntNode*>& rSwapVec); //!< swap Bnt nodes
     BntNode* GetHotSpeculativeBntNode() const { return mpHotSpeculativeBntNode; } //!< get hot speculative Bnt node
     void PopSpeculativeBntNode(); //!< pop speculative Bnt node from the stack and set to be hot.
+    uint32 RetireBntNodes(Generator* pGen); //!< Delete saved Bnt nodes whose not-taken paths can no longer be generated, return number of nodes deleted.
+    uint32 RetireBntNodes(const std::vector<const ConstraintSet* >& rFreeConstraints, uint64 minSpace); //!< Delete saved Bnt nodes whose not-taken paths can no longer be generated, given the free memory of each memory bank and the minimum space of a path, return number of nodes deleted.
+    void AccountMemoryFootprint(MemoryFootprint& rFootprint) const; //!< Account all saved Bnt nodes to the memory footprint.
 
     ASSIGNMENT_OPERATOR_ABSENT(BntNodeManager);
   protected:
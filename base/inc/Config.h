@@ -49,12 +49,20 @@ namespace Force {
     uint64 LimitValue(ELimitType limitType) const; //!< Return limitation value of various aspects of the design
     bool OutputAssembly() const { return mOutputAssembly; } //!< Return whether to output assembly code.
     bool OutputImage() const { return mOutputImage; } //!< Return whether to output image.
+    bool OutputBinaryImage() const { return mOutputBinaryImage; } //!< Return whether to output the memory and registers image in binary format.
     void SetOutputAssembly(bool output) { mOutputAssembly = output; } //!< Set flag to output assembly, or not.
     void SetOutputImage(bool output) { mOutputImage = output; } //!< Set flag to output image, or not.
+    void SetOutputBinaryImage(bool binary) { mOutputBinaryImage = binary; } //!< Set flag to output the memory and registers image in binary format, or not.
     bool DoSimulate() const { return mDoSimulate; } //<! Return true if each generated instruction is to be simulated.
     void SetDoSimulate(bool dosim) { mDoSimulate = dosim; } //!< Set flag to simulate each generated instruction, or not.
     bool OutputWithSeed(uint64& initialSeed) const { initialSeed = mInitialSeed; return mOutputWithSeed; } //!< return true if output with seed
     void SetOutputWithSeed(bool seed, uint64 initialSeed = 0) {mOutputWithSeed = seed; mInitialSeed = initialSeed; } //!< set flag to output with seed or not
+    uint64 TestSeed() const { return mTestSeed; } //!< Return the seed the test generation started with.
+    void SetTestSeed(uint64 testSeed) { mTestSeed = testSeed; } //!< Set the seed the test generation started with.
+    uint32 SeedCount() const { return mSeedCount; } //!< Return number of seeds to generate tests with in this process.
+    void SetSeedCount(uint32 seedCount) { mSeedCount = seedCount; } //!< Set number of seeds to generate tests with in this process.
+    uint32 ParallelJobs() const { return mParallelJobs; } //!< Return maximum number of seeds generated concurrently, 0 means not specified.
+    void SetParallelJobs(uint32 parallelJobs) { mParallelJobs = parallelJobs; } //!< Set maximum number of seeds generated concurrently.
     void SetFailOnOperandOverrides() {mFailOverrides = true; }
     bool FailOnOperandOverrides() const {return mFailOverrides; }
     void SetMaxInstructions(uint64 maxInstr) { mMaxInstructions = maxInstr; } //!< Set max instructions allowed to be simulated.
@@ -78,10 +86,11 @@ namespace Force {
     uint64 GetGlobalStateValue(EGlobalStateType globalStateType) const; //!< Return global state value for the given type, fail if not found.
     const std::string GlobalStateString(EGlobalStateType globalStateType, bool& exists) const; //!< Return global state string for the given type.
     void SetCommandLine(const std::string& commandLine) { mCommandLine = commandLine; } //!< set command line.
+    const std::string& CommandLine() const { return mCommandLine; } //!< return command line.
     const std::string HeadOfImage() const; //!< return the head string of the Image file.
     uint64 MaxVectorLen() const; //!< Return max vector register length allowed to be simulated.
   private:
-    Config() : mMainPath(), mTestTemplate(), mMemoryFile(), mBntFile(), mChoicesModificationFile(), mIssApiTraceFile(), mLimits(), mOptionValues(), mOptionStrings(), mGlobalStateValues(), mGlobalStateStrings(), mImportFiles(), mOutputAssembly(true), mOutputImage(false), mDoSimulate(false), mOutputWithSeed(false), mInitialSeed(0), mMaxInstructions(0), mNumChips(1), mNumCores(1), mNumThreads(1), mFailOverrides(false), mConfigFile(), mCommandLine(), mMaxVectorLen(0) { }  //!< Constructor, private.
+    Config() : mMainPath(), mTestTemplate(), mMemoryFile(), mBntFile(), mChoicesModificationFile(), mIssApiTraceFile(), mLimits(), mOptionValues(), mOptionStrings(), mGlobalStateValues(), mGlobalStateStrings(), mImportFiles(), mOutputAssembly(true), mOutputImage(false), mOutputBinaryImage(false), mDoSimulate(false), mOutputWithSeed(false), mInitialSeed(0), mTestSeed(0), mSeedCount(1), mParallelJobs(0), mMaxInstructions(0), mNumChips(1), mNumCores(1), mNumThreads(1), mFailOverrides(false), mConfigFile(), mCommandLine(), mMaxVectorLen(0) { }  //!< Constructor, private.
     virtual ~Config() { } //!< Destructor, private.
     void Setup(const std::string& programPath); //!< Config object setup.
     bool ParseOption(const std::string& optString); //!< Parse option string.
@@ -102,9 +111,13 @@ namespace Force {
     std::list<std::string> mImportFiles; //!< the container for import files
     bool mOutputAssembly; //!< Whether to output assembly code.
     bool mOutputImage; //!< Whether to output image.
+    bool mOutputBinaryImage; //!< Whether to output the memory and registers image in binary format.
     bool mDoSimulate; //!< Whether or not to simulate during test generation.
     bool mOutputWithSeed; //!< Whether to output with seed
     uint64 mInitialSeed; //!< initial seed .
+    uint64 mTestSeed; //!< Seed the test generation started with.
+    uint32 mSeedCount; //!< Number of seeds to generate tests with in this process.
+    uint32 mParallelJobs; //!< Maximum number of seeds generated concurrently.
     uint64 mMaxInstructions; //!< Maximum instructions allowed to be simulated.
     uint64 mNumChips; //!< Number of chips to simulate with.
     uint64 mNumCores; //!< Number of cores per chip to simulate with.
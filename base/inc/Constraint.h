@@ -16,6 +16,7 @@
 #ifndef Force_Constraint_H
 #define Force_Constraint_H
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -293,7 +294,7 @@ namespace Force {
     std::vector<Constraint* > mConstraints; //!< container of the sorted constraint objects
 #ifdef UNIT_TEST
   public:
-    static uint32 msConstraintDeleteCount; //!< Variable to assist unit-testing.
+    static std::atomic<uint32> msConstraintDeleteCount; //!< Variable to assist unit-testing, atomic since constraint sets may be deleted on worker threads.
 #endif
   };
 
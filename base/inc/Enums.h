@@ -601,6 +601,7 @@ namespace Force {
     MemAttrArch = 4,
     MemAttrImpl = 5,
     AliasPageId = 6,
+    PreferredPA = 7,
   };
   extern unsigned char EPageRequestAttributeTypeSize;
   extern const std::string EPageRequestAttributeType_to_string(EPageRequestAttributeType in_enum); //!< Get string name for enum.
@@ -765,6 +766,7 @@ namespace Force {
     AddressShortage = 4096,
     RecordingState = 8192,
     RestoreStateLoop = 16384,
+    NoBnt = 32768,
   };
   extern unsigned int EGenModeTypeSize;
   extern const std::string EGenModeType_to_string(EGenModeType in_enum); //!< Get string name for enum.
@@ -26,6 +26,8 @@
 
 namespace Force {
 
+  class MemoryFootprint;
+
    /*!
     \class ExceptionRecord
     \brief A single record that contains information about the exeption event. Managed by ExceptionRecordManager.
@@ -55,10 +57,14 @@ namespace Force {
     void ReportNewExceptionRecord(const ExceptionRecord& exception_record); //!< Used by the exception space to record any new exceptions.
     void GetExceptionHistoryByEC(EExceptionClassType exceptionType, std::vector<ExceptionRecord> &output); //!< Returns a list of exception events, sorted in chronological order, in the provided output vector
     void GetExceptionHistoryByArgs(const std::map<std::string, std::string>& inputArgs, std::vector<ExceptionRecord> &output); //!< Returns a list of exception events, sorted in chronological order, in the provided output vector
+    void AccountMemoryFootprint(MemoryFootprint& rFootprint) const; //!< Account the exception records to the memory footprint.
+    uint32 RetireRecords(uint32 keepCount); //!< Keep the most recent records, summarize older ones into retired counts per exception class, return number of records retired.
+    uint64 RetiredRecordCount() const; //!< Return number of records retired so far.
   protected:
     ExceptionRecordManager(const ExceptionRecordManager& rOther); //!< Copy constructor.
   protected:
-    std::vector<ExceptionRecord> mRecords; //!< List maintaining the chronological history of all exceptions.
+    std::vector<ExceptionRecord> mRecords; //!< List maintaining the chronological history of all exceptions, except retired ones.
+    std::map<uint32, uint64> mRetiredCounts; //!< Number of retired records by exception class.
   };
 
 }
@@ -22,19 +22,17 @@
 #include "GenAgent.h"
 #include "Notify.h"
 #include "NotifyDefines.h"
+#include "Register.h"
+#include "SimAPI.h"
 
 namespace Force {
 
   class GenInstructionRequest;
   class Instruction;
-  class SimAPI;
   class Register;
   class ReadOnlyRegister;
   class ReadOnlyRegisterField;
   class BntNode;
-  struct RegUpdate;
-  struct MemUpdate;
-  struct ExceptionUpdate;
 
   /*!
     \class GenInstructionAgent
@@ -42,7 +40,7 @@ namespace Force {
   */
   class GenInstructionAgent : public GenAgent, public NotificationSender, public NotificationReceiver {
   public:
-    GenInstructionAgent() : GenAgent(), Receiver(), mInstrSimulated(0), mpInstructionRequest(nullptr), mRegisterInitializations() { } //!< Constructor.
+    GenInstructionAgent() : GenAgent(), Receiver(), mInstrSimulated(0), mpInstructionRequest(nullptr), mRegisterInitializations(), mPhysicalRegisterInits(), mRegisterWrites() { } //!< Constructor.
     ~GenInstructionAgent(); //!< Destructor.
     ASSIGNMENT_OPERATOR_ABSENT(GenInstructionAgent);
 
@@ -88,6 +86,8 @@ namespace Force {
     std::vector<Register* > mRegisterInitializations; //!< Vector of initialized registers.
   private:
     void InitializeLoopMemory(cuint64 startVa, cuint64 memRangeSize) const; //!< Initialize any uninitialized memory that will be recorded by a restore loop.
+    PhysicalRegisterQueue mPhysicalRegisterInits; //!< Physical registers to write to the ISS, in the order they were first initialized.
+    std::vector<RegisterWrite> mRegisterWrites; //!< Register writes sent to the ISS, kept to reuse the allocation.
  };
 }
 
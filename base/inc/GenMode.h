@@ -51,6 +51,7 @@ namespace Force {
     inline bool RestoreStateLoop() const { return ((mMode & EGenModeTypeBaseType(EGenModeType::RestoreStateLoop)) != 0); } //!< Return whether the Generator is in RestoreStateLoop mode.
     inline bool IsFiller() const { return ((mMode & EGenModeTypeBaseType(EGenModeType::Filler)) != 0); } //!< Return whether the Generator is in filler mode
     inline bool IsSpeculative() const { return ((mMode & EGenModeTypeBaseType(EGenModeType::Speculative)) != 0); } //!< Return whether the Generator is in filler mode
+    inline bool NoBnt() const { return ((mMode & EGenModeTypeBaseType(EGenModeType::NoBnt)) != 0); } //!< Return whether the Generator is in no-bnt mode.
     inline bool IsAddressShortage() const { return ((mMode & EGenModeTypeBaseType(EGenModeType::AddressShortage)) != 0); } //!< Return whether the Generator is in address shortage mode
 
     void PushGenMode(EGenModeTypeBaseType modeVar); //!< Push generator mode with value parameter.
@@ -176,10 +176,11 @@ namespace Force {
   */
   class GenInstructionRecordQuery : public GenQuery {
   public:
-    explicit GenInstructionRecordQuery(EQueryType queryType) : GenQuery(queryType), mName(), mOpcode(0), mPA(0), mBank(0), mVA(), mIPA(), mLSTarget(), mBRTarget(), mGroup(), mDests(), mSrcs(), mImms(), mAddressingName(), mAddressingIndex(), mStatus(), mValid(true) { clear(); } //!< Default constructor.
+    explicit GenInstructionRecordQuery(EQueryType queryType) : GenQuery(queryType), mName(), mAssembly(), mOpcode(0), mPA(0), mBank(0), mVA(), mIPA(), mLSTarget(), mBRTarget(), mGroup(), mDests(), mSrcs(), mImms(), mAddressingName(), mAddressingIndex(), mStatus(), mValid(true) { clear(); } //!< Default constructor.
     void GetResults(py::object& rPyObject) const override; //!< Return RegisterIndex query results in the passed in rPyObject.
 
     const std::string& Name() const { return mName; }       //!< Return instruction full-name
+    const std::string& Assembly() const { return mAssembly; } //!< Return instruction assembly text
     const uint64 Opcode() const { return mOpcode; }         //!< Return instruction Opcode
     const uint64 PA() const { return mPA; }                 //!< Return instruction physical address
     const std::pair<bool, uint64>& VA()  const { return mVA; }  //!< return instruction virtual address
@@ -198,6 +199,7 @@ namespace Force {
     const uint32 Bank() const { return mBank; }  //!< Return instruction record memory bank id
 
     void SetName (const std::string& name) const { mName = name; }     //!< Set instruction full-name
+    void SetAssembly (const std::string& assembly) const { mAssembly = assembly; } //!< Set instruction assembly text
     void SetOpcode (uint64 opcode) const { mOpcode = opcode; }         //!< Set instruction Opcode
     void SetPA(uint64 pa) const { mPA = pa; }                          //!< Set instruction physical address
     void SetVA(uint64 va) const { mVA.first = true; mVA.second = va; } //!< Set instruction virtual address
@@ -227,6 +229,7 @@ namespace Force {
     void clear()        //!< clear instruction record
     {
         mName = std::string();
+        mAssembly = std::string();
         mOpcode = 0;
         mPA = 0;
         mBank = 0;
@@ -244,6 +247,7 @@ namespace Force {
         mValid = true;
     }
     mutable std::string mName;       //!< instruction full-name
+    mutable std::string mAssembly;   //!< instruction assembly text
     mutable uint64 mOpcode;     //!< instruction Opcode
     mutable uint64 mPA;         //!< instruction physical address
     mutable uint32 mBank;       //!< instruction memory bank
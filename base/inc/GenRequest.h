@@ -870,6 +870,7 @@ namespace Force {
     uint64 mIPA; //!< IPA to be mapped.
     uint64 mPA; //!< PA to be mapped.
     uint64 mPageId; //!< Page ID to alias mapping to.
+    uint64 mPreferredPA; //!< PA the VA should preferably translate to, used if the page there is usable, otherwise the PA is chosen as usual.
     uint64 mAttributeMask; //!< Attribute set mask.
     uint64 mGenBoolAttributes; //!< Generation boolean type attributes.
     uint64 mGenBoolAttrMask; //!< Generation boolean type attributes set mask.
@@ -68,6 +68,7 @@ namespace Force {
   class BntNodeManager;
   class AddressTableManager;
   class SimAPI;
+  class MemoryFootprint;
 
   /*!
     \class Generator
@@ -172,6 +173,7 @@ namespace Force {
     bool AddressProtection() const; //!< Indicate if the current mode need address protection.
     bool RecordingState() const; //!< Indicate if the generator is in recording state mode.
     bool RestoreStateLoop() const; //!< Indicate if the generator is in RestoreStateLoop mode.
+    bool NoBnt() const; //!< Indicate if the generator is in no-bnt mode, where branches don't save Bnt nodes.
     inline uint64 MaxInstructions() const { return mMaxInstructions; } //!< Return maximum number of instructions allowed.
     inline uint64 MaxPhysicalVectorLen() const { return mMaxPhysicalVectorLen; } //!< Return maximum physical vector register length allowed.
     void GetTranslationRange(uint64 VA, TranslationRange& rTransRange) const; //!< Get translation range for the specified VA.
@@ -183,6 +185,7 @@ namespace Force {
     void SetStateValue(EGenStateType stateType, uint64 value); //!< Set a certain state for the Generator to the given value.
     bool GetStateValue(EGenStateType stateType, uint64& stateValue) const; //!< Return the state numeric value of this Generator.
     void InitializeMemory(uint64 addr, uint32 bank, uint32 size, uint64 data, bool isInstr, bool isVirtual); //!< Initialize a memory location.
+    void InitializeInstructions(uint64 addr, uint32 bank, uint32 instrSize, const std::vector<uint64>& opcodes, const std::vector<std::string>& names, const std::vector<std::string>& asmTexts); //!< Initialize a block of consecutive instructions at a physical address, without generating them.
     void Query(const GenQuery& rGenQuery) const; //!< Process queries of various types.
     void GenVmRequest(GenRequest* pVmReq); //!< Process virtual memory related requests.
     void StateRequest(GenRequest* pStateReq); //!< Process state related requests.
@@ -231,6 +234,8 @@ namespace Force {
     SimAPI* GetSimAPI() const { return mpSimAPI; } //!< Return a pointer to the SimAPI object.
 
     void OutputImage(ImageIO* imageIO) const; //!< Output image in text format.
+    void AccountMemoryFootprint(MemoryFootprint& rFootprint) const; //!< Account the instructions, Bnt nodes, records and exception records of the generator thread to the memory footprint.
+    void Compact(uint32 exceptionRecordLimit); //!< Drop Bnt nodes and records that can no longer affect generation, keep at most exceptionRecordLimit exception records unless 0.
     void SolveAddressShortage(); //!< Handle Address shortage.
     const std::vector<GenAgent*>& GetAgents(){return mAgents;}
 
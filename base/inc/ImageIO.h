@@ -17,6 +17,7 @@
 #define Force_ImageIO_H
 
 #include <map>
+#include <string>
 
 #include "Defines.h"
 
@@ -26,24 +27,32 @@ namespace Force {
   class RegisterFile;
   class ImagePrinter;
   class ImageLoader;
+  class BinaryImageLoader;
   /*!
     \class ImageIO
-    \brief print/load memory and register in text format.
+    \brief print/load memory and register in text or binary format.
+
+    The binary format, see BinaryImage.h, is a header, the image head text, the raw section payloads and register values,
+    followed by a section table and a register table. Loading maps the file and reads the payloads in place. Either
+    format is recognized on load, and fpix loads binary memory images directly.
    */
   class ImageIO {
   public:
-    ImageIO(); //!< Default constructor
+    explicit ImageIO(bool binaryFormat = false); //!< Constructor, printing in binary format if binaryFormat is true.
     ~ImageIO(); //!< Destructor
     ASSIGNMENT_OPERATOR_ABSENT(ImageIO);
     COPY_CONSTRUCTOR_ABSENT(ImageIO);
-    void PrintMemoryImage(const std::string& imageFile, const Memory* memory);  //!< write memory initial data to an image file.
+    void PrintMemoryImage(const std::string& imageFile, const Memory* memory, uint64 entryPoint = 0);  //!< write memory initial data to an image file, recording the test entry point in binary format.
     void PrintRegistersImage(const std::string& imageFile, const std::map<std::string, uint64>& threadInfo, const RegisterFile* regFile); //!< write registers initial value to an Text file.
+    void Close(); //!< Finish writing the registers image file, in binary format written once with the registers of all printed threads.
 
     void LoadMemoryImage(const std::string& imageFile, Memory* memory); //!< load memory initial data from an image file.
     void LoadRegistersImage(const std::string& imageFile, std::map<std::string, uint64>& threadInfo, RegisterFile* registerFile); //!< load registers initial value from an Text file.
+    static bool IsBinaryImage(const std::string& imageFile); //!< Return true if the image file is in binary format.
   private:
     ImagePrinter* mpImagePrinter; //!< pointer of Image Printer.
     ImageLoader* mpImageLoader; //!< pointer of Image Loader.
+    BinaryImageLoader* mpBinaryImageLoader; //!< pointer of binary Image Loader.
   };
 
 }
@@ -51,7 +51,7 @@ namespace Force {
 
     const std::string FullName() const; //!< Return instruction full name.
     const std::string& Name() const; //!< Return instruction name.
-    const std::string AssemblyText() const; //!< return instruction assembly code.
+    virtual const std::string AssemblyText() const; //!< return instruction assembly code.
     uint32 Opcode() const { return mOpcode; } //!< Return instruction final opcode.
     uint32 Size() const; //!< Return instruction size in number of bits.
     uint32 ByteSize() const; //!< Return instruction size in number of bytes.
@@ -112,6 +112,7 @@ namespace Force {
     //\ section - instruction record
     EInstructionGroupType Group() const;
     const std::vector<Operand* > GetOperands() const { return mOperands; }
+    uint32 NumberOfOperands() const { return mOperands.size(); } //!< Return number of operands.
     const std::vector<ConstraintSet* >& LoadStoreGatherScatterTargetListConstraints() const;  //!< Return the targetlist constraint if available.
   protected:
     Instruction(const Instruction& rOther); //!< Copy constructor.
@@ -218,6 +219,25 @@ namespace Force {
     //InstructionConstraint* InstantiateInstructionConstraint() const override; //!< Return an instance of SystemCallInstructionConstraint object.
   };
 
+  /*!
+    \class PlacedInstruction
+    \brief Instruction placed in memory with a previously generated opcode, instead of being generated.
+  */
+  class PlacedInstruction : public Instruction {
+  public:
+    Object* Clone() const override { return new PlacedInstruction(*this); }  //!< Return a cloned PlacedInstruction object of the same type and same contents of the object.
+    const char* Type() const override { return "PlacedInstruction"; } //!< Return the type of the PlacedInstruction object in C string.
+
+    PlacedInstruction(const InstructionStructure* pStructure, uint32 opcode, const std::string& rAssemblyText); //!< Constructor with instruction structure, opcode and assembly text given.
+    ~PlacedInstruction() { } //!< Destructor
+    ASSIGNMENT_OPERATOR_ABSENT(PlacedInstruction);
+    const std::string AssemblyText() const override { return mAssemblyText; } //!< Return the assembly text recorded when the instruction was generated.
+  protected:
+    PlacedInstruction(const PlacedInstruction& rOther) : Instruction(rOther), mAssemblyText(rOther.mAssemblyText) { } //!< Copy constructor.
+  private:
+    std::string mAssemblyText; //!< Assembly text of the instruction.
+  };
+
 }
 
 #endif
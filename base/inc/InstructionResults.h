@@ -26,6 +26,7 @@ namespace Force {
 
   class Instruction;
   class Generator;
+  class MemoryFootprint;
 
   class InstructionResultsBank : public Object  {
   public:
@@ -62,11 +63,14 @@ namespace Force {
     ~ThreadInstructionResults(); //!< Destructor.
 
     bool Commit(Generator* gen, Instruction* instr); //!< Commit a generated instruction.
+    void PlaceInstruction(uint32 bank, uint64 pa, Instruction* instr); //!< Add an instruction that was placed in memory without being generated.
     void GenSummary(); // !< Generate the Instruction summary
     const Instruction* LookupInstruction(uint32 bank, uint64 address) const; //!< Look up instruction by its physical address.
     const std::map<uint64, Instruction* >& GetInstructions(uint32 bank) const; //!< Return instruction results in a memory bank.
     uint32 GetInstructionCount(cuint32 bank) const; //!< Return number of instructions for the specified bank.
     uint32 GetBankCount() const; //!< Return number of instruction results banks.
+    uint64 GetTotalInstructionCount() const; //!< Return number of instructions in all banks.
+    void AccountMemoryFootprint(MemoryFootprint& rFootprint) const; //!< Account the generated instructions to the memory footprint.
     void InvalidCurrentBankAddress(); //!< Invalidate current bank and address.
     void GetCurrentInstructionRecordId (std::string& rec_id); //!< Return current isntruction record id
   protected:
@@ -17,7 +17,9 @@
 #define Force_Log_H
 
 #include <cassert>
+#include <exception>
 #include <ostream>
+#include <string>
 
 namespace Force {
 
@@ -34,6 +36,23 @@ namespace Force {
     notice = 6
   };
 
+  /*!
+    \class DeferredFailure
+    \brief Failure raised by FAIL on a thread capturing its log output, to be reported by the thread that owns the output streams.
+  */
+  class DeferredFailure : public std::exception {
+  public:
+    DeferredFailure(const char* msg, const char* fileName, int lineNo, const char* funcName) //!< Constructor.
+      : std::exception(), mMessage(msg), mFileName(fileName), mLineNo(lineNo), mFuncName(funcName) { }
+    const char* what() const noexcept override { return mMessage.c_str(); } //!< Return the failure message.
+    void Report() const; //!< Report the failure through the global logger on the calling thread.
+  private:
+    std::string mMessage; //!< Failure message.
+    std::string mFileName; //!< Source file name of the failure.
+    int mLineNo; //!< Source line number of the failure.
+    std::string mFuncName; //!< Function name of the failure.
+  };
+
   class Logger {
   public:
     ~Logger() { } //!< Destructor.
@@ -42,9 +61,12 @@ namespace Force {
     void SetLevel(const char* logLevel);
     std::ostream& Stream(LL logLvel);
     std::ostream& TestStream() { return mTestStream; }
+    void Phase(const char* phaseName); //!< Log entering a generation phase with the wall time elapsed since the logger was initialized.
+    void Output(const std::string& rText); //!< Write log text captured on another thread to the output stream.
 
     static void Initialize();
     static void Destroy();
+    static void CaptureThreadOutput(std::ostream* pStream); //!< Send log output of the calling thread to the stream instead, nullptr to stop.
   private:
     Logger(std::ostream& stream, std::ostream& errorStream, std::ostream& testStream);
     void Fail(const char* msg, const char* fileName, int lineNo, const char* funcName);
@@ -53,6 +75,7 @@ namespace Force {
     std::ostream& mErrorStream;
     std::ostream& mTestStream;
     LL mLogLevel;
+    double mStartTime; //!< Wall time in seconds when the logger was initialized, close to process start.
   };
 
   extern Logger* gLog;
@@ -61,6 +84,7 @@ namespace Force {
 #define LOG(LEVEL) if (gLog->Log(LL::LEVEL)) gLog->Stream(LL::LEVEL)
 #define FAIL(msg) gLog->DumpFail(msg, __FILE__,__LINE__,__func__)
 #define SET_LOG_LEVEL(level) gLog->SetLevel(level)
+#define LOG_PHASE(phase) gLog->Phase(phase)
 #define TEST_INFO gLog->TestStream() << "[TEST_INFO]"
 #define MAX_SMALL_BUFFER_SIZE 256
 
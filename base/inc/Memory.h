@@ -27,6 +27,7 @@
 namespace Force {
 
   class MemoryBytes;
+  class MemoryFootprint;
   struct MetaAccess;
 
   /*!
@@ -69,6 +70,7 @@ namespace Force {
     bool IsEmpty() const { return mContent.empty(); } //!< Return if the memory module is empty.
 #ifndef UNIT_TEST
     static void InitializeFillPattern(); //!< initialize fill pattern
+    void AccountMemoryFootprint(MemoryFootprint& rFootprint) const; //!< Account the memory chunks to the memory footprint.
 #endif
   private:
     EMemBankType mBankType;
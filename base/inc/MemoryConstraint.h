@@ -95,8 +95,10 @@ namespace Force {
     const ConstraintSet* Shared() const { return mpShared->GetConstraintSet(); } //!< Return the shared memory constraint.
     void ApplyToConstraintSet(const EMemDataType memDataType, const EMemAccessType memAccessType, cuint32 threadId, const AddressReuseMode& rAddrReuseMode, ConstraintSet* constrSet) const; //!< Apply the appropriate constraints to the specified constraint set.
     void ReplaceUsableInRange(uint64 lower, uint64 upper, ConstraintSet& rReplaceConstr); //!< Replace the range with translated new ranges.
+    void CommitCachedUpdates(cuint32 threadId) const; //!< Commit cached updates, so that ApplyToConstraintSet() only reads the constraints and can be called from several threads at once.
   protected:
     virtual void MarkDataUsedForType(cuint64 startAddress, cuint64 endAddress, const EMemAccessType memAccessType, cuint32 threadId) = 0; //!< Mark a data address range as used for a given access type.
+    virtual void CommitDataUsedUpdates(cuint32 threadId) const = 0; //!< Commit cached updates of the used data addresses.
     virtual const ConstraintSet* DataReadUsed(cuint32 threadId) const = 0; //!< Return used addresses for data reads.
     virtual const ConstraintSet* DataWriteUsed(cuint32 threadId) const = 0; //!< Return used addresses for data writes.
   private:
@@ -127,6 +129,7 @@ namespace Force {
     void MarkDataUsedForType(cuint64 startAddress, cuint64 endAddress, const EMemAccessType memAccessType, cuint32 threadId) override; //!< Mark a data address range as used for a given access type.
     const ConstraintSet* DataReadUsed(cuint32 threadId) const override; //!< Return used addresses for data reads.
     const ConstraintSet* DataWriteUsed(cuint32 threadId) const override; //!< Return used addresses for data writes.
+    void CommitDataUsedUpdates(cuint32 threadId) const override; //!< Commit cached updates of the used data addresses.
   private:
     cuint32 mThreadId; //!< Thread ID associated with the memory constraints.
     LargeConstraintSet* mpDataReadUsed; //!< Used addresses for data reads.
@@ -152,6 +155,7 @@ namespace Force {
     void MarkDataUsedForType(cuint64 startAddress, cuint64 endAddress, const EMemAccessType memAccessType, cuint32 threadId) override; //!< Mark a data address range as used for a given access type.
     const ConstraintSet* DataReadUsed(cuint32 threadId) const override; //!< Return used addresses for data reads.
     const ConstraintSet* DataWriteUsed(cuint32 threadId) const override; //!< Return used addresses for data writes.
+    void CommitDataUsedUpdates(cuint32 threadId) const override; //!< Commit cached updates of the used data addresses.
   private:
     std::map<cuint32, LargeConstraintSet*> mDataReadUsedByThread; //!< Used addresses for data reads by thread ID.
     std::map<cuint32, LargeConstraintSet*> mDataWriteUsedByThread; //!< Used addresses for data writes by thread ID.
@@ -0,0 +1,100 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef Force_MemoryFootprint_H
+#define Force_MemoryFootprint_H
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Defines.h"
+
+namespace Force {
+
+  class ConstraintSet;
+
+  /*!
+    \class MemoryFootprint
+    \brief Per-subsystem breakdown of the memory held by the generator's long-lived containers.
+
+    Each subsystem adds the objects it holds and an estimate of their bytes, computed from container sizes and object sizes, so accounting
+    costs nothing while generating.  Heap data owned by the counted objects is only included where noted by the subsystem.  The report also
+    shows the resident set size of the process, which covers everything the breakdown does not, for example the Python runtime.
+
+    Growth and bounding policy of the accounted structures:
+      - Memory chunks: one MemoryBytes per initialized 8-byte chunk, needed for test output.  Bounded by the initialized memory, which the
+        generated instructions and data determine.
+      - Pages: one PhysicalPage per allocated physical range and one Page per virtual mapping, needed for test output and address
+        translation.  Bounded by the usable physical memory.
+      - ConstraintSets: memory bank and page-aligned free constraints.  Merged on every update, so they grow with fragmentation of the
+        free memory, not with the instruction count.
+      - Instructions: one Instruction per generated instruction, needed for test output.  Bounded by the instruction limits of the test.
+      - BntNodes: one node per branch whose not-taken path is generated at the end of the thread, each holding a register snapshot.  Released
+        when the BranchNotTaken sequence processes them.  Compaction deletes nodes whose not-taken path is no longer free memory.
+      - ResourcePeStates: states pushed on speculative BntNodes, released when the node is popped, so bounded by the speculative BNT depth.
+      - Records: MemoryInitRecords are recycled at the flush after the one sending them, onto a free list capped in length and record
+        size, so bounded by the records of two instructions.  Compaction frees recycled records beyond a small reserve.
+      - Exception records: one record per exception taken, kept for the exception history queries of the template.  With the
+        ExceptionRecordLimit option, compaction keeps only the most recent records and counts the older ones by exception class.
+    Compaction runs every CompactionInterval generated instructions when that option is set.
+    The access history of the dependence module is a fixed-size ring of ResourceAccessStage objects and is not accounted.
+  */
+  class MemoryFootprint {
+  public:
+    MemoryFootprint() : mSubsystems() { } //!< Constructor.
+    ~MemoryFootprint() { } //!< Destructor.
+    ASSIGNMENT_OPERATOR_ABSENT(MemoryFootprint);
+    COPY_CONSTRUCTOR_ABSENT(MemoryFootprint);
+
+    void Add(const std::string& rSubsystem, uint64 objects, uint64 bytes); //!< Add objects and their estimated bytes to a subsystem.
+    void AddConstraintSet(const std::string& rSubsystem, const ConstraintSet* pConstrSet); //!< Add a ConstraintSet and its Constraint objects to a subsystem.
+    uint64 Objects(const std::string& rSubsystem) const; //!< Return number of objects accounted to a subsystem.
+    uint64 Bytes(const std::string& rSubsystem) const; //!< Return number of bytes accounted to a subsystem.
+    uint64 TotalBytes() const; //!< Return number of bytes accounted to all subsystems.
+    void Report(const std::string& rWhen) const; //!< Log the breakdown together with the resident set size of the process.
+
+    template <typename T>
+    static uint64 VectorBytes(const std::vector<T>& rVector) //!< Return the bytes of the storage allocated by a vector.
+    {
+      return rVector.capacity() * sizeof(T);
+    }
+
+    template <typename K, typename V>
+    static uint64 MapBytes(const std::map<K, V>& rMap) //!< Return the estimated bytes of the nodes allocated by a map.
+    {
+      return rMap.size() * (sizeof(typename std::map<K, V>::value_type) + msMapNodeOverhead);
+    }
+  private:
+    /*!
+      \struct Usage
+      \brief Objects and bytes accounted to one subsystem.
+    */
+    struct Usage {
+      Usage() : mObjects(0), mBytes(0) { } //!< Constructor.
+
+      uint64 mObjects; //!< Number of objects.
+      uint64 mBytes; //!< Estimated number of bytes.
+    };
+
+    static const uint64 msMapNodeOverhead = 4 * sizeof(void*); //!< Color and links of a red-black tree node.
+    std::map<std::string, Usage> mSubsystems; //!< Usage by subsystem name, reported in name order.
+  };
+
+  bool read_process_memory_usage(uint64& rResidentBytes, uint64& rPeakResidentBytes); //!< Read current and peak resident set size of the process, return false if unavailable.
+
+}
+
+#endif
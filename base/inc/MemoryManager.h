@@ -43,6 +43,7 @@ namespace Force {
   class AddressReuseMode;
   class SymbolManager;
   class MemoryTraitsManager;
+  class MemoryFootprint;
 
   /*!
     \class MemoryBank
@@ -73,10 +74,12 @@ namespace Force {
     const ConstraintSet* Shared() const; //!< Return const pointer to shared ConstraintSet.
     const ConstraintSet* Unmapped() const; //!< Return const pointer to ConstraintSet of unmapped addresses.
     void ApplyUsableConstraint(const EMemDataType memDataType, const EMemAccessType memAccessType, cuint32 threadId, const AddressReuseMode& rAddrReuseMode, ConstraintSet* constrSet) const; //!< Apply usable constraint to specified constraint.
+    void CommitUsableConstraint(cuint32 threadId) const; //!< Commit cached updates of the usable constraint.
     void SetupPageTableRegion(); //!< Setup page table region in the memory bank.
     void ReserveMemory(const ConstraintSet& memConstr); //!< Reserve memory ranges.
     void UnreserveMemory(const ConstraintSet& memConstr); //!< Unreserve memory ranges
     bool AllocatePageTableBlock(uint64 align, uint64 size, const ConstraintSet* range, uint64& start); //!< Allocate page table block.
+    void AccountMemoryFootprint(MemoryFootprint& rFootprint) const; //!< Account the memory contents, pages and memory constraints of the bank to the memory footprint.
     PhysicalPageManager* GetPhysicalPageManager() const { return mpPhysicalPageManager; } //!< Return the physical page manager.
     PageTableManager* GetPageTableManager() const { return mpPageTableManager; } //!< Return the page table manager.
     SymbolManager* GetSymbolManager() const { return mpSymbolManager; } //!< Return the symbol manager.
@@ -142,7 +145,8 @@ namespace Force {
     const std::vector<PhysicalRegion* > & GetPhysicalRegions() const { return mPhysicalRegions; } //!< Return physical regions.
     bool PaInitialized(const PaTuple& rPaTuple, cuint32 size) const; //!< Check if the memory from target PA through target PA + size - 1 is initialized.
     bool InstructionPaInitialized(const PaTuple& rPaTuple) const; //!< Check if the instruction-sized block of memory starting at the target PA is initialized.
-    void OutputImage() const; //!< Output image in text format.
+    void OutputImage(uint64 resetPC) const; //!< Output memory image, in binary format if configured, with the reset PC as the entry point.
+    void AccountMemoryFootprint(MemoryFootprint& rFootprint) const; //!< Account all memory banks to the memory footprint.
   private:
     MemoryManager();  //!< Constructor, private.
     ~MemoryManager(); //!< Destructor, private.
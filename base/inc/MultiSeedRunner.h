@@ -0,0 +1,73 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef Force_MultiSeedRunner_H
+#define Force_MultiSeedRunner_H
+
+#include <sys/types.h>
+
+#include <vector>
+
+#include "Defines.h"
+
+namespace Force {
+
+  /*!
+    \class MultiSeedRunner
+    \brief Generate tests for multiple seeds from a single FORCE invocation.
+
+    Configuration, architecture data, the Python runtime and the simulator library are set up once in the parent process.  Each seed is then
+    generated by a forked worker process that inherits that read-only state copy-on-write and creates its own Scheduler, Generators and
+    simulator state.  Worker outputs are suffixed with their seeds, as with --outputwithseed, and each worker logs to gen_<seed>.log.
+  */
+  class MultiSeedRunner {
+  public:
+    MultiSeedRunner(uint64 initialSeed, uint32 seedCount, uint32 maxJobs); //!< Constructor.
+    ~MultiSeedRunner() { } //!< Destructor.
+    ASSIGNMENT_OPERATOR_ABSENT(MultiSeedRunner);
+    COPY_CONSTRUCTOR_ABSENT(MultiSeedRunner);
+
+    typedef void (*GenerateFunction)(); //!< Function generating one test with the current seed.
+    int Run(GenerateFunction genFunc); //!< Generate a test for each seed, return non-zero if any of them failed.
+    uint32 SeedCount() const { return mSeedRuns.size(); } //!< Return number of seeds to generate tests with.
+    uint64 GetSeed(uint32 index) const { return mSeedRuns[index].mSeed; } //!< Return seed of the specified index.
+  private:
+    /*!
+      \struct SeedRun
+      \brief Status and timing of the generation run of one seed.
+    */
+    struct SeedRun {
+      explicit SeedRun(uint64 seed) : mSeed(seed), mPid(0), mExitStatus(0), mStartTime(0.0), mElapsedTime(0.0), mDone(false) { } //!< Constructor.
+
+      uint64 mSeed; //!< Seed of the run.
+      pid_t mPid; //!< Process ID of the worker.
+      int mExitStatus; //!< Raw wait status of the worker.
+      double mStartTime; //!< Start time of the worker in seconds.
+      double mElapsedTime; //!< Wall time of the worker in seconds.
+      bool mDone; //!< Whether the worker has finished.
+    };
+
+    void Launch(SeedRun& rSeedRun, GenerateFunction genFunc); //!< Fork a worker process for the seed run.
+    void RunWorker(uint64 seed, GenerateFunction genFunc); //!< Generate the test for one seed in the worker process, does not return.
+    bool Succeeded(const SeedRun& rSeedRun) const; //!< Return true if the seed run finished successfully.
+    void PrintSummary(double totalTime) const; //!< Print per-seed status and timing.
+  private:
+    std::vector<SeedRun> mSeedRuns; //!< Seed runs in seed order.
+    uint32 mMaxJobs; //!< Maximum number of concurrent workers.
+  };
+
+}
+
+#endif
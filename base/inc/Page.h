@@ -16,6 +16,7 @@
 #ifndef Force_Page_H
 #define Force_Page_H
 
+#include <map>
 #include <vector>
 
 #include "Defines.h"
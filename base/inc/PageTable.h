@@ -16,7 +16,6 @@
 #ifndef Force_PageTable_H
 #define Force_PageTable_H
 
-#include <map>
 #include <vector>
 
 #include "Defines.h"
@@ -34,6 +33,9 @@ namespace Force {
   /*!
     \class PageTable
     \brief Page table holdes pointers to all allocated pages or down stream tables.
+
+    The entries are kept in a dense array with one slot per PTE index, allocated when the first entry is committed, along with a bitmap
+    of the occupied slots.
   */
   class PageTable {
   public:
@@ -61,13 +63,15 @@ namespace Force {
     uint32 GetPteIndex(uint64 address) const; //!< Get index for associated PTE given the address it covers.
     TablePte* GetNextLevelTable(uint64 pageStart) const; //!< Get next level table that covers the address passed in.
     void CommitPageTableEntry(uint64 pageStart, PageTableEntry* pPte, VmAddressSpace* pVmas); //!< Insert PTE object into the table.
+    bool EntryPresent(uint32 pteIndex) const { return (pteIndex < mEntries.size()) and ((mPresentEntries[pteIndex >> 6] >> (pteIndex & 0x3f)) & 1); } //!< Return true if there is a PTE at the specified index.
   protected:
     EMemBankType mMemoryBank; //!< The memory bank where the page table is located.
     uint32 mMask; //!< Mask to extract index for PTE in the table.
     uint32 mLowestLookUpBit; //!< LSB of the look up bit range.
     uint32 mTableLevel; //!< Level of the table.
     uint64 mTableBase; //!< Table base address.
-    std::map<uint32, PageTableEntry* > mEntries; //!< Container of all allocated pages or down stream tables.
+    std::vector<PageTableEntry* > mEntries; //!< Container of all allocated pages or down stream tables, indexed by PTE index.
+    std::vector<uint64> mPresentEntries; //!< Bitmap of the PTE indices holding an entry.
   };
 
   /*!
@@ -60,6 +60,7 @@ namespace Force
 
     void AddPage(const Page* pPage);     //!< Add a virtual page preserving sorted order
     void Merge(PhysicalPage* pPhysPage); //!< Merge with another physical page, deletes pPhysPage and sets to nullptr
+    uint32 VirtualPageCount() const { return mVirtualPages.size(); } //!< Return number of virtual pages mapped to this physical page.
 
     protected:
     uint64 mLower; //!< Start physical address of this physical page
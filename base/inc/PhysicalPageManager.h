@@ -35,6 +35,7 @@ namespace Force
   class  MemoryConstraintUpdate;
   class  MemoryTraitsManager;
   class  MemoryTraitsRange;
+  class  MemoryFootprint;
   struct PageSizeInfo;
 
   /*!
@@ -52,12 +53,14 @@ namespace Force
 
     void Initialize(const ConstraintSet* pUsableMem, const ConstraintSet* pBoundary); //!< call to setup initial constraint set objects based on the usable physical memory
     bool AllocatePage(cuint32 threadId, uint64 VA, uint64 size, GenPageRequest* pPageReq, PageSizeInfo& rSizeInfo, const PagingChoicesAdapter* pChoicesAdapter); //!< Allocate page if VA lies in free range, return true if allocated
+    bool PlanPhysicalRange(uint64 VA, uint64 size, uint64 maxPhysical, uint64& rPA) const; //!< Choose free physical memory in the boundary for the whole virtual range, return true with the PA of VA in rPA if found
     void CommitPage(const Page* pPage, uint64 size); //!< Commit page to appropriate physical page object
     void SubFromBoundary(const ConstraintSet& rConstr); //!< Subtract constraint from memory boundary.
     void AddToBoundary(const ConstraintSet& rConstr); //!< Add constraint to memory boundary.
     const ConstraintSet* GetUsable() const { return mpFreeRanges; } //!< Return the free ranges.
     void HandleMemoryConstraintUpdate(const MemoryConstraintUpdate& rMemConstrUpdate) const; //!< Update objects dependent on the physical memory constraint.
     const Page* GetVirtualPage(uint64 PA, const VmAddressSpace* pVmas) const;
+    void AccountMemoryFootprint(MemoryFootprint& rFootprint) const; //!< Account the pages and page constraints to the memory footprint.
   protected:
     virtual const std::vector<EPteType>& GetPteTypes() const = 0; //! Return vector of EPteTypes
   private:
@@ -22,6 +22,7 @@ namespace PyEnvironment {
 
   void initialize_python(); //!< Load Python modules defined via pybind and initialize Python interpreter.
   void finalize_python(); //!< Shut down Python interpreter.
+  void reinitialize_python_after_fork(); //!< Restore Python interpreter internal state in a forked child process.
 
 }
 
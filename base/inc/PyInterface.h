@@ -54,6 +54,7 @@ namespace Force {
     py::object GenInstruction(uint32 threadId, const std::string& instrName, const py::dict& parms); //!< API that generate an instruction requested by front-end.
     py::object GenMetaInstruction(uint32 threadId, const std::string& instrName, const py::dict& metaParms); //!< API that generate a meta instruction requested by front-end.
     void InitializeMemory(uint32 threadId, uint64 addr, uint32 bank, uint32 size, uint64 data, bool isInstr, bool isVirtual); //!< Initialize a memory location.
+    void InitializeInstructions(uint32 threadId, uint64 addr, uint32 bank, uint32 instrSize, const py::list& opcodes, const py::list& names, const py::list& asmTexts); //!< Initialize a block of consecutive instructions at a physical address.
     py::object AddChoicesModification(uint32 threadId, const py::object& choicesType, const std::string& treeName, const py::dict& params, bool globalModification = false); //!< Add choices modification
     void CommitModificationSet(uint32 threadId, const py::object& choicesType, const py::object& setId); //!< commit a modification set
     void RevertModificationSet(uint32 threadId, const py::object& choicesType, const py::object& setId);  //!< revert a modification set with the given ID
@@ -75,6 +76,8 @@ namespace Force {
 
     // Random module APIs
     py::object Sample(uint64 totals, uint64 samples) const; //!< Return a vector of randomly sampled numbers between 0 and totals-1
+    void BeginDetachedRandomStream(uint64 seed) const; //!< Save the random engine state and seed the engine for values that do not affect the saved state
+    void EndDetachedRandomStream() const; //!< Restore the random engine state saved by the matching BeginDetachedRandomStream call
 
     // Register module APIs
     py::object GetRandomRegisters(cuint32 threadId, cuint32 number, const std::string& rRegType, const std::string& rExcludes) const; //!< Get random registers that are not reserved.
@@ -38,6 +38,8 @@ namespace Force {
     uint32 Random32(uint32 min=0, uint32 max=MAX_UINT32) const; //!< Obtain a random 32 bit integer value
     uint64 Random64(uint64 min=0, uint64 max=MAX_UINT64) const; //!< Obtain a random 64 bit integer value
     double RandomReal(double min=0.0, double max=1.0) const; //!< Obtain a random 64 bit real value
+    void BeginDetachedStream(uint64 seed); //!< Save the random engine state and seed the engine for values that do not affect the saved state.
+    void EndDetachedStream(); //!< Restore the random engine state saved by the matching BeginDetachedStream call.
   private:
     Random();  //!< Constructor, private.
     ~Random(); //!< Destructor, private.
@@ -56,8 +58,8 @@ namespace Force {
   class RandomURBG32 {
   public:
     typedef uint32 result_type; //!< Type define required by STL
-    uint32 min() const { return 0; } //!< min function required by STL
-    uint32 max() const { return MAX_UINT32; } //!< max function required by STL
+    static constexpr uint32 min() { return 0; } //!< min function required by STL
+    static constexpr uint32 max() { return MAX_UINT32; } //!< max function required by STL
     uint32 operator () () const { return mpRandomInstance->Random32(min(), max()); }
 
     explicit RandomURBG32(const Random* randomInstance) : mpRandomInstance(randomInstance) { } //!< Constructor with pointer to a Random object provieded.
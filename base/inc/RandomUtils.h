@@ -61,6 +61,27 @@ namespace Force {
       return nullptr;
     }
 
+  /*!
+    Draw items considering weights from the vector without replacement until tryItem accepts one, return the accepted item or nullptr.
+    The drawn items are erased from the vector, the accepted item is chosen with the same probability as choosing by weight among all the
+    acceptable items, but usually only a few items need to be tried.
+  */
+  template <typename T, typename TryItem>
+    T* choose_weighted_item_lazily(std::vector<T *>& rPending, TryItem tryItem)
+    {
+      while (not rPending.empty()) {
+        T* vec_item = choose_weighted_item(rPending);
+        if (vec_item == nullptr) {
+          break;
+        }
+        rPending.erase(std::find(rPending.begin(), rPending.end(), vec_item));
+        if (tryItem(vec_item)) {
+          return vec_item;
+        }
+      }
+      return nullptr;
+    }
+
   /*!
     Return an item's index in the vector considering relative weights..
   */
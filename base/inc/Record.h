@@ -75,8 +75,11 @@ namespace Force {
     const std::string DataString() const; //!< Return the data byte stream in string format for printing.
   protected:
     MemoryInitRecord(const MemoryInitRecord& rOther); //!< Copy constructor.
+    void Reset(cuint32 threadId, uint32 size, uint32 elementSize, EMemDataType type, const EMemAccessType memAccessType); //!< Reset a recycled record for a new memory initialization, reusing its buffers when large enough.
+    void CheckElementSize() const; //!< Check the data size is a multiple of the element size.
   protected:
-    cuint32 mThreadId; //!< ID of the thread requesting the memory initialization.
+    uint32 mThreadId; //!< ID of the thread requesting the memory initialization.
+    uint32 mCapacity; //!< Size of the data and attribute buffers, at least mSize.
     uint32 mSize; //!< Size of the initializing data.
     uint32 mElementSize; //!< Element size of the initializaing data.
     uint64 mAddress; //!< Physical address of the memory initialization target.
@@ -85,9 +88,51 @@ namespace Force {
     EMemAccessType mMemAccessType; //!< Memory access type.
     uint8* mpData; //!< The byte stream data.
     uint8* mpAttrs; //!< Attributes corresponding to the data.
+
+    friend class RecordArchive;
+  };
+
+  /*!
+    \struct MemoryInitLogEntry
+    \brief One write of a MemoryInitLog, covering one or more memory initializations of adjacent bytes.
+  */
+  struct MemoryInitLogEntry {
+    uint64 mAddress; //!< Physical address of the first byte.
+    uint32 mMemoryId; //!< Target memory ID.
+    uint32 mSize; //!< Number of bytes.
+    const uint8* mpData; //!< Data of the write, in the buffer of the MemoryInitRecord or, for merged initializations, in the log arena.
+  };
+
+  /*!
+    \class MemoryInitLog
+    \brief Log of memory initializations, merging an initialization that continues the previous one into a single write.
+
+    A write of a single initialization refers to the data of its MemoryInitRecord, so only merged initializations are copied, into an arena
+    kept between uses.  An arena grown beyond msMaxKeptArenaBytes by an unusually large flush is freed when the log is cleared.
+  */
+  class MemoryInitLog {
+  public:
+    MemoryInitLog() : mEntries(), mArena(), mDataSize(0) { } //!< Constructor.
+    COPY_CONSTRUCTOR_ABSENT(MemoryInitLog);
+    ASSIGNMENT_OPERATOR_ABSENT(MemoryInitLog);
+
+    void Build(const std::vector<MemoryInitRecord* >& rRecords); //!< Log the memory initializations of the records, which need to stay unchanged while the log is in use.
+    void Clear(); //!< Remove all entries, keeping the allocated storage unless it is beyond the kept size.
+    void Release(); //!< Remove all entries and free the allocated storage.
+    const std::vector<MemoryInitLogEntry>& Entries() const { return mEntries; } //!< Return the logged writes, in initialization order.
+    const uint8* EntryData(const MemoryInitLogEntry& rEntry) const { return rEntry.mpData; } //!< Return the data of a logged write.
+    uint64 DataSize() const { return mDataSize; } //!< Return the number of logged bytes.
+    uint64 CopiedSize() const { return mArena.size(); } //!< Return the number of logged bytes copied into the arena.
+    uint64 StorageBytes() const { return mEntries.capacity() * sizeof(MemoryInitLogEntry) + mArena.capacity(); } //!< Return the number of bytes allocated for entries and data.
+  private:
+    static const uint64 msMaxKeptArenaBytes = 0x10000; //!< Largest arena kept when the log is cleared.
+    std::vector<MemoryInitLogEntry> mEntries; //!< Logged writes.
+    std::vector<uint8> mArena; //!< Data of the merged writes.
+    uint64 mDataSize; //!< Number of logged bytes.
   };
 
   class BntNode;
+  class MemoryFootprint;
 
   /*!
     \class RecordArchive
@@ -95,7 +140,7 @@ namespace Force {
   */
   class RecordArchive : public Object {
   public:
-    RecordArchive() : Object(), mCurrentId(0), mRecords() { } //!< Constructor
+    RecordArchive() : Object(), mCurrentId(0), mRecords(), mFlushedRecords(), mFreeRecords(), mMemoryInitLog(), mRetainRecords(true), mRecordCount(0), mAllocatedCount(0), mFlushCount(0), mFlushedWriteCount(0), mFlushedByteCount(0) { } //!< Constructor
     Object* Clone() const override { return new RecordArchive(*this); } //!< Return a cloned RecordArchive object of the same type
     const std::string ToString() const override; //!< Return a string describing the current state of the RecordArchive object.
     const char* Type() const override { return "RecordArchive"; } //!< Return a string describing the actual type of the RecordArchive Object
@@ -103,12 +148,34 @@ namespace Force {
 
     MemoryInitRecord* GetMemoryInitRecord(cuint32 threadId, uint32 size, uint32 elementSize, EMemDataType type) const; //!< Return a MemoryInitRecord object.
     MemoryInitRecord* GetMemoryInitRecord(cuint32 threadId, uint32 size, uint32 elementSize, EMemDataType type, const EMemAccessType memAccessType) const; //!< Return a MemoryInitRecord object.
-    void SwapMemoryInitRecords(std::vector<MemoryInitRecord* >& rSwapVec); //!< Swap MemoryInitRecords vector
+    const MemoryInitLog& FlushMemoryInitRecords(); //!< Log the pending MemoryInitRecords and return the memory init log; the log and its records stay valid until the next flush or discard.
+    void DiscardMemoryInitRecords(); //!< Drop the pending MemoryInitRecords and the memory init log.
+    void ReleaseMemoryInitRecord(const MemoryInitRecord* pRecord) const; //!< Return a MemoryInitRecord that has been applied to the memory, recycling it right away when MemoryInitRecords are not retained.
+    void SetRetainMemoryInitRecords(bool retain) { mRetainRecords = retain; } //!< Set whether MemoryInitRecords are kept until flushed; when not, only one record may be outstanding and it is recycled when released.
+    void LogSummary() const; //!< Log the memory initialization record counts.
+    void AccountMemoryFootprint(MemoryFootprint& rFootprint) const; //!< Account the pending and recycled records and the memory init log to the memory footprint.
+    uint32 ReleaseUnusedStorage(); //!< Free recycled records beyond a small reserve and the memory init log storage, return number of records freed.
   protected:
-    RecordArchive(const RecordArchive& rOther) : Object(rOther), mCurrentId(0), mRecords() { } //!< Copy constructor
+    RecordArchive(const RecordArchive& rOther) : Object(rOther), mCurrentId(0), mRecords(), mFlushedRecords(), mFreeRecords(), mMemoryInitLog(), mRetainRecords(true), mRecordCount(0), mAllocatedCount(0), mFlushCount(0), mFlushedWriteCount(0), mFlushedByteCount(0) { } //!< Copy constructor
+  private:
+    MemoryInitRecord* NewMemoryInitRecord(cuint32 threadId, uint32 size, uint32 elementSize, EMemDataType type, const EMemAccessType memAccessType) const; //!< Return a pending MemoryInitRecord, recycled if possible.
+    void RecycleMemoryInitRecord(MemoryInitRecord* pRecord) const; //!< Move a MemoryInitRecord to the free list, deleting it if beyond the free list bounds.
+    void RecycleMemoryInitRecords(std::vector<MemoryInitRecord* >& rRecords) const; //!< Move the MemoryInitRecords to the free list, deleting those beyond the free list bounds.
   private:
+    static const uint32 msKeptFreeRecords = 16; //!< Number of recycled records kept when releasing unused storage, enough for the records of a typical instruction.
+    static const uint32 msMaxFreeRecords = 256; //!< Largest number of recycled records kept on the free list.
+    static const uint32 msMaxRecycledCapacity = 0x1000; //!< Largest buffer size of a recycled record, larger records are deleted.
     mutable uint32 mCurrentId; //!< Incrementing IDs to be assigned to each new Record object.
-    mutable std::vector<MemoryInitRecord* > mRecords; //!< Container of all Record objects in the current PE.
+    mutable std::vector<MemoryInitRecord* > mRecords; //!< MemoryInitRecords pending to be sent to the ISS.
+    mutable std::vector<MemoryInitRecord* > mFlushedRecords; //!< MemoryInitRecords referred to by the memory init log.
+    mutable std::vector<MemoryInitRecord* > mFreeRecords; //!< MemoryInitRecords already sent, kept for reuse.
+    MemoryInitLog mMemoryInitLog; //!< Memory initializations of the last flush.
+    bool mRetainRecords; //!< Whether MemoryInitRecords are kept until flushed, as needed to send them to an ISS.
+    mutable uint64 mRecordCount; //!< Number of MemoryInitRecords handed out.
+    mutable uint64 mAllocatedCount; //!< Number of MemoryInitRecord objects allocated.
+    uint64 mFlushCount; //!< Number of flushes and discards, one per instruction step.
+    uint64 mFlushedWriteCount; //!< Number of writes in the flushed memory init logs.
+    uint64 mFlushedByteCount; //!< Number of bytes in the flushed memory init logs.
   };
 
 }
@@ -70,6 +70,7 @@ namespace Force {
     uint32              Size()                    const { return mSize;         } //!< Get mSize
     uint32              IndexValue()              const { return mIndex;        } //!< Get mIndex
     uint32              SubIndexValue()           const { return mSubIndex;     } //!< Get mSubIndex
+    uint32              FileIndex()               const { return mFileIndex;    } //!< Get mFileIndex
 
     virtual void SetValue(uint64 value, uint64 mask);      //!< Set mValue using value for mask's bits
     void         SetResetValue(uint64 value, uint64 mask); //!< Set mResetValue/mResetMask using value for mask's bits
@@ -89,6 +90,7 @@ namespace Force {
     uint32 mSize;                //!< Size (0 <= size <= 64)
     uint32 mIndex;               //!< Index value
     uint32 mSubIndex;            //!< SubIndex value
+    uint32 mFileIndex;           //!< Dense index of the register in its register file, assigned in the order registers are added
     uint32 mAttributes;          //!< Bitmap of ERegAttrType (3 bits - HasValue | Write | Read)
 
     friend class RegisterParser;
@@ -96,6 +98,7 @@ namespace Force {
     friend class BitField;
     friend class LinkedPhysicalRegister;
     friend class ImageLoader;
+    friend class BinaryImageLoader;
   };
 
   /*!
@@ -177,6 +180,7 @@ namespace Force {
     void Block()                     const { mpRegister->Block();   } //!< Block Sender class from sending notifications
     void Unblock()                   const { mpRegister->Unblock(); } //!< Unblock Sender class from sending notifications
     void GetPhysicalRegisters(std::set<PhysicalRegister*>& phyRegisterSet) const; //!< Add new physical registers in this vector;
+    void GetPhysicalRegisters(std::vector<PhysicalRegister*>& rPhyRegisters) const; //!< Append the physical register to the vector.
 
     uint32 Size()                 const { return mSize; }                               //!< Get mSize
     uint64 Value()                const { return mpRegister->Value(mMask);           } //!< Get masked phy reg value
@@ -267,6 +271,7 @@ namespace Force {
 
     virtual void Setup(const RegisterFile* pRegisterFile);                         //!< Setup bitfields phy reg pointers and phy reg reset.
     void GetPhysicalRegisters(std::set<PhysicalRegister*>& phyRegisterSet) const; //!< Add this registerfields phy registers to input vector.
+    void GetPhysicalRegisters(std::vector<PhysicalRegister*>& rPhyRegisters) const; //!< Append this register field's physical registers to the vector, possibly with repeats.
 
     uint32      mSize;                  //!< Size of this register field.
     uint32      mLsb;                   //!< mLsb relative to the block, the lowest mLsb of its bitfields.
@@ -459,6 +464,7 @@ namespace Force {
     uint64 GetPhysicalRegisterMask(const PhysicalRegister& rPhyReg) const; //!< Return bitmask representing the mapping of this register unto the specified physical register
     const std::map<std::string, RegisterField*> GetRegisterFieldsFromMask(uint64 mask) const; // Return map of field names to RegisterField* of fields with bits inside give mask
     void GetPhysicalRegisters(std::set<PhysicalRegister*>& phyRegisterSet) const; //!< Add this register's physical registers to input vector
+    void GetPhysicalRegisters(std::vector<PhysicalRegister*>& rPhyRegisters) const; //!< Append this register's physical registers to the vector, possibly with repeats.
 
     bool HasAttribute(ERegAttrType) const; //!< Test if the register has the specified attribute.
     void SetAttribute(ERegAttrType);   //!< Set the attribute from given type.
@@ -529,6 +535,8 @@ namespace Force {
 
     std::vector<uint64> Values() const; //!< return vector of values for entire large register
     std::vector<uint64> InitialValues() const; //!< return vector of initial values for entire large register
+    void GetValues(std::vector<uint64>& rValues) const; //!< fill rValues with the values for entire large register, reusing its storage
+    void GetInitialValues(std::vector<uint64>& rValues) const; //!< fill rValues with the initial values for entire large register, reusing its storage
     std::vector<uint64> ReloadValues() const; //!< return vector of reload values for entire large register
 
     bool IsLargeRegister() const override { return true; } //!< Return true for being a LargeRegister
@@ -665,6 +673,22 @@ namespace Force {
     const Register* mpRazwiRegister; //!< Pointer to RAZ/WI register object.
   };
 
+  /*!
+    \class PhysicalRegisterQueue
+    \brief Physical registers queued once each in the order they were first added, repeats are skipped through a bitset indexed by register file index.
+  */
+  class PhysicalRegisterQueue {
+  public:
+    PhysicalRegisterQueue() : mRegisters(), mQueued() { } //!< Constructor.
+    void Add(const Register* pRegister); //!< Queue the physical registers of the register that are not queued yet.
+    bool IsQueued(const PhysicalRegister* pPhysRegister) const; //!< Return true if the physical register is queued.
+    const std::vector<PhysicalRegister* >& Registers() const { return mRegisters; } //!< Return the queued physical registers.
+    void Clear(); //!< Empty the queue, keeping the allocations for reuse.
+  private:
+    std::vector<PhysicalRegister* > mRegisters; //!< Queued physical registers, in the order they were first added.
+    std::vector<uint64> mQueued; //!< Bitset of the queued physical registers, indexed by register file index.
+  };
+
   class RegisterInitPolicy;
   class GenConditionSet;
   class RegisterReserver;
@@ -31,6 +31,43 @@ namespace Force {
   class ResourceTypeEntropy;
   class ResourceAccessQueue;
 
+  static const uint32 DEP_MAX_ENTRY_COUNT = 256; //!< set a practical maximum dependency entry count.
+
+  /*!
+    \class ResourceAccessBits
+    \brief Bitset of accessed resource indices of one resource type, one bit per dependency entry.
+  */
+  class ResourceAccessBits {
+  public:
+    ResourceAccessBits() : mWords() { Clear(); } //!< Constructor.
+
+    inline void Clear() //!< Clear all bits.
+    {
+      for (uint32 i = 0; i < WORD_COUNT; ++ i) mWords[i] = 0;
+    }
+
+    inline void Set(uint32 index) { CheckIndex(index); mWords[index >> 6] |= (1ull << (index & 0x3f)); } //!< Set the bit of a resource index.
+    inline void Reset(uint32 index) { CheckIndex(index); mWords[index >> 6] &= ~(1ull << (index & 0x3f)); } //!< Reset the bit of a resource index.
+    inline bool Test(uint32 index) const { CheckIndex(index); return (mWords[index >> 6] >> (index & 0x3f)) & 1; } //!< Return whether the bit of a resource index is set.
+
+    inline ResourceAccessBits& operator|=(const ResourceAccessBits& rOther) //!< Merge the bits of another object.
+    {
+      for (uint32 i = 0; i < WORD_COUNT; ++ i) mWords[i] |= rOther.mWords[i];
+      return *this;
+    }
+
+    bool None() const; //!< Return true if no bit is set.
+    uint32 Count() const; //!< Return number of bits set.
+    void SetConstraint(const ConstraintSet& rConstr); //!< Set the bits of all values in the constraint set.
+    void GetConstraint(ConstraintSet& rConstr) const; //!< Add the set bits to the constraint set, runs of bits are added as ranges.
+  private:
+    inline void CheckIndex(uint32 index) const { if (index >= DEP_MAX_ENTRY_COUNT) FailIndex(index); } //!< Fail if the index is out of range.
+    static void FailIndex(uint32 index); //!< Fail on an out of range resource index.
+  private:
+    static const uint32 WORD_COUNT = DEP_MAX_ENTRY_COUNT / 64; //!< Number of 64-bit words.
+    uint64 mWords[WORD_COUNT]; //!< Bit storage.
+  };
+
   /*!
     \class ResourceAccessStage
     \brief Current resource accesses for destination regsiters and source regsiters in an instruction
@@ -263,6 +300,18 @@ namespace Force {
       return (mIndex + mHistoryLimit - dist) % mHistoryLimit;
     }
 
+    inline ResourceAccessBits& SlotAccessBits(uint32 queueIndex, EResourceType resType, EDependencyType depType) //!< Return access bits of a queue slot.
+    {
+      return mAccessBits[((EResourceTypeBaseType(resType) << 1) + EDependencyTypeBaseType(depType)) * mHistoryLimit + queueIndex];
+    }
+
+    inline const ResourceAccessBits& SlotAccessBits(uint32 queueIndex, EResourceType resType, EDependencyType depType) const //!< Return access bits of a queue slot, const version.
+    {
+      return mAccessBits[((EResourceTypeBaseType(resType) << 1) + EDependencyTypeBaseType(depType)) * mHistoryLimit + queueIndex];
+    }
+
+    void UpdateAccessBits(uint32 queueIndex, const ResourceAccessStage* pStage); //!< Set the access bits of a queue slot from an access stage.
+
     bool EntropyStable(EResourceType resType, EDependencyType depType) const; //!< whether the current entropy is low.
     void VerifyAccessEntropy() const; //!< Verify access entropy value, a debugging method.
     uint32 CalculateAccessEntropy(EResourceType resType, EDependencyType depType) const; //!< Calculate entroy for a resource type and dependency type, a debugging method.
@@ -276,6 +325,7 @@ namespace Force {
     std::vector<ResourceAccessStage* > mQueue; //!< Resource access entries submitted.
     std::vector<ResourceTypeAges* > mTypeAges; //!< Ages contains for all supported resource types.
     std::vector<ResourceTypeEntropy* > mTypeEntropies; //!< Entropies contains for all supported resource types.
+    std::vector<ResourceAccessBits> mAccessBits; //!< Source and dest access bits of every queue slot, per resource type, kept in sync with the access stages.
   };
 
 }
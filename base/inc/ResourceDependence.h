@@ -44,6 +44,7 @@ namespace Force {
 
     void Setup(const Generator* pGen); //!< set up choice and trees and so on
     const ConstraintSet* GetDependenceConstraint(ERegAttrType access, EResourceType resType, const ResourceAccessStage* pHotResource) const; //!< Get dependence constraint.
+    bool MayChooseDependence(ERegAttrType access, EResourceType resType) const; //!< Return whether GetDependenceConstraint may return a dependence constraint, without making any choice.
     void HandleNotification(const NotificationSender* sender, ENotificationType eventType, Object* pPayload) override; //!< Receive Notification override
     const ResourceDependence* Snapshot() const; //!< take a snapshot
   protected:
@@ -55,6 +56,7 @@ namespace Force {
     void UpdateVariable(const Variable* pVar); //!< Update variables.
     const ConstraintSet* ChooseResourceConstraint(EResourceType resType, EDependencyType depType) const; //!< choose resource by choices tree
     uint32 ChooseDependenceType(ERegAttrType access) const; //!< Choose dependence type.
+    bool MayChooseInterDependence(ERegAttrType access, EResourceType resType) const; //!< Return whether GetInterDependenceConstraint may return a dependence constraint.
   protected:
     const ChoiceTree* mpDependenceTree; //!< Pointer to the dependence choices tree.
     const ChoiceTree* mpSourceTree;  //!< source choice tree
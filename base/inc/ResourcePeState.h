@@ -44,6 +44,7 @@ namespace Force {
     void PushResourcePeState(const ResourcePeState* pState); //!< push resource pe state to stacks
     virtual bool RecoverResourcePeStates(Generator* pGen, SimAPI* pSim); //!< recover resource pe states on both FORCE and ISS side
     bool IsEmpty() const; //!< whether the stack is empty
+    uint32 Size() const { return mResourcePeStates.size(); } //!< Return number of resource PE states on the stack.
 
     ASSIGNMENT_OPERATOR_ABSENT(ResourcePeStateStack);
     COPY_CONSTRUCTOR_ABSENT(ResourcePeStateStack);
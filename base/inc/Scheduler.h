@@ -61,6 +61,7 @@ namespace Force {
     void GenInstruction(uint32 threadId, GenInstructionRequest * instrReq, std::string& rec_id); //!< Called to generate an instruction.
     uint32 ThreadId(uint32 iThread, uint32 iCore, uint32 iChip); //!< Return a thread identifier encoding in an integer.
     void InitializeMemory(uint32 threadId, uint64 addr, uint32 bank, uint32 size, uint64 data, bool isInstr, bool isVirtual); //!< Initialize a memory location.
+    void InitializeInstructions(uint32 threadId, uint64 addr, uint32 bank, uint32 instrSize, const std::vector<uint64>& opcodes, const std::vector<std::string>& names, const std::vector<std::string>& asmTexts); //!< Initialize a block of consecutive instructions.
     uint32 AddChoicesModification(uint32 threadId, EChoicesType choicesType, const std::string& treeName,
                                 const std::map<std::string, uint32>& modifications); //!< add choice modification
     void CommitModificationSet(uint32 threadId,  EChoicesType choicesType, uint32 setId); //!< commit modification set
@@ -134,6 +135,8 @@ namespace Force {
     COPY_CONSTRUCTOR_ABSENT(Scheduler);
     ~Scheduler(); //!< Destructor.
     ASSIGNMENT_OPERATOR_ABSENT(Scheduler);
+    void ReportMemoryFootprint(const std::string& rWhen) const; //!< Log the memory footprint of all generator threads and memory banks.
+    void CheckInstructionIntervals(); //!< Compact the generator threads and report the memory footprint when the generated instruction count crosses the next interval.
   private:
     static Scheduler* mspScheduler; //!< Static pointer to Scheduler.
     uint32 mNumChips; //!< Number of chips in the system.
@@ -149,6 +152,12 @@ namespace Force {
     SynchronizeBarrierManager* mpSyncBarrierManager; //!< Synchronize barriers manager.
 
     std::map<uint32, Generator *> mGenerators; //!< Holder of all Generators.
+    bool mMemoryReport; //!< Whether to report the memory footprint at the end of the test.
+    uint64 mMemoryReportInterval; //!< Number of generated instructions between memory footprint reports, 0 for none.
+    uint64 mNextMemoryReport; //!< Generated instruction count at which the next interval report is due.
+    uint64 mCompactionInterval; //!< Number of generated instructions between compactions of the generator threads, 0 for none.
+    uint64 mNextCompaction; //!< Generated instruction count at which the next compaction is due.
+    uint32 mExceptionRecordLimit; //!< Number of exception records kept per thread on compaction, 0 for all.
   };
 
 }
@@ -48,6 +48,8 @@ namespace Force
     virtual void DeactivateThread(uint32 threadId) = 0; //!< Deactivate thread.
     virtual void GetScheduledThreadIds(ConstraintSet& constr) const = 0; //!< Vector of the all thread IDs to schedule.
     virtual void GetActiveThreadIds(ConstraintSet& constr) const = 0; //!< Vector of the active thread IDs.
+    virtual void SetQuantum(uint32 quantum) = 0; //!< Set the number of requests a thread is scheduled for before advancing to the next thread.
+    virtual uint32 Quantum() const = 0; //!< Return the number of requests a thread is scheduled for before advancing to the next thread.
   };
 
 
@@ -81,6 +83,8 @@ namespace Force
     void DeactivateThread(uint32 threadId) override; //!< Deactivate thread.
     void GetScheduledThreadIds(ConstraintSet& constr) const override; //!< Vector of the all thread IDs to schedule.
     void GetActiveThreadIds(ConstraintSet& constr) const override; //!< Vector of the active thread IDs.
+    void SetQuantum(uint32 quantum) override; //!< Set the number of requests a thread is scheduled for before advancing to the next thread.
+    uint32 Quantum() const override { return mQuantum; } //!< Return the number of requests a thread is scheduled for before advancing to the next thread.
 
     COPY_CONSTRUCTOR_ABSENT(ShuffledRoundRobinSchedulingStrategy);
     ASSIGNMENT_OPERATOR_ABSENT(ShuffledRoundRobinSchedulingStrategy);
@@ -90,6 +94,7 @@ namespace Force
     {
       mCurrentThreadId = mActiveThreadIds.at(mNextIndex);
       mNextIndex += 1;
+      mQuantumLeft = mQuantum;
     }
 
   private:
@@ -99,6 +104,8 @@ namespace Force
     ESchedulingState mLockingState; //!< The scheduler state when thread locking occurs.
     uint32 mLockingLevel; //!< Schedule locking level.
     uint32 mLockingThreadId; //!< ThreadId of the thread that holds the schedule lock.
+    uint32 mQuantum; //!< Number of requests a thread is scheduled for before advancing to the next thread.
+    uint32 mQuantumLeft; //!< Number of requests left in the quantum of the current thread.
     std::vector<uint32> mThreadIds; //!< Vector of the thread IDs to schedule.
     std::vector<uint32> mActiveThreadIds; //!< Vector of the active thread IDs to schedule.
   };
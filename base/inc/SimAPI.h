@@ -111,6 +111,16 @@ namespace Force {
     std::string mComments;  //!< exception description
   };
 
+  //!< RegisterWrite - struct used to pass a batch of register writes to the simulator...
+
+  struct RegisterWrite {
+    const char* mpName; //!< Register name, for simulators resolving registers by name.
+    uint32 mRegisterId; //!< Register ID, register type in bits [31:28] and register index in bits [27:0].
+    uint32 mSubIndex; //!< Sub-index of the physical register within its logical register.
+    uint64 mValue; //!< Value to write.
+    uint64 mMask; //!< Mask of the bits to write.
+  };
+
   struct ThreadSummary {
     uint32 mInstructionCount; //!< Instruction count for a thread.
     uint32 mExitCode; //!< Exit code for a thread.
@@ -172,6 +182,9 @@ namespace Force {
     //!< write simulator register. mask indicates which bits to write...
     virtual void WriteRegister(uint32 CpuID,const char *regname,uint64 rval,uint64 rmask) = 0;
 
+    //!< write a batch of simulator registers in order. the default writes them one at a time by name...
+    virtual void WriteRegisters(uint32 CpuID, const RegisterWrite* pWrites, uint32 count);
+
     //!< step instruction for specified cpu; returns after simulator step complete, with all updates.
     virtual void Step(uint32 cpuid,std::vector<RegUpdate> &rRegUpdates,std::vector<MemUpdate> &rMemUpdates, std::vector<MmuEvent> &rMmuEvents, std::vector<ExceptionUpdate> &rExceptUpdates) = 0;
 
@@ -181,6 +194,10 @@ namespace Force {
     virtual void LeaveSpeculativeMode(uint32 cpuId) = 0; //!< The CPU thread leaves speculative mode.
     virtual void RecordExceptionUpdate(const SimException *pException) = 0; //!< Record exceptions.
 
+    //!< return true if stepping the next instruction of the cpu can neither access memory nor change state other cpus observe. The
+    //!< default cannot tell, and so returns false...
+    virtual bool NextInstructionIsLocal(uint32 cpuId) { return false; }
+
     //!< form 'cpuID' from cluster,core,thread...
     uint32 CpuID(uint32 socket, uint32 cluster, uint32 core, uint32 thread);
 
@@ -51,6 +51,8 @@ namespace Force {
     COPY_CONSTRUCTOR_DEFAULT(SimplePeState);
     void SaveState(Generator* pGen, const std::vector<Register* >& rRegContext); //!< Save PE state.
     bool RestoreState(); //!< Restore PE state;
+    bool CoversState(const SimplePeState& rOther) const; //!< Return whether restoring this state overwrites every register restored by the other state.
+    uint64 StorageBytes() const { return sizeof(SimplePeState) + mRegisterStates.capacity() * sizeof(SimpleRegisterState); } //!< Return number of bytes held by the PE state.
   private:
     std::vector<SimpleRegisterState> mRegisterStates;
     Register* mpGpr; //!< Pointer to an useable GPR register.
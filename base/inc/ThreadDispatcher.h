@@ -98,7 +98,7 @@ namespace Force {
   private:
     Scheduler* mpScheduler; //!< Scheduler
     CountingMutex mDispatchMutex; //!< Reentrant mutex with lock count
-    std::condition_variable_any mCondVar; //!< Condition variable to ensure thread is current thread
+    std::map<uint32, std::condition_variable_any> mCondVars; //!< Condition variable for each thread ID, so that only the thread scheduled next is woken up
     std::map<std::thread::id, uint32> mThreadIds; //!< Mapping between internal execution thread ID and application thread ID
   };
 
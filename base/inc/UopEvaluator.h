@@ -0,0 +1,50 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef Force_UopEvaluator_H
+#define Force_UopEvaluator_H
+
+#include <vector>
+
+#include "Defines.h"
+#include "UopInterface.h"
+
+namespace Force {
+
+  class ConstraintSet;
+
+  /*!
+    \class UopEvaluator
+    \brief Evaluate integer micro-ops in process, one input tuple or a batch of candidate tuples at a time.
+
+    Inputs are passed in the same order as to execute_uop(). The shifted register micro-ops take the first operand, the
+    second operand, the shift type (0 to 3 for LSL, LSR, ASR and ROR) and the shift amount; the move not forms take no first
+    operand. The 32-bit forms use and yield the low 32 bits. Where the result is an affine function of one input, the
+    micro-op can also be inverted, turning a constraint on the result into the constraint on that input.
+  */
+  class UopEvaluator {
+  public:
+    static bool IsSupported(const EUop uop); //!< Return true if the micro-op can be evaluated in process.
+    static uint32 InputCount(const EUop uop); //!< Return the number of inputs of a supported micro-op.
+    static uint64 Evaluate(const EUop uop, const uint64* pInputs, cuint32 inputCount); //!< Evaluate the micro-op on one input tuple.
+    static void EvaluateBatch(const EUop uop, const std::vector<std::vector<uint64> >& rInputColumns, std::vector<uint64>& rResults); //!< Evaluate the micro-op on a batch of input tuples, given one column of values per input.
+    static bool IsInvertible(const EUop uop, cuint32 inputIndex); //!< Return true if the input at inputIndex can be solved for analytically.
+    static void InvertConstraint(const EUop uop, cuint32 inputIndex, const uint64* pInputs, cuint32 inputCount, ConstraintSet& rConstr); //!< Replace the result constraint with the constraint on the input at inputIndex, given the other inputs.
+    static uint64 InvertValue(const EUop uop, cuint32 inputIndex, const uint64* pInputs, cuint32 inputCount, cuint64 result); //!< Return the value of the input at inputIndex yielding the result, given the other inputs.
+  };
+
+}
+
+#endif  // Force_UopEvaluator_H
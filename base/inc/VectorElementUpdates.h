@@ -36,6 +36,7 @@ namespace Force {
     VectorElementUpdate(uint32 elementIndex, uint32 elementByteLength) : mElementIndex(elementIndex), mElementByteLength(elementByteLength) {}
     
     bool GetPhysicalRegisterIndices(cuint32 physRegSize, cuint32 numPhysRegs, std::set<uint32>& rPhysicalRegisterIndices) const; //Return value true means 'some indices were added', false means 'nothing new added'
+    void GetPhysicalRegisterRange(cuint32 physRegSize, cuint32 numPhysRegs, uint32& rFirstIndex, uint32& rEndIndex) const; //!< Return the range [rFirstIndex, rEndIndex) of physical registers the element intersects with.
     
     cuint32 mElementIndex;
     cuint32 mElementByteLength; 
@@ -44,7 +45,7 @@ namespace Force {
   class VectorElementUpdates {
   public:
     VectorElementUpdates(uint32 processorId, uint32 vectorLogicalRegisterWidth, const std::vector<std::string>& rVectorPhysicalRegisterNames, cuint32 physRegSize, cuint32 numPhysRegs) : 
-      mProcessorId(processorId), mVectorLogicalRegisterWidth(vectorLogicalRegisterWidth), mVectorRegisterName(), mPhysRegSize(physRegSize), mNumPhysRegs(numPhysRegs), mVectorPhysicalRegisterNames(rVectorPhysicalRegisterNames), mRegisterValue(vectorLogicalRegisterWidth), mElementReadUpdates(), mElementWriteUpdates() {}
+      mProcessorId(processorId), mVectorLogicalRegisterWidth(vectorLogicalRegisterWidth), mVectorRegisterName(), mPhysRegSize(physRegSize), mNumPhysRegs(numPhysRegs), mVectorPhysicalRegisterNames(rVectorPhysicalRegisterNames), mReadValues(), mReadDirtyBits((numPhysRegs + 63) / 64, 0), mWriteDirtyBits((numPhysRegs + 63) / 64, 0) {}
  
     DESTRUCTOR_DEFAULT(VectorElementUpdates); 
     ASSIGNMENT_OPERATOR_ABSENT(VectorElementUpdates);
@@ -56,9 +57,9 @@ namespace Force {
       mPhysRegSize(other.mPhysRegSize),
       mNumPhysRegs(other.mNumPhysRegs),
       mVectorPhysicalRegisterNames(other.mVectorPhysicalRegisterNames),
-      mRegisterValue(other.mRegisterValue),
-      mElementReadUpdates(other.mElementReadUpdates),
-      mElementWriteUpdates(other.mElementWriteUpdates)
+      mReadValues(other.mReadValues),
+      mReadDirtyBits(other.mReadDirtyBits),
+      mWriteDirtyBits(other.mWriteDirtyBits)
     {}
   
     void insert(uint32 processorId, const char* pRegisterName, uint32 eltIndex, uint32 eltByteWidth, const uint8_t* pEntireRegValue, uint32 regByteWidth, const char* pAccessType);
@@ -66,6 +67,10 @@ namespace Force {
     void translateElementToRegisterUpdates(SimAPI& rApiHandle, std::vector<RegUpdate>& rRegisterUpdates) const;
   
   private:
+    static inline bool isDirty(const std::vector<uint64>& rDirtyBits, cuint32 physRegIndex) { return (rDirtyBits[physRegIndex >> 6] >> (physRegIndex & 0x3f)) & 1; } //!< Return true if the physical register is marked in the dirty bitmap.
+    static inline void markDirty(std::vector<uint64>& rDirtyBits, cuint32 physRegIndex) { rDirtyBits[physRegIndex >> 6] |= (1ull << (physRegIndex & 0x3f)); } //!< Mark the physical register in the dirty bitmap.
+    bool hasDirtyRegisters(const std::vector<uint64>& rDirtyBits) const; //!< Return true if any physical register is marked in the dirty bitmap.
+    void appendRegisterUpdate(cuint32 physRegIndex, const uint8_t* pPhysRegValue, const char* pAccessType, std::vector<RegUpdate>& rRegisterUpdates) const; //!< Append the register update of one physical register.
     void validateInsertArguments(uint32 processorId, const char* pRegisterName, uint32 eltIndex, uint32 eltByteWidth, const uint8_t* pEntireRegValue, uint32 regByteWidth, const char* pAccessType); //!< Fail if any of the provided arguments have invalid values for the insert() method.
   private:
     cuint32 mProcessorId;
@@ -74,9 +79,9 @@ namespace Force {
     cuint32 mPhysRegSize;
     cuint32 mNumPhysRegs;
     const std::vector<std::string>& mVectorPhysicalRegisterNames;
-    std::vector<uint8_t> mRegisterValue;
-    std::vector<VectorElementUpdate> mElementReadUpdates;
-    std::vector<VectorElementUpdate> mElementWriteUpdates;
+    std::vector<uint8_t> mReadValues; //!< Bytes of the read physical registers, each captured when the register is first read; allocated on the first read.
+    std::vector<uint64> mReadDirtyBits; //!< Bitmap of physical registers intersecting with a read element.
+    std::vector<uint64> mWriteDirtyBits; //!< Bitmap of physical registers intersecting with a written element.
   };
 
 }
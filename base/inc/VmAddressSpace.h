@@ -56,6 +56,7 @@ namespace Force {
     ConstraintSet* VirtualUsableConstraintSetClone(bool isInstr) override; //!< Return cloned pointer to applicable virtual constraint object.
     const ConstraintSet* VirtualSharedConstraintSet() const override; //!< Return const pointer to virtual shared constraint object.
     void ApplyVirtualUsableConstraint(const EMemDataType memDataType, const EMemAccessType memAccessType, const AddressReuseMode& rAddrReuseMode, ConstraintSet* constrSet) const override; //!< Apply virtual usable constraint to specified constraint.
+    void CommitVirtualUsableConstraint() const override; //!< Commit cached updates of the virtual usable constraint.
     void Activate()   override; //!< Activate the VmAddressSpace object.
     void Initialize() override; //!< Initialize the VmAddressSpace object.
     void Deactivate() override; //!< Deactivate the VmAddressSpace object.
@@ -111,7 +112,8 @@ namespace Force {
     void PopulateVirtualUsableConstraint(); //!< Will handle the repopulation of virtual usable constraint on vmas becoming active again
     void UpdateVirtualUsableByPage(const Page* pPage); //!< Will perform an update on the virtual constraints in the pages virtual address range
     virtual Page* PageInstance() const; //!< Return an instance of the Page class or its sub-class.
-    const Page* MapAddress(uint64 VA, uint64 size, bool isInstr, const GenPageRequest* pPageReq, bool& newAlloc); //!< Map one virtual address.
+    const Page* MapAddress(uint64 VA, uint64 size, bool isInstr, const GenPageRequest* pPageReq, const uint64* pPreferredPA, bool& newAlloc); //!< Map one virtual address, preferably translating it to *pPreferredPA if specified.
+    bool PlanPhysicalRange(uint64 VA, uint64 size, const GenPageRequest* pPageReq, uint64& rPA) const; //!< Choose contiguous free physical memory for a large virtual address range, return true with the PA of VA in rPA if it is to be used.
     const Page* MapAddressForPA(uint64 PA, EMemBankType bank, uint64 size, bool isInstr, const GenPageRequest* pPageReq); //!< Map one virtual address to the given physical address.
     const Page* SetupPageMapping(uint64 VA, uint64 size, bool isSysPage, GenPageRequest* pPageReq); //!< Setup mapping of VA to page
     const Page* SetupPageMappingForPA(uint64 VA, EMemBankType bank, uint64 size, bool isInstr, GenPageRequest* pPageReq); //!< Setup mapping of VA to page
@@ -133,6 +135,7 @@ namespace Force {
     std::vector<ConstraintSet* > mVmConstraints; //!< Container of all the applicable VM constraints.
     std::vector<PageTableConstraint* > mPageTableConstraints; //!< Pointer to page table related constraints.
     bool mFlatMapped;
+    static const uint64 msRangePlanMinSize = 0x10000; //!< Smallest virtual address range that is considered for contiguous physical allocation.
 
     friend class VmPagingMapper;
   private:
@@ -77,6 +77,7 @@ namespace Force {
     //Mapper Interface Definition
     virtual void   AddPhysicalRegion(PhysicalRegion* pRegion, bool map) = 0; //!< Add Physical Region to be mapped
     virtual void   ApplyVirtualUsableConstraint(const EMemDataType memDataType, const EMemAccessType memAccessType, const AddressReuseMode& rAddrReuseMode, ConstraintSet* constrSet) const = 0; //!< Apply virtual usable constraint to specified constraint.
+    virtual void   CommitVirtualUsableConstraint() const = 0; //!< Commit cached updates of the virtual usable constraint, so that it can be applied from several threads at once.
     virtual void   DumpPage(const EDumpFormat dumpFormat, std::ofstream& os) const = 0; //!< Dump pages.
     virtual void   GetVmContextDelta(std::map<std::string, uint64> & rDeltaMap) const = 0; //!< Find the delta map between the VmMapper and currect machine state.
     virtual bool   GetPageInfo(uint64 addr, const std::string& type, uint32 bank, PageInformation& page_info) const = 0; //!< Return the page information record according to the given address/address type
@@ -184,6 +185,7 @@ namespace Force {
     virtual void Initialize() override; //!< Initialize the VmMapper object.
     virtual void AddPhysicalRegion(PhysicalRegion* pRegion, bool map) override { } //!< Add Physical Region to be mapped
     virtual void ApplyVirtualUsableConstraint(const EMemDataType memDataType, const EMemAccessType memAccessType, const AddressReuseMode& rAddrReuseMode, ConstraintSet* constrSet) const override; //!< Apply virtual usable constraint to specified constraint.
+    virtual void CommitVirtualUsableConstraint() const override; //!< Commit cached updates of the virtual usable constraint.
     virtual void GetVmContextDelta(std::map<std::string, uint64> & rDeltaMap) const override; //!< Find the delta map between the VmMapper and currect machine state.
     virtual void DumpPage(const EDumpFormat dumpFormat, std::ofstream& os) const override { } //!< Dump pages.
     virtual bool GetPageInfo(uint64 addr, const std::string& type, uint32 bank, PageInformation& page_info) const override { return false; } //!< Return the page information record according to the given address/address type
@@ -251,6 +253,7 @@ namespace Force {
     //VmMapper Overrides
     virtual void AddPhysicalRegion(PhysicalRegion* pRegion, bool map) override; //!< Add Physical Region to be mapped
     virtual void ApplyVirtualUsableConstraint(const EMemDataType memDataType, const EMemAccessType memAccessType, const AddressReuseMode& rAddrReuseMode, ConstraintSet* constrSet) const override; //!< Apply virtual usable constraint to specified constraint.
+    virtual void CommitVirtualUsableConstraint() const override; //!< Commit cached updates of the virtual usable constraint.
     virtual void ApplyVmConstraints(const GenPageRequest* pPageReq, ConstraintSet& rConstr) const override; //!< Apply VmConstraints.
     virtual void DumpPage(const EDumpFormat dumpFormat, std::ofstream& os) const override; //!< dump pages
     virtual void GetVmContextDelta(std::map<std::string, uint64> & rDeltaMap) const override { }; //!< Find the delta map between the VmMapper and currect machine state.
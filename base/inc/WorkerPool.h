@@ -0,0 +1,86 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef Force_WorkerPool_H
+#define Force_WorkerPool_H
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Defines.h"
+
+namespace Force {
+
+  /*!
+    \class WorkerPool
+    \brief Small pool of worker threads running independent tasks of one job concurrently.
+
+    A job is a number of tasks identified by their index. The calling thread works on the job together with the workers,
+    each thread taking the next unstarted task until none is left, and Run() returns once all tasks are done. Tasks are
+    expected to only write results owned by their index, so the results don't depend on which thread ran which task.
+
+    The log output of the tasks is captured and written by the calling thread in task order once the job is done, and a FAIL raised by a
+    task is reported by the calling thread as well, so only the calling thread uses the output streams.
+
+    The worker threads are started on the first job, so that processes forked before that get their own workers.
+   */
+  class WorkerPool {
+  public:
+    typedef std::function<void (uint32)> Task; //!< Task function, called with the task index.
+
+    static void Initialize();  //!< Initialization interface.
+    static void Destroy();     //!< Destruction clean up interface.
+    inline static WorkerPool* Instance() { return mspWorkerPool; } //!< Access WorkerPool instance.
+
+    void SetThreadCount(uint32 threadCount); //!< Set the number of threads working on a job, including the calling thread.
+    inline uint32 ThreadCount() const { return mThreadCount; } //!< Return the number of threads working on a job.
+    void Run(uint32 taskCount, const Task& rTask); //!< Run tasks 0 to taskCount - 1 and return when all are done.
+  private:
+    WorkerPool();  //!< Constructor, private.
+    ~WorkerPool(); //!< Destructor, private.
+    COPY_CONSTRUCTOR_ABSENT(WorkerPool);
+    ASSIGNMENT_OPERATOR_ABSENT(WorkerPool);
+    void StartWorkers(); //!< Start the worker threads.
+    void StopWorkers(); //!< Stop and join the worker threads.
+    void WorkerLoop(uint64 jobNumber); //!< Main function of the worker threads, started after job number jobNumber.
+    void RunTasks(); //!< Run unstarted tasks of the current job until none is left.
+  private:
+    static WorkerPool* mspWorkerPool;  //!< Static singleton pointer to the worker pool.
+    uint32 mThreadCount; //!< Number of threads working on a job, including the calling thread.
+    std::vector<std::thread> mWorkers; //!< Worker threads.
+    std::mutex mRunMutex; //!< Held by the thread running a job.
+    std::mutex mMutex; //!< Protect the job state shared with the workers.
+    std::condition_variable mJobCondition; //!< Signal workers a new job or stopping.
+    std::condition_variable mDoneCondition; //!< Signal the calling thread that all workers finished the job.
+    const Task* mpTask; //!< Task function of the current job.
+    uint32 mTaskCount; //!< Number of tasks of the current job.
+    std::atomic<uint32> mNextTask; //!< Index of the next unstarted task.
+    uint64 mJobNumber; //!< Number of the current job.
+    uint32 mBusyWorkers; //!< Number of workers not done with the current job.
+    std::vector<std::string> mTaskOutputs; //!< Log output captured from each task of the current job.
+    std::exception_ptr mException; //!< Exception thrown by the lowest indexed failing task of the current job.
+    uint32 mExceptionTask; //!< Index of the task that threw mException.
+    bool mStopping; //!< Indicate the workers should exit.
+  };
+
+}
+
+#endif
@@ -68,6 +68,11 @@ namespace Force {
           LOG(notice) << "Front-end: " << rLogMessage << std::endl;
         }
         /* No call guard because only intended for special thread executor use case in between starting dispatcher and starting threads */)
+      .def("phase",
+        [](const std::string &rPhaseName) {
+          LOG_PHASE(rPhaseName.c_str());
+        }
+        /* No call guard because phases are only entered from the main thread outside of the multi-threading phase */)
       ;
   }
 
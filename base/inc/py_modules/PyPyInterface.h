@@ -36,6 +36,7 @@ namespace Force {
       .def("genInstruction", &PyInterface::GenInstruction, py::call_guard<ThreadContext>())
       .def("genMetaInstruction", &PyInterface::GenMetaInstruction, py::call_guard<ThreadContext>())
       .def("initializeMemory", &PyInterface::InitializeMemory, py::call_guard<ThreadContext>())
+      .def("initializeInstructions", &PyInterface::InitializeInstructions, py::call_guard<ThreadContext>())
       .def("addChoicesModification", &PyInterface::AddChoicesModification, py::call_guard<ThreadContext>())
       .def("commitModificationSet",  &PyInterface::CommitModificationSet, py::call_guard<ThreadContext>())
       .def("revertModificationSet",  &PyInterface::RevertModificationSet, py::call_guard<ThreadContext>())
@@ -45,6 +46,8 @@ namespace Force {
       .def("genVAforPA", &PyInterface::GenVAforPA, py::call_guard<ThreadContext>())
       .def("genFreePagesRange", &PyInterface::GenFreePagesRange, py::call_guard<ThreadContext>())
       .def("sample", &PyInterface::Sample, py::call_guard<ThreadContext>())
+      .def("beginDetachedRandomStream", &PyInterface::BeginDetachedRandomStream, py::call_guard<ThreadContext>())
+      .def("endDetachedRandomStream", &PyInterface::EndDetachedRandomStream, py::call_guard<ThreadContext>())
       .def("getRandomRegisters", &PyInterface::GetRandomRegisters, py::call_guard<ThreadContext>())
       .def("getRandomRegistersForAccess", &PyInterface::GetRandomRegistersForAccess, py::call_guard<ThreadContext>())
       .def("isRegisterReserved", &PyInterface::IsRegisterReserved, py::call_guard<ThreadContext>())
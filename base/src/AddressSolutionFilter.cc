@@ -15,6 +15,7 @@
 //
 #include "AddressSolutionFilter.h"
 
+#include <algorithm>
 #include <memory>
 
 #include "AddressSolver.h"
@@ -104,6 +105,21 @@ namespace Force {
     return true;
   }
 
+  bool BaseDependencyFilter::NeedsAllSolutions(const AddressSolver& rAddrSolver, const vector<AddressingMode* >& rModes) const
+  {
+    auto opr_struct = rAddrSolver.GetBaseOperand()->GetOperandStructure();
+    if (EOperandType::VECREG == opr_struct->mType) {
+      return false;
+    }
+
+    EResourceType res_type = EResourceType(0);
+    if (not mpGenerator->OperandTypeToResourceType(opr_struct->mType, res_type)) {
+      return false;
+    }
+
+    return mpGenerator->GetDependenceInstance()->MayChooseDependence(opr_struct->mAccess, res_type);
+  }
+
   void IndexDependencyFilter::Setup(const Generator* pGen)
   {
     AddressSolutionFilter::Setup(pGen);
@@ -151,21 +167,38 @@ namespace Force {
   }
 
   const ConstraintSet* IndexDependencyFilter::GetIndexDependenceConstraint(const AddressSolver& rAddrSolver, const Instruction& rInstr) const
+  {
+    const OperandStructure* index_opr_struct = GetIndexOperandStructure(rAddrSolver);
+
+    EResourceType res_type = EResourceType(0);
+    const ConstraintSet* dep_constr = nullptr;
+    if (mpGenerator->OperandTypeToResourceType(index_opr_struct->mType, res_type)) {
+      dep_constr = mpGenerator->GetDependenceInstance()->GetDependenceConstraint(index_opr_struct->mAccess, res_type, rInstr.GetInstructionConstraint()->GetHotResource());
+    }
+
+    return dep_constr;
+  }
+
+  const OperandStructure* IndexDependencyFilter::GetIndexOperandStructure(const AddressSolver& rAddrSolver) const
   {
     const AddressingOperand* reg_opr_ptr = rAddrSolver.GetAddressingOperand();
     const OperandStructure* opr_struct = reg_opr_ptr->GetOperandStructure();
     const auto lsop_struct = opr_struct->CastOperandStructure<LoadStoreOperandStructure>();
 
     const Operand* index_opr_ptr = reg_opr_ptr->MatchOperand(lsop_struct->Index());
-    const OperandStructure* index_opr_struct = index_opr_ptr->GetOperandStructure();
+    return index_opr_ptr->GetOperandStructure();
+  }
+
+  bool IndexDependencyFilter::NeedsAllSolutions(const AddressSolver& rAddrSolver, const vector<AddressingMode* >& rModes) const
+  {
+    const OperandStructure* index_opr_struct = GetIndexOperandStructure(rAddrSolver);
 
     EResourceType res_type = EResourceType(0);
-    const ConstraintSet* dep_constr = nullptr;
-    if (mpGenerator->OperandTypeToResourceType(index_opr_struct->mType, res_type)) {
-      dep_constr = mpGenerator->GetDependenceInstance()->GetDependenceConstraint(index_opr_struct->mAccess, res_type, rInstr.GetInstructionConstraint()->GetHotResource());
+    if (not mpGenerator->OperandTypeToResourceType(index_opr_struct->mType, res_type)) {
+      return false;
     }
 
-    return dep_constr;
+    return mpGenerator->GetDependenceInstance()->MayChooseDependence(index_opr_struct->mAccess, res_type);
   }
 
   void SpAlignmentFilter::Setup(const Generator* pGen)
@@ -181,6 +214,11 @@ namespace Force {
     mUnalign = choice_ptr->Value() == 0;
   }
 
+  bool SpAlignmentFilter::NeedsAllSolutions(const AddressSolver& rAddrSolver, const vector<AddressingMode* >& rModes) const
+  {
+    return any_of(rModes.cbegin(), rModes.cend(), [](const AddressingMode* pMode) { return pMode->Base()->RegisterType() == ERegisterType::SP; });
+  }
+
   static bool check_sp_alignment(uint64 base_value, bool ref_unalign)
   {
     bool unalign = base_value & 0xF;
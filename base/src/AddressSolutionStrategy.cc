@@ -25,6 +25,7 @@
 #include "OperandSolutionMap.h"
 #include "Random.h"
 #include "Register.h"
+#include "UopEvaluator.h"
 #include "UtilityFunctions.h"
 
 using namespace std;
@@ -58,6 +59,14 @@ namespace Force {
       return false;
     }
 
+    if (UopEvaluator::IsSupported(mUop) and (UopEvaluator::InputCount(mUop) == pOprSolutions->size())) {
+      if (SolveByInversion(pOprSolutions, rTargetAddress, pAddrTagging)) {
+        return true;
+      }
+
+      return SolveByTrials(pOprSolutions, rTargetAddress, pAddrTagging);
+    }
+
     uint8_t input_param_count = pOprSolutions->size();
     UopParameter input_params[input_param_count];
     uint8_t input_param_index = 0;
@@ -94,14 +103,108 @@ namespace Force {
 
     rTargetAddress = output_params[0].value;
 
-    if (pAddrTagging != nullptr)
-    {
+    return IsTargetAddressUsable(rTargetAddress, pAddrTagging);
+  }
+
+  bool AddressSolutionStrategy::SolveByInversion(OperandSolutionMap* pOprSolutions, uint64& rTargetAddress, const AddressTagging* pAddrTagging) const
+  {
+    // Solve for the first operand that is not fixed and has an analytic inverse.
+    uint32 input_count = pOprSolutions->size();
+    uint32 solve_index = input_count;
+    uint32 input_index = 0;
+    for (const auto& opr_solution_entry : (*pOprSolutions)) {
+      if ((opr_solution_entry.second.GetConstraint()->Size() != 1) and UopEvaluator::IsInvertible(mUop, input_index)) {
+        solve_index = input_index;
+        break;
+      }
+      ++ input_index;
+    }
+
+    if (solve_index == input_count) {
+      return false;
+    }
+
+    uint64 inputs[input_count];
+    input_index = 0;
+    for (const auto& opr_solution_entry : (*pOprSolutions)) {
+      inputs[input_index] = (input_index == solve_index) ? 0 : opr_solution_entry.second.GetConstraint()->ChooseValue();
+      ++ input_index;
+    }
+
+    OperandSolution& solve_opr_solution = (pOprSolutions->begin() + solve_index)->second;
+    unique_ptr<ConstraintSet> solution_constr(mpAddressConstr->Clone());
+    UopEvaluator::InvertConstraint(mUop, solve_index, inputs, input_count, *solution_constr);
+    solution_constr->ApplyConstraintSet(*(solve_opr_solution.GetConstraint()));
+
+    // The result is an affine function of the solved operand, so the result is aligned exactly when the operand is
+    // congruent to the operand value yielding a zero result.
+    uint64 align_residue = UopEvaluator::InvertValue(mUop, solve_index, inputs, input_count, 0) & get_mask64(mAlignShift);
+    solution_constr->SubtractFromElements(align_residue);
+    solution_constr->AlignWithSize(~get_mask64(mAlignShift), 1);
+    if (solution_constr->IsEmpty()) {
+      return false;
+    }
+    solution_constr->ShiftRight(mAlignShift);
+    inputs[solve_index] = (solution_constr->ChooseValue() << mAlignShift) + align_residue;
+
+    rTargetAddress = UopEvaluator::Evaluate(mUop, inputs, input_count);
+    input_index = 0;
+    for (auto& opr_solution_entry : (*pOprSolutions)) {
+      opr_solution_entry.second.SetValue(inputs[input_index ++]);
+    }
+
+    return IsTargetAddressUsable(rTargetAddress, pAddrTagging);
+  }
+
+  bool AddressSolutionStrategy::SolveByTrials(OperandSolutionMap* pOprSolutions, uint64& rTargetAddress, const AddressTagging* pAddrTagging) const
+  {
+    // Draw a batch of candidate operand values and evaluate them together, instead of evaluating one trial at a time.
+    uint32 batch_size = 1;
+    for (const auto& opr_solution_entry : (*pOprSolutions)) {
+      if (opr_solution_entry.second.GetConstraint()->Size() != 1) {
+        batch_size = TrialBatchSize();
+        break;
+      }
+    }
+
+    vector<vector<uint64> > input_columns(pOprSolutions->size(), vector<uint64>(batch_size));
+    uint32 input_index = 0;
+    for (const auto& opr_solution_entry : (*pOprSolutions)) {
+      const ConstraintSet* opr_constr = opr_solution_entry.second.GetConstraint();
+      for (uint32 trial = 0; trial < batch_size; ++ trial) {
+        input_columns[input_index][trial] = opr_constr->ChooseValue();
+      }
+      ++ input_index;
+    }
+
+    vector<uint64> results;
+    UopEvaluator::EvaluateBatch(mUop, input_columns, results);
+
+    uint32 chosen_trial = batch_size - 1;
+    for (uint32 trial = 0; trial < batch_size; ++ trial) {
+      if (IsTargetAddressUsable(results[trial], pAddrTagging)) {
+        chosen_trial = trial;
+        break;
+      }
+    }
+
+    rTargetAddress = results[chosen_trial];
+    input_index = 0;
+    for (auto& opr_solution_entry : (*pOprSolutions)) {
+      opr_solution_entry.second.SetValue(input_columns[input_index ++][chosen_trial]);
+    }
+
+    return IsTargetAddressUsable(rTargetAddress, pAddrTagging);
+  }
+
+  bool AddressSolutionStrategy::IsTargetAddressUsable(cuint64 targetAddress, const AddressTagging* pAddrTagging) const
+  {
+    if (pAddrTagging != nullptr) {
       bool is_instruction = false;
-      uint64 untagged_target_address = pAddrTagging->UntagAddress(rTargetAddress, is_instruction);
-      return IsTargetAddressValidAndAligned(untagged_target_address);
+      return IsTargetAddressValidAndAligned(pAddrTagging->UntagAddress(targetAddress, is_instruction));
     }
 
-    return IsTargetAddressValidAndAligned(rTargetAddress);
+    return IsTargetAddressValidAndAligned(targetAddress);
   }
 
   bool AddressSolutionStrategy::HasRepeatedRegisters(const OperandSolutionMap& rOprSolutions) const
@@ -201,16 +304,7 @@ namespace Force {
 
       rTargetAddress = ComputeTargetAddress(multiplicand, multiplier, addend);
 
-      if (pAddrTagging != nullptr)
-      {
-        bool is_instruction = false;
-        uint64 untagged_target_address = pAddrTagging->UntagAddress(rTargetAddress, is_instruction);
-        solved = IsTargetAddressValidAndAligned(untagged_target_address);
-      }
-      else
-      {
-        solved = IsTargetAddressValidAndAligned(rTargetAddress);
-      }
+      solved = IsTargetAddressUsable(rTargetAddress, pAddrTagging);
     }
 
     if (solved) {
@@ -258,7 +352,8 @@ namespace Force {
   {
     const ConstraintSet* address_constr = GetAddressConstraint();
     unique_ptr<ConstraintSet> solution_constr(address_constr->Clone());
-    solution_constr->SubtractFromElements(multiplicand * multiplier);
+    uint64 inputs[3] = {multiplicand, multiplier, 0};
+    UopEvaluator::InvertConstraint(UopMulAdd, 2, inputs, 3, *solution_constr);
     solution_constr->ApplyConstraintSet(rAddendConstr);
     solution_constr->ShiftRight(GetAlignShift());
 
@@ -273,28 +368,8 @@ namespace Force {
 
   uint64 MulAddSolutionStrategy::ComputeTargetAddress(cuint64 multiplicand, cuint64 multiplier, cuint64 addend) const
   {
-    uint8_t input_param_count = 3;
-    UopParameter input_params[input_param_count];
-    for (uint8_t i = 0; i < input_param_count; i++) {
-      input_params[i].type = UopParamUInt64;
-    }
-
-    input_params[0].value = multiplicand;
-    input_params[1].value = multiplier;
-    input_params[2].value = addend;
-
-    uint8_t output_param_count = 1;
-    UopParameter output_param;
-    output_param.type = UopParamUInt64;
-    output_param.value = 0;
-
-    bool success = execute_uop(GetCpuId(), UopMulAdd, input_params, input_param_count, &output_param, &output_param_count);
-    if (!success) {
-      LOG(fail) << "{MulAddSolutionStrategy::ComputeTargetAddress} execute_uop() failed for UopMulAdd operation" << endl;
-      FAIL("execute-uop-failure");
-    }
-
-    return output_param.value;
+    uint64 inputs[3] = {multiplicand, multiplier, addend};
+    return UopEvaluator::Evaluate(UopMulAdd, inputs, 3);
   }
 
   void MulAddSolutionStrategy::DivideConstraintElements(cuint64 divisor, ConstraintSet* pConstr) const
@@ -326,56 +401,27 @@ namespace Force {
     OperandSolution* divisor_opr_solution = GetOperandSolution("divisor", pOprSolutions);
     const ConstraintSet* divisor_constr = divisor_opr_solution->GetConstraint();
 
-    uint64 dividend = dividend_constr->ChooseValue();
-    uint64 divisor = divisor_constr->ChooseValue();
-
-    bool solved = false;
-    if (divisor != 0) {
-      rTargetAddress = ComputeTargetAddress(dividend, divisor);
-
-      if (pAddrTagging != nullptr)
-      {
-        bool is_instruction = false;
-        uint64 untagged_target_address = pAddrTagging->UntagAddress(rTargetAddress, is_instruction);
-        solved = IsTargetAddressValidAndAligned(untagged_target_address);
-      }
-      else
-      {
-        solved = IsTargetAddressValidAndAligned(rTargetAddress);
-      }
+    // Draw a batch of candidate operand values and evaluate them together, instead of evaluating one trial at a time.
+    uint32 batch_size = ((dividend_constr->Size() != 1) or (divisor_constr->Size() != 1)) ? TrialBatchSize() : 1;
+    vector<vector<uint64> > input_columns(3, vector<uint64>(batch_size, mSignedOperands));
+    for (uint32 trial = 0; trial < batch_size; ++ trial) {
+      input_columns[0][trial] = dividend_constr->ChooseValue();
+      input_columns[1][trial] = divisor_constr->ChooseValue();
     }
 
-    if (solved) {
-      dividend_opr_solution->SetValue(dividend);
-      divisor_opr_solution->SetValue(divisor);
-    }
+    vector<uint64> results;
+    UopEvaluator::EvaluateBatch(UopDiv, input_columns, results);
 
-    return solved;
-  }
-
-  uint64 DivSolutionStrategy::ComputeTargetAddress(cuint64 dividend, cuint64 divisor) const
-  {
-    uint8_t input_param_count = 3;
-    UopParameter input_params[input_param_count];
-    input_params[0].type = UopParamUInt64;
-    input_params[0].value = dividend;
-    input_params[1].type = UopParamUInt64;
-    input_params[1].value = divisor;
-    input_params[2].type = UopParamBool;
-    input_params[2].value = mSignedOperands;
-
-    uint8_t output_param_count = 1;
-    UopParameter output_param;
-    output_param.type = UopParamUInt64;
-    output_param.value = 0;
-
-    bool success = execute_uop(GetCpuId(), UopDiv, input_params, input_param_count, &output_param, &output_param_count);
-    if (!success) {
-      LOG(fail) << "{DivSolutionStrategy::ComputeTargetAddress} execute_uop() failed for UopDiv operation" << endl;
-      FAIL("execute-uop-failure");
+    for (uint32 trial = 0; trial < batch_size; ++ trial) {
+      if ((input_columns[1][trial] != 0) and IsTargetAddressUsable(results[trial], pAddrTagging)) {
+        rTargetAddress = results[trial];
+        dividend_opr_solution->SetValue(input_columns[0][trial]);
+        divisor_opr_solution->SetValue(input_columns[1][trial]);
+        return true;
+      }
     }
 
-    return output_param.value;
+    return false;
   }
 
   AddWithCarrySolutionStrategy::AddWithCarrySolutionStrategy(const ConstraintSet* pAddressConstr, cuint32 alignShift, const EUop uop, cuint32 cpuId, const ConditionFlags condFlags)
@@ -415,16 +461,7 @@ namespace Force {
 
       rTargetAddress = ComputeTargetAddress(addend1, addend2);
 
-      if (pAddrTagging != nullptr)
-      {
-        bool is_instruction = false;
-        uint64 untagged_target_address = pAddrTagging->UntagAddress(rTargetAddress, is_instruction);
-        solved = IsTargetAddressValidAndAligned(untagged_target_address);
-      }
-      else
-      {
-        solved = IsTargetAddressValidAndAligned(rTargetAddress);
-      }
+      solved = IsTargetAddressUsable(rTargetAddress, pAddrTagging);
     }
 
     if (solved) {
@@ -440,7 +477,8 @@ namespace Force {
   {
     const ConstraintSet* address_constr = GetAddressConstraint();
     unique_ptr<ConstraintSet> solution_constr(address_constr->Clone());
-    solution_constr->SubtractFromElements(indOperandValue + mCondFlags.mCarryFlag);
+    uint64 inputs[3] = {0, indOperandValue, mCondFlags.mCarryFlag};
+    UopEvaluator::InvertConstraint(UopAddWithCarry, 0, inputs, 3, *solution_constr);
     solution_constr->ApplyConstraintSet(rDepOperandConstr);
     solution_constr->ShiftRight(GetAlignShift());
 
@@ -455,27 +493,8 @@ namespace Force {
 
   uint64 AddWithCarrySolutionStrategy::ComputeTargetAddress(cuint64 addend1, cuint64 addend2) const
   {
-    uint8_t input_param_count = 3;
-    UopParameter input_params[input_param_count];
-    input_params[0].value = addend1;
-    input_params[0].type = UopParamUInt64;
-    input_params[1].value = addend2;
-    input_params[1].type = UopParamUInt64;
-    input_params[2].value = mCondFlags.mCarryFlag;
-    input_params[2].type = UopParamBool;
-
-    uint8_t output_param_count = 1;
-    UopParameter output_param;
-    output_param.type = UopParamUInt64;
-    output_param.value = 0;
-
-    bool success = execute_uop(GetCpuId(), UopAddWithCarry, input_params, input_param_count, &output_param, &output_param_count);
-    if (!success) {
-      LOG(fail) << "{AddWithCarrySolutionStrategy::ComputeTargetAddress} execute_uop() failed for UopAddWithCarry operation" << endl;
-      FAIL("execute-uop-failure");
-    }
-
-    return output_param.value;
+    uint64 inputs[3] = {addend1, addend2, mCondFlags.mCarryFlag};
+    return UopEvaluator::Evaluate(UopAddWithCarry, inputs, 3);
   }
 
   SubWithCarrySolutionStrategy::SubWithCarrySolutionStrategy(const ConstraintSet* pAddressConstr, cuint32 alignShift, const EUop uop, cuint32 cpuId, const ConditionFlags condFlags)
@@ -515,16 +534,7 @@ namespace Force {
 
       rTargetAddress = ComputeTargetAddress(minuend, subtrahend);
 
-      if (pAddrTagging != nullptr)
-      {
-        bool is_instruction = false;
-        uint64 untagged_target_address = pAddrTagging->UntagAddress(rTargetAddress, is_instruction);
-        solved = IsTargetAddressValidAndAligned(untagged_target_address);
-      }
-      else
-      {
-        solved = IsTargetAddressValidAndAligned(rTargetAddress);
-      }
+      solved = IsTargetAddressUsable(rTargetAddress, pAddrTagging);
     }
 
     if (solved) {
@@ -540,7 +550,8 @@ namespace Force {
   {
     const ConstraintSet* address_constr = GetAddressConstraint();
     unique_ptr<ConstraintSet> solution_constr(address_constr->Clone());
-    solution_constr->SubtractFromElements(~subtrahendValue + mCondFlags.mCarryFlag);
+    uint64 inputs[3] = {0, subtrahendValue, mCondFlags.mCarryFlag};
+    UopEvaluator::InvertConstraint(UopSubWithCarry, 0, inputs, 3, *solution_constr);
     solution_constr->ApplyConstraintSet(rMinuendConstr);
     solution_constr->ShiftRight(GetAlignShift());
 
@@ -557,8 +568,8 @@ namespace Force {
   {
     const ConstraintSet* address_constr = GetAddressConstraint();
     unique_ptr<ConstraintSet> solution_constr(address_constr->Clone());
-    solution_constr->SubtractFromElements(minuendValue + mCondFlags.mCarryFlag);
-    solution_constr->NotElements();
+    uint64 inputs[3] = {minuendValue, 0, mCondFlags.mCarryFlag};
+    UopEvaluator::InvertConstraint(UopSubWithCarry, 1, inputs, 3, *solution_constr);
     solution_constr->ApplyConstraintSet(rSubtrahendConstr);
     solution_constr->ShiftRight(GetAlignShift());
 
@@ -573,27 +584,8 @@ namespace Force {
 
   uint64 SubWithCarrySolutionStrategy::ComputeTargetAddress(cuint64 minuend, cuint64 subtrahend) const
   {
-    uint8_t input_param_count = 3;
-    UopParameter input_params[input_param_count];
-    input_params[0].value = minuend;
-    input_params[0].type = UopParamUInt64;
-    input_params[1].value = subtrahend;
-    input_params[1].type = UopParamUInt64;
-    input_params[2].value = mCondFlags.mCarryFlag;
-    input_params[2].type = UopParamBool;
-
-    uint8_t output_param_count = 1;
-    UopParameter output_param;
-    output_param.type = UopParamUInt64;
-    output_param.value = 0;
-
-    bool success = execute_uop(GetCpuId(), UopSubWithCarry, input_params, input_param_count, &output_param, &output_param_count);
-    if (!success) {
-      LOG(fail) << "{SubWithCarrySolutionStrategy::ComputeTargetAddress} execute_uop() failed for UopSubWithCarry operation" << endl;
-      FAIL("execute-uop-failure");
-    }
-
-    return output_param.value;
+    uint64 inputs[3] = {minuend, subtrahend, mCondFlags.mCarryFlag};
+    return UopEvaluator::Evaluate(UopSubWithCarry, inputs, 3);
   }
 
   MulSolutionStrategy::MulSolutionStrategy(const ConstraintSet* pAddressConstr, cuint32 alignShift, const EUop uop, cuint32 cpuId)
@@ -633,16 +625,7 @@ namespace Force {
 
       rTargetAddress = ComputeTargetAddress(multiplicand, multiplier, 0);
 
-      if (pAddrTagging != nullptr)
-      {
-        bool is_instruction = false;
-        uint64 untagged_target_address = pAddrTagging->UntagAddress(rTargetAddress, is_instruction);
-        solved = IsTargetAddressValidAndAligned(untagged_target_address);
-      }
-      else
-      {
-        solved = IsTargetAddressValidAndAligned(rTargetAddress);
-      }
+      solved = IsTargetAddressUsable(rTargetAddress, pAddrTagging);
     }
 
     if (solved) {
@@ -27,6 +27,7 @@
 #include "AluImmediateConstraint.h"
 #include "BaseOffsetConstraint.h"
 #include "Choices.h"
+#include "Config.h"
 #include "Constraint.h"
 #include "Defines.h"
 #include "GenMode.h"
@@ -42,6 +43,7 @@
 #include "Register.h"
 #include "VmManager.h"
 #include "VmMapper.h"
+#include "WorkerPool.h"
 
 using namespace std;
 
@@ -98,8 +100,7 @@ namespace {
       vector<uint64> target_addresses;
       rSolutionContainer.GetTargetAddresses(rAddrSolShared, *solution_choice, target_addresses);
 
-      choice_usable = all_of(target_addresses.cbegin(), target_addresses.cend(),
-        [&rAddrSolShared, solution_choice](cuint64 targetAddr) { return rAddrSolShared.MapTargetAddressRange(targetAddr, solution_choice->VmTimeStampReference()); });
+      choice_usable = rAddrSolShared.MapTargetAddressRanges(target_addresses, solution_choice->VmTimeStampReference());
 
       if (not choice_usable) {
         solution_choice->SetZeroWeight();
@@ -185,15 +186,28 @@ namespace {
   }
 
   AddressingMode::AddressingMode()
-    : AddressingRegister(), mTargetAddress(0)
+    : AddressingRegister(), mTargetAddress(0), mPreparedConstraints(), mPreparedTimeStamp(0)
   {
   }
 
   AddressingMode::AddressingMode(const AddressingMode& rOther)
-    : AddressingRegister(rOther), mTargetAddress(0)
+    : AddressingRegister(rOther), mTargetAddress(0), mPreparedConstraints(), mPreparedTimeStamp(0)
   {
   }
 
+  AddressingMode::~AddressingMode()
+  {
+    ClearPrepared();
+  }
+
+  void AddressingMode::ClearPrepared()
+  {
+    for (auto& prepared_item : mPreparedConstraints) {
+      delete prepared_item.second;
+    }
+    mPreparedConstraints.clear();
+  }
+
   bool AddressingMode::BaseValueUsable(uint64 baseValue, const AddressSolvingShared* pAddrSolShared) const
   {
     return pAddrSolShared->AlignmentOkay(baseValue);
@@ -217,50 +231,54 @@ namespace {
   }
 
   bool AddressingMode::SolveWithValue(uint64 value, const AddressSolvingShared& rShared, const ConstraintSet* pTargetConstr, uint64& rTargetAddr) const
+  {
+    ConstraintSet value_constr;
+    const ConstraintSet* choice_constr = FindPrepared(value, rShared, pTargetConstr);
+    if (choice_constr == nullptr) {
+      GetValueConstraint(value, rShared, pTargetConstr, value_constr);
+      choice_constr = &value_constr;
+    }
+    if (choice_constr->IsEmpty()) return false;
+
+    rTargetAddr = choice_constr->ChooseValue() << rShared.AlignShift();
+    return true;
+  }
+
+  void AddressingMode::GetValueConstraint(uint64 value, const AddressSolvingShared& rShared, const ConstraintSet* pTargetConstr, ConstraintSet& rValueConstr) const
   {
     auto addr_opr_constr = rShared.GetAddressingOperandConstraint();
 
-    ConstraintSet value_constr;
-    addr_opr_constr->GetBaseConstraint(value, MAX_UINT64, rShared.Size(), value_constr);
-    rShared.ApplyVirtualUsableConstraint(&value_constr, mVmTimeStamp);
-    if (value_constr.IsEmpty()) return false;
+    addr_opr_constr->GetBaseConstraint(value, MAX_UINT64, rShared.Size(), rValueConstr);
+    rShared.ApplyVirtualUsableConstraint(&rValueConstr, mVmTimeStamp);
+    if (rValueConstr.IsEmpty()) return;
 
-    value_constr.SubConstraintSet(*(rShared.PcConstraint()));
-    if (value_constr.IsEmpty()) return false;
+    rValueConstr.SubConstraintSet(*(rShared.PcConstraint()));
+    if (rValueConstr.IsEmpty()) return;
 
-    value_constr.AlignWithSize(rShared.AlignMask(), rShared.Size());
-    if (value_constr.IsEmpty()) return false;
+    rValueConstr.AlignWithSize(rShared.AlignMask(), rShared.Size());
+    if (rValueConstr.IsEmpty()) return;
 
     if (pTargetConstr != nullptr) {
-      value_constr.ApplyConstraintSet(*pTargetConstr);
+      rValueConstr.ApplyConstraintSet(*pTargetConstr);
     }
-    if (value_constr.IsEmpty()) return false;
+    if (rValueConstr.IsEmpty()) return;
 
-    uint32 align_shift = rShared.AlignShift();
-    value_constr.ShiftRight(align_shift);
-    rTargetAddr = value_constr.ChooseValue() << align_shift;
-    return true;
+    rValueConstr.ShiftRight(rShared.AlignShift());
   }
 
   bool AddressingMode::SolveWithBase(cuint64 baseValue, const AddressSolvingShared& rShared, const BaseOffsetConstraint& rBaseOffsetConstr, const ConstraintSet* pTargetConstr, uint64& rTargetAddr) const
   {
     const AddressTagging* addr_tagging = rShared.GetAddressTagging();
-    uint64 untagged_base_value = addr_tagging->UntagAddress(baseValue, rShared.IsInstruction());
 
     ConstraintSet target_addr_constr;
-    rBaseOffsetConstr.GetConstraint(untagged_base_value, rShared.Size(), nullptr, target_addr_constr);
-
-    rShared.ApplyVirtualUsableConstraint(&target_addr_constr, mVmTimeStamp);
-    if (target_addr_constr.IsEmpty()) return false;
-
-    target_addr_constr.SubConstraintSet(*(rShared.PcConstraint()));
-    if (target_addr_constr.IsEmpty()) return false;
-
-    //apply target constraint. Hard constraint also need to be checked.
-    if (pTargetConstr != nullptr) {
-      target_addr_constr.ApplyConstraintSet(*pTargetConstr);
-      if (target_addr_constr.IsEmpty()) return false;
+    const ConstraintSet* prepared_constr = FindPrepared(baseValue, rShared, pTargetConstr);
+    if (prepared_constr != nullptr) {
+      target_addr_constr.MergeConstraintSet(*prepared_constr);
     }
+    else {
+      GetBaseTargetConstraint(baseValue, rShared, rBaseOffsetConstr, pTargetConstr, target_addr_constr);
+    }
+    if (target_addr_constr.IsEmpty()) return false;
 
     bool solve_result = ChooseTargetAddress(rShared, target_addr_constr, rTargetAddr);
 
@@ -275,6 +293,111 @@ namespace {
     return solve_result;
   }
 
+  void AddressingMode::GetBaseTargetConstraint(cuint64 baseValue, const AddressSolvingShared& rShared, const BaseOffsetConstraint& rBaseOffsetConstr, const ConstraintSet* pTargetConstr, ConstraintSet& rTargetAddrConstr) const
+  {
+    const AddressTagging* addr_tagging = rShared.GetAddressTagging();
+    uint64 untagged_base_value = addr_tagging->UntagAddress(baseValue, rShared.IsInstruction());
+
+    rBaseOffsetConstr.GetConstraint(untagged_base_value, rShared.Size(), nullptr, rTargetAddrConstr);
+
+    rShared.ApplyVirtualUsableConstraint(&rTargetAddrConstr, mVmTimeStamp);
+    if (rTargetAddrConstr.IsEmpty()) return;
+
+    rTargetAddrConstr.SubConstraintSet(*(rShared.PcConstraint()));
+    if (rTargetAddrConstr.IsEmpty()) return;
+
+    //apply target constraint. Hard constraint also need to be checked.
+    if (pTargetConstr != nullptr) {
+      rTargetAddrConstr.ApplyConstraintSet(*pTargetConstr);
+    }
+  }
+
+  const ConstraintSet* AddressingMode::PrepareWithValue(uint64 value, const AddressSolvingShared& rShared, const ConstraintSet* pTargetConstr)
+  {
+    mPreparedTimeStamp = rShared.VmTimeStamp();
+    auto prepared_key = make_pair(value, pTargetConstr);
+    auto find_iter = mPreparedConstraints.find(prepared_key);
+    if (find_iter != mPreparedConstraints.end()) {
+      return find_iter->second;
+    }
+
+    auto value_constr = new ConstraintSet();
+    GetValueConstraint(value, rShared, pTargetConstr, *value_constr);
+    mPreparedConstraints.emplace(prepared_key, value_constr);
+    return value_constr;
+  }
+
+  void AddressingMode::PrepareWithBase(cuint64 baseValue, const AddressSolvingShared& rShared, const BaseOffsetConstraint& rBaseOffsetConstr, const ConstraintSet* pTargetConstr)
+  {
+    mPreparedTimeStamp = rShared.VmTimeStamp();
+    auto prepared_key = make_pair(baseValue, pTargetConstr);
+    if (mPreparedConstraints.find(prepared_key) != mPreparedConstraints.end()) {
+      return;
+    }
+
+    auto target_addr_constr = new ConstraintSet();
+    GetBaseTargetConstraint(baseValue, rShared, rBaseOffsetConstr, pTargetConstr, *target_addr_constr);
+    mPreparedConstraints.emplace(prepared_key, target_addr_constr);
+  }
+
+  bool AddressingMode::AreElementAddressesUsable(const vector<uint64>& rElemAddresses, const AddressSolvingShared& rShared, const ConstraintSet* pTargetConstr) const
+  {
+    const AddressTagging* addr_tagging = rShared.GetAddressTagging();
+    vector<uint64> untagged_addresses(rElemAddresses.size());
+    transform(rElemAddresses.cbegin(), rElemAddresses.cend(), untagged_addresses.begin(),
+      [addr_tagging, &rShared](cuint64 elemAddr) { return addr_tagging->UntagAddress(elemAddr, rShared.IsInstruction()); });
+
+    uint64 last_start = MAX_UINT64 - rShared.Size() + 1;
+    bool elements_okay = all_of(untagged_addresses.cbegin(), untagged_addresses.cend(),
+      [&rShared, last_start](cuint64 untaggedAddr) { return rShared.AlignmentOkay(untaggedAddr) and (untaggedAddr <= last_start); });
+    if ((not elements_okay) or untagged_addresses.empty()) {
+      return false;
+    }
+
+    if ((pTargetConstr != nullptr) and (not pTargetConstr->ContainsValue(untagged_addresses[0]))) {
+      return false;
+    }
+
+    // Every element range is usable if and only if their union is, so merge the element ranges into spans and check the
+    // spans with a single pass over the virtual usable and PC constraints.
+    sort(untagged_addresses.begin(), untagged_addresses.end());
+    ConstraintSet span_constr;
+    uint64 span_start = untagged_addresses[0];
+    uint64 span_end = span_start + rShared.Size() - 1;
+    for (cuint64 untagged_addr : untagged_addresses) {
+      if ((span_end != MAX_UINT64) and (untagged_addr > span_end + 1)) {
+        span_constr.AddRange(span_start, span_end);
+        span_start = untagged_addr;
+      }
+      span_end = max(span_end, untagged_addr + rShared.Size() - 1);
+    }
+    span_constr.AddRange(span_start, span_end);
+
+    uint64 span_size = span_constr.Size();
+    rShared.ApplyVirtualUsableConstraint(&span_constr, mVmTimeStamp);
+    if (span_constr.Size() != span_size) {
+      return false;
+    }
+
+    span_constr.SubConstraintSet(*(rShared.PcConstraint()));
+    return (span_constr.Size() == span_size);
+  }
+
+  const ConstraintSet* AddressingMode::FindPrepared(uint64 value, const AddressSolvingShared& rShared, const ConstraintSet* pTargetConstr) const
+  {
+    // new pages may have been added by other modes since the preparation, making more addresses usable.
+    if (mPreparedConstraints.empty() or (mPreparedTimeStamp != rShared.VmTimeStamp())) {
+      return nullptr;
+    }
+
+    auto find_iter = mPreparedConstraints.find(make_pair(value, pTargetConstr));
+    if (find_iter == mPreparedConstraints.end()) {
+      return nullptr;
+    }
+
+    return find_iter->second;
+  }
+
   const string AddressingMode::ToString() const
   {
     stringstream out_str;
@@ -422,6 +545,20 @@ namespace {
     return new BaseOffsetMode(*this);
   }
 
+  void BaseOffsetMode::PrepareSolve(const AddressSolvingShared& rShared)
+  {
+    auto addr_opr_constr = rShared.GetAddressingOperandConstraint();
+    auto offset_opr = addr_opr_constr->OffsetOperand();
+    auto offset_constr = offset_opr->GetOperandConstraint();
+
+    if (offset_constr->HasConstraint()) {
+      return;
+    }
+
+    BaseOffsetConstraint bo_constr_builder(offset_opr->BaseValue(), offset_opr->Size(), OffsetScale(), MAX_UINT64, IsOffsetShift());
+    PrepareWithBase(BaseValue(), rShared, bo_constr_builder, rShared.TargetConstraint());
+  }
+
   bool BaseOffsetMode::Solve(const AddressSolvingShared& rShared)
   {
     //get offset operand
@@ -433,13 +570,16 @@ namespace {
       return SolveOffsetHasConstraint(&rShared);
     }
 
-    bool isOffsetShift = true;
-    if (dynamic_cast<BaseOffsetMulMode*> (this)) {isOffsetShift = false;}
-    BaseOffsetConstraint bo_constr_builder(offset_opr->BaseValue(), offset_opr->Size(), OffsetScale(), MAX_UINT64, isOffsetShift);
+    BaseOffsetConstraint bo_constr_builder(offset_opr->BaseValue(), offset_opr->Size(), OffsetScale(), MAX_UINT64, IsOffsetShift());
 
     return SolveWithBase(BaseValue(), rShared, bo_constr_builder, rShared.TargetConstraint(), mTargetAddress);
   }
 
+  bool BaseOffsetMode::IsOffsetShift() const
+  {
+    return (dynamic_cast<const BaseOffsetMulMode*>(this) == nullptr);
+  }
+
   bool BaseOffsetMode::SolveOffsetHasConstraint(const AddressSolvingShared* rShared) {
     auto offset_value = rShared->FreeOffset(this);
     uint64 target = BaseValue() + offset_value;
@@ -680,6 +820,16 @@ namespace {
     return HasIndexSolutions();
   }
 
+  void BaseIndexExtendMode::PrepareSolve(const AddressSolvingShared& rShared)
+  {
+    const auto& rSharedBI= dynamic_cast<const BaseIndexSolvingShared&>(rShared);
+    if ((nullptr != rSharedBI.TargetConstraint()) and (1 == rSharedBI.TargetConstraint()->Size())) {
+      return;
+    }
+
+    PrepareWithAmountBit(rSharedBI, 1);
+  }
+
   bool BaseIndexExtendMode::SolveFree(const AddressSolvingShared& rShared)
   {
     //Target constraint has been included to the flow of rShared.SolveFree()
@@ -741,6 +891,20 @@ namespace {
     }
   }
 
+  void BaseIndexExtendMode::PrepareWithAmountBit(const BaseIndexSolvingShared& rSharedBI, uint32 amountBit)
+  {
+    uint32 extend_amount = rSharedBI.ExtendAmount() * amountBit;
+    const AddressTagging* addr_tagging = rSharedBI.GetAddressTagging();
+    for (auto index_choice : rSharedBI.GetIndexChoices()) {
+      uint64 index_value = extend_regval(index_choice->RegisterValue(), rSharedBI.ExtendType(), extend_amount);
+      uint64 untagged_temp_target = addr_tagging->UntagAddress(BaseValue() + index_value, rSharedBI.IsInstruction());
+
+      if (rSharedBI.AlignmentOkay(untagged_temp_target)) {
+        PrepareWithValue(untagged_temp_target, rSharedBI, rSharedBI.TargetConstraint());
+      }
+    }
+  }
+
   void BaseIndexExtendMode::CreateFreeBaseIndexSolutionWithAmount(const BaseIndexSolvingShared& rBaseIndexShared, const AddressingRegister& rIndexChoice, const uint64 index_value, uint32 amountBit)
   {
     uint32 extend_amount = rBaseIndexShared.ExtendAmount() * amountBit;
@@ -826,9 +990,7 @@ namespace {
   void VectorStridedMode::CalculateTargetAddresses(const AddressSolvingShared& rShared, const IndexSolution& rIndexSolution, vector<uint64>& rTargetAddresses) const
   {
     auto& strided_shared = dynamic_cast<const VectorStridedSolvingShared&>(rShared);
-    for (uint32 elem_index = 0; elem_index < strided_shared.GetDataElementCount(); elem_index++) {
-      rTargetAddresses.push_back(rIndexSolution.BaseValue() + rIndexSolution.RegisterValue() * elem_index);
-    }
+    CalculateElementAddresses(strided_shared, rIndexSolution.BaseValue(), rIndexSolution.RegisterValue(), rTargetAddresses);
   }
 
   RegisterOperand* VectorStridedMode::GetIndexOperand(const AddressSolvingShared& rShared) const
@@ -904,35 +1066,21 @@ namespace {
 
   bool VectorStridedMode::AreTargetAddressesUsable(const VectorStridedSolvingShared& rStridedShared, cuint64 baseVal, cuint64 strideVal)
   {
-    bool target_addresses_usable = IsTargetAddressUsable(rStridedShared, baseVal, rStridedShared.TargetConstraint());
-    for (uint32 elem_index = 1; elem_index < rStridedShared.GetDataElementCount(); elem_index++) {
-      if (not target_addresses_usable) {
-        break;
-      }
-
-      uint64 elem_target_addr = baseVal + strideVal * elem_index;
-      target_addresses_usable = IsTargetAddressUsable(rStridedShared, elem_target_addr, nullptr);
-    }
-
-    return target_addresses_usable;
+    vector<uint64> elem_target_addresses;
+    CalculateElementAddresses(rStridedShared, baseVal, strideVal, elem_target_addresses);
+    return AreElementAddressesUsable(elem_target_addresses, rStridedShared, rStridedShared.TargetConstraint());
   }
 
-  bool VectorStridedMode::IsTargetAddressUsable(const VectorStridedSolvingShared& rStridedShared, cuint64 targetAddr, const ConstraintSet* pTargetConstr)
+  void VectorStridedMode::CalculateElementAddresses(const VectorStridedSolvingShared& rStridedShared, cuint64 baseVal, cuint64 strideVal, vector<uint64>& rElemAddresses) const
   {
-    bool target_addr_usable = false;
-    const AddressTagging* addr_tagging = rStridedShared.GetAddressTagging();
-    uint64 untagged_target_addr = addr_tagging->UntagAddress(targetAddr, rStridedShared.IsInstruction());
-
-    if (rStridedShared.AlignmentOkay(untagged_target_addr)) {
-      uint64 solved_target_addr = 0;
-      bool solved = SolveWithValue(untagged_target_addr, rStridedShared, pTargetConstr, solved_target_addr);
+    uint32 elem_count = rStridedShared.GetDataElementCount();
+    size_t first_elem_pos = rElemAddresses.size();
+    rElemAddresses.resize(first_elem_pos + elem_count);
 
-      if (solved and (solved_target_addr == untagged_target_addr)) {
-        target_addr_usable = true;
-      }
+    uint64* elem_addresses = rElemAddresses.data() + first_elem_pos;
+    for (uint32 elem_index = 0; elem_index < elem_count; elem_index++) {
+      elem_addresses[elem_index] = baseVal + strideVal * elem_index;
     }
-
-    return target_addr_usable;
   }
 
   VectorIndexedMode::VectorIndexedMode()
@@ -1052,12 +1200,8 @@ namespace {
     vector<uint64> reg_values;
     IndexValuesForChoice(rIndexSolution, reg_values);
 
-    vector<uint64> index_elem_values;
     auto& indexed_shared = dynamic_cast<const VectorIndexedSolvingShared&>(rShared);
-    change_uint64_to_elementform(indexed_shared.GetIndexElementSize(), indexed_shared.GetIndexElementSize(), reg_values, index_elem_values);
-
-    transform(index_elem_values.cbegin(), index_elem_values.cend(), back_inserter(rTargetAddresses),
-      [&rIndexSolution](cuint64 indexElemVal) { return (rIndexSolution.BaseValue() + indexElemVal); });
+    CalculateElementAddresses(indexed_shared, rIndexSolution.BaseValue(), reg_values, rTargetAddresses);
   }
 
   void VectorIndexedMode::IndexValues(vector<uint64>& rIndexRegValues) const
@@ -1144,45 +1288,30 @@ namespace {
   void VectorIndexedMode::IndexValuesForChoice(const AddressingMultiRegister& rAddressingReg, vector<uint64>& rIndexRegValues) const
   {
     for (AddressingRegister* addressing_reg : rAddressingReg.GetAddressingRegisters()) {
-      vector<uint64> reg_values = addressing_reg->RegisterValues();
+      const vector<uint64>& reg_values = addressing_reg->RegisterValues();
       copy(reg_values.cbegin(), reg_values.cend(), back_inserter(rIndexRegValues));
     }
   }
 
   bool VectorIndexedMode::AreTargetAddressesUsable(const VectorIndexedSolvingShared& rIndexedShared, cuint64 baseVal, const vector<uint64>& rIndexRegValues, const ConstraintSet* pTargetConstr)
   {
-    vector<uint64> index_elem_values;
-    change_uint64_to_elementform(rIndexedShared.GetIndexElementSize(), rIndexedShared.GetIndexElementSize(), rIndexRegValues, index_elem_values);
-
-    bool target_addresses_usable = IsTargetAddressUsable(rIndexedShared, (baseVal + index_elem_values[0]), pTargetConstr);
-
-    for (uint32 elem_index = 1; elem_index < index_elem_values.size(); elem_index++) {
-      if (not target_addresses_usable) {
-        break;
-      }
-
-      target_addresses_usable = IsTargetAddressUsable(rIndexedShared, (baseVal + index_elem_values[elem_index]), nullptr);
-    }
-
-    return target_addresses_usable;
+    vector<uint64> elem_target_addresses;
+    CalculateElementAddresses(rIndexedShared, baseVal, rIndexRegValues, elem_target_addresses);
+    return AreElementAddressesUsable(elem_target_addresses, rIndexedShared, pTargetConstr);
   }
 
-  bool VectorIndexedMode::IsTargetAddressUsable(const VectorIndexedSolvingShared& rIndexedShared, cuint64 targetAddr, const ConstraintSet* pTargetConstr)
+  void VectorIndexedMode::CalculateElementAddresses(const VectorIndexedSolvingShared& rIndexedShared, cuint64 baseVal, const vector<uint64>& rIndexRegValues, vector<uint64>& rElemAddresses) const
   {
-    bool target_addr_usable = false;
-    const AddressTagging* addr_tagging = rIndexedShared.GetAddressTagging();
-    uint64 untagged_target_addr = addr_tagging->UntagAddress(targetAddr, rIndexedShared.IsInstruction());
+    vector<uint64> index_elem_values;
+    change_uint64_to_elementform(rIndexedShared.GetIndexElementSize(), rIndexedShared.GetIndexElementSize(), rIndexRegValues, index_elem_values);
 
-    if (rIndexedShared.AlignmentOkay(untagged_target_addr)) {
-      uint64 solved_target_addr = 0;
-      bool solved = SolveWithValue(untagged_target_addr, rIndexedShared, pTargetConstr, solved_target_addr);
+    size_t first_elem_pos = rElemAddresses.size();
+    rElemAddresses.resize(first_elem_pos + index_elem_values.size());
 
-      if (solved and (solved_target_addr == untagged_target_addr)) {
-        target_addr_usable = true;
-      }
+    uint64* elem_addresses = rElemAddresses.data() + first_elem_pos;
+    for (size_t elem_index = 0; elem_index < index_elem_values.size(); elem_index++) {
+      elem_addresses[elem_index] = baseVal + index_elem_values[elem_index];
     }
-
-    return target_addr_usable;
   }
 
   uint64 VectorIndexedMode::GetElementCountForRegister(const vector<uint64>& rRegValues, cuint64 elemSize) const
@@ -1213,6 +1342,21 @@ namespace {
     return HasIndexSolutions();
   }
 
+  void BaseIndexAmountBitExtendMode::PrepareSolve(const AddressSolvingShared& rShared)
+  {
+    const auto & rSharedBI= dynamic_cast<const BaseIndexAmountBitSolvingShared&>(rShared);
+    if ((nullptr != rSharedBI.TargetConstraint()) and (1 == rSharedBI.TargetConstraint()->Size())) {
+      return;
+    }
+
+    if (rSharedBI.IsExtendAmount0Valid()) {
+      PrepareWithAmountBit(rSharedBI, 0);
+    }
+    if (rSharedBI.IsExtendAmount1Valid()) {
+      PrepareWithAmountBit(rSharedBI, 1);
+    }
+  }
+
   AddressSolvingShared* BaseIndexAmountBitExtendMode::AddressSolvingSharedInstance() const
   {
     return new BaseIndexAmountBitSolvingShared();
@@ -1560,34 +1704,122 @@ namespace {
       return nullptr;
     }
 
+    if (ShouldSolveLazily(gen, rModes)) {
+      SolveLazily(gen, instr, rModes);
+      return mpChosenSolution;
+    }
+
+    PrepareModes(rModes);
     for (auto mode : rModes) {
-      if (mode->IsFree()) {
-        if (mode->SolveFree(*mpAddressSolvingShared)) {
-          LOG(info) << "{AddressSolver::SolveWithModes} choice: " << mode->ToString() << endl;
-          mSolutionChoices.push_back(mode);
-          continue;
-        }
-      } else {
-        if (mode->Solve(*mpAddressSolvingShared)) {
-          LOG(info) << "{AddressSolver::SolveWithModes} choice: " << mode->ToString() << endl;
-          mSolutionChoices.push_back(mode);
-          continue;
-        }
+      if (SolveMode(*mode)) {
+        LOG(info) << "{AddressSolver::SolveWithModes} choice: " << mode->ToString() << endl;
+        mSolutionChoices.push_back(mode);
+        continue;
       }
       delete mode;
     }
 
+    LOG(info) << "{AddressSolver::SolveWithModes} solved " << dec << rModes.size() << " of " << rModes.size() << " modes." << endl;
+
     // try to set address shortage flag.
-    if (ShouldEnableAddressShortage(instr)) {
-      auto gen_mode = gen.GetGenMode();
+    UpdateAddressShortage(gen, instr, mSolutionChoices.size());
 
-      if (not gen_mode->IsAddressShortage()) {
-        gen_mode->EnableGenMode(EGenModeTypeBaseType(EGenModeType::AddressShortage));
+    ChooseSolution(gen, instr);
+    return mpChosenSolution;
+  }
+
+  bool AddressSolver::ShouldSolveLazily(const Generator& gen, const vector<AddressingMode* >& rModes) const
+  {
+    bool lazy_valid = false;
+    uint64 lazy_solving = Config::Instance()->GetOptionValue(ESystemOptionType_to_string(ESystemOptionType::LazyAddressSolving), lazy_valid);
+    if ((not lazy_valid) or (lazy_solving == 0) or (rModes.size() < 2)) {
+      return false;
+    }
+
+    // preview the filters, modes are fully solved if any of them might filter on the whole solution set, for example to pick a dependent register.
+    vector<AddressSolutionFilter* > filter_vec;
+    gen.GetAddressFilteringRegulator()->GetAddressSolutionFilters(*mpModeTemplate, filter_vec);
+
+    return none_of(filter_vec.cbegin(), filter_vec.cend(), [this, &rModes](const AddressSolutionFilter* pFilter) { return pFilter->NeedsAllSolutions(*this, rModes); });
+  }
+
+  // Drawing the modes by weight without replacement and skipping the unusable ones picks each usable mode with the same
+  // probability as solving all modes and then choosing by weight, but usually only a few modes need to be solved.
+  void AddressSolver::SolveLazily(const Generator& gen, const Instruction& instr, const vector<AddressingMode* >& rModes)
+  {
+    vector<AddressingMode* > pending_modes(rModes);
+    uint32 solution_count = 0;
+
+    // the first solved mode is either chosen, or kept without being chosen, which fails the full solving as well.
+    AddressingMode* mode = choose_weighted_item_lazily(pending_modes, [this](AddressingMode* pMode) {
+        if (SolveMode(*pMode)) {
+          return true;
+        }
+        delete pMode;
+        return false;
+      });
+
+    if (mode != nullptr) {
+      LOG(info) << "{AddressSolver::SolveLazily} choice: " << mode->ToString() << endl;
+      ++ solution_count;
+      mSolutionChoices.push_back(mode);
+      UpdateSolution();
+    }
+
+    // address shortage only depends on whether more than one mode can be solved.
+    for (auto mode_iter = pending_modes.begin(); (mode_iter != pending_modes.end()) and ShouldEnableAddressShortage(instr, solution_count); ++ mode_iter) {
+      if (SolveMode(**mode_iter)) {
+        ++ solution_count;
       }
     }
 
-    ChooseSolution(gen, instr);
-    return mpChosenSolution;
+    LOG(info) << "{AddressSolver::SolveLazily} solved " << dec << (rModes.size() - pending_modes.size()) << " of " << rModes.size() << " modes lazily." << endl;
+
+    for (auto mode : pending_modes) {
+      delete mode;
+    }
+
+    UpdateAddressShortage(gen, instr, solution_count);
+
+    if (mpChosenSolution != nullptr) {
+      ApplySolutionFilters(gen, instr);
+    }
+  }
+
+  // Preparing computes the usable target constraints, which is most of the solving work, but doesn't choose from them. The
+  // modes are still solved in order on the calling thread afterwards, so the random choices and the results are the same
+  // as without preparing.
+  void AddressSolver::PrepareModes(const vector<AddressingMode* >& rModes) const
+  {
+    // applying the virtual usable constraint can log at info level, solve sequentially then so the log stays in solving order.
+    WorkerPool* worker_pool = WorkerPool::Instance();
+    if ((worker_pool == nullptr) or (worker_pool->ThreadCount() < 2) or gLog->Log(LL::info)) {
+      return;
+    }
+
+    // free modes share the free target solved on the first of them, which may add pages.
+    vector<AddressingMode* > fixed_modes;
+    copy_if(rModes.cbegin(), rModes.cend(), back_inserter(fixed_modes), [](const AddressingMode* pMode) { return not pMode->IsFree(); });
+    if (fixed_modes.size() < 2) {
+      return;
+    }
+
+    mpAddressSolvingShared->CommitVirtualUsableConstraint();
+    worker_pool->Run(fixed_modes.size(), [this, &fixed_modes](uint32 modeIndex) { fixed_modes[modeIndex]->PrepareSolve(*mpAddressSolvingShared); });
+  }
+
+  bool AddressSolver::SolveMode(AddressingMode& rMode) const
+  {
+    bool solved = false;
+    if (rMode.IsFree()) {
+      solved = rMode.SolveFree(*mpAddressSolvingShared);
+    }
+    else {
+      solved = rMode.Solve(*mpAddressSolvingShared);
+    }
+
+    rMode.ClearPrepared();
+    return solved;
   }
 
   bool AddressSolver::GetAvailableBaseChoices(Generator& gen, Instruction& instr, vector<AddressingMode* >& rBaseChoices) const
@@ -1758,6 +1990,11 @@ namespace {
 
     // << "initial solution: " << mpChosenSolution->ToString() << endl;
 
+    ApplySolutionFilters(rGen, rInstr);
+  }
+
+  void AddressSolver::ApplySolutionFilters(const Generator& rGen, const Instruction& rInstr)
+  {
     vector<AddressSolutionFilter* > filter_vec;
     rGen.GetAddressFilteringRegulator()->GetAddressSolutionFilters(*mpModeTemplate, filter_vec);
 
@@ -1817,7 +2054,7 @@ namespace {
 
   // We want to enable address shortage mode if we only have one solution for a load or store
   // instruction that wasn't forced by constraints or by the instruction format.
-  bool AddressSolver::ShouldEnableAddressShortage(const Instruction& instr) const
+  bool AddressSolver::ShouldEnableAddressShortage(const Instruction& instr, uint32 solutionCount) const
   {
     bool enable_addr_shortage = true;
 
@@ -1829,7 +2066,7 @@ namespace {
     if (not instr.IsLoadStore()) {
       enable_addr_shortage = false;
     }
-    else if (mSolutionChoices.size() > 1) {
+    else if (solutionCount > 1) {
       enable_addr_shortage = false;
     }
     else if (constraint->ConstraintForced()) {
@@ -1845,6 +2082,17 @@ namespace {
     return enable_addr_shortage;
   }
 
+  void AddressSolver::UpdateAddressShortage(const Generator& gen, const Instruction& instr, uint32 solutionCount) const
+  {
+    if (ShouldEnableAddressShortage(instr, solutionCount)) {
+      auto gen_mode = gen.GetGenMode();
+
+      if (not gen_mode->IsAddressShortage()) {
+        gen_mode->EnableGenMode(EGenModeTypeBaseType(EGenModeType::AddressShortage));
+      }
+    }
+  }
+
   bool AddressSolverWithOnlyChoice::GetAvailableBaseChoices(Generator& gen, Instruction& instr, std::vector<AddressingMode* >& rBaseChoices) const
   {
     auto cast_opr = dynamic_cast<const ImpliedRegisterOperand *> (mpBaseOperand);
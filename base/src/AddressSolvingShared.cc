@@ -122,36 +122,74 @@ namespace Force {
 
   }
 
-  bool AddressSolvingShared::ReVerifyTargetAddressRange(uint64 targetAddress) const
+  void AddressSolvingShared::CommitVirtualUsableConstraint() const
+  {
+    mpVmMapper->CommitVirtualUsableConstraint();
+  }
+
+  bool AddressSolvingShared::ReVerifyTargetAddressRange(uint64 targetAddress, uint64 size) const
   {
     // Need to verify the address is usable when new pages are allocated because we can't know before the virtual
     // addresses have been mapped.
     const AddressTagging* addr_tagging = GetAddressTagging();
     uint64 untagged_target_address = addr_tagging->UntagAddress(targetAddress, IsInstruction());
-    ConstraintSet generated_addr_constr(untagged_target_address, untagged_target_address + Size() - 1);
+    ConstraintSet generated_addr_constr(untagged_target_address, untagged_target_address + size - 1);
     uint32 temp_var = 0;
     ApplyVirtualUsableConstraint(&generated_addr_constr, temp_var);
 
-    return (generated_addr_constr.Size() == Size());
+    return (generated_addr_constr.Size() == size);
   }
 
   bool AddressSolvingShared::MapTargetAddressRange(uint64 targetAddress, uint32& rTimeStamp) const
+  {
+    return MapTargetAddressSpan(targetAddress, Size(), rTimeStamp);
+  }
+
+  bool AddressSolvingShared::MapTargetAddressRanges(const vector<uint64>& rTargetAddresses, uint32& rTimeStamp) const
+  {
+    if (rTargetAddresses.empty()) {
+      return true;
+    }
+
+    // Merge each target address range into the current span while it overlaps or directly follows the span, so that
+    // pages are still mapped in the order the addresses are accessed.
+    uint64 span_start = rTargetAddresses.front();
+    uint64 span_end = span_start + Size() - 1;
+    for (auto addr_itr = rTargetAddresses.cbegin() + 1; addr_itr != rTargetAddresses.cend(); ++ addr_itr) {
+      uint64 target_addr = *addr_itr;
+      uint64 target_end = target_addr + Size() - 1;
+      if ((target_addr >= span_start) and (target_addr <= span_end + 1) and (target_end >= target_addr)) {
+        span_end = max(span_end, target_end);
+        continue;
+      }
+
+      if (not MapTargetAddressSpan(span_start, span_end - span_start + 1, rTimeStamp)) {
+        return false;
+      }
+      span_start = target_addr;
+      span_end = target_end;
+    }
+
+    return MapTargetAddressSpan(span_start, span_end - span_start + 1, rTimeStamp);
+  }
+
+  bool AddressSolvingShared::MapTargetAddressSpan(uint64 targetAddress, uint64 size, uint32& rTimeStamp) const
   {
     bool addr_usable = false;
-    bool mapped_to_new_pages = GetVmMapper()->MapAddressRange(targetAddress, Size(), IsInstruction(), mpAddressingOperandConstraint->GetPageRequest());
+    bool mapped_to_new_pages = GetVmMapper()->MapAddressRange(targetAddress, size, IsInstruction(), mpAddressingOperandConstraint->GetPageRequest());
     if (mapped_to_new_pages) {
       ++ mVmTimeStamp;
-      addr_usable = ReVerifyTargetAddressRange(targetAddress);
+      addr_usable = ReVerifyTargetAddressRange(targetAddress, size);
     }
     else if (rTimeStamp < mVmTimeStamp) {
-      addr_usable = ReVerifyTargetAddressRange(targetAddress);
+      addr_usable = ReVerifyTargetAddressRange(targetAddress, size);
     }
     else {
       // If the address range mapped into existing pages, it should be usable.
       addr_usable = true;
     }
 
-    // << "{AddressSolvingShared::MapTargetAddressRange} address 0x" << hex << targetAddress << " in time stamp: " << dec << rTimeStamp << " VM time stamp: " << mVmTimeStamp << " mapped to new page: " << mapped_to_new_pages << " usable: " << addr_usable << endl;
+    // << "{AddressSolvingShared::MapTargetAddressSpan} address 0x" << hex << targetAddress << " size 0x" << size << " in time stamp: " << dec << rTimeStamp << " VM time stamp: " << mVmTimeStamp << " mapped to new page: " << mapped_to_new_pages << " usable: " << addr_usable << endl;
     rTimeStamp = mVmTimeStamp; // update caller's time-stamp.
 
     return addr_usable;
@@ -81,76 +81,87 @@ namespace Force {
     }
   }
 
-  Generator* ArchInfoBase::CreateGenerator(uint32 threadId) const
+  void ArchInfoBase::SetupGeneratorTemplate() const
   {
-    Generator* ret_gen = nullptr;
-    if (nullptr == mpGeneratorTemplate) {
-      if (nullptr != mpInstructionSet) {
-        LOG(fail) << "Expecting instruction-set pointer to be nullptr at this point." << endl;
-        FAIL("instruction-set-not-nullptr");
-      }
+    if (nullptr != mpGeneratorTemplate) {
+      return;
+    }
 
-      mpInstructionSet = new InstructionSet();
-      mpInstructionSet->Setup(*this);
-      mpPagingInfo = new PagingInfo();
-      mpPagingInfo->Setup(*this);
-
-      mpGeneratorTemplate = InstantiateGenerator();
-      mpGeneratorTemplate->mpArchInfo = this;
-      mpGeneratorTemplate->mpInstructionSet = mpInstructionSet;
-      mpGeneratorTemplate->mpPagingInfo = mpPagingInfo;
-      mpGeneratorTemplate->mpSimAPI = mpSimAPI;
-      mpGeneratorTemplate->mpMemoryManager = MemoryManager::Instance();
-
-      RegisterFile* register_file = InstantiateRegisterFile();
-      register_file->LoadRegisterFiles(RegisterFiles());
-      mpGeneratorTemplate->mpRegisterFile = register_file;
-
-      VmManager* vm_manager = InstantiateVmManager();
-      vm_manager->Initialize(VmRegimeTypes());
-      mpGeneratorTemplate->mpVmManager = vm_manager;
-      mpGeneratorTemplate->mpVirtualMemoryInitializer = new VirtualMemoryInitializer(vm_manager, mpGeneratorTemplate->mpRecordArchive, MemoryManager::Instance());
-
-      mpGeneratorTemplate->mpBootOrder = InstantiateBootOrder();
-      mpGeneratorTemplate->mpExceptionRecordManager = InstantiateExceptionRecordManager();
-      mpGeneratorTemplate->mpConditionSet = InstantiateGenConditionSet();
-      mpGeneratorTemplate->mpPageRequestRegulator = InstantiatePageRequestRegulator();
-      mpGeneratorTemplate->mpAddressFilteringRegulator = InstantiateAddressFilteringRegulator();
-      mpGeneratorTemplate->mpAddressTableManager = InstantiateAddressTableManager();
-
-      EGenModeTypeBaseType gen_mode = 0;
-      auto config_inst = Config::Instance();
-      if (not config_inst->DoSimulate()) {
-        gen_mode |= EGenModeTypeBaseType(EGenModeType::NoIss) | EGenModeTypeBaseType(EGenModeType::SimOff);
-      }
-      bool no_skip_valid = false;
-      auto no_skip = config_inst->GetOptionValue(ESystemOptionType_to_string(ESystemOptionType::NoSkip), no_skip_valid);
-      if (no_skip) {
-        LOG(notice) << "System option: " << ESystemOptionType_to_string(ESystemOptionType::NoSkip) << " set." << endl;
-        gen_mode |= EGenModeTypeBaseType(EGenModeType::NoSkip);
-      }
-      mpGeneratorTemplate->mpGenMode = new GenMode(gen_mode);
+    if (nullptr != mpInstructionSet) {
+      LOG(fail) << "Expecting instruction-set pointer to be nullptr at this point." << endl;
+      FAIL("instruction-set-not-nullptr");
+    }
 
-      mpGeneratorTemplate->mMaxInstructions = config_inst->MaxInstructions();
-      mpGeneratorTemplate->mMaxPhysicalVectorLen = config_inst->MaxVectorLen();
+    mpInstructionSet = new InstructionSet();
+    mpInstructionSet->Setup(*this);
+    mpPagingInfo = new PagingInfo();
+    mpPagingInfo->Setup(*this);
+
+    mpGeneratorTemplate = InstantiateGenerator();
+    mpGeneratorTemplate->mpArchInfo = this;
+    mpGeneratorTemplate->mpInstructionSet = mpInstructionSet;
+    mpGeneratorTemplate->mpPagingInfo = mpPagingInfo;
+    mpGeneratorTemplate->mpSimAPI = mpSimAPI;
+    mpGeneratorTemplate->mpMemoryManager = MemoryManager::Instance();
+
+    RegisterFile* register_file = InstantiateRegisterFile();
+    register_file->LoadRegisterFiles(RegisterFiles());
+    mpGeneratorTemplate->mpRegisterFile = register_file;
+
+    VmManager* vm_manager = InstantiateVmManager();
+    vm_manager->Initialize(VmRegimeTypes());
+    mpGeneratorTemplate->mpVmManager = vm_manager;
+    mpGeneratorTemplate->mpVirtualMemoryInitializer = new VirtualMemoryInitializer(vm_manager, mpGeneratorTemplate->mpRecordArchive, MemoryManager::Instance());
+
+    mpGeneratorTemplate->mpBootOrder = InstantiateBootOrder();
+    mpGeneratorTemplate->mpExceptionRecordManager = InstantiateExceptionRecordManager();
+    mpGeneratorTemplate->mpConditionSet = InstantiateGenConditionSet();
+    mpGeneratorTemplate->mpPageRequestRegulator = InstantiatePageRequestRegulator();
+    mpGeneratorTemplate->mpAddressFilteringRegulator = InstantiateAddressFilteringRegulator();
+    mpGeneratorTemplate->mpAddressTableManager = InstantiateAddressTableManager();
+
+    EGenModeTypeBaseType gen_mode = 0;
+    auto config_inst = Config::Instance();
+    if (not config_inst->DoSimulate()) {
+      gen_mode |= EGenModeTypeBaseType(EGenModeType::NoIss) | EGenModeTypeBaseType(EGenModeType::SimOff);
+    }
+    bool no_skip_valid = false;
+    auto no_skip = config_inst->GetOptionValue(ESystemOptionType_to_string(ESystemOptionType::NoSkip), no_skip_valid);
+    if (no_skip) {
+      LOG(notice) << "System option: " << ESystemOptionType_to_string(ESystemOptionType::NoSkip) << " set." << endl;
+      gen_mode |= EGenModeTypeBaseType(EGenModeType::NoSkip);
+    }
+    mpGeneratorTemplate->mpGenMode = new GenMode(gen_mode);
 
+    mpGeneratorTemplate->mMaxInstructions = config_inst->MaxInstructions();
+    mpGeneratorTemplate->mMaxPhysicalVectorLen = config_inst->MaxVectorLen();
 
-      AssignGenAgents(mpGeneratorTemplate);
-      ret_gen = mpGeneratorTemplate;
 
-      ChoicesParser choices_parser(mChoicesSets);
-      choices_parser.Setup(*this);
-      mpGeneratorTemplate->mpChoicesModerators->Setup(mChoicesSets);
+    AssignGenAgents(mpGeneratorTemplate);
 
-      VariableParser variable_parser(mVariableSets);
-      variable_parser.Setup(*this);
-      for (auto variable_set : mVariableSets) {
-        VariableModerator* pModerator;
-        pModerator = new VariableModerator(variable_set);
-        mpGeneratorTemplate->mVariableModerators.push_back(pModerator);
-      }
+    ChoicesParser choices_parser(mChoicesSets);
+    choices_parser.Setup(*this);
+    mpGeneratorTemplate->mpChoicesModerators->Setup(mChoicesSets);
+
+    VariableParser variable_parser(mVariableSets);
+    variable_parser.Setup(*this);
+    for (auto variable_set : mVariableSets) {
+      VariableModerator* pModerator;
+      pModerator = new VariableModerator(variable_set);
+      mpGeneratorTemplate->mVariableModerators.push_back(pModerator);
+    }
+
+    AssignAddressSolutionFilters(mpGeneratorTemplate);
+  }
 
-      AssignAddressSolutionFilters(mpGeneratorTemplate);
+  Generator* ArchInfoBase::CreateGenerator(uint32 threadId) const
+  {
+    Generator* ret_gen = nullptr;
+    SetupGeneratorTemplate();
+    if (not mTemplateHandedOut) {
+      // The first Generator created is the template itself.
+      ret_gen = mpGeneratorTemplate;
+      mTemplateHandedOut = true;
     } else {
       ret_gen = dynamic_cast<Generator*>(mpGeneratorTemplate->Clone());
     }
@@ -27,7 +27,7 @@ using namespace std;
 namespace Force {
 
   ArchInfo::ArchInfo(const std::string& name)
-    : mName(name), mpGeneratorTemplate(nullptr), mpInstructionSet(nullptr), mpPagingInfo(nullptr), mpSimAPI(nullptr), mpSimApiModule(nullptr), mChoicesSets(), mVariableSets(), mMemoryBanks(), mInstructionFiles(), mRegisterFiles(), mChoicesFiles(), mPagingFiles(), mVariableFiles(),
+    : mName(name), mpGeneratorTemplate(nullptr), mTemplateHandedOut(false), mpInstructionSet(nullptr), mpPagingInfo(nullptr), mpSimAPI(nullptr), mpSimApiModule(nullptr), mChoicesSets(), mVariableSets(), mMemoryBanks(), mInstructionFiles(), mRegisterFiles(), mChoicesFiles(), mPagingFiles(), mVariableFiles(),
       mDefaultIClass(), mDefaultPteClass(), mDefaultPteAttributeClass(), mDefaultOperandClasses(), mRegisterClasses(), mSimulatorApiModule(), mSimulatorDLL(), mSimulatorStandalone(), mSimulatorConfigString()
   {
 
@@ -141,4 +141,11 @@ namespace Force {
     }
   }
 
+  void Architectures::SetupGeneratorTemplates()
+  {
+    for (auto & map_item : mArchInfoObjects) {
+      map_item.second->SetupGeneratorTemplate();
+    }
+  }
+
 }
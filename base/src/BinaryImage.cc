@@ -0,0 +1,217 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "BinaryImage.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "Log.h"
+
+/*!
+  \file BinaryImage.cc
+  \brief Code for reading and writing image files in binary format.
+*/
+
+using namespace std;
+
+namespace Force {
+
+#define BINARY_IMAGE_ALIGN(s)  (((s) + 7ull) & ~7ull)
+
+  static const char sBinaryImageMagic[8] = {'F', 'R', 'C', 'I', 'M', 'A', 'G', 'E'};
+  static cuint32 sBinaryImageVersion = 3;
+  static cuint32 sBinaryImageByteOrder = 0x01020304;
+
+  void BinaryImageWriter::Open(const string& imageFile, const string& head)
+  {
+    mImageFile.open(imageFile, ios::out | ios::binary | ios::trunc);
+    if (not mImageFile.is_open())
+    {
+      LOG(fail) << "{BinaryImageWriter::Open} can't open file " << imageFile << endl;
+      FAIL("can-not-open-file");
+    }
+    mPath = imageFile;
+    mMemoryBank = 0;
+    mEntryPoint = 0;
+    mSections.clear();
+    mRegisters.clear();
+
+    // the header is written on close, once the tables are in place.
+    BinaryImageHeader header;
+    memset(&header, 0, sizeof(header));
+    mImageFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    mImageFile.write(head.data(), head.size());
+    mHeadSize = head.size();
+    mOffset = sizeof(header) + mHeadSize;
+  }
+
+  uint64 BinaryImageWriter::WritePayload(const void* pData, uint64 size)
+  {
+    static const char padding[8] = {0};
+    uint64 payload_offset = BINARY_IMAGE_ALIGN(mOffset);
+    mImageFile.write(padding, payload_offset - mOffset);
+    mImageFile.write(reinterpret_cast<const char*>(pData), size);
+    mOffset = payload_offset + size;
+    return payload_offset;
+  }
+
+  void BinaryImageWriter::AppendSection(char type, uint64 address, uint64 size, const uint8* data)
+  {
+    BinaryImageSection section;
+    memset(&section, 0, sizeof(section));
+    section.mAddress = address;
+    section.mSize = size;
+    section.mType = type;
+    section.mDataOffset = WritePayload(data, size);
+    mSections.push_back(section);
+  }
+
+  void BinaryImageWriter::AppendRegister(uint32 threadId, char flag, const string& name, const vector<uint64>& values, uint32 valueSize)
+  {
+    BinaryImageRegister register_entry;
+    memset(&register_entry, 0, sizeof(register_entry));
+    register_entry.mThreadId = threadId;
+    register_entry.mFlag = flag;
+    register_entry.mNameSize = name.size();
+    register_entry.mValueCount = values.size();
+    register_entry.mValueSize = valueSize;
+    register_entry.mValuesOffset = WritePayload(values.data(), values.size() * sizeof(uint64));
+    register_entry.mNameOffset = WritePayload(name.data(), name.size());
+    mRegisters.push_back(register_entry);
+  }
+
+  void BinaryImageWriter::Close()
+  {
+    BinaryImageHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.mMagic, sBinaryImageMagic, sizeof(sBinaryImageMagic));
+    header.mVersion = sBinaryImageVersion;
+    header.mByteOrder = sBinaryImageByteOrder;
+    header.mHeadSize = mHeadSize;
+    header.mSectionCount = mSections.size();
+    header.mRegisterCount = mRegisters.size();
+    header.mMemoryBank = mMemoryBank;
+    header.mSectionTableOffset = WritePayload(mSections.data(), mSections.size() * sizeof(BinaryImageSection));
+    header.mRegisterTableOffset = WritePayload(mRegisters.data(), mRegisters.size() * sizeof(BinaryImageRegister));
+    header.mFileSize = mOffset;
+    header.mEntryPoint = mEntryPoint;
+
+    mImageFile.seekp(0);
+    mImageFile.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    mImageFile.close();
+    if (mImageFile.fail())
+    {
+      LOG(fail) << "{BinaryImageWriter::Close} failed to write file " << mPath << endl;
+      FAIL("write-image-failed");
+    }
+  }
+
+  BinaryImageFile::~BinaryImageFile()
+  {
+    Unload();
+  }
+
+  void BinaryImageFile::Load(const string& imageFile)
+  {
+    Unload();
+
+    int file_descriptor = open(imageFile.c_str(), O_RDONLY);
+    if (file_descriptor < 0)
+    {
+      LOG(fail) << "{BinaryImageFile::Load} can't open file " << imageFile << ": " << strerror(errno) << endl;
+      FAIL("can-not-open-file");
+    }
+
+    struct stat file_stat;
+    if ((fstat(file_descriptor, &file_stat) != 0) or (uint64(file_stat.st_size) < sizeof(BinaryImageHeader)))
+    {
+      close(file_descriptor);
+      LOG(fail) << "{BinaryImageFile::Load} \"" << imageFile << "\" is too small to be a binary image." << endl;
+      FAIL("invalid-binary-image");
+    }
+
+    void* mapping = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    close(file_descriptor);
+    if (mapping == MAP_FAILED)
+    {
+      LOG(fail) << "{BinaryImageFile::Load} failed to map \"" << imageFile << "\": " << strerror(errno) << endl;
+      FAIL("map-binary-image-failed");
+    }
+    mpMapping = static_cast<uint8*>(mapping);
+    mMappedSize = file_stat.st_size;
+    mPath = imageFile;
+
+    const BinaryImageHeader* header = Header();
+    if ((memcmp(header->mMagic, sBinaryImageMagic, sizeof(sBinaryImageMagic)) == 0) and (header->mByteOrder != sBinaryImageByteOrder))
+    {
+      Unload();
+      LOG(fail) << "{BinaryImageFile::Load} \"" << imageFile << "\" was written with a different byte order." << endl;
+      FAIL("binary-image-byte-order-mismatch");
+    }
+    if ((memcmp(header->mMagic, sBinaryImageMagic, sizeof(sBinaryImageMagic)) != 0) or (header->mVersion != sBinaryImageVersion) or (header->mFileSize != mMappedSize))
+    {
+      Unload();
+      LOG(fail) << "{BinaryImageFile::Load} \"" << imageFile << "\" is not a version " << dec << sBinaryImageVersion << " binary image." << endl;
+      FAIL("invalid-binary-image");
+    }
+  }
+
+  void BinaryImageFile::Unload()
+  {
+    if (mpMapping != nullptr) {
+      munmap(mpMapping, mMappedSize);
+      mpMapping = nullptr;
+      mMappedSize = 0;
+    }
+    mPath.clear();
+  }
+
+  const BinaryImageSection* BinaryImageFile::Sections() const
+  {
+    const BinaryImageHeader* header = Header();
+    return reinterpret_cast<const BinaryImageSection*>(Payload(header->mSectionTableOffset, uint64(header->mSectionCount) * sizeof(BinaryImageSection)));
+  }
+
+  const BinaryImageRegister* BinaryImageFile::Registers() const
+  {
+    const BinaryImageHeader* header = Header();
+    return reinterpret_cast<const BinaryImageRegister*>(Payload(header->mRegisterTableOffset, uint64(header->mRegisterCount) * sizeof(BinaryImageRegister)));
+  }
+
+  const uint8* BinaryImageFile::Payload(uint64 offset, uint64 size) const
+  {
+    if ((offset > mMappedSize) or (size > mMappedSize - offset))
+    {
+      LOG(fail) << "{BinaryImageFile::Payload} 0x" << hex << size << " bytes at offset 0x" << offset << " lie outside of \"" << mPath << "\"." << endl;
+      FAIL("invalid-binary-image");
+    }
+    return mpMapping + offset;
+  }
+
+  bool BinaryImageFile::IsBinaryImage(const string& imageFile)
+  {
+    char magic[sizeof(sBinaryImageMagic)] = {0};
+    ifstream image_file(imageFile, ios::in | ios::binary);
+    image_file.read(magic, sizeof(magic));
+    return image_file.good() and (memcmp(magic, sBinaryImageMagic, sizeof(sBinaryImageMagic)) == 0);
+  }
+
+}
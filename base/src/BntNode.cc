@@ -24,6 +24,7 @@
 #include "Generator.h"
 #include "Instruction.h"
 #include "Log.h"
+#include "MemoryFootprint.h"
 #include "Register.h"
 #include "ResourcePeState.h"
 #include "SimAPI.h"
@@ -43,7 +44,7 @@ namespace Force {
   uint32 BntNode::msBntId = 0;
 
   BntNode::BntNode(uint64 brTarget, bool taken, bool cond)
-    : mBranchTarget(brTarget), mNextPC(0),  mAttributes(0), mId(0), mSequenceName(), mBntFunction(), mpPeState(nullptr)
+    : mBranchTarget(brTarget), mNextPC(0),  mAttributes(0), mId(0), mSequenceName(), mBntFunction(), mpPeState(nullptr), mNotTakenPa(0), mNotTakenBank(0), mNotTakenPaValid(false)
   {
     SetTaken(taken);
     SetConditional(cond);
@@ -113,9 +114,28 @@ namespace Force {
     snprintf(print_buffer, 32, "BNT%d", mId);
     pGen->ReserveMemory(print_buffer, untagged_bnt_address, pGen->BntReserveSpace(), 0, true);
 
+    // The path is translated in the same context it is generated in, after the saved PE state is restored.
+    mNotTakenPaValid = (vm_mapper->TranslateVaToPa(not_taken_addr, mNotTakenPa, mNotTakenBank) == ETranslationResultType::Mapped);
+
     SavePeState(pGen);
   }
 
+  bool BntNode::IsRetirable(const vector<const ConstraintSet* >& rFreeConstraints, uint64 minSpace) const
+  {
+    if (PathsSame()) {
+      return true;
+    }
+
+    if (IsSpeculative() or IsAccurate() or (not mNotTakenPaValid) or (mNotTakenBank >= rFreeConstraints.size())) {
+      return false;
+    }
+
+    // Free memory only shrinks, so once the not-taken path no longer starts a large enough free range, it never will again.
+    uint64 inter_size = 0;
+    uint64 inter_start = rFreeConstraints[mNotTakenBank]->LeadingIntersectingRange(mNotTakenPa, -1ull, inter_size);
+    return (mNotTakenPa != inter_start) or (inter_size < minSpace);
+  }
+
   void BntNode::SavePeState(Generator* pGen)
   {
     auto vm_regime = pGen->GetVmManager()->CurrentVmRegime();
@@ -154,6 +174,12 @@ namespace Force {
     FAIL("No-implementation-for-Bnt");
   }
 
+  void BntNode::AccountMemoryFootprint(MemoryFootprint& rFootprint) const
+  {
+    uint64 pe_state_bytes = (nullptr != mpPeState) ? mpPeState->StorageBytes() : 0;
+    rFootprint.Add("BntNodes", 1, sizeof(*this) + mSequenceName.capacity() + mBntFunction.capacity() + pe_state_bytes);
+  }
+
   SpeculativeBntNode::SpeculativeBntNode(uint64 brTarget, bool taken, bool cond) : BntNode(brTarget, taken, cond), mResourcePeStateStacks(EResourcePeStateTypeSize, nullptr), mRealPath(0ull), mInstructions(0ull), mReservedTakenPath(false)
   {
     for ( EResourcePeStateTypeBaseType type = 0; type < EResourcePeStateTypeSize; type ++)
@@ -270,4 +296,16 @@ namespace Force {
     return (mInstructions >= bnt_limit);
   }
 
+  void SpeculativeBntNode::AccountMemoryFootprint(MemoryFootprint& rFootprint) const
+  {
+    BntNode::AccountMemoryFootprint(rFootprint);
+
+    // BlockMemoryPeState is the largest resource PE state type.
+    uint64 state_count = 0;
+    for (auto state_stack : mResourcePeStateStacks) {
+      state_count += state_stack->Size();
+    }
+    rFootprint.Add("ResourcePeStates", state_count, state_count * (sizeof(BlockMemoryPeState) + sizeof(ResourcePeState*)) + mResourcePeStateStacks.size() * sizeof(ResourcePeStateStack));
+  }
+
 }
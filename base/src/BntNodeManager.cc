@@ -15,10 +15,15 @@
 //
 #include "BntNodeManager.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "BntNode.h"
+#include "Generator.h"
 #include "Log.h"
+#include "MemoryFootprint.h"
+#include "MemoryManager.h"
+#include "SimplePeState.h"
 
 /*!
   \file BntNodeManager.cc
@@ -96,6 +101,61 @@ namespace Force {
     }
   }
 
+  uint32 BntNodeManager::RetireBntNodes(Generator* pGen)
+  {
+    vector<const ConstraintSet* > free_constraints;
+    for (auto mem_bank : pGen->GetMemoryManager()->MemoryBanks()) {
+      free_constraints.push_back(mem_bank->Free());
+    }
+
+    return RetireBntNodes(free_constraints, pGen->BntMinSpace());
+  }
+
+  uint32 BntNodeManager::RetireBntNodes(const vector<const ConstraintSet* >& rFreeConstraints, uint64 minSpace)
+  {
+    if (mBntNodes.size() < 2) {
+      return 0;
+    }
+
+    // The nodes are processed in order and each one restores its PE state, so a node is only deleted if the next kept node
+    // restores the same registers.  The last node is always kept, since the state it restores is the one generation continues with.
+    vector<BntNode* > kept_nodes;
+    kept_nodes.reserve(mBntNodes.size());
+    kept_nodes.push_back(mBntNodes.back());
+    uint32 retired_count = 0;
+    for (auto node_iter = mBntNodes.rbegin() + 1; node_iter != mBntNodes.rend(); ++ node_iter) {
+      BntNode* bnt_node = *node_iter;
+      const SimplePeState* next_state = kept_nodes.back()->GetPeState();
+      bool state_covered = bnt_node->PathsSame() or ((nullptr != next_state) and next_state->CoversState(*(bnt_node->GetPeState())));
+      if (state_covered and bnt_node->IsRetirable(rFreeConstraints, minSpace)) {
+        delete bnt_node;
+        ++ retired_count;
+      }
+      else {
+        kept_nodes.push_back(bnt_node);
+      }
+    }
+
+    reverse(kept_nodes.begin(), kept_nodes.end());
+    kept_nodes.shrink_to_fit();
+    mBntNodes.swap(kept_nodes);
+    return retired_count;
+  }
+
+  void BntNodeManager::AccountMemoryFootprint(MemoryFootprint& rFootprint) const
+  {
+    rFootprint.Add("BntNodes", 0, MemoryFootprint::VectorBytes(mBntNodes) + MemoryFootprint::VectorBytes(mSpeculativeBntNodes));
+    for (auto bnt_node : mBntNodes) {
+      bnt_node->AccountMemoryFootprint(rFootprint);
+    }
+    for (auto bnt_node : mSpeculativeBntNodes) {
+      bnt_node->AccountMemoryFootprint(rFootprint);
+    }
+    if (nullptr != mpHotSpeculativeBntNode) {
+      mpHotSpeculativeBntNode->AccountMemoryFootprint(rFootprint);
+    }
+  }
+
   BntNodeManager::BntNodeManager(const BntNodeManager& rOther) : Object(rOther), mBntNodes(), mpHotSpeculativeBntNode(nullptr), mSpeculativeBntNodes()
   {
 
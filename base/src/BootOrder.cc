@@ -71,7 +71,7 @@ namespace Force {
   {
     auto large_reg_ptr = dynamic_cast<LargeRegister* >(pRegister);
     if (large_reg_ptr != nullptr) {
-      mValues = large_reg_ptr->InitialValues();
+      large_reg_ptr->GetInitialValues(mValues);
     }
     else {
       LOG(info) << "{LargeRegisterElement} register: " << pRegister->Name() << ", initial value:0x" << hex << pRegister->InitialValue()  << endl;
@@ -838,7 +838,7 @@ namespace Force {
   }
 
 #ifdef UNIT_TEST
-  uint32 ConstraintSet::msConstraintDeleteCount = 0;
+  std::atomic<uint32> ConstraintSet::msConstraintDeleteCount(0);
 #endif
 
   ConstraintSet::ConstraintSet(uint64 lower, uint64 upper)
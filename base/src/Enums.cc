@@ -3196,7 +3196,7 @@ namespace Force {
   }
 
 
-  unsigned char EPageRequestAttributeTypeSize = 7;
+  unsigned char EPageRequestAttributeTypeSize = 8;
 
   const string EPageRequestAttributeType_to_string(EPageRequestAttributeType in_enum)
   {
@@ -3208,6 +3208,7 @@ namespace Force {
     case EPageRequestAttributeType::MemAttrArch: return "MemAttrArch";
     case EPageRequestAttributeType::MemAttrImpl: return "MemAttrImpl";
     case EPageRequestAttributeType::AliasPageId: return "AliasPageId";
+    case EPageRequestAttributeType::PreferredPA: return "PreferredPA";
     default:
       unknown_enum_value("EPageRequestAttributeType", (unsigned char)(in_enum));
     }
@@ -3218,13 +3219,22 @@ namespace Force {
   {
     string enum_type_name = "EPageRequestAttributeType";
     size_t size = in_str.size();
-    char hash_value = in_str.at(0) ^ in_str.at(7 < size ? 7 : 7 % size);
+    char hash_value = in_str.at(1 < size ? 1 : 1 % size) ^ in_str.at(10 < size ? 10 : 10 % size);
 
     switch (hash_value) {
-    case 4:
+    case 0:
+      validate(in_str, "IPA", enum_type_name);
+      return EPageRequestAttributeType::IPA;
+    case 6:
+      validate(in_str, "PageSize", enum_type_name);
+      return EPageRequestAttributeType::PageSize;
+    case 8:
+      validate(in_str, "AliasPageId", enum_type_name);
+      return EPageRequestAttributeType::AliasPageId;
+    case 9:
       validate(in_str, "MemAttrImpl", enum_type_name);
       return EPageRequestAttributeType::MemAttrImpl;
-    case 12:
+    case 13:
       validate(in_str, "MemAttrArch", enum_type_name);
       return EPageRequestAttributeType::MemAttrArch;
     case 17:
@@ -3233,15 +3243,9 @@ namespace Force {
     case 23:
       validate(in_str, "VA", enum_type_name);
       return EPageRequestAttributeType::VA;
-    case 25:
-      validate(in_str, "IPA", enum_type_name);
-      return EPageRequestAttributeType::IPA;
-    case 38:
-      validate(in_str, "AliasPageId", enum_type_name);
-      return EPageRequestAttributeType::AliasPageId;
-    case 53:
-      validate(in_str, "PageSize", enum_type_name);
-      return EPageRequestAttributeType::PageSize;
+    case 51:
+      validate(in_str, "PreferredPA", enum_type_name);
+      return EPageRequestAttributeType::PreferredPA;
     default:
       unknown_enum_name(enum_type_name, in_str);
     }
@@ -3252,13 +3256,22 @@ namespace Force {
   {
     okay = true;
     size_t size = in_str.size();
-    char hash_value = in_str.at(0) ^ in_str.at(7 < size ? 7 : 7 % size);
+    char hash_value = in_str.at(1 < size ? 1 : 1 % size) ^ in_str.at(10 < size ? 10 : 10 % size);
 
     switch (hash_value) {
-    case 4:
+    case 0:
+      okay = (in_str == "IPA");
+      return EPageRequestAttributeType::IPA;
+    case 6:
+      okay = (in_str == "PageSize");
+      return EPageRequestAttributeType::PageSize;
+    case 8:
+      okay = (in_str == "AliasPageId");
+      return EPageRequestAttributeType::AliasPageId;
+    case 9:
       okay = (in_str == "MemAttrImpl");
       return EPageRequestAttributeType::MemAttrImpl;
-    case 12:
+    case 13:
       okay = (in_str == "MemAttrArch");
       return EPageRequestAttributeType::MemAttrArch;
     case 17:
@@ -3267,15 +3280,9 @@ namespace Force {
     case 23:
       okay = (in_str == "VA");
       return EPageRequestAttributeType::VA;
-    case 25:
-      okay = (in_str == "IPA");
-      return EPageRequestAttributeType::IPA;
-    case 38:
-      okay = (in_str == "AliasPageId");
-      return EPageRequestAttributeType::AliasPageId;
-    case 53:
-      okay = (in_str == "PageSize");
-      return EPageRequestAttributeType::PageSize;
+    case 51:
+      okay = (in_str == "PreferredPA");
+      return EPageRequestAttributeType::PreferredPA;
     default:
       okay = false;
       return EPageRequestAttributeType::VA;
@@ -3924,7 +3931,7 @@ namespace Force {
   }
 
 
-  unsigned int EGenModeTypeSize = 15;
+  unsigned int EGenModeTypeSize = 16;
 
   const string EGenModeType_to_string(EGenModeType in_enum)
   {
@@ -3944,6 +3951,7 @@ namespace Force {
     case EGenModeType::AddressShortage: return "AddressShortage";
     case EGenModeType::RecordingState: return "RecordingState";
     case EGenModeType::RestoreStateLoop: return "RestoreStateLoop";
+    case EGenModeType::NoBnt: return "NoBnt";
     default:
       unknown_enum_value("EGenModeType", (unsigned int)(in_enum));
     }
@@ -3969,6 +3977,9 @@ namespace Force {
     case 11:
       validate(in_str, "NoEscape", enum_type_name);
       return EGenModeType::NoEscape;
+    case 12:
+      validate(in_str, "NoBnt", enum_type_name);
+      return EGenModeType::NoBnt;
     case 23:
       validate(in_str, "ReExe", enum_type_name);
       return EGenModeType::ReExe;
@@ -4027,6 +4038,9 @@ namespace Force {
     case 11:
       okay = (in_str == "NoEscape");
       return EGenModeType::NoEscape;
+    case 12:
+      okay = (in_str == "NoBnt");
+      return EGenModeType::NoBnt;
     case 23:
       okay = (in_str == "ReExe");
       return EGenModeType::ReExe;
@@ -16,21 +16,24 @@
 #include "ExceptionRecords.h"
 
 #include <algorithm>
+#include <memory>
+#include <sstream>
 
 #include "Constraint.h"
 #include "Log.h"
+#include "MemoryFootprint.h"
 
 using namespace std;
 
 namespace Force {
 
   ExceptionRecordManager::ExceptionRecordManager()
-    : Object(), mRecords()
+    : Object(), mRecords(), mRetiredCounts()
   {
   }
 
   ExceptionRecordManager::ExceptionRecordManager(const ExceptionRecordManager& rOther)
-    : Object(rOther), mRecords()
+    : Object(rOther), mRecords(), mRetiredCounts()
   {
 
   }
@@ -41,7 +44,12 @@ namespace Force {
 
   const string ExceptionRecordManager::ToString() const
   {
-    return Type();
+    stringstream out_str;
+    out_str << Type() << " records=" << dec << mRecords.size() << " retired=" << RetiredRecordCount();
+    for (const auto& retired_count : mRetiredCounts) {
+      out_str << " " << EExceptionClassType_to_string(EExceptionClassType(retired_count.first)) << ":" << retired_count.second;
+    }
+    return out_str.str();
   }
 
   Object* ExceptionRecordManager::Clone() const
@@ -71,47 +79,73 @@ namespace Force {
       [exceptionClass](const ExceptionRecord& rExceptionRecord) { return (rExceptionRecord.exception_code == EExceptionClassTypeBaseType(exceptionClass)); });
   }
 
+  typedef uint64 (*ExceptionRecordField)(const ExceptionRecord& rRecord); //!< Function returning a searchable field of an exception record.
+
   // This is the combination seach by arguments, if a field in the sample is not explicitly set, the field will not be searched.
   void ExceptionRecordManager::GetExceptionHistoryByArgs(const map<string, string>& inputArgs, vector<ExceptionRecord> &output)
   {
-    /* See if this sample exception event field(s) is in our history */
-    if (inputArgs.find("Last") != inputArgs.end() && inputArgs.at("Last") == "True")
-    {
-      for (auto itr = mRecords.rbegin(); itr != mRecords.rend(); ++itr )
-      {
-        if (inputArgs.find("EC") != inputArgs.end() && !ConstraintSet(inputArgs.at("EC")).ContainsValue((*itr).exception_code))
-          continue;
-        if (inputArgs.find("PC") != inputArgs.end() && !ConstraintSet(inputArgs.at("PC")).ContainsValue((*itr).pc_value))
-          continue;
-        if (inputArgs.find("SRC_PRIVLEV") != inputArgs.end() && !ConstraintSet(inputArgs.at("SRC_PRIVLEV")).ContainsValue((*itr).src_exception_level))
-          continue;
-        if (inputArgs.find("TGT_PRIVLEV") != inputArgs.end() && !ConstraintSet(inputArgs.at("TGT_PRIVLEV")).ContainsValue((*itr).tgt_exception_level))
-          continue;
-        if (inputArgs.find("FSC") != inputArgs.end() && !ConstraintSet(inputArgs.at("FSC")).ContainsValue((*itr).dfsc_ifsc_code))
-          continue;
-        output.push_back(*itr);
-        break;
+    static const vector<pair<string, ExceptionRecordField>> search_fields = {
+      {"EC", [](const ExceptionRecord& rRecord) -> uint64 { return rRecord.exception_code; }},
+      {"PC", [](const ExceptionRecord& rRecord) -> uint64 { return rRecord.pc_value; }},
+      {"SRC_PRIVLEV", [](const ExceptionRecord& rRecord) -> uint64 { return rRecord.src_exception_level; }},
+      {"TGT_PRIVLEV", [](const ExceptionRecord& rRecord) -> uint64 { return rRecord.tgt_exception_level; }},
+      {"FSC", [](const ExceptionRecord& rRecord) -> uint64 { return rRecord.dfsc_ifsc_code; }}
+    };
+
+    // Parse the constraint of each searched field once rather than once per record.
+    vector<pair<ExceptionRecordField, unique_ptr<ConstraintSet>>> field_constraints;
+    for (const auto& search_field : search_fields) {
+      auto arg_finder = inputArgs.find(search_field.first);
+      if (arg_finder != inputArgs.end()) {
+        field_constraints.emplace_back(search_field.second, unique_ptr<ConstraintSet>(new ConstraintSet(arg_finder->second)));
       }
     }
-    else
-    {
-      for (auto exception_record : mRecords)
-      {
-        if (inputArgs.find("EC") != inputArgs.end() && !ConstraintSet(inputArgs.at("EC")).ContainsValue(exception_record.exception_code))
-          continue;
-        if (inputArgs.find("PC") != inputArgs.end() && !ConstraintSet(inputArgs.at("PC")).ContainsValue(exception_record.pc_value))
-          continue;
-        if (inputArgs.find("SRC_PRIVLEV") != inputArgs.end() && !ConstraintSet(inputArgs.at("SRC_PRIVLEV")).ContainsValue(exception_record.src_exception_level))
-          continue;
-        if (inputArgs.find("TGT_PRIVLEV") != inputArgs.end() && !ConstraintSet(inputArgs.at("TGT_PRIVLEV")).ContainsValue(exception_record.tgt_exception_level))
-          continue;
-        if (inputArgs.find("FSC") != inputArgs.end() && !ConstraintSet(inputArgs.at("FSC")).ContainsValue(exception_record.dfsc_ifsc_code))
-          continue;
-        output.push_back(exception_record);
+
+    auto record_matches = [&field_constraints](const ExceptionRecord& rRecord) {
+      return all_of(field_constraints.cbegin(), field_constraints.cend(),
+        [&rRecord](const pair<ExceptionRecordField, unique_ptr<ConstraintSet>>& rFieldConstr) { return rFieldConstr.second->ContainsValue(rFieldConstr.first(rRecord)); });
+    };
+
+    /* See if this sample exception event field(s) is in our history */
+    auto last_finder = inputArgs.find("Last");
+    if ((last_finder != inputArgs.end()) and (last_finder->second == "True")) {
+      auto record_finder = find_if(mRecords.crbegin(), mRecords.crend(), record_matches);
+      if (record_finder != mRecords.crend()) {
+        output.push_back(*record_finder);
       }
     }
+    else {
+      copy_if(mRecords.cbegin(), mRecords.cend(), back_inserter(output), record_matches);
+    }
   }
 
+  void ExceptionRecordManager::AccountMemoryFootprint(MemoryFootprint& rFootprint) const
+  {
+    rFootprint.Add("Exception records", mRecords.size(), MemoryFootprint::VectorBytes(mRecords) + MemoryFootprint::MapBytes(mRetiredCounts));
+  }
 
-}
+  uint32 ExceptionRecordManager::RetireRecords(uint32 keepCount)
+  {
+    if (mRecords.size() <= keepCount) {
+      return 0;
+    }
+
+    uint32 retire_count = mRecords.size() - keepCount;
+    for (auto record_iter = mRecords.cbegin(); record_iter != mRecords.cbegin() + retire_count; ++ record_iter) {
+      ++ mRetiredCounts[record_iter->exception_code];
+    }
+    mRecords.erase(mRecords.begin(), mRecords.begin() + retire_count);
+    mRecords.shrink_to_fit();
+    return retire_count;
+  }
 
+  uint64 ExceptionRecordManager::RetiredRecordCount() const
+  {
+    uint64 retired_total = 0;
+    for (const auto& retired_count : mRetiredCounts) {
+      retired_total += retired_count.second;
+    }
+    return retired_total;
+  }
+
+}
@@ -59,7 +59,7 @@ using namespace std;
 namespace Force {
 
   GenInstructionAgent::GenInstructionAgent(const GenInstructionAgent& rOther)
-    : GenAgent(rOther), Receiver(rOther), mInstrSimulated(0), mpInstructionRequest(nullptr), mRegisterInitializations() { } //!< Copy constructor, do not copy the request pointer.
+    : GenAgent(rOther), Receiver(rOther), mInstrSimulated(0), mpInstructionRequest(nullptr), mRegisterInitializations(), mPhysicalRegisterInits(), mRegisterWrites() { } //!< Copy constructor, do not copy the request pointer.
 
   GenInstructionAgent::~GenInstructionAgent()
   {
@@ -181,7 +181,7 @@ namespace Force {
       else {
         mpGenerator->AdvancePC(instr_bytes);
       }
-      if (!pInstr->NoBnt()) {
+      if (!pInstr->NoBnt() and !mpGenerator->NoBnt()) {
         if (not mpGenerator->InFiller()) {
           // inaccurate BNT handling, like exception handler
           bnt_node->PreserveNotTakenPath(mpGenerator);
@@ -214,12 +214,7 @@ namespace Force {
     // These Register pointer should not be deleted
     reg_inits.clear();
 
-    auto record_archive = mpGenerator->GetRecordArchive();
-    vector<MemoryInitRecord* > memory_records;
-    record_archive->SwapMemoryInitRecords(memory_records);
-    for (auto mem_rd : memory_records) {
-      delete mem_rd;
-    }
+    mpGenerator->GetRecordArchive()->DiscardMemoryInitRecords();
   }
 
   void GenInstructionAgent::SendInitsToISS()
@@ -227,7 +222,6 @@ namespace Force {
     SimAPI *sim_ptr = mpGenerator->GetSimAPI(); // get handle to simulator...
 
     // make register inits (if different from current state?)
-    std::vector<const PhysicalRegister* > phys_reg_inits;
     auto choice_mod_ptr = mpGenerator->GetChoicesModerator(EChoicesType::RegisterFieldValueChoices);
     auto reg_file = mpGenerator->GetRegisterFile();
 
@@ -249,11 +243,7 @@ namespace Force {
 	  } else
              reg_file->InitializeRegisterRandomly(wider_reg, choice_mod_ptr);
         }
-        std::set<PhysicalRegister* > phyRegisterSet;
-        reg_init->GetPhysicalRegisters(phyRegisterSet);
-        for (auto phys_register : phyRegisterSet) {
-          insert_sorted<const PhysicalRegister* >(phys_reg_inits, phys_register);
-        }
+        mPhysicalRegisterInits.Add(reg_init);
       }
       reg_inits.clear();
       ++ loop_count;
@@ -263,10 +253,11 @@ namespace Force {
       }
     }
     while (mRegisterInitializations.size() > 0); // New inits could be put into the vector.
+    mRegisterInitializations.swap(reg_inits); // hand the emptied vector back to keep its allocation.
 
-    // write fully initialized physical registers.
-    uint32 thread_id = mpGenerator->ThreadId();
-    for (auto phys_reg_ptr : phys_reg_inits) {
+    // write fully initialized physical registers in one batch.
+    mRegisterWrites.clear();
+    for (auto phys_reg_ptr : mPhysicalRegisterInits.Registers()) {
       uint64 phys_reg_mask = phys_reg_ptr->Mask();
       if (phys_reg_ptr->HasAttribute(ERegAttrType::UpdatedFromISS)) {
         LOG(info) << "{GenInstructionAgent::SendInitsToISS} ignore register " << phys_reg_ptr->Name() << " as its value was updated from ISS, "
@@ -275,16 +266,24 @@ namespace Force {
       }
 
       LOG(info) << "{ GenInstructionAgent::SendInitsToISS} writing register " << phys_reg_ptr->Name() << " initial value 0x" << hex << phys_reg_ptr->InitialValue(phys_reg_mask) << endl;
-      sim_ptr->WriteRegister(thread_id, phys_reg_ptr->Name().c_str(), phys_reg_ptr->InitialValue(phys_reg_mask), phys_reg_mask);
+      RegisterWrite reg_write;
+      reg_write.mpName = phys_reg_ptr->Name().c_str();
+      reg_write.mRegisterId = (uint32(phys_reg_ptr->RegisterType()) << 28) + phys_reg_ptr->IndexValue();
+      reg_write.mSubIndex = phys_reg_ptr->SubIndexValue();
+      reg_write.mValue = phys_reg_ptr->InitialValue(phys_reg_mask);
+      reg_write.mMask = phys_reg_mask;
+      mRegisterWrites.push_back(reg_write);
+    }
+    mPhysicalRegisterInits.Clear();
+
+    if (not mRegisterWrites.empty()) {
+      sim_ptr->WriteRegisters(mpGenerator->ThreadId(), mRegisterWrites.data(), mRegisterWrites.size());
     }
 
-    // memory inits include the instruction opcode and memory associated with a load/store...
-    auto record_archive = mpGenerator->GetRecordArchive();
-    vector<MemoryInitRecord* > memory_records;
-    record_archive->SwapMemoryInitRecords(memory_records);
-    for (auto mem_rd : memory_records) {
-      sim_ptr->WritePhysicalMemory(mem_rd->MemoryId(), mem_rd->Address(), mem_rd->Size(), mem_rd->InitData());
-      delete mem_rd;
+    // memory inits include the instruction opcode and memory associated with a load/store, adjacent ones merged into one write...
+    const MemoryInitLog& mem_init_log = mpGenerator->GetRecordArchive()->FlushMemoryInitRecords();
+    for (const auto& log_entry : mem_init_log.Entries()) {
+      sim_ptr->WritePhysicalMemory(log_entry.mMemoryId, log_entry.mAddress, log_entry.mSize, mem_init_log.EntryData(log_entry));
     }
   }
 
@@ -358,7 +357,7 @@ namespace Force {
       StepInstructionWithSimulation();
     }
 
-    if (!pInstr->NoBnt()) {
+    if (!pInstr->NoBnt() and !mpGenerator->NoBnt()) {
       uint32 instr_bytes = pInstr->ByteSize();
       bnt_node->UpdateAccurateState(mpGenerator, instr_bytes);
       auto bnt_hook =  mpGenerator->GetBntHookManager()->GetBntHook();
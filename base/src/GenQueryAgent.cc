@@ -312,6 +312,7 @@ namespace Force {
     const Instruction *instr_ptr = instr_res->LookupInstruction (bank, phys_addr);
 
     target_query->SetName(instr_ptr->FullName());
+    target_query->SetAssembly(instr_ptr->AssemblyText());
     target_query->SetOpcode(instr_ptr->Opcode());
     target_query->SetPA(phys_addr);
     target_query->SetBank(bank);
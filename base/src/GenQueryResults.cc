@@ -89,6 +89,7 @@ namespace Force {
 
     ret_dict["Opcode"] = py::int_(Opcode());
     ret_dict["Name"] = py::cast(Name());
+    ret_dict["Assembly"] = py::cast(Assembly());
     ret_dict["Group"] = py::cast(Group());
     ret_dict["PA"] = py::int_(PA());
     ret_dict["Bank"] = py::int_(Bank());
@@ -1303,14 +1303,14 @@ namespace Force {
   }
 
   GenPageRequest::GenPageRequest()
-    : GenVirtualMemoryRequest(EVmRequestType::GenPage), mVA(0), mIPA(0), mPA(0), mPageId(0), mAttributeMask(0), mGenBoolAttributes(0), mGenBoolAttrMask(0), mMemAccessType(EMemAccessType(0)),
+    : GenVirtualMemoryRequest(EVmRequestType::GenPage), mVA(0), mIPA(0), mPA(0), mPageId(0), mPreferredPA(0), mAttributeMask(0), mGenBoolAttributes(0), mGenBoolAttrMask(0), mMemAccessType(EMemAccessType(0)),
       mPageSizes(), mPteAttributes(), mGenAttributes(), mExceptionConstraints()
   {
 
   }
 
   GenPageRequest::GenPageRequest(const GenPageRequest& rOther)
-    : GenVirtualMemoryRequest(rOther), mVA(rOther.mVA), mIPA(rOther.mIPA), mPA(rOther.mPA), mPageId(rOther.mPageId), mAttributeMask(rOther.mAttributeMask), mGenBoolAttributes(rOther.mGenBoolAttributes), mGenBoolAttrMask(rOther.mGenBoolAttrMask),
+    : GenVirtualMemoryRequest(rOther), mVA(rOther.mVA), mIPA(rOther.mIPA), mPA(rOther.mPA), mPageId(rOther.mPageId), mPreferredPA(rOther.mPreferredPA), mAttributeMask(rOther.mAttributeMask), mGenBoolAttributes(rOther.mGenBoolAttributes), mGenBoolAttrMask(rOther.mGenBoolAttrMask),
       mMemAccessType(rOther.mMemAccessType), mPageSizes(), mPteAttributes(), mGenAttributes(), mExceptionConstraints(rOther.mExceptionConstraints)
   {
     transform(rOther.mPageSizes.begin(), rOther.mPageSizes.end(), back_inserter(mPageSizes), [](PageSizeInfo* ps_info) { return new PageSizeInfo(*ps_info); });
@@ -1472,6 +1472,9 @@ namespace Force {
     case EPageRequestAttributeType::AliasPageId:
       value = mPageId;
       break;
+    case EPageRequestAttributeType::PreferredPA:
+      value = mPreferredPA;
+      break;
     case EPageRequestAttributeType::PageSize:
     case EPageRequestAttributeType::MemAttrArch:
     case EPageRequestAttributeType::MemAttrImpl:
@@ -1501,6 +1504,9 @@ namespace Force {
     case EPageRequestAttributeType::AliasPageId:
       mPageId = value;
       break;
+    case EPageRequestAttributeType::PreferredPA:
+      mPreferredPA = value;
+      break;
     default:
       LOG(fail) << "{GenPageRequest::SetAttributeValue} unexpected attribute case: " << EPageRequestAttributeType_to_string(attrType) << endl;
       FAIL("unexpected-attribute-case");
@@ -28,6 +28,7 @@
 #include "ChoicesModerator.h"
 #include "Config.h"
 #include "Constraint.h"
+#include "ExceptionRecords.h"
 #include "GenAgent.h"
 #include "GenCondition.h"
 #include "GenInstructionAgent.h"
@@ -41,6 +42,7 @@
 #include "InstructionResults.h"
 #include "InstructionSet.h"
 #include "Log.h"
+#include "MemoryFootprint.h"
 #include "MemoryManager.h"
 #include "MemoryReservation.h"
 #include "PageRequestRegulator.h"
@@ -286,7 +288,15 @@ namespace Force {
     else {
       mpRegisterFile->InitializeReadOnlyRegistersNoISS();
     }
-    mpRegisterFile->SignUp(instr_agent);
+
+    if (HasISS()) {
+      mpRegisterFile->SignUp(instr_agent);
+    }
+    else {
+      // without an ISS, initializations only update the generator state, so neither register initializations nor memory
+      // init records need to be kept for sending.
+      mpRecordArchive->SetRetainMemoryInitRecords(false);
+    }
 
     mpRegisterFile->GetConditionSet()->SignUp();
 
@@ -386,6 +396,7 @@ namespace Force {
   void Generator::GenSummary()
   {
     mpThreadInstructionResults->GenSummary();
+    mpRecordArchive->LogSummary();
   }
 
   void Generator::ProcessGenRequest(GenRequest* genRequest)
@@ -489,6 +500,7 @@ namespace Force {
   void Generator::InitializeMemory(const MemoryInitRecord* memInitRecord)
   {
     mpMemoryManager->InitializeMemory(memInitRecord);
+    mpRecordArchive->ReleaseMemoryInitRecord(memInitRecord);
   }
 
   void Generator::SetStateValue(EGenStateType stateType, uint64 value)
@@ -548,6 +560,23 @@ namespace Force {
     InitializeMemory(mem_init_data);
   }
 
+  void Generator::InitializeInstructions(uint64 addr, uint32 bank, uint32 instrSize, const vector<uint64>& opcodes, const vector<string>& names, const vector<string>& asmTexts)
+  {
+    if ((names.size() != opcodes.size()) or (asmTexts.size() != opcodes.size())) {
+      LOG(fail) << "{Generator::InitializeInstructions} " << dec << opcodes.size() << " opcodes given with " << names.size() << " names and " << asmTexts.size() << " assembly texts." << endl;
+      FAIL("initialize-instructions-size-mismatch");
+    }
+
+    // the opcodes are written the way committed instructions are, one element per instruction, and listed in the instruction results.
+    uint64 instr_addr = addr;
+    for (uint32 i = 0; i < opcodes.size(); ++ i) {
+      InitializeMemoryWithEndian(instr_addr, bank, instrSize, opcodes[i], true, IsInstructionBigEndian());
+      auto placed_instr = new PlacedInstruction(GetInstructionStructure(names[i]), opcodes[i], asmTexts[i]);
+      mpThreadInstructionResults->PlaceInstruction(bank, instr_addr, placed_instr);
+      instr_addr += instrSize;
+    }
+  }
+
   void Generator::ReserveMemory(const string& name, const string& range, uint32 bank, bool isVirtual)
   {
     MemoryReservation * mem_reserv = new MemoryReservation(name);
@@ -1137,6 +1166,11 @@ namespace Force {
     return mpGenMode->RestoreStateLoop();
   }
 
+  bool Generator::NoBnt() const
+  {
+    return mpGenMode->NoBnt();
+  }
+
   void Generator::ModifyVariable(const string& name, const string& value, EVariableType var_type)
   {
     auto var_mod = GetVariableModerator(var_type);
@@ -1189,6 +1223,23 @@ namespace Force {
     imagePrinter->PrintRegistersImage(output_name_img, thread_info, mpRegisterFile);
   }
 
+  void Generator::AccountMemoryFootprint(MemoryFootprint& rFootprint) const
+  {
+    mpThreadInstructionResults->AccountMemoryFootprint(rFootprint);
+    mpBntNodeManager->AccountMemoryFootprint(rFootprint);
+    mpRecordArchive->AccountMemoryFootprint(rFootprint);
+    mpExceptionRecordManager->AccountMemoryFootprint(rFootprint);
+  }
+
+  void Generator::Compact(uint32 exceptionRecordLimit)
+  {
+    uint32 retired_bnt_count = mpBntNodeManager->RetireBntNodes(this);
+    uint32 retired_exception_count = (exceptionRecordLimit != 0) ? mpExceptionRecordManager->RetireRecords(exceptionRecordLimit) : 0;
+    uint32 released_record_count = mpRecordArchive->ReleaseUnusedStorage();
+
+    LOG(notice) << "{Generator::Compact} thread " << dec << mThreadId << " retired " << retired_bnt_count << " Bnt nodes and " << retired_exception_count << " exception records, released " << released_record_count << " memory init records" << endl;
+  }
+
   void Generator::SolveAddressShortage()
   {
     // clear AddressShortage flag to avoid infinite loop.
@@ -17,11 +17,14 @@
 
 #include <fmt.h>
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <set>
 #include <sstream>
 #include <vector>
 
+#include "BinaryImage.h"
 #include "Config.h"
 #include "Log.h"
 #include "Memory.h"
@@ -125,21 +128,106 @@ namespace Force {
     uint32 mThreadId;                                //!< the current thread id.
   };
 
+  /*!
+    \class ImagePrinter
+    \brief base class of image printers, collecting the memory sections and register values to print.
+  */
   class ImagePrinter {
   public:
-    ImagePrinter() : mImageFile(), mPrinted() { } //!< Constructor
-    virtual ~ImagePrinter(); //!< Destructor
-    void PrintMemoryImage(const string& imageFile, const Memory* memory);  //!< write memory initial data to an image file.
-    void PrintRegistersImage(const string& imageFile, const map<string, uint64>& threadInfo, const RegisterFile* regFile); //!< write registers initial value to an Text file.
+    ImagePrinter() : mPrinted() { } //!< Constructor
+    virtual ~ImagePrinter() { } //!< Destructor
+    void PrintMemoryImage(const string& imageFile, const Memory* memory, uint64 entryPoint);  //!< write memory initial data to an image file.
+    void PrintRegistersImage(const string& imageFile, const map<string, uint64>& threadInfo, const RegisterFile* regFile); //!< write registers initial value to an image file.
+    virtual void Close() = 0; //!< Finish writing the registers image file.
+  protected:
+    virtual void BeginMemoryImage(const string& imageFile, uint32 memBank, uint64 entryPoint) = 0; //!< Start writing a memory image file.
+    virtual void PrintInitialMemorySection(EMemDataType type, uint64 address, uint32 size, const uint8* data) = 0; //!< print initial memory section.
+    virtual void EndMemoryImage() = 0; //!< Finish writing the memory image file.
+    virtual void BeginRegistersImage(const string& imageFile) = 0; //!< Start writing the registers of a thread to the image file.
+    virtual void PrintThreadInfo(uint32 threadId, const map<string, uint64>& threadInfo) = 0; //!< write thread info to the image file.
+    virtual void PrintThreadImageSegment(const ThreadImageSegment* pSegment) = 0; //!< print thread image segment.
+    virtual void EndRegistersImage() = 0; //!< Finish writing the registers of a thread.
   private:
-    void PrintInitialMemorySection(EMemDataType type, uint64 address, uint32 size, const uint8* data); //!< print initial memory section.
     static void SetupThreadImageSegment(const Register* pReg, const RegisterFile* regFile, ThreadImageSegment* pSegment); //!< set up thread image segment.
-    void PrintThreadImageSegment(const ThreadImageSegment* pSegment); //!< print thread image segment.
+  private:
+    set<string> mPrinted; //!< already printed name.
+  };
+
+  /*!
+    \class TextImagePrinter
+    \brief printer of image files in text format.
+  */
+  class TextImagePrinter : public ImagePrinter {
+  public:
+    TextImagePrinter() : ImagePrinter(), mImageFile() { } //!< Constructor
+    ~TextImagePrinter() override; //!< Destructor
+    void Close() override; //!< Close the registers image file.
+  protected:
+    void BeginMemoryImage(const string& imageFile, uint32 memBank, uint64 entryPoint) override; //!< Start writing a memory image file.
+    void PrintInitialMemorySection(EMemDataType type, uint64 address, uint32 size, const uint8* data) override; //!< print initial memory section.
+    void EndMemoryImage() override; //!< Finish writing the memory image file.
+    void BeginRegistersImage(const string& imageFile) override; //!< Start writing the registers of a thread to the image file.
+    void PrintThreadInfo(uint32 threadId, const map<string, uint64>& threadInfo) override; //!< write thread info to the Text file.
+    void PrintThreadImageSegment(const ThreadImageSegment* pSegment) override; //!< print thread image segment.
+    void EndRegistersImage() override { } //!< Finish writing the registers of a thread.
+  private:
     bool OpenImageFile(const string& imageFile); //!< Open image file.
-    void PrintThreadInfo(const map<string, uint64>& threadInfo); //!< write thread info to the Text file.
   private:
     ofstream mImageFile; //!< image file output stream.
-    set<string> mPrinted; //!< already printed name.
+  };
+
+  /*!
+    \class BinaryImagePrinter
+    \brief printer of image files in binary format.
+  */
+  class BinaryImagePrinter : public ImagePrinter {
+  public:
+    BinaryImagePrinter() : ImagePrinter(), mWriter(), mRegistersFile(), mRegistersHead(), mThreadId(0), mRegisterEntries() { } //!< Constructor
+    ~BinaryImagePrinter() { } //!< Destructor
+    void Close() override; //!< Write the registers image file with the registers of all threads.
+  protected:
+    void BeginMemoryImage(const string& imageFile, uint32 memBank, uint64 entryPoint) override; //!< Start writing a memory image file.
+    void PrintInitialMemorySection(EMemDataType type, uint64 address, uint32 size, const uint8* data) override; //!< print initial memory section.
+    void EndMemoryImage() override; //!< Finish writing the memory image file.
+    void BeginRegistersImage(const string& imageFile) override; //!< Start writing the registers of a thread to the image file.
+    void PrintThreadInfo(uint32 threadId, const map<string, uint64>& threadInfo) override; //!< Add thread info of the thread.
+    void PrintThreadImageSegment(const ThreadImageSegment* pSegment) override; //!< Add a register value of the thread.
+    void EndRegistersImage() override { } //!< Finish adding the registers of a thread.
+  private:
+    /*!
+      \struct RegisterEntry
+      \brief thread info or register value to be written to the registers image file.
+    */
+    struct RegisterEntry {
+      uint32 mThreadId; //!< Thread ID.
+      char mFlag; //!< 'V' for thread info, 'R' for registers.
+      string mName; //!< Name of the thread info or register.
+      vector<SegmentDataUnit> mValues; //!< Value units.
+    };
+
+    BinaryImageWriter mWriter; //!< Image file writer.
+    string mRegistersFile; //!< Path of the registers image file.
+    string mRegistersHead; //!< Head text of the registers image file.
+    uint32 mThreadId; //!< ID of the thread being printed.
+    vector<RegisterEntry> mRegisterEntries; //!< Thread info and register values of the threads printed since the registers image file was last written.
+  };
+
+  /*!
+    \class BinaryImageLoader
+    \brief loader of image files in binary format, reading the payloads in place from the mapped file.
+  */
+  class BinaryImageLoader {
+  public:
+    BinaryImageLoader() : mImageFile() { } //!< Constructor
+    ~BinaryImageLoader() { } //!< Destructor
+    ASSIGNMENT_OPERATOR_ABSENT(BinaryImageLoader);
+    COPY_CONSTRUCTOR_ABSENT(BinaryImageLoader);
+    bool IsLoaded(const string& imageFile) const { return mImageFile.IsLoaded(imageFile); } //!< Return true if the image file is loaded.
+    void Load(const string& imageFile) { mImageFile.Load(imageFile); } //!< Map the image file.
+    void WriteToMemory(Memory* memory) const; //!< write memory.
+    void WriteToThread(map<string, uint64>& threadInfo, RegisterFile* registerFile) const; //!< write thread info.
+  private:
+    BinaryImageFile mImageFile; //!< The mapped image file.
   };
 
   ImageLoader::~ImageLoader()
@@ -324,14 +412,93 @@ namespace Force {
     return nullptr;
   }
 
-  ImagePrinter::~ImagePrinter()
+  void ImagePrinter::PrintMemoryImage(const string& imageFile, const Memory* memory, uint64 entryPoint)
+  {
+    BeginMemoryImage(imageFile, uint32(memory->MemoryBankType()), entryPoint);
+
+    vector<Section> sections;
+    memory->GetSections(sections);
+    vector<uint8> data;
+    for (auto const& rSection : sections) {
+      data.resize(rSection.mSize);
+      memory->ReadPartiallyInitialized(rSection.mAddress, rSection.mSize, data.data());
+      PrintInitialMemorySection(rSection.mType, rSection.mAddress, rSection.mSize, data.data());
+    }
+    EndMemoryImage();
+  }
+
+  void ImagePrinter::SetupThreadImageSegment(const Register* pReg, const RegisterFile* regFile, ThreadImageSegment* pSegment)
+  {
+    set<PhysicalRegister* > phys_regs_set;
+    pReg->GetPhysicalRegisters(phys_regs_set);
+    pSegment->mFlag = "R";
+
+    auto reg_type = pReg->RegisterType();
+    switch (reg_type) {
+    case ERegisterType::SIMDVR:
+    case ERegisterType::VECREG:
+    case ERegisterType::PREDREG:
+      pSegment->mName = pReg->Name();
+      for (auto riter = phys_regs_set.rbegin(); riter != phys_regs_set.rend(); ++riter) {
+        auto phys_reg_ptr = *riter;
+        pSegment->AddValueUnit(phys_reg_ptr->InitialValue(phys_reg_ptr->Mask()), phys_reg_ptr->Size()/8);
+      }
+      break;
+    default:
+      if (phys_regs_set.size() > 1) {
+        LOG(fail) << "have multi physical registers" << endl;;
+        FAIL("multi-physical-registers");
+      }
+      for (auto phys_reg_ptr : phys_regs_set) {
+        pSegment->mName = phys_reg_ptr->Name();
+        pSegment->AddValueUnit(phys_reg_ptr->InitialValue(pReg->GetPhysicalRegisterMask(*phys_reg_ptr)), phys_reg_ptr->Size()/8);
+      }
+      break;
+    }
+  }
+
+  void ImagePrinter::PrintRegistersImage(const string& imageFile, const map<string, uint64>& threadInfo, const RegisterFile* regFile)
+  {
+    auto thread_id_iter = threadInfo.find("ThreadID");
+    if (thread_id_iter == threadInfo.end())
+    {
+      LOG(fail) << "Can't find the thread ID in threadInfo" << endl;;
+      FAIL("can-not-find-thread-id");
+    }
+
+    BeginRegistersImage(imageFile);
+    PrintThreadInfo(thread_id_iter->second, threadInfo);
+
+    auto registers = regFile->Registers();
+    list<Register*> initialized_regs;
+    for (auto map_iter = registers.begin(); map_iter != registers.end(); ++map_iter)
+    {
+      if (map_iter->second->Boot() and map_iter->second->IsInitialized())
+      {
+        initialized_regs.push_back(map_iter->second);
+      }
+    }
+
+    for (auto reg_ptr : initialized_regs) {
+      ThreadImageSegment image_segment;
+      SetupThreadImageSegment(reg_ptr, regFile, &image_segment);
+      if (mPrinted.find(image_segment.Name()) == mPrinted.end())
+      {
+        PrintThreadImageSegment(&image_segment);
+        mPrinted.insert(image_segment.Name());
+      }
+    }
+    EndRegistersImage();
+  }
+
+  TextImagePrinter::~TextImagePrinter()
   {
     if (mImageFile.is_open()) {
       mImageFile.close();
     }
   }
 
-  bool ImagePrinter::OpenImageFile(const string& imageFile)
+  bool TextImagePrinter::OpenImageFile(const string& imageFile)
   {
     if (not mImageFile.is_open())
     {
@@ -349,7 +516,21 @@ namespace Force {
     }
   }
 
-  void ImagePrinter::PrintInitialMemorySection(EMemDataType type, uint64 address, uint32 size, const uint8* data)
+  void TextImagePrinter::Close()
+  {
+    if (mImageFile.is_open()) {
+      mImageFile.close();
+    }
+  }
+
+  void TextImagePrinter::BeginMemoryImage(const string& imageFile, uint32 memBank, uint64 entryPoint)
+  {
+    OpenImageFile(imageFile);
+    mImageFile << Config::Instance()->HeadOfImage() << endl;
+    mImageFile << "# Initializations " << " Memory" << endl;
+  }
+
+  void TextImagePrinter::PrintInitialMemorySection(EMemDataType type, uint64 address, uint32 size, const uint8* data)
   {
     string data_type_str = (type == EMemDataType::Instruction) ? "I" : "D";
     mImageFile << data_type_str << " " << fmtx0(address, 16) << " " << fmtd(size, 4) << " " ;
@@ -377,23 +558,20 @@ namespace Force {
     mImageFile << endl;
   }
 
-  void ImagePrinter::PrintMemoryImage(const string& imageFile, const Memory* memory)
+  void TextImagePrinter::EndMemoryImage()
   {
-    OpenImageFile(imageFile);
-    mImageFile << Config::Instance()->HeadOfImage() << endl;
-    mImageFile << "# Initializations " << " Memory" << endl;
+    mImageFile.close();
+  }
 
-    vector<Section> sections;
-    memory->GetSections(sections);
-    for (auto const& rSection : sections) {
-      uint8 data[rSection.mSize];
-      memory->ReadPartiallyInitialized(rSection.mAddress, rSection.mSize, (uint8*)data);
-      PrintInitialMemorySection(rSection.mType, rSection.mAddress, rSection.mSize, data);
+  void TextImagePrinter::BeginRegistersImage(const string& imageFile)
+  {
+    if (OpenImageFile(imageFile))
+    {
+      mImageFile << Config::Instance()->HeadOfImage() << endl;
     }
-    mImageFile.close();
   }
 
-  void ImagePrinter::PrintThreadImageSegment(const ThreadImageSegment* pSegment)
+  void TextImagePrinter::PrintThreadImageSegment(const ThreadImageSegment* pSegment)
   {
     mImageFile << pSegment->Flag() << " " << fmt(pSegment->Name(), 14).left() << " ";
     auto values = pSegment->Values();
@@ -403,99 +581,185 @@ namespace Force {
     mImageFile << endl;
   }
 
-  void ImagePrinter::SetupThreadImageSegment(const Register* pReg, const RegisterFile* regFile, ThreadImageSegment* pSegment)
+  void TextImagePrinter::PrintThreadInfo(uint32 threadId, const map<string, uint64>& threadInfo)
   {
-    set<PhysicalRegister* > phys_regs_set;
-    pReg->GetPhysicalRegisters(phys_regs_set);
-    pSegment->mFlag = "R";
-
-    auto reg_type = pReg->RegisterType();
-    switch (reg_type) {
-    case ERegisterType::SIMDVR:
-    case ERegisterType::VECREG:
-    case ERegisterType::PREDREG:
-      pSegment->mName = pReg->Name();
-      for (auto riter = phys_regs_set.rbegin(); riter != phys_regs_set.rend(); ++riter) {
-        auto phys_reg_ptr = *riter;
-        pSegment->AddValueUnit(phys_reg_ptr->InitialValue(phys_reg_ptr->Mask()), phys_reg_ptr->Size()/8);
-      }
-      break;
-    default:
-      if (phys_regs_set.size() > 1) {
-        LOG(fail) << "have multi physical registers" << endl;;
-        FAIL("multi-physical-registers");
-      }
-      for (auto phys_reg_ptr : phys_regs_set) {
-        pSegment->mName = phys_reg_ptr->Name();
-        pSegment->AddValueUnit(phys_reg_ptr->InitialValue(pReg->GetPhysicalRegisterMask(*phys_reg_ptr)), phys_reg_ptr->Size()/8);
+    mImageFile << "# Thread " << threadId << " Registers Initializations" << endl;
+    mImageFile << "T " << threadId << endl;
+    for (auto info_iter = threadInfo.begin(); info_iter != threadInfo.end(); ++info_iter) {
+      if (info_iter->first != "ThreadID")
+      {
+        mImageFile << "V " << fmt(info_iter->first, 14).left() << " " << fmtx0(info_iter->second, 16) << endl;
       }
-      break;
     }
   }
 
-  void ImagePrinter::PrintThreadInfo(const map<string, uint64>& threadInfo)
+  void BinaryImagePrinter::BeginMemoryImage(const string& imageFile, uint32 memBank, uint64 entryPoint)
   {
-    auto thread_id_iter = threadInfo.find("ThreadID");
-    if (thread_id_iter == threadInfo.end())
-    {
-      LOG(fail) << "Can't find the thread ID in threadInfo" << endl;;
-      FAIL("can-not-find-thread-id");
+    mWriter.Open(imageFile, Config::Instance()->HeadOfImage());
+    mWriter.SetMemoryBank(memBank);
+    mWriter.SetEntryPoint(entryPoint);
+  }
+
+  void BinaryImagePrinter::PrintInitialMemorySection(EMemDataType type, uint64 address, uint32 size, const uint8* data)
+  {
+    mWriter.AppendSection((type == EMemDataType::Instruction) ? 'I' : 'D', address, size, data);
+  }
+
+  void BinaryImagePrinter::EndMemoryImage()
+  {
+    mWriter.Close();
+  }
+
+  void BinaryImagePrinter::BeginRegistersImage(const string& imageFile)
+  {
+    if (imageFile != mRegistersFile) {
+      Close();
+      mRegistersFile = imageFile;
+      mRegistersHead = Config::Instance()->HeadOfImage();
     }
+  }
 
-    mImageFile << "# Thread " << thread_id_iter->second << " Registers Initializations" << endl;
-    mImageFile << "T " << thread_id_iter->second << endl;
+  void BinaryImagePrinter::PrintThreadInfo(uint32 threadId, const map<string, uint64>& threadInfo)
+  {
+    mThreadId = threadId;
     for (auto info_iter = threadInfo.begin(); info_iter != threadInfo.end(); ++info_iter) {
       if (info_iter->first != "ThreadID")
       {
-        mImageFile << "V " << fmt(info_iter->first, 14).left() << " " << fmtx0(info_iter->second, 16) << endl;
+        RegisterEntry info_entry = {threadId, 'V', info_iter->first, {SegmentDataUnit(info_iter->second, 8)}};
+        mRegisterEntries.push_back(info_entry);
       }
     }
   }
 
-  void ImagePrinter::PrintRegistersImage(const string& imageFile, const map<string, uint64>& threadInfo, const RegisterFile* regFile)
+  void BinaryImagePrinter::PrintThreadImageSegment(const ThreadImageSegment* pSegment)
   {
-    if (OpenImageFile(imageFile))
-    {
-      mImageFile << Config::Instance()->HeadOfImage() << endl;
+    RegisterEntry register_entry = {mThreadId, pSegment->Flag().at(0), pSegment->Name(), pSegment->Values()};
+    mRegisterEntries.push_back(register_entry);
+  }
+
+  void BinaryImagePrinter::Close()
+  {
+    // the tables follow the payloads, so the file is written once with the registers of all threads.
+    if (mRegisterEntries.empty()) {
+      return;
     }
 
-    PrintThreadInfo(threadInfo);
+    mWriter.Open(mRegistersFile, mRegistersHead);
+    vector<uint64> value_units;
+    for (auto const& rEntry : mRegisterEntries) {
+      value_units.clear();
+      for (auto const& rValue : rEntry.mValues) {
+        value_units.push_back(rValue.mData);
+      }
+      uint32 value_size = rEntry.mValues.empty() ? 8 : rEntry.mValues.front().mSize;
+      mWriter.AppendRegister(rEntry.mThreadId, rEntry.mFlag, rEntry.mName, value_units, value_size);
+    }
+    mWriter.Close();
+    mRegisterEntries.clear();
+  }
 
-    auto registers = regFile->Registers();
-    list<Register*> initialized_regs;
-    for (auto map_iter = registers.begin(); map_iter != registers.end(); ++map_iter)
-    {
-      if (map_iter->second->Boot() and map_iter->second->IsInitialized())
-      {
-        initialized_regs.push_back(map_iter->second);
+  void BinaryImageLoader::WriteToMemory(Memory* memory) const
+  {
+    const BinaryImageHeader* header = mImageFile.Header();
+    const BinaryImageSection* sections = mImageFile.Sections();
+    for (uint32 i = 0; i < header->mSectionCount; ++ i) {
+      const BinaryImageSection& section = sections[i];
+      const uint8* data = mImageFile.Payload(section.mDataOffset, section.mSize);
+      EMemDataType type = (section.mType == 'I') ? EMemDataType::Instruction : EMemDataType::Data;
+      for (uint64 offset = 0; offset < section.mSize; offset += 8) {
+        uint32 size = (section.mSize - offset < 8) ? (section.mSize - offset) : 8;
+        uint64 value = 0;
+        for (uint32 byte_index = 0; byte_index < size; ++ byte_index) {
+          value = (value << 8) | data[offset + byte_index];
+        }
+        memory->Initialize(section.mAddress + offset, value, size, type);
       }
     }
+  }
 
-    for (auto reg_ptr : initialized_regs) {
-      ThreadImageSegment image_segment;
-      SetupThreadImageSegment(reg_ptr, regFile, &image_segment);
-      if (mPrinted.find(image_segment.Name()) == mPrinted.end())
+  void BinaryImageLoader::WriteToThread(map<string, uint64>& threadInfo, RegisterFile* registerFile) const
+  {
+    auto it = threadInfo.find("ThreadID");
+    if (it == threadInfo.end())
+    {
+      LOG(fail) << "Can't find the thread ID in threadInfo" << endl;
+      FAIL("can-not-find-thread-id");
+    }
+
+    const BinaryImageHeader* header = mImageFile.Header();
+    const BinaryImageRegister* registers = mImageFile.Registers();
+    bool thread_found = false;
+    for (uint32 i = 0; i < header->mRegisterCount; ++ i) {
+      const BinaryImageRegister& register_entry = registers[i];
+      if (register_entry.mThreadId != it->second) {
+        continue;
+      }
+      thread_found = true;
+
+      string name(reinterpret_cast<const char*>(mImageFile.Payload(register_entry.mNameOffset, register_entry.mNameSize)), register_entry.mNameSize);
+      const uint64* values = reinterpret_cast<const uint64*>(mImageFile.Payload(register_entry.mValuesOffset, register_entry.mValueCount * sizeof(uint64)));
+      if (register_entry.mValueCount == 0) {
+        continue;
+      }
+
+      if (register_entry.mFlag == 'V')
       {
-        PrintThreadImageSegment(&image_segment);
-        mPrinted.insert(image_segment.Name());
+        threadInfo[name] = values[0];
+      }
+      else if (register_entry.mValueCount > 1)
+      {
+        // name is a logical register name, with the value units in the order they are printed
+        vector<uint64> reg_values(values, values + register_entry.mValueCount);
+        reverse(reg_values.begin(), reg_values.end());
+        registerFile->InitializeRegister(name, reg_values, nullptr);
       }
+      else
+      {
+        auto phys_register = registerFile->PhysicalRegisterLookup(name);
+        phys_register->Initialize(values[0], phys_register->Mask());
+      }
+    }
+
+    if (not thread_found)
+    {
+      LOG(fail) << "Can't find threadId " << it->second << endl;
+      FAIL("can-not-find-thread");
     }
   }
 
-  ImageIO::ImageIO(): mpImagePrinter(nullptr), mpImageLoader(nullptr)
+  ImageIO::ImageIO(bool binaryFormat): mpImagePrinter(nullptr), mpImageLoader(nullptr), mpBinaryImageLoader(nullptr)
   {
-    mpImagePrinter = new ImagePrinter;
+    if (binaryFormat) {
+      mpImagePrinter = new BinaryImagePrinter;
+    }
+    else {
+      mpImagePrinter = new TextImagePrinter;
+    }
     mpImageLoader = new ImageLoader;
+    mpBinaryImageLoader = new BinaryImageLoader;
   }
 
   ImageIO::~ImageIO()
   {
     delete mpImagePrinter;
     delete mpImageLoader;
+    delete mpBinaryImageLoader;
+  }
+
+  bool ImageIO::IsBinaryImage(const string& imageFile)
+  {
+    return BinaryImageFile::IsBinaryImage(imageFile);
   }
 
   void ImageIO::LoadMemoryImage(const string& imageFile, Memory* memory)
   {
+    if (IsBinaryImage(imageFile)) {
+      BinaryImageLoader image_loader;
+      image_loader.Load(imageFile);
+      image_loader.WriteToMemory(memory);
+      return;
+    }
+
     ImageLoader image_loader;
     image_loader.Load(imageFile);
     image_loader.WriteToMemory(memory);
@@ -503,15 +767,23 @@ namespace Force {
 
   void ImageIO::LoadRegistersImage(const string& imageFile, map<string, uint64>& threadInfo, RegisterFile* registerFile)
   {
+    if (mpBinaryImageLoader->IsLoaded(imageFile) or IsBinaryImage(imageFile)) {
+      if (not mpBinaryImageLoader->IsLoaded(imageFile)) {
+        mpBinaryImageLoader->Load(imageFile);
+      }
+      mpBinaryImageLoader->WriteToThread(threadInfo, registerFile);
+      return;
+    }
+
     if (!mpImageLoader->IsOpen()) {
       mpImageLoader->Load(imageFile);
     }
     mpImageLoader->WriteToThread(threadInfo, registerFile);
   }
 
-  void ImageIO::PrintMemoryImage(const string& imageFile, const Memory* memory)
+  void ImageIO::PrintMemoryImage(const string& imageFile, const Memory* memory, uint64 entryPoint)
   {
-    mpImagePrinter->PrintMemoryImage(imageFile, memory);
+    mpImagePrinter->PrintMemoryImage(imageFile, memory, entryPoint);
   }
 
   void ImageIO::PrintRegistersImage(const string& imageFile, const map<string, uint64>& threadInfo, const RegisterFile* regFile)
@@ -519,4 +791,9 @@ namespace Force {
     mpImagePrinter->PrintRegistersImage(imageFile, threadInfo, regFile);
   }
 
+  void ImageIO::Close()
+  {
+    mpImagePrinter->Close();
+  }
+
 }
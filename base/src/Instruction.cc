@@ -363,6 +363,13 @@ namespace Force {
     return cast_iconstr->GetLoadStoreOperand()->GetPrePostAmbleRequests(gen);
   }
 
+  PlacedInstruction::PlacedInstruction(const InstructionStructure* pStructure, uint32 opcode, const string& rAssemblyText)
+    : Instruction(), mAssemblyText(rAssemblyText)
+  {
+    mpStructure = pStructure;
+    mOpcode = opcode;
+  }
+
   void UnpredictStoreInstruction::Generate(Generator& gen)
   {
     LoadStoreInstruction::Generate(gen);
@@ -24,6 +24,8 @@
 #include "Generator.h"
 #include "Instruction.h"
 #include "Log.h"
+#include "MemoryFootprint.h"
+#include "Operand.h"
 #include "Record.h"
 #include "UtilityFunctions.h"
 
@@ -126,6 +128,12 @@ namespace Force {
     mCurAddrValid = true;
   }
 
+  void ThreadInstructionResults::PlaceInstruction(uint32 bank, uint64 pa, Instruction* instr)
+  {
+    // placed instructions are not executed, so the current instruction bank and address are left alone.
+    mBanks[bank]->AddInstruction(pa, instr);
+  }
+
   bool ThreadInstructionResults::Commit(Generator* gen, Instruction* instr)
   {
     auto gen_pc = gen->GetGenPC();
@@ -194,6 +202,25 @@ namespace Force {
     return mBanks.size();
   }
 
+  uint64 ThreadInstructionResults::GetTotalInstructionCount() const
+  {
+    return accumulate(mBanks.cbegin(), mBanks.cend(), uint64(0),
+      [](cuint64 count, const InstructionResultsBank* pBank) { return count + pBank->GetInstructionCount(); });
+  }
+
+  void ThreadInstructionResults::AccountMemoryFootprint(MemoryFootprint& rFootprint) const
+  {
+    // Operand objects differ in size by type, so the base Operand size is used as an estimate.
+    for (auto instr_bank : mBanks) {
+      const map<uint64, Instruction* >& instructions = instr_bank->GetInstructions();
+      uint64 instr_bytes = MemoryFootprint::MapBytes(instructions);
+      for (const auto& instr_item : instructions) {
+        instr_bytes += sizeof(Instruction) + instr_item.second->NumberOfOperands() * (sizeof(Operand) + sizeof(Operand*));
+      }
+      rFootprint.Add("Instructions", instructions.size(), instr_bytes);
+    }
+  }
+
   void ThreadInstructionResults::GetCurrentInstructionRecordId (std::string& rec_id)
   {
     stringstream ss;
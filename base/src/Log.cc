@@ -15,6 +15,8 @@
 //
 #include "Log.h"
 
+#include <chrono>
+#include <iomanip>
 #include <iostream>
 
 #include "Dump.h"
@@ -25,12 +27,18 @@ namespace Force {
 
   Logger* gLog = nullptr;
   char* gSmallBuffer = nullptr;
+  static thread_local ostream* stpCaptureStream = nullptr; //!< Stream capturing the log output of the current thread, if any.
+
+  static double wall_time_seconds()
+  {
+    return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+  }
 
   /*!
     \class Logger
   */
   Logger::Logger(ostream& stream, ostream& errorStream, ostream& testStream)
-    : mOStream(stream), mErrorStream(errorStream), mTestStream(testStream), mLogLevel(LL::error)
+    : mOStream(stream), mErrorStream(errorStream), mTestStream(testStream), mLogLevel(LL::error), mStartTime(wall_time_seconds())
   {
   }
 
@@ -97,9 +105,24 @@ namespace Force {
     return LL::notice;
   }
 
+  /*!
+    Worker threads must not write to the shared output streams, they capture their log output and have it written with Output() by the
+    thread that owns the streams. FAIL on a capturing thread throws a DeferredFailure instead of dumping and exiting, for the owning thread
+    to report.
+  */
+  void Logger::CaptureThreadOutput(ostream* pStream)
+  {
+    stpCaptureStream = pStream;
+  }
+
   ostream& Logger::Stream(LL logLevel)
   {
     const char * heading = ll_to_string(logLevel);
+    if (nullptr != stpCaptureStream) {
+      *stpCaptureStream << heading;
+      return *stpCaptureStream;
+    }
+
     switch (logLevel)
     {
       case LL::fail:
@@ -115,6 +138,10 @@ namespace Force {
 
   void Logger::Fail(const char* msg, const char* fileName, int lineNo, const char* funcName)
   {
+    if (nullptr != stpCaptureStream) {
+      throw DeferredFailure(msg, fileName, lineNo, funcName);
+    }
+
 #ifndef UNIT_TEST
     mErrorStream << "[FAIL]{" << msg << "} in file \'" << fileName << "\' line " << dec << lineNo << " func \'" << funcName << "\'." << endl;
     if (mLogLevel < LL::error) {
@@ -131,11 +158,32 @@ namespace Force {
   void Logger::DumpFail(const char* msg, const char* fileName, int lineNo, const char* funcName)
   {
 #ifndef UNIT_TEST
-    Dump::Instance()->DumpInfo();
+    if (nullptr == stpCaptureStream) {
+      Dump::Instance()->DumpInfo();
+    }
 #endif
     Fail(msg, fileName, lineNo, funcName);
   }
 
+  /*!
+    Phase markers are logged regardless of the logging level so benchmark runners can split the run time into phases, the line is flushed
+    so a reader of the output stream sees it immediately.
+  */
+  void Logger::Phase(const char* phaseName)
+  {
+    mOStream << ll_to_string(LL::notice) << "{Logger::Phase} entering phase \"" << phaseName << "\" at " << fixed << setprecision(6) << (wall_time_seconds() - mStartTime) << " s" << defaultfloat << endl;
+  }
+
+  void Logger::Output(const string& rText)
+  {
+    mOStream << rText << flush;
+  }
+
+  void DeferredFailure::Report() const
+  {
+    gLog->DumpFail(mMessage.c_str(), mFileName.c_str(), mLineNo, mFuncName.c_str());
+  }
+
   void Logger::SetLevel(const char* logLevel)
   {
     LL log_level = string_to_ll(logLevel);
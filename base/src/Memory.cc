@@ -23,6 +23,7 @@
 
 #include "Config.h"
 #include "Log.h"
+#include "MemoryFootprint.h"
 #include "Random.h"
 #include "UtilityFunctions.h"
 
@@ -907,6 +908,11 @@ namespace Force {
     }
 
   }
+
+  void Memory::AccountMemoryFootprint(MemoryFootprint& rFootprint) const
+  {
+    rFootprint.Add("Memory chunks", mContent.size(), MemoryFootprint::MapBytes(mContent) + mContent.size() * sizeof(MemoryBytes));
+  }
 #endif
 
 }
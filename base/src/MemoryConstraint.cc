@@ -116,6 +116,13 @@ namespace Force {
     mpUsable->GetConstraintSet()->ReplaceInRange(lower, upper, rReplaceConstr);
   }
 
+  void MemoryConstraint::CommitCachedUpdates(cuint32 threadId) const
+  {
+    mpUsable->GetConstraintSet();
+    mpShared->GetConstraintSet();
+    CommitDataUsedUpdates(threadId);
+  }
+
   void MemoryConstraint::ApplyToConstraintSet(const EMemDataType memDataType, const EMemAccessType memAccessType, cuint32 threadId, const AddressReuseMode& rAddrReuseMode, ConstraintSet* constrSet) const
   {
     switch (memDataType) {
@@ -313,6 +320,14 @@ namespace Force {
     return mpDataWriteUsed->GetConstraintSet();
   }
 
+  void SingleThreadMemoryConstraint::CommitDataUsedUpdates(cuint32 threadId) const
+  {
+    if (threadId == mThreadId) {
+      mpDataReadUsed->GetConstraintSet();
+      mpDataWriteUsed->GetConstraintSet();
+    }
+  }
+
   MultiThreadMemoryConstraint::MultiThreadMemoryConstraint(cuint32 threadCount)
     : MemoryConstraint(), mDataReadUsedByThread(), mDataWriteUsedByThread()
   {
@@ -413,6 +428,19 @@ namespace Force {
     return itr->second->GetConstraintSet();
   }
 
+  void MultiThreadMemoryConstraint::CommitDataUsedUpdates(cuint32 threadId) const
+  {
+    auto read_itr = mDataReadUsedByThread.find(threadId);
+    if (read_itr != mDataReadUsedByThread.end()) {
+      read_itr->second->GetConstraintSet();
+    }
+
+    auto write_itr = mDataWriteUsedByThread.find(threadId);
+    if (write_itr != mDataWriteUsedByThread.end()) {
+      write_itr->second->GetConstraintSet();
+    }
+  }
+
   LargeConstraintSet::LargeConstraintSet()
     : mpConstraintSet(nullptr), mpCachedAdds(nullptr), mpCachedSubs(nullptr), mState(0)
   {
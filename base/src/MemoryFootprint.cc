@@ -0,0 +1,124 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "MemoryFootprint.h"
+
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+
+#include "Constraint.h"
+#include "Log.h"
+
+using namespace std;
+
+/*!
+  \file MemoryFootprint.cc
+  \brief Code for accounting and reporting the memory held by generator subsystems.
+*/
+
+namespace Force {
+
+  static double to_megabytes(uint64 bytes)
+  {
+    return bytes / (1024.0 * 1024.0);
+  }
+
+  void MemoryFootprint::Add(const string& rSubsystem, uint64 objects, uint64 bytes)
+  {
+    Usage& usage = mSubsystems[rSubsystem];
+    usage.mObjects += objects;
+    usage.mBytes += bytes;
+  }
+
+  void MemoryFootprint::AddConstraintSet(const string& rSubsystem, const ConstraintSet* pConstrSet)
+  {
+    if (nullptr == pConstrSet) {
+      return;
+    }
+
+    // Constraint objects are allocated individually; RangeConstraint is the larger of the two types.
+    const vector<Constraint* >& constraints = pConstrSet->GetConstraints();
+    Add(rSubsystem, 1, sizeof(ConstraintSet) + VectorBytes(constraints) + constraints.size() * sizeof(RangeConstraint));
+  }
+
+  uint64 MemoryFootprint::Objects(const string& rSubsystem) const
+  {
+    auto usage_finder = mSubsystems.find(rSubsystem);
+    return (usage_finder != mSubsystems.end()) ? usage_finder->second.mObjects : 0;
+  }
+
+  uint64 MemoryFootprint::Bytes(const string& rSubsystem) const
+  {
+    auto usage_finder = mSubsystems.find(rSubsystem);
+    return (usage_finder != mSubsystems.end()) ? usage_finder->second.mBytes : 0;
+  }
+
+  uint64 MemoryFootprint::TotalBytes() const
+  {
+    uint64 total_bytes = 0;
+    for (const auto& subsystem_usage : mSubsystems) {
+      total_bytes += subsystem_usage.second.mBytes;
+    }
+    return total_bytes;
+  }
+
+  void MemoryFootprint::Report(const string& rWhen) const
+  {
+    uint64 resident_bytes = 0;
+    uint64 peak_resident_bytes = 0;
+    stringstream summary_stream;
+    summary_stream << "{MemoryFootprint::Report} memory footprint " << rWhen << ": accounted " << fixed << setprecision(2) << to_megabytes(TotalBytes()) << " MB";
+    if (read_process_memory_usage(resident_bytes, peak_resident_bytes)) {
+      summary_stream << ", resident " << to_megabytes(resident_bytes) << " MB, peak resident " << to_megabytes(peak_resident_bytes) << " MB";
+    }
+    LOG(notice) << summary_stream.str() << endl;
+
+    for (const auto& subsystem_usage : mSubsystems) {
+      const Usage& usage = subsystem_usage.second;
+      stringstream usage_stream;
+      usage_stream << "{MemoryFootprint::Report}   " << left << setw(24) << subsystem_usage.first << right << setw(12) << usage.mObjects << " objects " << fixed << setprecision(2) << setw(10) << to_megabytes(usage.mBytes) << " MB";
+      LOG(notice) << usage_stream.str() << endl;
+    }
+  }
+
+  bool read_process_memory_usage(uint64& rResidentBytes, uint64& rPeakResidentBytes)
+  {
+    ifstream status_file("/proc/self/status");
+    if (not status_file) {
+      return false;
+    }
+
+    uint32 found = 0;
+    string field_name;
+    while ((found < 2) and (status_file >> field_name)) {
+      if (field_name == "VmRSS:") {
+        status_file >> rResidentBytes;
+        rResidentBytes *= 1024;
+        ++ found;
+      }
+      else if (field_name == "VmHWM:") {
+        status_file >> rPeakResidentBytes;
+        rPeakResidentBytes *= 1024;
+        ++ found;
+      }
+      status_file.ignore(numeric_limits<streamsize>::max(), '\n');
+    }
+
+    return (found == 2);
+  }
+
+}
@@ -27,6 +27,7 @@
 #include "Memory.h"
 #include "MemoryConstraint.h"
 #include "MemoryConstraintUpdate.h"
+#include "MemoryFootprint.h"
 #include "MemoryReservation.h"
 #include "MemoryTraits.h"
 #include "PageTableManager.h"
@@ -179,6 +180,11 @@ namespace Force {
     mpUsable->ApplyToConstraintSet(memDataType, memAccessType, threadId, rAddrReuseMode, constrSet);
   }
 
+  void MemoryBank::CommitUsableConstraint(cuint32 threadId) const
+  {
+    mpUsable->CommitCachedUpdates(threadId);
+  }
+
   void MemoryBank::SetupPageTableRegion()
   {
     if (nullptr != mpPhysicalPageManager) {
@@ -254,6 +260,20 @@ namespace Force {
     return allocated;
   }
 
+  void MemoryBank::AccountMemoryFootprint(MemoryFootprint& rFootprint) const
+  {
+    mpMemory->AccountMemoryFootprint(rFootprint);
+    rFootprint.AddConstraintSet("ConstraintSets", mpBaseConstraint);
+    rFootprint.AddConstraintSet("ConstraintSets", mpFree);
+    if (nullptr != mpUsable) {
+      rFootprint.AddConstraintSet("ConstraintSets", mpUsable->Usable());
+      rFootprint.AddConstraintSet("ConstraintSets", mpUsable->Shared());
+    }
+    if (nullptr != mpPhysicalPageManager) {
+      mpPhysicalPageManager->AccountMemoryFootprint(rFootprint);
+    }
+  }
+
   MemoryManager * MemoryManager::mspMemoryManager = nullptr;
 
   void MemoryManager::Initialize()
@@ -507,7 +527,7 @@ namespace Force {
       }
     }
   }
-  void MemoryManager::OutputImage() const
+  void MemoryManager::OutputImage(uint64 resetPC) const
   {
     for (auto mem_bank : mMemoryBanks) {
       Memory* output_mem = mem_bank->MemoryInstance();
@@ -524,8 +544,15 @@ namespace Force {
       string mem_bank_str = EMemBankType_to_string(output_mem->MemoryBankType());
       output_name_img += "." + mem_bank_str + ".img";
 
-      ImageIO printer;
-      printer.PrintMemoryImage(output_name_img, output_mem);
+      ImageIO printer(cfg_handle->OutputBinaryImage());
+      printer.PrintMemoryImage(output_name_img, output_mem, resetPC);
+    }
+  }
+
+  void MemoryManager::AccountMemoryFootprint(MemoryFootprint& rFootprint) const
+  {
+    for (auto mem_bank : mMemoryBanks) {
+      mem_bank->AccountMemoryFootprint(rFootprint);
     }
   }
 
@@ -0,0 +1,193 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "MultiSeedRunner.h"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+#include "Config.h"
+#include "Log.h"
+#include "PyEnvironment.h"
+#include "Random.h"
+
+using namespace std;
+
+/*!
+  \file MultiSeedRunner.cc
+  \brief Code for generating tests for multiple seeds in one process.
+*/
+
+namespace Force {
+
+  static double wall_time_seconds()
+  {
+    return chrono::duration<double>(chrono::steady_clock::now().time_since_epoch()).count();
+  }
+
+  /*!
+    The first seed is the initial seed so that a single seed run is reproducible with the original command line, the remaining ones are drawn
+    from the random engine seeded with the initial seed, making the whole seed list reproducible as well.
+   */
+  MultiSeedRunner::MultiSeedRunner(uint64 initialSeed, uint32 seedCount, uint32 maxJobs)
+    : mSeedRuns(), mMaxJobs(maxJobs)
+  {
+    Random* random_ptr = Random::Instance();
+    random_ptr->Seed(initialSeed);
+    mSeedRuns.push_back(SeedRun(initialSeed));
+    while (mSeedRuns.size() < seedCount) {
+      uint64 seed = random_ptr->Random64();
+      auto find_iter = find_if(mSeedRuns.begin(), mSeedRuns.end(), [seed](const SeedRun& rRun) { return rRun.mSeed == seed; });
+      if (find_iter == mSeedRuns.end()) {
+        mSeedRuns.push_back(SeedRun(seed));
+      }
+    }
+
+    if (mMaxJobs == 0) {
+      mMaxJobs = max(1u, thread::hardware_concurrency());
+    }
+    mMaxJobs = min(mMaxJobs, seedCount);
+  }
+
+  int MultiSeedRunner::Run(GenerateFunction genFunc)
+  {
+    double start_time = wall_time_seconds();
+    uint32 next_index = 0;
+    uint32 running_count = 0;
+    while ((next_index < mSeedRuns.size()) or (running_count > 0)) {
+      while ((running_count < mMaxJobs) and (next_index < mSeedRuns.size())) {
+        Launch(mSeedRuns[next_index], genFunc);
+        ++ next_index;
+        ++ running_count;
+      }
+
+      int wait_status = 0;
+      pid_t pid = waitpid(-1, &wait_status, 0);
+      if (pid < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        LOG(fail) << "{MultiSeedRunner::Run} failed waiting for worker processes, errno " << dec << errno << "." << endl;
+        FAIL("multi-seed-wait-failed");
+      }
+
+      auto find_iter = find_if(mSeedRuns.begin(), mSeedRuns.end(), [pid](const SeedRun& rRun) { return rRun.mPid == pid; });
+      if (find_iter == mSeedRuns.end()) {
+        continue;
+      }
+      find_iter->mExitStatus = wait_status;
+      find_iter->mElapsedTime = wall_time_seconds() - find_iter->mStartTime;
+      find_iter->mDone = true;
+      -- running_count;
+    }
+
+    PrintSummary(wall_time_seconds() - start_time);
+
+    bool all_passed = all_of(mSeedRuns.begin(), mSeedRuns.end(), [this](const SeedRun& rRun) { return Succeeded(rRun); });
+    return all_passed ? 0 : 1;
+  }
+
+  void MultiSeedRunner::Launch(SeedRun& rSeedRun, GenerateFunction genFunc)
+  {
+    // Flush pending output so that it is not duplicated into the worker.
+    cout.flush();
+    cerr.flush();
+    fflush(nullptr);
+
+    rSeedRun.mStartTime = wall_time_seconds();
+    pid_t pid = fork();
+    if (pid < 0) {
+      LOG(fail) << "{MultiSeedRunner::Launch} failed to fork worker process for seed 0x" << hex << rSeedRun.mSeed << ", errno " << dec << errno << "." << endl;
+      FAIL("multi-seed-fork-failed");
+    }
+    else if (pid == 0) {
+      RunWorker(rSeedRun.mSeed, genFunc);
+    }
+
+    rSeedRun.mPid = pid;
+  }
+
+  void MultiSeedRunner::RunWorker(uint64 seed, GenerateFunction genFunc)
+  {
+    PyEnvironment::reinitialize_python_after_fork();
+
+    stringstream seed_stream;
+    seed_stream << "0x" << hex << seed;
+    string log_name = "gen_" + seed_stream.str() + ".log";
+    if ((freopen(log_name.c_str(), "w", stdout) == nullptr) or (freopen(log_name.c_str(), "a", stderr) == nullptr)) {
+      _exit(2);
+    }
+
+    Random::Instance()->Seed(seed);
+    Config* config_ptr = Config::Instance();
+    config_ptr->SetTestSeed(seed);
+    config_ptr->SetOutputWithSeed(true, seed);
+    config_ptr->SetSeedCount(1);
+    // Later options take precedence, so appending them gives a command line that regenerates this seed on its own.
+    config_ptr->SetCommandLine(config_ptr->CommandLine() + " -K 1 -w -s " + seed_stream.str());
+    LOG(notice) << "Command line: " << config_ptr->CommandLine() << endl;
+
+    genFunc();
+
+    cout.flush();
+    cerr.flush();
+    fflush(nullptr);
+    _exit(0);
+  }
+
+  bool MultiSeedRunner::Succeeded(const SeedRun& rSeedRun) const
+  {
+    return rSeedRun.mDone and WIFEXITED(rSeedRun.mExitStatus) and (WEXITSTATUS(rSeedRun.mExitStatus) == 0);
+  }
+
+  void MultiSeedRunner::PrintSummary(double totalTime) const
+  {
+    uint32 pass_count = 0;
+    double accumulated_time = 0.0;
+    cout << "Multi-seed generation summary:" << endl;
+    cout << "  " << left << setw(20) << "Seed" << setw(16) << "Status" << right << setw(12) << "Time(s)" << endl;
+    for (const SeedRun& seed_run : mSeedRuns) {
+      stringstream seed_stream;
+      seed_stream << "0x" << hex << seed_run.mSeed;
+
+      stringstream status_stream;
+      if (Succeeded(seed_run)) {
+        status_stream << "PASS";
+        ++ pass_count;
+      }
+      else if (WIFSIGNALED(seed_run.mExitStatus)) {
+        status_stream << "FAIL(signal " << dec << WTERMSIG(seed_run.mExitStatus) << ")";
+      }
+      else {
+        status_stream << "FAIL(exit " << dec << WEXITSTATUS(seed_run.mExitStatus) << ")";
+      }
+
+      accumulated_time += seed_run.mElapsedTime;
+      cout << "  " << left << setw(20) << seed_stream.str() << setw(16) << status_stream.str() << right << setw(12) << fixed << setprecision(3) << seed_run.mElapsedTime << endl;
+    }
+    cout << dec << mSeedRuns.size() << " seeds, " << pass_count << " passed, " << (mSeedRuns.size() - pass_count) << " failed, " << mMaxJobs << " concurrent jobs; ";
+    cout << "wall time " << fixed << setprecision(3) << totalTime << "s, accumulated seed time " << accumulated_time << "s." << endl;
+  }
+
+}
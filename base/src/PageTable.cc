@@ -37,21 +37,26 @@ using namespace std;
 namespace Force {
 
   PageTable::PageTable()
-    : mMemoryBank(EMemBankType(0)), mMask(0), mLowestLookUpBit(0), mTableLevel(0), mTableBase(0), mEntries()
+    : mMemoryBank(EMemBankType(0)), mMask(0), mLowestLookUpBit(0), mTableLevel(0), mTableBase(0), mEntries(), mPresentEntries()
   {
 
   }
 
   PageTable::PageTable(const PageTable& rOther)
-    : mMemoryBank(EMemBankType(0)), mMask(0), mLowestLookUpBit(0), mTableLevel(0), mTableBase(0), mEntries()
+    : mMemoryBank(EMemBankType(0)), mMask(0), mLowestLookUpBit(0), mTableLevel(0), mTableBase(0), mEntries(), mPresentEntries()
   {
 
   }
 
   PageTable::~PageTable()
   {
-    for (auto entry_iter : mEntries) {
-      delete entry_iter.second;
+    for (uint32 word_index = 0; word_index < mPresentEntries.size(); ++ word_index) {
+      uint64 present_bits = mPresentEntries[word_index];
+      while (present_bits != 0) {
+        uint32 bit_index = lowest_bit_set(present_bits);
+        delete mEntries[(word_index << 6) + bit_index];
+        present_bits &= ~(1ull << bit_index);
+      }
     }
     // << "page table deleted." << endl;
   }
@@ -159,11 +164,11 @@ namespace Force {
   TablePte* PageTable::GetNextLevelTable(uint64 pageStart) const
   {
     uint32 pte_index = GetPteIndex(pageStart);
-    auto pte_finder = mEntries.find(pte_index);
-    if (pte_finder != mEntries.end()) {
-      TablePte* cast_pte = dynamic_cast<TablePte* > (pte_finder->second);
+    if (EntryPresent(pte_index)) {
+      PageTableEntry* pte = mEntries[pte_index];
+      TablePte* cast_pte = dynamic_cast<TablePte* > (pte);
       if (nullptr == cast_pte) {
-        LOG(fail) << "{PageTable::GetNextLevelTable} expecting a TablePte type object but getting " << pte_finder->second->Type() << endl;
+        LOG(fail) << "{PageTable::GetNextLevelTable} expecting a TablePte type object but getting " << pte->Type() << endl;
         FAIL("incorrect-table-entry-type");
       }
       return cast_pte;
@@ -175,12 +180,18 @@ namespace Force {
   void PageTable::CommitPageTableEntry(uint64 pageStart, PageTableEntry* pPte, VmAddressSpace* pVmas)
   {
     uint32 pte_index = GetPteIndex(pageStart);
-    auto pte_finder = mEntries.find(pte_index);
-    if (pte_finder != mEntries.end()) {
-      LOG(fail) << "{PageTable::CommitPageTableEntry} inserting PTE where there is an existing PTE at index 0x" << hex << pte_index << " in " << this->PageTableInfo() << " descriptor: " << pPte->DescriptorDetails() << " existing descriptor: " << pte_finder->second->DescriptorDetails() << endl;
+    if (EntryPresent(pte_index)) {
+      LOG(fail) << "{PageTable::CommitPageTableEntry} inserting PTE where there is an existing PTE at index 0x" << hex << pte_index << " in " << this->PageTableInfo() << " descriptor: " << pPte->DescriptorDetails() << " existing descriptor: " << mEntries[pte_index]->DescriptorDetails() << endl;
       FAIL("duplicated-pte-in-table");
     }
+
+    if (mEntries.empty()) {
+      uint32 entry_count = mMask + 1;
+      mEntries.assign(entry_count, nullptr);
+      mPresentEntries.assign((entry_count + 63) >> 6, 0);
+    }
     mEntries[pte_index] = pPte;
+    mPresentEntries[pte_index >> 6] |= (1ull << (pte_index & 0x3f));
 
     // write descriptor to memory.
     uint64 descr_addr = TableBase() + (pte_index << pVmas->GetControlBlock()->PteShift());
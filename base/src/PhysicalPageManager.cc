@@ -22,6 +22,7 @@
 #include "GenRequest.h"
 #include "Log.h"
 #include "MemoryConstraintUpdate.h"
+#include "MemoryFootprint.h"
 #include "MemoryTraits.h"
 #include "Page.h"
 #include "PagingChoicesAdapter.h"
@@ -408,6 +409,52 @@ namespace Force
     return alloc_result;
   }
 
+  bool PhysicalPageManager::PlanPhysicalRange(uint64 VA, uint64 size, uint64 maxPhysical, uint64& rPA) const
+  {
+    // Every page mapping part of the range needs backing, so the range is widened to the smallest page size.
+    vector<uint32> page_shifts;
+    for (auto pte_type : GetPteTypes()) {
+      page_shifts.push_back(get_page_shift(pte_type));
+    }
+    if (page_shifts.empty()) {
+      return false;
+    }
+    sort(page_shifts.begin(), page_shifts.end());
+
+    uint64 min_page_mask = get_mask64(page_shifts.front());
+    uint64 range_start = VA & ~min_page_mask;
+    uint64 range_size = ((VA + size - 1) | min_page_mask) - range_start + 1;
+
+    ConstraintSet free_constr(*mpBoundary);
+    free_constr.ApplyLargeConstraintSet(*mpFreeRanges);
+    if ((not free_constr.IsEmpty()) and (free_constr.UpperBound() > maxPhysical)) {
+      free_constr.SubRange(maxPhysical + 1, free_constr.UpperBound());
+    }
+
+    // Try to keep the physical range congruent with the virtual range for the largest page size fitting in it, so large pages can use it too.
+    for (auto shift_iter = page_shifts.rbegin(); shift_iter != page_shifts.rend(); ++ shift_iter) {
+      uint32 page_shift = *shift_iter;
+      if ((page_shift != page_shifts.front()) and ((1ull << page_shift) > range_size)) {
+        continue;
+      }
+
+      uint64 page_mask = get_mask64(page_shift);
+      ConstraintSet aligned_constr(free_constr);
+      aligned_constr.AlignOffsetWithSize(~page_mask, range_start & page_mask, range_size);
+      if (aligned_constr.IsEmpty()) {
+        continue;
+      }
+
+      aligned_constr.ShiftRight(page_shift);
+      rPA = (aligned_constr.ChooseValue() << page_shift) + (range_start & page_mask) + (VA - range_start);
+      LOG(info) << "{PhysicalPageManager::PlanPhysicalRange} VA=0x" << hex << VA << " size=0x" << size << " planned at PA=0x" << rPA << endl;
+      return true;
+    }
+
+    LOG(info) << "{PhysicalPageManager::PlanPhysicalRange} no free physical range for VA=0x" << hex << VA << " size=0x" << size << endl;
+    return false;
+  }
+
   void PhysicalPageManager::CommitPage(const Page* pPage, uint64 size)
   {
     PhysicalPage* phys_page = FindPhysicalPage(pPage->PhysicalLower(), pPage->PhysicalUpper());
@@ -562,6 +609,22 @@ namespace Force
     }
   }
 
+  void PhysicalPageManager::AccountMemoryFootprint(MemoryFootprint& rFootprint) const
+  {
+    uint64 virtual_page_count = 0;
+    for (const PhysicalPage* phys_page : mPhysicalPages) {
+      virtual_page_count += phys_page->VirtualPageCount();
+    }
+    rFootprint.Add("Pages", mPhysicalPages.size() + virtual_page_count, MemoryFootprint::VectorBytes(mPhysicalPages) + mPhysicalPages.size() * sizeof(PhysicalPage) + virtual_page_count * (sizeof(Page) + sizeof(Page*)));
+
+    for (const ConstraintSet* constr_set : {mpBoundary, mpFreeRanges, mpAllocatedRanges, mpAliasExcludeRanges}) {
+      rFootprint.AddConstraintSet("ConstraintSets", constr_set);
+    }
+    for (const auto& page_aligned_item : mUsablePageAligned) {
+      rFootprint.AddConstraintSet("ConstraintSets", page_aligned_item.second);
+    }
+  }
+
   bool phys_page_less_than(const PhysicalPage* lhs, const PhysicalPage* rhs)
   {
     return (lhs->Upper() < rhs->Lower());
@@ -62,6 +62,11 @@ namespace PyEnvironment {
     py::finalize_interpreter();
   }
 
+  void reinitialize_python_after_fork()
+  {
+    PyOS_AfterFork_Child();
+  }
+
 }
 
 }
@@ -28,6 +28,7 @@
 #include "InstructionStructure.h"
 #include "Log.h"
 #include "PathUtils.h"
+#include "Random.h"
 #include "Scheduler.h"
 #include "StringUtils.h"
 #include "ThreadGroup.h"
@@ -131,6 +132,7 @@ namespace Force {
   void PyInterface::RunTest()
   {
     try {
+      LOG_PHASE("template");
       std::string template_path = Config::Instance()->TestTemplate();
       SetupModulePaths(template_path);
       py::module main = py::module::import("__main__");
@@ -358,6 +360,14 @@ namespace Force {
     mpScheduler->InitializeMemory(threadId, addr, bank, size, data, isInstr, isVirtual);
   }
 
+  void PyInterface::InitializeInstructions(uint32 threadId, uint64 addr, uint32 bank, uint32 instrSize, const py::list& opcodes, const py::list& names, const py::list& asmTexts)
+  {
+    auto opcode_vec = opcodes.cast<vector<uint64>>();
+    auto name_vec = names.cast<vector<string>>();
+    auto asm_text_vec = asmTexts.cast<vector<string>>();
+    mpScheduler->InitializeInstructions(threadId, addr, bank, instrSize, opcode_vec, name_vec, asm_text_vec);
+  }
+
   static void process_AddChoicesModification_parameters(const py::dict& params, std::map<std::string, uint32>& modifications)
   {
      for (const auto & dict_pair : params) {
@@ -454,6 +464,16 @@ namespace Force {
     return pyList;
   }
 
+  void PyInterface::BeginDetachedRandomStream(uint64 seed) const
+  {
+    Random::Instance()->BeginDetachedStream(seed);
+  }
+
+  void PyInterface::EndDetachedRandomStream() const
+  {
+    Random::Instance()->EndDetachedStream();
+  }
+
   // Register module API
   py::object PyInterface::GetRandomRegisters(cuint32 threadId, cuint32 number, const string& rRegType, const string& rExcludes) const
   {
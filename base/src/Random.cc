@@ -16,6 +16,7 @@
 #include "Random.h"
 
 #include <random>
+#include <vector>
 
 #include "Log.h"
 
@@ -33,9 +34,11 @@ namespace Force {
     \brief internal struct pointing to 32-bit and 64-bit random number engine in use
    */
   struct RandomEngine {
-    RandomEngine() : mEngine32(), mEngine64() { }
+    RandomEngine() : mEngine32(), mEngine64(), mSavedEngines32(), mSavedEngines64() { }
     std::mt19937 mEngine32;    //!< Instance of 32-bit random number engine in use
     std::mt19937_64 mEngine64; //!< Instance of 64-bit random number engine in use
+    std::vector<std::mt19937> mSavedEngines32;    //!< 32-bit random number engines saved while detached streams are in use
+    std::vector<std::mt19937_64> mSavedEngines64; //!< 64-bit random number engines saved while detached streams are in use
   };
 
   Random* Random::mspRandom = nullptr;
@@ -98,4 +101,27 @@ namespace Force {
     return dist(mpRandomEngine->mEngine64);
   }
 
+  void Random::BeginDetachedStream(uint64 seed)
+  {
+    mpRandomEngine->mSavedEngines32.push_back(mpRandomEngine->mEngine32);
+    mpRandomEngine->mSavedEngines64.push_back(mpRandomEngine->mEngine64);
+
+    mpRandomEngine->mEngine64.seed(seed);
+    uint32 seed32 = Random64(0, UINT32_MAX);
+    mpRandomEngine->mEngine32.seed(seed32);
+  }
+
+  void Random::EndDetachedStream()
+  {
+    if (mpRandomEngine->mSavedEngines64.empty()) {
+      LOG(fail) << "{Random::EndDetachedStream} no detached stream in use." << endl;
+      FAIL("no-detached-random-stream");
+    }
+
+    mpRandomEngine->mEngine32 = mpRandomEngine->mSavedEngines32.back();
+    mpRandomEngine->mSavedEngines32.pop_back();
+    mpRandomEngine->mEngine64 = mpRandomEngine->mSavedEngines64.back();
+    mpRandomEngine->mSavedEngines64.pop_back();
+  }
+
 }
@@ -21,6 +21,7 @@
 #include <sstream>
 
 #include "Log.h"
+#include "MemoryFootprint.h"
 #include "UtilityFunctions.h"
 
 using namespace std;
@@ -40,16 +41,9 @@ namespace Force {
   }
 
   MemoryInitRecord::MemoryInitRecord(cuint32 threadId, uint32 size, uint32 elementSize, EMemDataType type, const EMemAccessType memAccessType)
-    : Record(), mThreadId(threadId), mSize(size), mElementSize(elementSize), mAddress(0), mMemoryId(0), mType(type), mMemAccessType(memAccessType), mpData(nullptr), mpAttrs(nullptr)
+    : Record(), mThreadId(threadId), mCapacity(size), mSize(size), mElementSize(elementSize), mAddress(0), mMemoryId(0), mType(type), mMemAccessType(memAccessType), mpData(nullptr), mpAttrs(nullptr)
   {
-    if (mElementSize > mSize) {
-      LOG(fail) << "Data element size: " << dec << mElementSize << " larger than whole data size: " << mSize << endl;
-      FAIL("element-larger-than-whole-size");
-    }
-    if (mSize % mElementSize) {
-      LOG(fail) << "Data size: " << mSize << " should be multiples of element size: " << mElementSize << endl;
-      FAIL("size-element-mod-check");
-    }
+    CheckElementSize();
     mpData = new uint8[mSize];
     mpAttrs = new uint8[mSize];
   }
@@ -61,7 +55,7 @@ namespace Force {
   }
 
   MemoryInitRecord::MemoryInitRecord(const MemoryInitRecord& rOther)
-    : Record(rOther), mThreadId(rOther.mThreadId), mSize(rOther.mSize), mElementSize(rOther.mElementSize), mAddress(0), mMemoryId(0), mType(rOther.mType), mMemAccessType(), mpData(nullptr), mpAttrs(nullptr)
+    : Record(rOther), mThreadId(rOther.mThreadId), mCapacity(rOther.mSize), mSize(rOther.mSize), mElementSize(rOther.mElementSize), mAddress(0), mMemoryId(0), mType(rOther.mType), mMemAccessType(), mpData(nullptr), mpAttrs(nullptr)
   {
     if (rOther.mpData) {
       mpData = new uint8[mSize];
@@ -74,6 +68,38 @@ namespace Force {
     }
   }
 
+  void MemoryInitRecord::Reset(cuint32 threadId, uint32 size, uint32 elementSize, EMemDataType type, const EMemAccessType memAccessType)
+  {
+    mThreadId = threadId;
+    mSize = size;
+    mElementSize = elementSize;
+    mAddress = 0;
+    mMemoryId = 0;
+    mType = type;
+    mMemAccessType = memAccessType;
+    CheckElementSize();
+
+    if ((mSize > mCapacity) or (nullptr == mpData) or (nullptr == mpAttrs)) {
+      delete [] mpData;
+      delete [] mpAttrs;
+      mpData = new uint8[mSize];
+      mpAttrs = new uint8[mSize];
+      mCapacity = mSize;
+    }
+  }
+
+  void MemoryInitRecord::CheckElementSize() const
+  {
+    if (mElementSize > mSize) {
+      LOG(fail) << "Data element size: " << dec << mElementSize << " larger than whole data size: " << mSize << endl;
+      FAIL("element-larger-than-whole-size");
+    }
+    if (mSize % mElementSize) {
+      LOG(fail) << "Data size: " << mSize << " should be multiples of element size: " << mElementSize << endl;
+      FAIL("size-element-mod-check");
+    }
+  }
+
   const string MemoryInitRecord::ToString() const
   {
     stringstream out_stream;
@@ -175,6 +201,7 @@ namespace Force {
     }
 
     mpData = dataVec;
+    mCapacity = mSize;
 
     if (nullptr != mpAttrs) {
       memset(mpAttrs, 0x0, mSize);
@@ -193,6 +220,75 @@ namespace Force {
     mpAttrs = attrVec;
   }
 
+  void MemoryInitLog::Build(const vector<MemoryInitRecord* >& rRecords)
+  {
+    Clear();
+
+    // group the records into writes first, so the arena is sized once and data pointers into it stay valid.
+    uint64 merged_size = 0;
+    for (auto mem_rd : rRecords) {
+      mDataSize += mem_rd->Size();
+      if (not mEntries.empty()) {
+        MemoryInitLogEntry& last_entry = mEntries.back();
+        if ((last_entry.mMemoryId == mem_rd->MemoryId()) and (last_entry.mAddress + last_entry.mSize == mem_rd->Address()) and (last_entry.mSize <= MAX_UINT32 - mem_rd->Size())) {
+          if (last_entry.mpData != nullptr) {
+            merged_size += last_entry.mSize;
+            last_entry.mpData = nullptr;
+          }
+          merged_size += mem_rd->Size();
+          last_entry.mSize += mem_rd->Size();
+          continue;
+        }
+      }
+
+      MemoryInitLogEntry entry;
+      entry.mAddress = mem_rd->Address();
+      entry.mMemoryId = mem_rd->MemoryId();
+      entry.mSize = mem_rd->Size();
+      entry.mpData = mem_rd->InitData();
+      mEntries.push_back(entry);
+    }
+
+    if (merged_size == 0) {
+      return;
+    }
+
+    mArena.reserve(merged_size);
+    auto rec_iter = rRecords.cbegin();
+    for (auto& log_entry : mEntries) {
+      if (log_entry.mpData != nullptr) {
+        ++ rec_iter;
+        continue;
+      }
+
+      log_entry.mpData = mArena.data() + mArena.size();
+      for (uint64 copied_size = 0; copied_size < log_entry.mSize; ++ rec_iter) {
+        const MemoryInitRecord* mem_rd = (*rec_iter);
+        mArena.insert(mArena.end(), mem_rd->InitData(), mem_rd->InitData() + mem_rd->Size());
+        copied_size += mem_rd->Size();
+      }
+    }
+  }
+
+  void MemoryInitLog::Clear()
+  {
+    mEntries.clear();
+    if (mArena.capacity() > msMaxKeptArenaBytes) {
+      vector<uint8>().swap(mArena);
+    }
+    else {
+      mArena.clear();
+    }
+    mDataSize = 0;
+  }
+
+  void MemoryInitLog::Release()
+  {
+    vector<MemoryInitLogEntry>().swap(mEntries);
+    vector<uint8>().swap(mArena);
+    mDataSize = 0;
+  }
+
   const string RecordArchive::ToString() const
   {
     return "RecordArchive";
@@ -204,26 +300,147 @@ namespace Force {
       delete rec_item;
     }
 
+    for (auto rec_item : mFlushedRecords) {
+      delete rec_item;
+    }
+
+    for (auto rec_item : mFreeRecords) {
+      delete rec_item;
+    }
   }
 
   MemoryInitRecord* RecordArchive::GetMemoryInitRecord(cuint32 threadId, uint32 size, uint32 elementSize, EMemDataType type) const
   {
-    MemoryInitRecord* ret_rec = new MemoryInitRecord(threadId, size, elementSize, type);
-    ret_rec->SetId(mCurrentId++);
-    mRecords.push_back(ret_rec);
-    return ret_rec;
+    return NewMemoryInitRecord(threadId, size, elementSize, type, EMemAccessType::Unknown);
   }
 
   MemoryInitRecord* RecordArchive::GetMemoryInitRecord(cuint32 threadId, uint32 size, uint32 elementSize, EMemDataType type, const EMemAccessType memAccessType) const
   {
-    MemoryInitRecord* ret_rec = new MemoryInitRecord(threadId, size, elementSize, type, memAccessType);
+    return NewMemoryInitRecord(threadId, size, elementSize, type, memAccessType);
+  }
+
+  MemoryInitRecord* RecordArchive::NewMemoryInitRecord(cuint32 threadId, uint32 size, uint32 elementSize, EMemDataType type, const EMemAccessType memAccessType) const
+  {
+    if ((not mRetainRecords) and (not mRecords.empty())) {
+      LOG(fail) << "{RecordArchive::NewMemoryInitRecord} MemoryInitRecord " << dec << mRecords.back()->Id() << " not released before requesting another one." << endl;
+      FAIL("memory-init-record-not-released");
+    }
+
+    MemoryInitRecord* ret_rec = nullptr;
+    if (mFreeRecords.empty()) {
+      ret_rec = new MemoryInitRecord(threadId, size, elementSize, type, memAccessType);
+      ++ mAllocatedCount;
+    }
+    else {
+      ret_rec = mFreeRecords.back();
+      mFreeRecords.pop_back();
+      ret_rec->Reset(threadId, size, elementSize, type, memAccessType);
+    }
+
     ret_rec->SetId(mCurrentId++);
     mRecords.push_back(ret_rec);
+    ++ mRecordCount;
     return ret_rec;
   }
 
-  void RecordArchive::SwapMemoryInitRecords(std::vector<MemoryInitRecord* >& rSwapVec)
+  const MemoryInitLog& RecordArchive::FlushMemoryInitRecords()
   {
-    rSwapVec.swap(mRecords);
+    // the records of the previous flush are no longer referred to once the log is rebuilt.
+    RecycleMemoryInitRecords(mFlushedRecords);
+    mMemoryInitLog.Build(mRecords);
+    mFlushedRecords.swap(mRecords);
+
+    mFlushedWriteCount += mMemoryInitLog.Entries().size();
+    mFlushedByteCount += mMemoryInitLog.DataSize();
+    ++ mFlushCount;
+    return mMemoryInitLog;
   }
+
+  void RecordArchive::DiscardMemoryInitRecords()
+  {
+    mMemoryInitLog.Clear();
+    RecycleMemoryInitRecords(mFlushedRecords);
+    RecycleMemoryInitRecords(mRecords);
+    ++ mFlushCount;
+  }
+
+  void RecordArchive::ReleaseMemoryInitRecord(const MemoryInitRecord* pRecord) const
+  {
+    if (mRetainRecords) {
+      return;
+    }
+
+    auto rec_iter = find(mRecords.begin(), mRecords.end(), pRecord);
+    if (rec_iter == mRecords.end()) {
+      LOG(fail) << "{RecordArchive::ReleaseMemoryInitRecord} MemoryInitRecord " << dec << pRecord->Id() << " is not outstanding." << endl;
+      FAIL("releasing-unknown-memory-init-record");
+    }
+    MemoryInitRecord* mem_rd = (*rec_iter);
+    mRecords.erase(rec_iter);
+    RecycleMemoryInitRecord(mem_rd);
+  }
+
+  void RecordArchive::RecycleMemoryInitRecord(MemoryInitRecord* pRecord) const
+  {
+    if ((mFreeRecords.size() < msMaxFreeRecords) and (pRecord->mCapacity <= msMaxRecycledCapacity)) {
+      mFreeRecords.push_back(pRecord);
+    }
+    else {
+      delete pRecord;
+    }
+  }
+
+  void RecordArchive::RecycleMemoryInitRecords(vector<MemoryInitRecord* >& rRecords) const
+  {
+    for (auto mem_rd : rRecords) {
+      RecycleMemoryInitRecord(mem_rd);
+    }
+    rRecords.clear();
+  }
+
+  void RecordArchive::LogSummary() const
+  {
+    if (mFlushCount == 0) {
+      return;
+    }
+
+    char per_step_buffer[32];
+    snprintf(per_step_buffer, 32, "%.2f", double(mRecordCount) / mFlushCount);
+    LOG(notice) << "Memory Init Record Summary" << endl;
+    LOG(notice) << "Steps: " << dec << mFlushCount << ", records: " << mRecordCount << " (" << per_step_buffer << " per step), record objects allocated: " << mAllocatedCount << endl;
+    LOG(notice) << "ISS writes: " << mFlushedWriteCount << ", bytes: " << mFlushedByteCount << endl;
+  }
+
+  void RecordArchive::AccountMemoryFootprint(MemoryFootprint& rFootprint) const
+  {
+    uint64 record_bytes = MemoryFootprint::VectorBytes(mRecords) + MemoryFootprint::VectorBytes(mFlushedRecords) + MemoryFootprint::VectorBytes(mFreeRecords) + mMemoryInitLog.StorageBytes();
+    for (const vector<MemoryInitRecord* >* record_list : {&mRecords, &mFlushedRecords, &mFreeRecords}) {
+      for (auto mem_init_record : *record_list) {
+        record_bytes += sizeof(MemoryInitRecord) + 2 * mem_init_record->mCapacity;
+      }
+    }
+    rFootprint.Add("Records", mRecords.size() + mFlushedRecords.size() + mFreeRecords.size(), record_bytes);
+  }
+
+  uint32 RecordArchive::ReleaseUnusedStorage()
+  {
+    // The memory init log is only valid until the next flush, so it is not in use between instructions.
+    if (mRecords.empty()) {
+      mMemoryInitLog.Release();
+      RecycleMemoryInitRecords(mFlushedRecords);
+    }
+
+    if (mFreeRecords.size() <= msKeptFreeRecords) {
+      return 0;
+    }
+
+    uint32 release_count = mFreeRecords.size() - msKeptFreeRecords;
+    for (auto rec_iter = mFreeRecords.begin() + msKeptFreeRecords; rec_iter != mFreeRecords.end(); ++ rec_iter) {
+      delete (*rec_iter);
+    }
+    mFreeRecords.resize(msKeptFreeRecords);
+    mFreeRecords.shrink_to_fit();
+    return release_count;
+  }
+
 }
@@ -368,7 +368,7 @@ namespace Force
    */
   PhysicalRegister::PhysicalRegister()
     : mName(),mRegisterType(ERegisterType::GPR), mValue(0), mMask(0), mInitialValue(0), mInitMask(0),
-      mResetValue(0), mResetMask(0), mSize(0), mIndex(0), mSubIndex(0), mAttributes((uint32)ERegAttrType::ReadWrite)
+      mResetValue(0), mResetMask(0), mSize(0), mIndex(0), mSubIndex(0), mFileIndex(0), mAttributes((uint32)ERegAttrType::ReadWrite)
   {
   }
 
@@ -379,7 +379,7 @@ namespace Force
   PhysicalRegister::PhysicalRegister(const PhysicalRegister& rOther)
     : Object(rOther), mName(rOther.mName), mRegisterType(rOther.mRegisterType), mValue(rOther.mValue), mMask(rOther.mMask),
       mInitialValue(rOther.mInitialValue), mInitMask(rOther.mInitMask), mResetValue(rOther.mResetValue), mResetMask(rOther.mResetMask),
-      mSize(rOther.mSize), mIndex(rOther.mIndex), mSubIndex(rOther.mSubIndex), mAttributes(rOther.mAttributes)
+      mSize(rOther.mSize), mIndex(rOther.mIndex), mSubIndex(rOther.mSubIndex), mFileIndex(rOther.mFileIndex), mAttributes(rOther.mAttributes)
   {
   }
 
@@ -604,6 +604,11 @@ namespace Force
     phyRegisterSet.insert(mpRegister);
   }
 
+  void BitField::GetPhysicalRegisters(std::vector<PhysicalRegister*>& rPhyRegisters) const
+  {
+    rPhyRegisters.push_back(mpRegister);
+  }
+
   uint64 BitField::ReloadValue(uint64& reloadValue, uint64 new_value) const
   {
     uint64 full_mask = ~0x0ull;
@@ -963,6 +968,13 @@ namespace Force
     }
   }
 
+  void RegisterField::GetPhysicalRegisters(std::vector<PhysicalRegister*>& rPhyRegisters) const
+  {
+    for (auto bit_field : mBitFields) {
+      bit_field->GetPhysicalRegisters(rPhyRegisters);
+    }
+  }
+
   bool RegisterField:: IgnoreUpdate(const std::string& ignoredRegFields) const
   {
     bool ignored = false;
@@ -1399,6 +1411,13 @@ namespace Force
     }
   }
 
+  void Register::GetPhysicalRegisters(std::vector<PhysicalRegister*>& rPhyRegisters) const
+  {
+    for (auto reg_field : mRegisterFields) {
+      reg_field->GetPhysicalRegisters(rPhyRegisters);
+    }
+  }
+
   bool Register::HasAttribute(ERegAttrType attr) const
   {
     bool all_reg_fields_have_attribute = all_of(mRegisterFields.cbegin(), mRegisterFields.cend(),
@@ -1546,14 +1565,21 @@ namespace Force
   std::vector<uint64> LargeRegister::Values() const
   {
     std::vector<uint64> values;
+    GetValues(values);
+    return values;
+  }
+
+  void LargeRegister::GetValues(std::vector<uint64>& rValues) const
+  {
+    rValues.clear();
+    rValues.reserve(mRegisterFields.size());
     for (auto reg_field_ptr : mRegisterFields)
     {
       if (reg_field_ptr->IsInitialized())
       {
-        values.push_back(reg_field_ptr->Value());
+        rValues.push_back(reg_field_ptr->Value());
       }
     }
-    return values;
   }
 
   void LargeRegister::Initialize(std::vector<uint64> values)
@@ -1585,14 +1611,21 @@ namespace Force
   std::vector<uint64> LargeRegister::InitialValues() const
   {
     std::vector<uint64> values;
+    GetInitialValues(values);
+    return values;
+  }
+
+  void LargeRegister::GetInitialValues(std::vector<uint64>& rValues) const
+  {
+    rValues.clear();
+    rValues.reserve(mRegisterFields.size());
     for (auto reg_field_ptr : mRegisterFields)
     {
       if (reg_field_ptr->IsInitialized())
       {
-        values.push_back(reg_field_ptr->InitialValue());
+        rValues.push_back(reg_field_ptr->InitialValue());
       }
     }
-    return values;
   }
 
   std::vector<uint64> LargeRegister::ReloadValues() const
@@ -1983,6 +2016,7 @@ namespace Force
     }
     else
     {
+      phy_reg_ptr->mFileIndex = mPhysicalRegisters.size();
       mPhysicalRegisters[pr_name] = phy_reg_ptr;
       uint32 index;
       index = ( ((uint32) phy_reg_ptr->RegisterType()) <<28) + phy_reg_ptr->IndexValue();
@@ -2257,4 +2291,44 @@ namespace Force
     pRoRegField->SetFieldResetValue(value);
   }
 
+  void PhysicalRegisterQueue::Add(const Register* pRegister)
+  {
+    // append all the physical registers, then keep in place those not already queued.
+    uint32 start_size = mRegisters.size();
+    pRegister->GetPhysicalRegisters(mRegisters);
+
+    uint32 kept_size = start_size;
+    for (uint32 i = start_size; i < mRegisters.size(); ++ i) {
+      PhysicalRegister* phys_reg_ptr = mRegisters[i];
+      uint32 file_index = phys_reg_ptr->FileIndex();
+      uint32 word_index = file_index / 64;
+      if (word_index >= mQueued.size()) {
+        mQueued.resize(word_index + 1, 0);
+      }
+
+      uint64 bit = 1ull << (file_index % 64);
+      if ((mQueued[word_index] & bit) == 0) {
+        mQueued[word_index] |= bit;
+        mRegisters[kept_size ++] = phys_reg_ptr;
+      }
+    }
+    mRegisters.resize(kept_size);
+  }
+
+  bool PhysicalRegisterQueue::IsQueued(const PhysicalRegister* pPhysRegister) const
+  {
+    uint32 file_index = pPhysRegister->FileIndex();
+    uint32 word_index = file_index / 64;
+    return (word_index < mQueued.size()) and ((mQueued[word_index] >> (file_index % 64)) & 1);
+  }
+
+  void PhysicalRegisterQueue::Clear()
+  {
+    for (auto phys_reg_ptr : mRegisters) {
+      uint32 file_index = phys_reg_ptr->FileIndex();
+      mQueued[file_index / 64] &= ~(1ull << (file_index % 64));
+    }
+    mRegisters.clear();
+  }
+
 }
@@ -47,6 +47,62 @@ namespace Force {
 
 //#define DEBUG_ENTROPY 1
 
+  void ResourceAccessBits::FailIndex(uint32 index)
+  {
+    LOG(fail) << "{ResourceAccessBits::FailIndex} resource index: " << dec << index << " exceeded max entry count: " << DEP_MAX_ENTRY_COUNT << endl;
+    FAIL("resource-index-out-of-range");
+  }
+
+  bool ResourceAccessBits::None() const
+  {
+    for (uint32 i = 0; i < WORD_COUNT; ++ i) {
+      if (mWords[i]) return false;
+    }
+    return true;
+  }
+
+  uint32 ResourceAccessBits::Count() const
+  {
+    uint32 count = 0;
+    for (uint32 i = 0; i < WORD_COUNT; ++ i) {
+      count += __builtin_popcountll(mWords[i]);
+    }
+    return count;
+  }
+
+  void ResourceAccessBits::SetConstraint(const ConstraintSet& rConstr)
+  {
+    for (auto constr_item : rConstr.GetConstraints()) {
+      for (uint64 value = constr_item->LowerBound(); value <= constr_item->UpperBound(); ++ value) {
+        Set(value);
+      }
+    }
+  }
+
+  void ResourceAccessBits::GetConstraint(ConstraintSet& rConstr) const
+  {
+    // scan word by word, adding each run of set bits as a range
+    bool in_run = false;
+    uint32 run_start = 0;
+    for (uint32 i = 0; i < WORD_COUNT; ++ i) {
+      uint64 word = mWords[i];
+      if ((word == 0 and not in_run) or (word == ~0ull and in_run)) continue;
+
+      for (uint32 bit = 0; bit < 64; ++ bit) {
+        bool is_set = (word >> bit) & 1;
+        if (is_set != in_run) {
+          uint32 index = (i << 6) + bit;
+          if (is_set) run_start = index;
+          else rConstr.AddRange(run_start, index - 1);
+          in_run = is_set;
+        }
+      }
+    }
+    if (in_run) {
+      rConstr.AddRange(run_start, DEP_MAX_ENTRY_COUNT - 1);
+    }
+  }
+
   ResourceAccessStage::ResourceAccessStage() : mSourceAccesses(), mDestAccesses()
   {
     mSourceAccesses.assign(EResourceTypeSize, nullptr);
@@ -269,7 +325,6 @@ namespace Force {
     mAccessType = ageType;
   }
 
-  static const uint32 DEP_MAX_ENTRY_COUNT = 256; //!< set a practical maximum dependency entry count.
   Object* ResourceTypeAges::Clone() const
   {
     return new ResourceTypeAges(*this);
@@ -418,19 +473,19 @@ namespace Force {
   }
 
   ResourceAccessQueue::ResourceAccessQueue()
-    : Object(), mAge(0), mHistoryLimit(0), mIndex(0), mLookUpFar(), mLookUpNear(), mpReturnConstraint(nullptr), mQueue(), mTypeAges(), mTypeEntropies()
+    : Object(), mAge(0), mHistoryLimit(0), mIndex(0), mLookUpFar(), mLookUpNear(), mpReturnConstraint(nullptr), mQueue(), mTypeAges(), mTypeEntropies(), mAccessBits()
   {
 
   }
 
   ResourceAccessQueue::ResourceAccessQueue(const ResourceAccessQueue& rOther)
-    : Object(rOther), mAge(0), mHistoryLimit(0), mIndex(0), mLookUpFar(), mLookUpNear(), mpReturnConstraint(nullptr), mQueue(), mTypeAges(), mTypeEntropies()
+    : Object(rOther), mAge(0), mHistoryLimit(0), mIndex(0), mLookUpFar(), mLookUpNear(), mpReturnConstraint(nullptr), mQueue(), mTypeAges(), mTypeEntropies(), mAccessBits()
   {
     // << "copy constructor const version" << endl;
   }
 
   ResourceAccessQueue::ResourceAccessQueue(ResourceAccessQueue& rOther)
-    : Object(rOther), mAge(rOther.mAge), mHistoryLimit(rOther.mHistoryLimit), mIndex(rOther.mIndex), mLookUpFar(rOther.mLookUpFar), mLookUpNear(rOther.mLookUpNear), mpReturnConstraint(nullptr), mQueue(), mTypeAges(), mTypeEntropies()
+    : Object(rOther), mAge(rOther.mAge), mHistoryLimit(rOther.mHistoryLimit), mIndex(rOther.mIndex), mLookUpFar(rOther.mLookUpFar), mLookUpNear(rOther.mLookUpNear), mpReturnConstraint(nullptr), mQueue(), mTypeAges(), mTypeEntropies(), mAccessBits(rOther.mAccessBits)
   {
     // << "copy constructor non-const version" << endl;
     mpReturnConstraint = dynamic_cast<ConstraintSet* >(rOther.mpReturnConstraint->Clone());
@@ -491,6 +546,8 @@ namespace Force {
     for (uint64 i = 0; i < mHistoryLimit ; i ++) {
       mQueue.push_back(new ResourceAccessStage());
     }
+
+    mAccessBits.assign(EResourceTypeSize * 2 * mHistoryLimit, ResourceAccessBits());
   }
 
   ResourceAccessStage* ResourceAccessQueue::CreateHotResource()
@@ -504,12 +561,32 @@ namespace Force {
     retired_stage->Retire(mIndex, mTypeEntropies);
     mQueue[mIndex] = nullptr;
     delete retired_stage;
+
+    for (EResourceTypeBaseType i = 0; i < EResourceTypeSize; ++ i) {
+      SlotAccessBits(mIndex, EResourceType(i), EDependencyType::OnSource).Clear();
+      SlotAccessBits(mIndex, EResourceType(i), EDependencyType::OnTarget).Clear();
+    }
+  }
+
+  void ResourceAccessQueue::UpdateAccessBits(uint32 queueIndex, const ResourceAccessStage* pStage)
+  {
+    for (EResourceTypeBaseType i = 0; i < EResourceTypeSize; ++ i) {
+      auto src_constr = pStage->GetSourceAccess(EResourceType(i));
+      if (nullptr != src_constr) {
+        SlotAccessBits(queueIndex, EResourceType(i), EDependencyType::OnSource).SetConstraint(*src_constr);
+      }
+      auto dest_constr = pStage->GetDestAccess(EResourceType(i));
+      if (nullptr != dest_constr) {
+        SlotAccessBits(queueIndex, EResourceType(i), EDependencyType::OnTarget).SetConstraint(*dest_constr);
+      }
+    }
   }
 
   void ResourceAccessQueue::Commit(ResourceAccessStage* pHotResource)
   {
     RetireReuseStage();
     mQueue[mIndex] = pHotResource;
+    UpdateAccessBits(mIndex, pHotResource);
 
     UpdateAccessEntropy(pHotResource);
 
@@ -584,11 +661,8 @@ namespace Force {
   uint32 ResourceAccessQueue::CalculateAccessEntropy(EResourceType resType, EDependencyType depType) const
   {
     uint32 entropy_sum = 0;
-    for (auto acc_entry : mQueue) {
-      const ConstraintSet* entry_constr = acc_entry->GetDependenceConstraint(resType, depType);
-      if (nullptr != entry_constr) {
-        entropy_sum += entry_constr->Size();
-      }
+    for (uint32 queue_index = 0; queue_index < mHistoryLimit; ++ queue_index) {
+      entropy_sum += SlotAccessBits(queue_index, resType, depType).Count();
     }
     return entropy_sum;
   }
@@ -650,9 +724,12 @@ namespace Force {
     if (stage_dist >= mHistoryLimit) // check if it has already fall out of bound of history limit.
       return;
 
-    auto access_stage = GetAccessStage(stage_dist);
+    uint32 queue_index = GetQueueIndex(stage_dist);
+    auto access_stage = mQueue[queue_index];
+    ResourceAccessBits& access_bits = SlotAccessBits(queue_index, resType, EDependencyType::OnSource);
     // << "access stage: " << access_stage->ToSimpleString() << endl;
-    if (access_stage->HasSourceAccess(index, resType)) {
+    if (access_bits.Test(index)) {
+      access_bits.Reset(index);
       access_stage->RemoveSourceAccess(index, resType);
       auto type_entropy = mTypeEntropies[EResourceTypeBaseType(resType)];
       type_entropy->SourceEntropy().Decrease();
@@ -672,9 +749,12 @@ namespace Force {
     if (stage_dist >= mHistoryLimit) // check if it has already fallen out of bounds of history limit.
       return;
 
-    auto access_stage = GetAccessStage(stage_dist);
+    uint32 queue_index = GetQueueIndex(stage_dist);
+    auto access_stage = mQueue[queue_index];
+    ResourceAccessBits& access_bits = SlotAccessBits(queue_index, resType, EDependencyType::OnTarget);
     // << "access stage: " << access_stage->ToSimpleString() << endl;
-    if (access_stage->HasDestAccess(index, resType)) {
+    if (access_bits.Test(index)) {
+      access_bits.Reset(index);
       access_stage->RemoveDestAccess(index, resType);
       auto type_entropy = mTypeEntropies[EResourceTypeBaseType(resType)];
       type_entropy->DestEntropy().Decrease();
@@ -711,25 +791,20 @@ namespace Force {
               << " dep type: " << EDependencyType_to_string(depType) << endl;
 
     mpReturnConstraint->Clear();
-    mLookUpFar.SetRange(low, high); // just use lookup far since we are going through whole range.
-    uint32 window_entry = low;
-    uint32 window_size = mLookUpFar.Size();
-    bool has_match = false;
-    uint32 looks = 0;
-
-    while (1) {
-      uint32 queue_index = GetQueueIndex(window_entry);
-      auto dep_constr = mQueue[queue_index]->GetDependenceConstraint(resType, depType);
-      if (nullptr != dep_constr) {
-        LOG(info) << "Gathered random resource slot #" << window_entry << endl;
-        mpReturnConstraint->MergeConstraintSet(*dep_constr);
-        has_match = true;
-      }
+    if (EDependencyType::NoDependency == depType) {
+      LOG(info) << "Not found random dependence resource, returning nullptr" << endl;
+      return nullptr;
+    }
 
-      ++ looks;
-      if (looks >= window_size) break;
+    // gather the accesses of all slots in the window with word-parallel ORs, then convert the union to a constraint once.
+    ResourceAccessBits window_bits;
+    for (uint32 window_entry = low; window_entry <= high; ++ window_entry) {
+      window_bits |= SlotAccessBits(GetQueueIndex(window_entry), resType, depType);
+    }
 
-      mLookUpFar.SlideWindow(window_entry);
+    bool has_match = not window_bits.None();
+    if (has_match) {
+      window_bits.GetConstraint(*mpReturnConstraint);
     }
 
     if (has_match) {
@@ -15,6 +15,7 @@
 //
 #include "ResourceDependence.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "Choices.h"
@@ -212,6 +213,50 @@ namespace Force {
     return dep_constr;
   }
 
+  bool ResourceDependence::MayChooseDependence(ERegAttrType access, EResourceType resType) const
+  {
+    vector<const Choice*> choices_list;
+    mpDependenceTree->GetAvailableChoices(choices_list);
+
+    for (auto choice_item : choices_list) {
+      switch (choice_item->Value()) {
+      case 0: // no dependency
+        break;
+      case 1: // inter dependency
+        if (MayChooseInterDependence(access, resType)) {
+          return true;
+        }
+        break;
+      default: // intra dependency depends on the hot resource.
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  bool ResourceDependence::MayChooseInterDependence(ERegAttrType access, EResourceType resType) const
+  {
+    const ChoiceTree* dep_type_tree = nullptr;
+    switch (access) {
+    case ERegAttrType::Read:
+    case ERegAttrType::ReadWrite:
+      dep_type_tree = mpSourceTree;
+      break;
+    case ERegAttrType::Write:
+      dep_type_tree = mpTargetTree;
+      break;
+    default:
+      return true; // let ChooseDependenceType report the error.
+    }
+
+    vector<const Choice*> choices_list;
+    dep_type_tree->GetAvailableChoices(choices_list);
+
+    return any_of(choices_list.cbegin(), choices_list.cend(),
+      [this, resType](const Choice* pChoice) { EDependencyType dep_type = EDependencyType(pChoice->Value()); return (EDependencyType::NoDependency != dep_type) and EntropyStable(resType, dep_type); });
+  }
+
   uint32 ResourceDependence::ChooseDependenceType(ERegAttrType access) const
   {
     const Choice* choice_ptr = nullptr;
@@ -25,7 +25,9 @@
 #include "FrontEndCall.h"
 #include "Generator.h"
 #include "ImageIO.h"
+#include "InstructionResults.h"
 #include "Log.h"
+#include "MemoryFootprint.h"
 #include "MemoryManager.h"
 #include "PyInterface.h"
 #include "RegisteredSetModifier.h"
@@ -60,7 +62,7 @@ namespace Force {
   }
 
   Scheduler::Scheduler()
-    : mNumChips(0), mNumCores(0), mNumThreads(0), mChipsLimit(0), mCoresLimit(0), mThreadsLimit(0), mpPyInterface(nullptr), mpSchedulingStrategy(nullptr), mpGroupModerator(nullptr), mpSemaManager(nullptr), mpSyncBarrierManager(nullptr), mGenerators()
+    : mNumChips(0), mNumCores(0), mNumThreads(0), mChipsLimit(0), mCoresLimit(0), mThreadsLimit(0), mpPyInterface(nullptr), mpSchedulingStrategy(nullptr), mpGroupModerator(nullptr), mpSemaManager(nullptr), mpSyncBarrierManager(nullptr), mGenerators(), mMemoryReport(false), mMemoryReportInterval(0), mNextMemoryReport(0), mCompactionInterval(0), mNextCompaction(0), mExceptionRecordLimit(0)
   {
     mpPyInterface = new PyInterface(this);
     Config * config_ptr = Config::Instance();
@@ -72,6 +74,32 @@ namespace Force {
     mThreadsLimit = config_ptr->LimitValue(ELimitType::ThreadsLimit);
 
     mpSchedulingStrategy = new ShuffledRoundRobinSchedulingStrategy();
+    bool quantum_valid = false;
+    uint64 scheduling_quantum = config_ptr->GetOptionValue(ESystemOptionType_to_string(ESystemOptionType::SchedulingQuantum), quantum_valid);
+    if (quantum_valid) {
+      mpSchedulingStrategy->SetQuantum(scheduling_quantum);
+    }
+    bool report_valid = false;
+    uint64 memory_report = config_ptr->GetOptionValue(ESystemOptionType_to_string(ESystemOptionType::MemoryReport), report_valid);
+    mMemoryReport = report_valid and (memory_report != 0);
+    bool interval_valid = false;
+    uint64 report_interval = config_ptr->GetOptionValue(ESystemOptionType_to_string(ESystemOptionType::MemoryReportInterval), interval_valid);
+    if (interval_valid and (report_interval != 0)) {
+      mMemoryReportInterval = report_interval;
+      mNextMemoryReport = report_interval;
+      mMemoryReport = true;
+    }
+    bool compaction_valid = false;
+    uint64 compaction_interval = config_ptr->GetOptionValue(ESystemOptionType_to_string(ESystemOptionType::CompactionInterval), compaction_valid);
+    if (compaction_valid) {
+      mCompactionInterval = compaction_interval;
+      mNextCompaction = compaction_interval;
+    }
+    bool record_limit_valid = false;
+    uint64 record_limit = config_ptr->GetOptionValue(ESystemOptionType_to_string(ESystemOptionType::ExceptionRecordLimit), record_limit_valid);
+    if (record_limit_valid) {
+      mExceptionRecordLimit = record_limit;
+    }
     mpGroupModerator = new ThreadGroupModerator(mNumChips, mNumCores, mNumThreads);
     mpSemaManager = new SemaphoreManager();
     mpSyncBarrierManager = new SynchronizeBarrierManager();
@@ -99,7 +127,12 @@ namespace Force {
   void Scheduler::Run()
   {
     mpPyInterface->RunTest();
+    if (mMemoryReport) {
+      ReportMemoryFootprint("at test end");
+    }
+    LOG_PHASE("output");
     OutputTest();
+    LOG_PHASE("teardown");
   }
 
   void Scheduler::OutputTest()
@@ -110,11 +143,12 @@ namespace Force {
 
     MemoryManager::Instance()->OutputTest(mGenerators, reset_pc, machine_type);
     if (config_ptr->OutputImage()) {
-      MemoryManager::Instance()->OutputImage();
-      ImageIO image_printer;
+      MemoryManager::Instance()->OutputImage(reset_pc);
+      ImageIO image_printer(config_ptr->OutputBinaryImage());
       for (auto it = mGenerators.begin(); it != mGenerators.end(); ++it) {
         it->second->OutputImage(&image_printer);
       }
+      image_printer.Close();
     }
   }
 
@@ -154,6 +188,40 @@ namespace Force {
   {
     auto gen_instance = LookUpGenerator(threadId);
     gen_instance->GenInstruction(instrReq, rec_id);
+    if ((mMemoryReportInterval != 0) or (mCompactionInterval != 0)) {
+      CheckInstructionIntervals();
+    }
+  }
+
+  void Scheduler::ReportMemoryFootprint(const string& rWhen) const
+  {
+    MemoryFootprint footprint;
+    for (const auto& gen_item : mGenerators) {
+      gen_item.second->AccountMemoryFootprint(footprint);
+    }
+    MemoryManager::Instance()->AccountMemoryFootprint(footprint);
+    footprint.Report(rWhen);
+  }
+
+  void Scheduler::CheckInstructionIntervals()
+  {
+    uint64 instr_count = 0;
+    for (const auto& gen_item : mGenerators) {
+      instr_count += gen_item.second->GetInstructionResults()->GetTotalInstructionCount();
+    }
+
+    // Compact first, so a report due at the same time shows the compacted footprint.
+    if ((mCompactionInterval != 0) and (instr_count >= mNextCompaction)) {
+      for (auto& gen_item : mGenerators) {
+        gen_item.second->Compact(mExceptionRecordLimit);
+      }
+      mNextCompaction = (instr_count / mCompactionInterval + 1) * mCompactionInterval;
+    }
+
+    if ((mMemoryReportInterval != 0) and (instr_count >= mNextMemoryReport)) {
+      ReportMemoryFootprint("after " + to_string(instr_count) + " instructions");
+      mNextMemoryReport = (instr_count / mMemoryReportInterval + 1) * mMemoryReportInterval;
+    }
   }
 
   void Scheduler::InitializeMemory(uint32 threadId, uint64 addr, uint32 bank, uint32 size, uint64 data, bool isInstr, bool isVirtual)
@@ -162,6 +230,12 @@ namespace Force {
     gen_instance->InitializeMemory(addr, bank, size, data, isInstr, isVirtual);
   }
 
+  void Scheduler::InitializeInstructions(uint32 threadId, uint64 addr, uint32 bank, uint32 instrSize, const vector<uint64>& opcodes, const vector<string>& names, const vector<string>& asmTexts)
+  {
+    auto gen_instance = LookUpGenerator(threadId);
+    gen_instance->InitializeInstructions(addr, bank, instrSize, opcodes, names, asmTexts);
+  }
+
   uint32 Scheduler::AddChoicesModification(uint32 threadId, EChoicesType choicesType, const std::string& treeName, const std::map<std::string, uint32>& modifications)
   {
     auto gen_instance = LookUpGenerator(threadId);
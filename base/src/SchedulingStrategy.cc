@@ -31,7 +31,7 @@ using namespace std;
 namespace Force {
 
   ShuffledRoundRobinSchedulingStrategy::ShuffledRoundRobinSchedulingStrategy()
-    : SchedulingStrategy(), mState(ESchedulingState::Random), mCurrentThreadId(-1), mNextIndex(0), mLockingState(ESchedulingState::Random), mLockingLevel(0), mLockingThreadId(-1), mThreadIds(), mActiveThreadIds()
+    : SchedulingStrategy(), mState(ESchedulingState::Random), mCurrentThreadId(-1), mNextIndex(0), mLockingState(ESchedulingState::Random), mLockingLevel(0), mLockingThreadId(-1), mQuantum(1), mQuantumLeft(0), mThreadIds(), mActiveThreadIds()
   {
 
   }
@@ -52,6 +52,9 @@ namespace Force {
     mThreadIds.erase(std::remove(mThreadIds.begin(), mThreadIds.end(), threadId), mThreadIds.end());
     mActiveThreadIds.erase(std::remove(mActiveThreadIds.begin(), mActiveThreadIds.end(), threadId), mActiveThreadIds.end());
     -- mNextIndex;
+    if (threadId == mCurrentThreadId) {
+      mQuantumLeft = 0;
+    }
     mState = ESchedulingState::Finishing;
   }
 
@@ -68,6 +71,12 @@ namespace Force {
       }
       // else fall through
     case ESchedulingState::Random:
+      if (mQuantumLeft > 1) {
+        // Keep the current thread for the rest of its quantum.
+        -- mQuantumLeft;
+        break;
+      }
+
       if (mNextIndex >= thread_list_size) {
         RefreshSchedule();
         return;
@@ -177,6 +186,15 @@ namespace Force {
 
     LOG(info) << "[ShuffledRoundRobinSchedulingStrategy::DeactivateThread] deactivate thread: 0x" << hex << threadId << endl;
     mActiveThreadIds.erase(std::remove(mActiveThreadIds.begin(), mActiveThreadIds.end(), threadId), mActiveThreadIds.end());
+    if (threadId == mCurrentThreadId) {
+      mQuantumLeft = 0;
+    }
+  }
+
+  void ShuffledRoundRobinSchedulingStrategy::SetQuantum(uint32 quantum)
+  {
+    mQuantum = (quantum > 0) ? quantum : 1;
+    LOG(info) << "[ShuffledRoundRobinSchedulingStrategy::SetQuantum] " << dec << mQuantum << " requests per thread." << endl;
   }
 
   void ShuffledRoundRobinSchedulingStrategy::GetScheduledThreadIds(ConstraintSet& constr) const
@@ -16,6 +16,8 @@
 #include "SimAPI.h"
 
 #include <iomanip>
+#include <tuple>
+#include <utility>
 
 /*!
   \file SimAPI.cc
@@ -46,6 +48,13 @@ namespace Force {
     CloseOfs(mOfsSimTrace);
   }
 
+  void SimAPI::WriteRegisters(uint32 CpuID, const RegisterWrite* pWrites, uint32 count)
+  {
+    for (uint32 i = 0; i < count; ++ i) {
+      WriteRegister(CpuID, pWrites[i].mpName, pWrites[i].mValue, pWrites[i].mMask);
+    }
+  }
+
   //!< for logging a 'trace session':
   void SimAPI::OpenApiTrace(const string& rApiTraceFile)
   {
@@ -260,9 +269,15 @@ namespace Force {
       it->second.insert(CpuID, pRegname, eltIndex, eltByteWidth, pValue, byteLength, pAccessType);
     }
     else{
-      VectorElementUpdates temp(CpuID, mVecRegWidth, mVecPhysRegNames, mPhysRegSize, mNumPhysRegs); 
-      temp.insert(CpuID, pRegname, eltIndex, eltByteWidth, pValue, byteLength, pAccessType);
-      mVectorElementUpdates.insert(std::pair<uint32, VectorElementUpdates>(vecRegIndex, temp)); 
+      // Construct the updates object in place, so its dirty bitmaps are not copied.
+      it = mVectorElementUpdates.emplace(std::piecewise_construct, std::forward_as_tuple(vecRegIndex), std::forward_as_tuple(CpuID, mVecRegWidth, mVecPhysRegNames, mPhysRegSize, mNumPhysRegs)).first;
+      try {
+        it->second.insert(CpuID, pRegname, eltIndex, eltByteWidth, pValue, byteLength, pAccessType);
+      }
+      catch (...) {
+        mVectorElementUpdates.erase(it);
+        throw;
+      }
     }
   }
 
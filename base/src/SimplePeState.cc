@@ -15,6 +15,8 @@
 //
 #include "SimplePeState.h"
 
+#include <algorithm>
+
 #include "Log.h"
 #include "Register.h"
 
@@ -56,4 +58,15 @@ namespace Force {
     return state_changed;
   }
 
+  bool SimplePeState::CoversState(const SimplePeState& rOther) const
+  {
+    // States saved in the same VM regime have the same register context, so compare in order.
+    if (rOther.mRegisterStates.size() > mRegisterStates.size()) {
+      return false;
+    }
+
+    return equal(rOther.mRegisterStates.cbegin(), rOther.mRegisterStates.cend(), mRegisterStates.cbegin(),
+      [](const SimpleRegisterState& rOtherState, const SimpleRegisterState& rState) { return rOtherState.mpRegister == rState.mpRegister; });
+  }
+
 }
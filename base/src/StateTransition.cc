@@ -378,7 +378,7 @@ namespace Force {
     vector<uint64> reg_values;
     if (reg->IsLargeRegister()) {
       auto large_reg = dynamic_cast<LargeRegister*>(reg);
-      reg_values = large_reg->Values();
+      large_reg->GetValues(reg_values);
     }
     else {
       reg_values.push_back(reg->Value());
@@ -62,7 +62,7 @@ namespace Force {
   ThreadDispatcher* ThreadDispatcher::mspDispatcher = nullptr;
 
   MultiThreadDispatcher::MultiThreadDispatcher(Scheduler* pScheduler)
-    : ThreadDispatcher(), mpScheduler(pScheduler), mDispatchMutex(), mCondVar(), mThreadIds()
+    : ThreadDispatcher(), mpScheduler(pScheduler), mDispatchMutex(), mCondVars(), mThreadIds()
   {
   }
 
@@ -90,7 +90,7 @@ namespace Force {
 
     uint32 thread_id = GetThreadId();
 
-    mCondVar.wait(lock,
+    mCondVars[thread_id].wait(lock,
       [thread_id, this]() { return (thread_id == this->mpScheduler->CurrentThreadId()); });
 
     // Hold the mutex lock until Finish() is called
@@ -126,6 +126,7 @@ namespace Force {
     unique_lock<CountingMutex> lock(mDispatchMutex);
 
     mpScheduler->AddThreadId(threadId);
+    mCondVars[threadId];
   }
 
   uint32 MultiThreadDispatcher::GetThreadId()
@@ -178,8 +179,18 @@ namespace Force {
     if (mDispatchMutex.get_lock_count() == 1) {
       mpScheduler->NextThread();
 
+      // Only wake up the thread scheduled next; the other threads would go straight back to waiting. Condition variables
+      // are never removed, so the pointer remains valid after unlocking.
+      condition_variable_any* next_cond_var = nullptr;
+      auto itr = mCondVars.find(mpScheduler->CurrentThreadId());
+      if (itr != mCondVars.end()) {
+        next_cond_var = &(itr->second);
+      }
+
       mDispatchMutex.unlock();
-      mCondVar.notify_all();
+      if (next_cond_var != nullptr) {
+        next_cond_var->notify_one();
+      }
     } else {
       // This will decrement the lock count, but not release the lock, as it is a nested call
       mDispatchMutex.unlock();
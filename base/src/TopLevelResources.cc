@@ -42,6 +42,7 @@
 #include "StringUtils.h"
 #include "ThreadGroupPartitioner.h"
 #include "UtilityFunctions.h"
+#include "WorkerPool.h"
 
 using namespace std;
 
@@ -81,7 +82,7 @@ namespace Force {
     }
   };
 
-  enum OptionIndex { UNKNOWN, CFG, HELP, LOGLEVEL, DUMP, NOASM, IMG, OPTIONS, SEED, TEST, NOISS, MAXINSTR, NUMCHIPS, NUMCORES, NUMTHREADS, OUTPUTWITHSEED, FAILOVERRIDE, GLOBALMODIFIER, ISSTRACEFILE };
+  enum OptionIndex { UNKNOWN, CFG, HELP, LOGLEVEL, DUMP, NOASM, IMG, BINIMG, OPTIONS, SEED, TEST, NOISS, MAXINSTR, NUMCHIPS, NUMCORES, NUMTHREADS, OUTPUTWITHSEED, FAILOVERRIDE, GLOBALMODIFIER, ISSTRACEFILE, NUMSEEDS, JOBS };
   const option::Descriptor usage[] =
     {
       {UNKNOWN,      0, "",   "",         Arg::None,     "USAGE: force [options]\n\n" "Options:" },
@@ -91,6 +92,7 @@ namespace Force {
       {DUMP,         0, "d", "dump",      Arg::NonEmpty, "  --dump, -d \tSpecify dumping option."},
       {NOASM,        0, "",  "noasm",     Arg::None,     "  --noasm, \tIndicate not to output assembly code."},
       {IMG,          0, "",  "img",       Arg::None,     "  --img, \tIndicate to output memory and registers image."},
+      {BINIMG,       0, "",  "binary-img", Arg::None,    "  --binary-img, \tIndicate to output memory and registers image in binary format, implies --img. fpix loads the memory image directly, utils/misc/image_to_text.py converts it to text."},
       {OPTIONS,      0, "o", "options",   Arg::NonEmpty, "  --options, -o \tSpecify test options."},
       {SEED,         0, "s", "seed",      Arg::Numeric,  "  --seed, -s  \tSpecify seed for test generation." },
       {TEST,         0, "t", "test",      Arg::NonEmpty, "  --test, -t  \tSpecify test template name to run." },
@@ -102,11 +104,14 @@ namespace Force {
       {OUTPUTWITHSEED, 0, "w",  "outputwithseed",  Arg::None, "  --outputwithseed, -w \tIndicate to generate outputs with seed number."},
       {FAILOVERRIDE, 0, "f",  "failOverride",  Arg::None, "  --failOverride, -f \tFORCE will fail when operand override is invalid."},
       {GLOBALMODIFIER, 0, "g",  "global-modifier",  Arg::NonEmpty, "  --global-modifier, -g \tGlobal modification file path."},
+      {NUMSEEDS,     0, "K", "num-seeds", Arg::Numeric,  "  --num-seeds, -K \tNumber of seeds to generate tests with in one process, outputs are suffixed with their seeds."},
+      {JOBS,         0, "j", "jobs",      Arg::Numeric,  "  --jobs, -j \tMaximum number of seeds generated concurrently with --num-seeds."},
 
 //      {ISSTRACEFILE, 0, "",  "apitrace",  Arg::NonEmpty, "  --apitrace, \tPath to simulator API trace file."},
       {UNKNOWN,      0, "",  "",          Arg::None,     "\nExamples:\n"
                                                          "  force -s 0x123 -t utils/smoke/test_force.py\n"
                                                          "  force -s 0x123 -l info -t utils/smoke/test_force.py\n"
+                                                         "  force -s 0x123 -K 16 -j 4 -t utils/smoke/test_force.py\n"
                                                          "  force --unknown -- --this_is_no_option\n"},
       {0,0,0,0,0,0}
     };
@@ -161,6 +166,7 @@ namespace Force {
       LOG(trace) << "Picked random seed 0x" << hex << test_seed << endl;
     }
     Random::Instance()->Seed(test_seed);
+    Config::Instance()->SetTestSeed(test_seed);
 
     string cfg_file = pDefConfig;
     if (options[CFG]) {
@@ -190,6 +196,12 @@ namespace Force {
       Config::Instance()->SetOutputImage(true);
     }
 
+    if (options[BINIMG]) {
+      LOG(notice) << "Output memory and registers image in binary format." << endl;
+      Config::Instance()->SetOutputImage(true);
+      Config::Instance()->SetOutputBinaryImage(true);
+    }
+
     if (options[NOISS]) {
       LOG(notice) << "NOT Simulating instructions during test generation." << endl;
     } else {
@@ -249,6 +261,28 @@ namespace Force {
       LOG(trace) << "User specified global modification file \"" << mod_file << "\"." << endl;
     }
 
+    if (options[NUMSEEDS]) {
+      option::Option* num_seeds_opt = options[NUMSEEDS].last();
+      uint64 num_seeds = parse_uint64(num_seeds_opt->arg);
+      if ((num_seeds == 0) or (num_seeds > MAX_UINT32)) {
+        LOG(fail) << "Number of seeds needs to be between 1 and " << dec << MAX_UINT32 << ", got " << num_seeds_opt->arg << "." << endl;
+        FAIL("invalid-number-of-seeds");
+      }
+      LOG(notice) << "Number of seeds: " << dec << num_seeds << endl;
+      Config::Instance()->SetSeedCount(num_seeds);
+    }
+
+    if (options[JOBS]) {
+      option::Option* jobs_opt = options[JOBS].last();
+      uint64 num_jobs = parse_uint64(jobs_opt->arg);
+      if ((num_jobs == 0) or (num_jobs > MAX_UINT32)) {
+        LOG(fail) << "Number of concurrent seeds needs to be between 1 and " << dec << MAX_UINT32 << ", got " << jobs_opt->arg << "." << endl;
+        FAIL("invalid-number-of-jobs");
+      }
+      LOG(notice) << "Maximum number of concurrent seeds: " << dec << num_jobs << endl;
+      Config::Instance()->SetParallelJobs(num_jobs);
+    }
+
     if (options[OPTIONS]) {
       option::Option* test_opt = options[OPTIONS].last();
       string opt_string = test_opt->arg;
@@ -297,6 +331,13 @@ namespace Force {
     ThreadPartitionerFactory::Initialize();
 
     Config * config_ptr = Config::Instance();
+    WorkerPool::Initialize();
+    bool threads_valid = false;
+    uint64 address_solving_threads = config_ptr->GetOptionValue(ESystemOptionType_to_string(ESystemOptionType::AddressSolvingThreads), threads_valid);
+    if (threads_valid) {
+      WorkerPool::Instance()->SetThreadCount(address_solving_threads);
+    }
+
     config_ptr->SetGlobalStateValue(EGlobalStateType::ElfMachine, arch_top->DefaultArchInfo()->ElfMachineType());
 
     arch_top->SetupSimAPIs();
@@ -324,6 +365,7 @@ namespace Force {
     RestoreLoopManagerRepository::Destroy();
     InstructionResults::Destroy();
     PcSpacing::Destroy();
+    WorkerPool::Destroy();
     ThreadPartitionerFactory::Destroy();
     MemoryManager::Destroy();
     ExceptionManager::Destroy();
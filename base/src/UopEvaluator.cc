@@ -0,0 +1,408 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "UopEvaluator.h"
+
+#include "Constraint.h"
+#include "Log.h"
+
+using namespace std;
+
+/*!
+  \file UopEvaluator.cc
+  \brief Code for in process evaluation and inversion of integer micro-ops.
+*/
+
+namespace Force {
+
+  // Micro-op operations, all taking four inputs so that they share the batch loop; unused inputs are ignored.
+  struct AddWithCarryOp {
+    static inline uint64 Apply(cuint64 a, cuint64 b, cuint64 carry, cuint64 unused) { return a + b + carry; }
+  };
+
+  struct MulOp {
+    static inline uint64 Apply(cuint64 a, cuint64 b, cuint64 unused, cuint64 unused2) { return a * b; }
+  };
+
+  struct MulAddOp {
+    static inline uint64 Apply(cuint64 a, cuint64 b, cuint64 addend, cuint64 unused) { return a * b + addend; }
+  };
+
+  struct DivOp {
+    // Division by zero yields all ones and the signed overflow case yields the dividend, as for the RISC-V divide instructions.
+    static inline uint64 Apply(cuint64 dividend, cuint64 divisor, cuint64 isSigned, cuint64 unused)
+    {
+      if (divisor == 0) {
+        return MAX_UINT64;
+      }
+
+      if (isSigned) {
+        int64 signed_dividend = int64(dividend);
+        int64 signed_divisor = int64(divisor);
+        if ((signed_divisor == -1) and (dividend == (uint64(1) << 63))) {
+          return dividend;
+        }
+        return uint64(signed_dividend / signed_divisor);
+      }
+
+      return dividend / divisor;
+    }
+  };
+
+  struct AddOp {
+    static inline uint64 Apply(cuint64 a, cuint64 b, cuint64 unused, cuint64 unused2) { return a + b; }
+  };
+
+  struct SubOp {
+    static inline uint64 Apply(cuint64 a, cuint64 b, cuint64 unused, cuint64 unused2) { return a - b; }
+  };
+
+  struct SubWithCarryOp {
+    static inline uint64 Apply(cuint64 a, cuint64 b, cuint64 carry, cuint64 unused) { return a + ~b + carry; }
+  };
+
+  /*!
+    Second operand of the shifted register micro-ops of the given size, shifted by the shift type 0 to 3 for LSL, LSR, ASR and ROR.
+  */
+  template <uint32 size>
+  struct ShiftedOperand {
+    static inline uint64 Mask() { return (size == 64) ? MAX_UINT64 : ((uint64(1) << size) - 1); }
+
+    static inline uint64 Shift(cuint64 value, cuint64 shiftType, cuint64 amount)
+    {
+      uint64 operand = value & Mask();
+      uint32 shift = amount & (size - 1);
+      if (shift == 0) {
+        return operand;
+      }
+
+      switch (shiftType & 3) {
+      case 0:
+        return (operand << shift) & Mask();
+      case 1:
+        return operand >> shift;
+      case 2:
+        return uint64((int64(operand << (64 - size)) >> (64 - size)) >> shift) & Mask();
+      default:
+        return ((operand >> shift) | (operand << (size - shift))) & Mask();
+      }
+    }
+  };
+
+  template <uint32 size>
+  struct AddShiftOp {
+    static inline uint64 Apply(cuint64 a, cuint64 b, cuint64 shiftType, cuint64 amount) { return (a + ShiftedOperand<size>::Shift(b, shiftType, amount)) & ShiftedOperand<size>::Mask(); }
+  };
+
+  template <uint32 size>
+  struct SubShiftOp {
+    static inline uint64 Apply(cuint64 a, cuint64 b, cuint64 shiftType, cuint64 amount) { return (a - ShiftedOperand<size>::Shift(b, shiftType, amount)) & ShiftedOperand<size>::Mask(); }
+  };
+
+  template <uint32 size>
+  struct AndShiftOp {
+    static inline uint64 Apply(cuint64 a, cuint64 b, cuint64 shiftType, cuint64 amount) { return a & ShiftedOperand<size>::Shift(b, shiftType, amount); }
+  };
+
+  template <uint32 size>
+  struct BicShiftOp {
+    static inline uint64 Apply(cuint64 a, cuint64 b, cuint64 shiftType, cuint64 amount) { return a & ~ShiftedOperand<size>::Shift(b, shiftType, amount) & ShiftedOperand<size>::Mask(); }
+  };
+
+  template <uint32 size>
+  struct EonShiftOp {
+    static inline uint64 Apply(cuint64 a, cuint64 b, cuint64 shiftType, cuint64 amount) { return (a ^ ~ShiftedOperand<size>::Shift(b, shiftType, amount)) & ShiftedOperand<size>::Mask(); }
+  };
+
+  template <uint32 size>
+  struct EorShiftOp {
+    static inline uint64 Apply(cuint64 a, cuint64 b, cuint64 shiftType, cuint64 amount) { return (a ^ ShiftedOperand<size>::Shift(b, shiftType, amount)) & ShiftedOperand<size>::Mask(); }
+  };
+
+  template <uint32 size>
+  struct OrrShiftOp {
+    static inline uint64 Apply(cuint64 a, cuint64 b, cuint64 shiftType, cuint64 amount) { return (a | ShiftedOperand<size>::Shift(b, shiftType, amount)) & ShiftedOperand<size>::Mask(); }
+  };
+
+  template <uint32 size>
+  struct OrnShiftOp {
+    static inline uint64 Apply(cuint64 a, cuint64 b, cuint64 shiftType, cuint64 amount) { return (a | ~ShiftedOperand<size>::Shift(b, shiftType, amount)) & ShiftedOperand<size>::Mask(); }
+  };
+
+  template <uint32 size>
+  struct MvnShiftOp {
+    static inline uint64 Apply(cuint64 b, cuint64 shiftType, cuint64 amount, cuint64 unused) { return ~ShiftedOperand<size>::Shift(b, shiftType, amount) & ShiftedOperand<size>::Mask(); }
+  };
+
+  template <class OpType>
+  static uint64 evaluate_tuple(const uint64* pInputs, cuint32 inputCount)
+  {
+    return OpType::Apply(pInputs[0], pInputs[1], (inputCount > 2) ? pInputs[2] : 0, (inputCount > 3) ? pInputs[3] : 0);
+  }
+
+  // Plain loop over the input columns, which the compiler can vectorize for the arithmetic operations.
+  template <class OpType>
+  static void evaluate_columns(const uint64* const* pInputColumns, cuint32 count, uint64* pResults)
+  {
+    const uint64* inputs0 = pInputColumns[0];
+    const uint64* inputs1 = pInputColumns[1];
+    const uint64* inputs2 = pInputColumns[2];
+    const uint64* inputs3 = pInputColumns[3];
+    for (uint32 i = 0; i < count; ++ i) {
+      pResults[i] = OpType::Apply(inputs0[i], inputs1[i], inputs2[i], inputs3[i]);
+    }
+  }
+
+  // Evaluate a micro-op with the evaluator type given, a single tuple or columns of tuples.
+  template <template <class> class Evaluator>
+  static void dispatch_uop(const EUop uop, typename Evaluator<AddOp>::Arguments& rArguments)
+  {
+    switch (uop) {
+    case UopAddWithCarry: Evaluator<AddWithCarryOp>::Run(rArguments); break;
+    case UopMul: Evaluator<MulOp>::Run(rArguments); break;
+    case UopMulAdd: Evaluator<MulAddOp>::Run(rArguments); break;
+    case UopDiv: Evaluator<DivOp>::Run(rArguments); break;
+    case UopAdd: Evaluator<AddOp>::Run(rArguments); break;
+    case UopSub: Evaluator<SubOp>::Run(rArguments); break;
+    case UopSubWithCarry: Evaluator<SubWithCarryOp>::Run(rArguments); break;
+    case UopAddShift32: Evaluator<AddShiftOp<32> >::Run(rArguments); break;
+    case UopAddShift64: Evaluator<AddShiftOp<64> >::Run(rArguments); break;
+    case UopSubShift32: Evaluator<SubShiftOp<32> >::Run(rArguments); break;
+    case UopSubShift64: Evaluator<SubShiftOp<64> >::Run(rArguments); break;
+    case UopAndShift32: Evaluator<AndShiftOp<32> >::Run(rArguments); break;
+    case UopAndShift64: Evaluator<AndShiftOp<64> >::Run(rArguments); break;
+    case UopBicShift32: Evaluator<BicShiftOp<32> >::Run(rArguments); break;
+    case UopBicShift64: Evaluator<BicShiftOp<64> >::Run(rArguments); break;
+    case UopEonShift32: Evaluator<EonShiftOp<32> >::Run(rArguments); break;
+    case UopEonShift64: Evaluator<EonShiftOp<64> >::Run(rArguments); break;
+    case UopEorShift32: Evaluator<EorShiftOp<32> >::Run(rArguments); break;
+    case UopEorShift64: Evaluator<EorShiftOp<64> >::Run(rArguments); break;
+    case UopOrrShift32: Evaluator<OrrShiftOp<32> >::Run(rArguments); break;
+    case UopOrrShift64: Evaluator<OrrShiftOp<64> >::Run(rArguments); break;
+    case UopOrnShift32: Evaluator<OrnShiftOp<32> >::Run(rArguments); break;
+    case UopOrnShift64: Evaluator<OrnShiftOp<64> >::Run(rArguments); break;
+    case UopMvnShift32: Evaluator<MvnShiftOp<32> >::Run(rArguments); break;
+    case UopMvnShift64: Evaluator<MvnShiftOp<64> >::Run(rArguments); break;
+    default:
+      ;
+    }
+  }
+
+  struct TupleArguments {
+    const uint64* mpInputs; //!< Input values.
+    uint32 mInputCount; //!< Number of input values.
+    uint64 mResult; //!< Result value.
+  };
+
+  template <class OpType>
+  struct TupleEvaluator {
+    typedef TupleArguments Arguments;
+    static void Run(Arguments& rArguments) { rArguments.mResult = evaluate_tuple<OpType>(rArguments.mpInputs, rArguments.mInputCount); }
+  };
+
+  struct ColumnArguments {
+    const uint64* mpInputColumns[4]; //!< Input columns, unused inputs pointing to a used column.
+    uint32 mCount; //!< Number of tuples.
+    uint64* mpResults; //!< Result column.
+  };
+
+  template <class OpType>
+  struct ColumnEvaluator {
+    typedef ColumnArguments Arguments;
+    static void Run(Arguments& rArguments) { evaluate_columns<OpType>(rArguments.mpInputColumns, rArguments.mCount, rArguments.mpResults); }
+  };
+
+  /*!
+    The solvable input x of an invertible micro-op is x = offset + result, or x = offset - result when negated.
+  */
+  struct AffineInverse {
+    uint64 mOffset; //!< Offset of the input value.
+    bool mNegated; //!< Indicate the input value decreases as the result increases.
+  };
+
+  static bool get_affine_inverse(const EUop uop, cuint32 inputIndex, const uint64* pInputs, AffineInverse& rInverse)
+  {
+    rInverse.mNegated = false;
+    switch (uop) {
+    case UopAdd:
+      if (inputIndex > 1) return false;
+      rInverse.mOffset = -pInputs[1 - inputIndex];
+      return true;
+    case UopAddWithCarry:
+      if (inputIndex > 1) return false;
+      rInverse.mOffset = -(pInputs[1 - inputIndex] + pInputs[2]);
+      return true;
+    case UopMulAdd:
+      if (inputIndex != 2) return false;
+      rInverse.mOffset = -(pInputs[0] * pInputs[1]);
+      return true;
+    case UopSub:
+      if (inputIndex == 0) {
+        rInverse.mOffset = pInputs[1];
+        return true;
+      }
+      if (inputIndex != 1) return false;
+      rInverse.mOffset = pInputs[0];
+      rInverse.mNegated = true;
+      return true;
+    case UopSubWithCarry:
+      if (inputIndex == 0) {
+        rInverse.mOffset = -(~pInputs[1] + pInputs[2]);
+        return true;
+      }
+      if (inputIndex != 1) return false;
+      rInverse.mOffset = pInputs[0] + pInputs[2] - 1;
+      rInverse.mNegated = true;
+      return true;
+    case UopAddShift64:
+      // the shifted operand isn't affine in the result, the 32-bit forms wrap around at 32 bits.
+      if (inputIndex != 0) return false;
+      rInverse.mOffset = -ShiftedOperand<64>::Shift(pInputs[1], pInputs[2], pInputs[3]);
+      return true;
+    case UopSubShift64:
+      if (inputIndex != 0) return false;
+      rInverse.mOffset = ShiftedOperand<64>::Shift(pInputs[1], pInputs[2], pInputs[3]);
+      return true;
+    default:
+      return false;
+    }
+  }
+
+  static void check_input_count(const EUop uop, cuint32 inputCount, const char* pCaller)
+  {
+    if (not UopEvaluator::IsSupported(uop)) {
+      LOG(fail) << "{UopEvaluator::" << pCaller << "} micro-op " << dec << uint32(uop) << " is not supported." << endl;
+      FAIL("unsupported-uop");
+    }
+
+    if (inputCount != UopEvaluator::InputCount(uop)) {
+      LOG(fail) << "{UopEvaluator::" << pCaller << "} micro-op " << dec << uint32(uop) << " expects " << UopEvaluator::InputCount(uop) << " inputs, given " << inputCount << "." << endl;
+      FAIL("unexpected-uop-input-count");
+    }
+  }
+
+  bool UopEvaluator::IsSupported(const EUop uop)
+  {
+    return InputCount(uop) != 0;
+  }
+
+  uint32 UopEvaluator::InputCount(const EUop uop)
+  {
+    switch (uop) {
+    case UopMul:
+    case UopAdd:
+    case UopSub:
+      return 2;
+    case UopAddWithCarry:
+    case UopMulAdd:
+    case UopDiv:
+    case UopSubWithCarry:
+    case UopMvnShift32:
+    case UopMvnShift64:
+      return 3;
+    case UopAddShift32:
+    case UopAddShift64:
+    case UopSubShift32:
+    case UopSubShift64:
+    case UopAndShift32:
+    case UopAndShift64:
+    case UopBicShift32:
+    case UopBicShift64:
+    case UopEonShift32:
+    case UopEonShift64:
+    case UopEorShift32:
+    case UopEorShift64:
+    case UopOrrShift32:
+    case UopOrrShift64:
+    case UopOrnShift32:
+    case UopOrnShift64:
+      return 4;
+    default:
+      return 0;
+    }
+  }
+
+  uint64 UopEvaluator::Evaluate(const EUop uop, const uint64* pInputs, cuint32 inputCount)
+  {
+    check_input_count(uop, inputCount, "Evaluate");
+
+    TupleArguments arguments = {pInputs, inputCount, 0};
+    dispatch_uop<TupleEvaluator>(uop, arguments);
+    return arguments.mResult;
+  }
+
+  void UopEvaluator::EvaluateBatch(const EUop uop, const vector<vector<uint64> >& rInputColumns, vector<uint64>& rResults)
+  {
+    check_input_count(uop, rInputColumns.size(), "EvaluateBatch");
+
+    uint32 batch_size = rInputColumns[0].size();
+    for (const auto& input_column : rInputColumns) {
+      if (input_column.size() != batch_size) {
+        LOG(fail) << "{UopEvaluator::EvaluateBatch} input columns differ in size." << endl;
+        FAIL("mismatched-uop-input-columns");
+      }
+    }
+
+    rResults.resize(batch_size);
+    ColumnArguments arguments;
+    for (uint32 i = 0; i < 4; ++ i) {
+      arguments.mpInputColumns[i] = (i < rInputColumns.size()) ? rInputColumns[i].data() : rInputColumns[1].data();
+    }
+    arguments.mCount = batch_size;
+    arguments.mpResults = rResults.data();
+    dispatch_uop<ColumnEvaluator>(uop, arguments);
+  }
+
+  bool UopEvaluator::IsInvertible(const EUop uop, cuint32 inputIndex)
+  {
+    uint64 inputs[4] = {0, 0, 0, 0};
+    AffineInverse inverse;
+    return get_affine_inverse(uop, inputIndex, inputs, inverse);
+  }
+
+  void UopEvaluator::InvertConstraint(const EUop uop, cuint32 inputIndex, const uint64* pInputs, cuint32 inputCount, ConstraintSet& rConstr)
+  {
+    check_input_count(uop, inputCount, "InvertConstraint");
+
+    AffineInverse inverse;
+    if (not get_affine_inverse(uop, inputIndex, pInputs, inverse)) {
+      LOG(fail) << "{UopEvaluator::InvertConstraint} input " << dec << inputIndex << " of micro-op " << uint32(uop) << " can not be solved for." << endl;
+      FAIL("uop-not-invertible");
+    }
+
+    if (inverse.mNegated) {
+      // ~(result - (offset + 1)) == offset - result
+      rConstr.SubtractFromElements(inverse.mOffset + 1);
+      rConstr.NotElements();
+    }
+    else {
+      rConstr.SubtractFromElements(-inverse.mOffset);
+    }
+  }
+
+  uint64 UopEvaluator::InvertValue(const EUop uop, cuint32 inputIndex, const uint64* pInputs, cuint32 inputCount, cuint64 result)
+  {
+    check_input_count(uop, inputCount, "InvertValue");
+
+    AffineInverse inverse;
+    if (not get_affine_inverse(uop, inputIndex, pInputs, inverse)) {
+      LOG(fail) << "{UopEvaluator::InvertValue} input " << dec << inputIndex << " of micro-op " << uint32(uop) << " can not be solved for." << endl;
+      FAIL("uop-not-invertible");
+    }
+
+    return inverse.mNegated ? (inverse.mOffset - result) : (inverse.mOffset + result);
+  }
+
+}
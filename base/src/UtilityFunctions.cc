@@ -501,6 +501,7 @@ namespace Force {
     EGenModeType::AddressShortage,
     EGenModeType::RecordingState,
     EGenModeType::RestoreStateLoop,
+    EGenModeType::NoBnt,
     EGenModeType(0)};
 
   const string get_gen_mode_name(EGenModeTypeBaseType gen_mode)
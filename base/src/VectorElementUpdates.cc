@@ -30,50 +30,74 @@ namespace Force
 
 bool VectorElementUpdate::GetPhysicalRegisterIndices(cuint32 physRegSize, cuint32 numPhysRegs, std::set<uint32>& rPhysicalRegisterIndices) const
 {
-  uint32 elt_offset = mElementIndex*mElementByteLength;
-  uint32 elt_upper_bound = elt_offset + mElementByteLength;   
+  uint32 first_index = 0;
+  uint32 end_index = 0;
+  GetPhysicalRegisterRange(physRegSize, numPhysRegs, first_index, end_index);
+
   bool contributed = false;
-  uint32 bottomIndex = elt_offset / physRegSize;
-  for(uint32 index = bottomIndex; index < numPhysRegs; ++index)
+  for(uint32 index = first_index; index < end_index; ++index)
   {
-    //Check that the first byte of the physical register actually intersects with the element.
-    if((index * physRegSize) < elt_upper_bound)
-    {
-      std::pair<std::set<uint32>::iterator, bool> result = rPhysicalRegisterIndices.insert(index);
-      contributed |= result.second;
-    }
+    std::pair<std::set<uint32>::iterator, bool> result = rPhysicalRegisterIndices.insert(index);
+    contributed |= result.second;
   }
 
   return contributed;
 }
 
+void VectorElementUpdate::GetPhysicalRegisterRange(cuint32 physRegSize, cuint32 numPhysRegs, uint32& rFirstIndex, uint32& rEndIndex) const
+{
+  uint32 elt_offset = mElementIndex*mElementByteLength;
+  uint32 elt_upper_bound = elt_offset + mElementByteLength;
+
+  //A physical register intersects with the element if its first byte is below the element's upper bound.
+  rFirstIndex = elt_offset / physRegSize;
+  rEndIndex = std::min(numPhysRegs, (elt_upper_bound + physRegSize - 1) / physRegSize);
+  if(rEndIndex < rFirstIndex)
+  {
+    rEndIndex = rFirstIndex;
+  }
+}
+
 void VectorElementUpdates::insert(uint32 processorId, const char* pRegisterName, uint32 eltIndex, uint32 eltByteWidth, const uint8_t* pEntireRegValue, uint32 regByteWidth, const char* pAccessType)
 {
   validateInsertArguments(processorId, pRegisterName, eltIndex, eltByteWidth, pEntireRegValue, regByteWidth, pAccessType);
 
   VectorElementUpdate tentative_update(eltIndex, eltByteWidth);
+  uint32 first_index = 0;
+  uint32 end_index = 0;
+  tentative_update.GetPhysicalRegisterRange(mPhysRegSize, mNumPhysRegs, first_index, end_index);
 
   if(strcmp(pAccessType, "read") == 0)
   {
-    mElementReadUpdates.push_back(tentative_update);
-
-    //Copy the value and register name if this was the first element added to the read updates vector.
-    if(mElementReadUpdates.size() == 1)
+    //Copy the register name if this was the first read update, and only the physical registers not read before.
+    if(not hasDirtyRegisters(mReadDirtyBits))
     {
-      memcpy(mRegisterValue.data(), pEntireRegValue, regByteWidth);
+      mReadValues.resize(mPhysRegSize * mNumPhysRegs);
       mVectorRegisterName = pRegisterName;
     }
+
+    for(uint32 phys_reg_idx = first_index; phys_reg_idx < end_index; ++phys_reg_idx)
+    {
+      if(not isDirty(mReadDirtyBits, phys_reg_idx))
+      {
+        markDirty(mReadDirtyBits, phys_reg_idx);
+        memcpy(&mReadValues[mPhysRegSize * phys_reg_idx], pEntireRegValue + mPhysRegSize * phys_reg_idx, mPhysRegSize);
+      }
+    }
   }
   else if(strcmp(pAccessType, "write") == 0)
   {
-    mElementWriteUpdates.push_back(tentative_update);
-
-    //Don't copy the value now because at this point the instruction hasn't completed. We need the name of the register though so we can read it from the simulator. 
-    //If this was the first writes vector update, copy the register name. 
-    if(mElementWriteUpdates.size() == 1)
+    //Don't copy the value now because at this point the instruction hasn't completed. We need the name of the register though so we can read it from the simulator.
+    //If this was the first writes vector update, copy the register name.
+    if(not hasDirtyRegisters(mWriteDirtyBits))
     {
       mVectorRegisterName = pRegisterName;
     }
+
+    for(uint32 phys_reg_idx = first_index; phys_reg_idx < end_index; ++phys_reg_idx)
+    {
+      markDirty(mWriteDirtyBits, phys_reg_idx);
+    }
   }
   else
   {
@@ -84,53 +108,59 @@ void VectorElementUpdates::insert(uint32 processorId, const char* pRegisterName,
 
 void VectorElementUpdates::translateElementToRegisterUpdates(SimAPI& rApiHandle, std::vector<RegUpdate>& rRegisterUpdates) const
 {
-
-  if(not mElementReadUpdates.empty() or not mElementWriteUpdates.empty())
+  if(hasDirtyRegisters(mReadDirtyBits))
   {
-    std::string access_type_temp = "read";
-    std::set<uint32> indices;
-
-    for(const VectorElementUpdate& update : mElementReadUpdates)
+    for(uint32 phys_reg_idx = 0; phys_reg_idx < mNumPhysRegs; ++phys_reg_idx)
     {
-      update.GetPhysicalRegisterIndices(mPhysRegSize, mNumPhysRegs, indices);
+      if(isDirty(mReadDirtyBits, phys_reg_idx))
+      {
+        appendRegisterUpdate(phys_reg_idx, &mReadValues[mPhysRegSize * phys_reg_idx], "read", rRegisterUpdates);
+      }
     }
+  }
 
-    for(uint32 phys_reg_idx : indices)
-    {
-      uint64 rval_temp = 0x0ull;
-      uint64 mask_temp = 0xffffffffffffffffull;  
-      memcpy(&rval_temp, &mRegisterValue.at(mPhysRegSize * phys_reg_idx), mPhysRegSize);
-
-      std::string regname_temp = mVectorRegisterName + mVectorPhysicalRegisterNames.at(phys_reg_idx);
-      RegUpdate reg_update_temp(mProcessorId, regname_temp.c_str(), rval_temp, mask_temp, access_type_temp.c_str());
-      rRegisterUpdates.push_back(reg_update_temp);
-    }    
-
-    std::vector<uint8_t> rval_buff;
-    if(not mElementWriteUpdates.empty())
+  if(hasDirtyRegisters(mWriteDirtyBits))
+  {
+    //Read each run of written physical registers from the simulator at once, skipping the untouched ones.
+    std::vector<uint8_t> rval_buff(mVectorLogicalRegisterWidth);
+    uint32 phys_reg_idx = 0;
+    while(phys_reg_idx < mNumPhysRegs)
     {
-      access_type_temp = "write";
-      rval_buff.resize(mVectorLogicalRegisterWidth);
-      rApiHandle.PartialReadLargeRegister(mProcessorId, mVectorRegisterName.c_str(), &rval_buff.at(0), mVectorLogicalRegisterWidth, 0);
+      if(not isDirty(mWriteDirtyBits, phys_reg_idx))
+      {
+        ++phys_reg_idx;
+        continue;
+      }
+
+      uint32 run_start = phys_reg_idx;
+      while((phys_reg_idx < mNumPhysRegs) and isDirty(mWriteDirtyBits, phys_reg_idx))
+      {
+        ++phys_reg_idx;
+      }
+
+      uint32 run_offset = mPhysRegSize * run_start;
+      rApiHandle.PartialReadLargeRegister(mProcessorId, mVectorRegisterName.c_str(), &rval_buff[run_offset], mPhysRegSize * (phys_reg_idx - run_start), run_offset);
+      for(uint32 run_idx = run_start; run_idx < phys_reg_idx; ++run_idx)
+      {
+        appendRegisterUpdate(run_idx, &rval_buff[mPhysRegSize * run_idx], "write", rRegisterUpdates);
+      }
     }
+  }
+}
 
-    indices.clear(); //Clear out because write updates are next
-    for(const VectorElementUpdate& update : mElementWriteUpdates)
-    {
-      update.GetPhysicalRegisterIndices(mPhysRegSize, mNumPhysRegs, indices);
-    }
+bool VectorElementUpdates::hasDirtyRegisters(const std::vector<uint64>& rDirtyBits) const
+{
+  return any_of(rDirtyBits.cbegin(), rDirtyBits.cend(), [](cuint64 dirtyWord) { return dirtyWord != 0; });
+}
 
-    for(uint32 phys_reg_idx : indices)
-    {
-      uint64 rval_temp = 0x0ull;
-      uint64 mask_temp = 0xffffffffffffffffull;  
-      memcpy(&rval_temp, &rval_buff.at(mPhysRegSize * phys_reg_idx), mPhysRegSize);
+void VectorElementUpdates::appendRegisterUpdate(cuint32 physRegIndex, const uint8_t* pPhysRegValue, const char* pAccessType, std::vector<RegUpdate>& rRegisterUpdates) const
+{
+  uint64 rval_temp = 0x0ull;
+  uint64 mask_temp = 0xffffffffffffffffull;
+  memcpy(&rval_temp, pPhysRegValue, std::min(mPhysRegSize, uint32(sizeof(rval_temp))));
 
-      std::string regname_temp = mVectorRegisterName + mVectorPhysicalRegisterNames.at(phys_reg_idx);
-      RegUpdate reg_update_temp(mProcessorId, regname_temp.c_str(), rval_temp, mask_temp, access_type_temp.c_str());
-      rRegisterUpdates.push_back(reg_update_temp);
-    }
-  }
+  std::string regname_temp = mVectorRegisterName + mVectorPhysicalRegisterNames.at(physRegIndex);
+  rRegisterUpdates.emplace_back(mProcessorId, regname_temp.c_str(), rval_temp, mask_temp, pAccessType);
 }
 
 void VectorElementUpdates::validateInsertArguments(uint32 processorId, const char* pRegisterName, uint32 eltIndex, uint32 eltByteWidth, const uint8_t* pEntireRegValue, uint32 regByteWidth, const char* pAccessType)
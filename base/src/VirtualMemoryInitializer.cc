@@ -51,6 +51,7 @@ namespace Force {
 
       mem_init_data1->SetDataWithAttributes(page_split.mPa1, page_split.mBank1, mem_data1, mem_attrs1, page_split.mSize1);
       mpMemoryManager->InitializeMemory(mem_init_data1);
+      mpRecordArchive->ReleaseMemoryInitRecord(mem_init_data1);
 
       MemoryInitRecord* mem_init_data2 = mpRecordArchive->GetMemoryInitRecord(mThreadId, page_split.mSize2, 1, memDataType, memAccessType);
       uint8* mem_data2 = new uint8[page_split.mSize2];
@@ -65,11 +66,13 @@ namespace Force {
 
       mem_init_data2->SetDataWithAttributes(page_split.mPa2, page_split.mBank2, mem_data2, mem_attrs2, page_split.mSize2);
       mpMemoryManager->InitializeMemory(mem_init_data2);
+      mpRecordArchive->ReleaseMemoryInitRecord(mem_init_data2);
     }
     else {
       MemoryInitRecord* mem_init_data = mpRecordArchive->GetMemoryInitRecord(mThreadId, page_split.mSize1, elementSize, memDataType, memAccessType);
       mem_init_data->SetDataWithAttributes(page_split.mPa1, page_split.mBank1, memData, memAttrs, page_split.mSize1);
       mpMemoryManager->InitializeMemory(mem_init_data);
+      mpRecordArchive->ReleaseMemoryInitRecord(mem_init_data);
     }
   }
 
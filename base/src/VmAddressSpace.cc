@@ -364,6 +364,11 @@ namespace Force {
     mpVirtualUsable->ApplyToConstraintSet(memDataType, memAccessType, mpGenerator->ThreadId(), rAddrReuseMode, constrSet);
   }
 
+  void VmAddressSpace::CommitVirtualUsableConstraint() const
+  {
+    mpVirtualUsable->CommitCachedUpdates(mpGenerator->ThreadId());
+  }
+
   void VmAddressSpace::MapEssentialPhysicalRegions()
   {
     auto mem_manager = mpGenerator->GetMemoryManager();
@@ -423,16 +428,19 @@ namespace Force {
     bool any_new_page_alloc = false;
     uint64 map_va = VA;
     uint64 size_remaining = size;
+    uint64 range_pa = 0;
+    bool range_planned = PlanPhysicalRange(VA, size, pPageReq, range_pa);
 
     do {
       LOG(info) << "{VmAddressSpace::MapAddressRange} mapping address 0x" << hex << map_va << " remaining_size 0x" << size_remaining << endl;
 
       bool new_page_alloc = false;
       const Page* map_page = nullptr;
+      uint64 preferred_pa = range_pa + (map_va - VA);
 
       try
       {
-        map_page = MapAddress(map_va, size_remaining, isInstr, pPageReq, new_page_alloc);
+        map_page = MapAddress(map_va, size_remaining, isInstr, pPageReq, (range_planned ? &preferred_pa : nullptr), new_page_alloc);
       }
       catch (const PagingError& err)
       {
@@ -638,7 +646,7 @@ namespace Force {
     return mpControlBlock->MaxPhysicalAddress();
   }
 
-  const Page* VmAddressSpace::MapAddress(uint64 VA, uint64 size, bool isInstr, const GenPageRequest* pPageReq, bool& newAlloc)
+  const Page* VmAddressSpace::MapAddress(uint64 VA, uint64 size, bool isInstr, const GenPageRequest* pPageReq, const uint64* pPreferredPA, bool& newAlloc)
   {
     const Page* map_page = GetPage(VA);
     if (nullptr != map_page)
@@ -661,6 +669,11 @@ namespace Force {
     GenPageRequest* updated_page_req = pPageReq->Clone();
     unique_ptr<GenPageRequest> page_req_storage(updated_page_req); // delete object when going out of scope.
 
+    uint64 pa_target = 0;
+    if ((nullptr != pPreferredPA) and (not updated_page_req->GetAttributeValue(EPageRequestAttributeType::PA, pa_target))) {
+      updated_page_req->SetAttributeValue(EPageRequestAttributeType::PreferredPA, *pPreferredPA);
+    }
+
     const Page* page_obj = SetupPageMapping(VA, size, is_sys_page, updated_page_req);
     CommitPage(page_obj, size);
 
@@ -668,6 +681,28 @@ namespace Force {
     return page_obj;
   }
 
+  bool VmAddressSpace::PlanPhysicalRange(uint64 VA, uint64 size, const GenPageRequest* pPageReq, uint64& rPA) const
+  {
+    // Giving each page of a large range its own random physical page fragments the usable constraints into one range per page, which
+    // makes mapping the rest of the range slow. Small ranges keep the per page allocation.
+    if ((size < msRangePlanMinSize) or mFlatMapped) {
+      return false;
+    }
+
+    uint64 pa_target = 0;
+    if ((nullptr != pPageReq) and (pPageReq->GenBoolAttributeDefaultFalse(EPageGenBoolAttrType::FlatMap) or pPageReq->GenBoolAttributeDefaultFalse(EPageGenBoolAttrType::ForceAlias)
+        or pPageReq->GetAttributeValue(EPageRequestAttributeType::PA, pa_target))) {
+      return false;
+    }
+
+    if (mpControlBlock->GetChoicesAdapter()->GetPlainPagingChoice("Range Physical Allocation") != 1) {
+      return false;
+    }
+
+    auto phys_page_manager = mpGenerator->GetMemoryManager()->GetPhysicalPageManager(mpControlBlock->DefaultMemoryBank());
+    return phys_page_manager->PlanPhysicalRange(VA, size, MaxPhysicalAddress(), rPA);
+  }
+
   const Page* VmAddressSpace::MapAddressForPA(uint64 PA, EMemBankType bank, uint64 size, bool isInstr, const GenPageRequest* pPageReq)
   {
     uint64 VA = 0;
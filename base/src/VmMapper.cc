@@ -248,6 +248,13 @@ namespace Force {
     mem_bank->ApplyUsableConstraint(memDataType, memAccessType, mpGenerator->ThreadId(), rAddrReuseMode, constrSet);
   }
 
+  void VmDirectMapper::CommitVirtualUsableConstraint() const
+  {
+    MemoryManager* mem_manager = mpGenerator->GetMemoryManager();
+    MemoryBank* mem_bank = mem_manager->GetMemoryBank(uint32(mMemoryBankType));
+    mem_bank->CommitUsableConstraint(mpGenerator->ThreadId());
+  }
+
   void VmDirectMapper::Activate()
   {
     if (mState == EVmStateType::Uninitialized)
@@ -421,6 +428,11 @@ namespace Force {
     return mpCurrentAddressSpace->ApplyVirtualUsableConstraint(memDataType, memAccessType, rAddrReuseMode, constrSet);
   }
 
+  void VmPagingMapper::CommitVirtualUsableConstraint() const
+  {
+    mpCurrentAddressSpace->CommitVirtualUsableConstraint();
+  }
+
   VmPagingMapper::~VmPagingMapper()
   {
     mpCurrentAddressSpace = nullptr;
@@ -94,16 +94,20 @@ namespace Force {
       return false;
     }
 
-    ConstraintSet physical_masked_usable(*pUsablePageAligned);
+    // The usable constraint can hold thousands of ranges once many pages are allocated, so it is only copied when it needs to be trimmed.
+    const ConstraintSet* physical_masked_usable = pUsablePageAligned;
+    unique_ptr<ConstraintSet> masked_usable_storage;
 
     //Need to further constrain the physical addresses based on the max supported physical address for current vmas
     uint64 max_physical_shifted = ( rSizeInfo.MaxPhysical() + 1ull ) >> page_shift;
     uint64 constr_upper = pUsablePageAligned->UpperBound();
     if (max_physical_shifted < constr_upper) {
-      physical_masked_usable.SubRange(max_physical_shifted, constr_upper);
+      masked_usable_storage.reset(new ConstraintSet(*pUsablePageAligned));
+      masked_usable_storage->SubRange(max_physical_shifted, constr_upper);
+      physical_masked_usable = masked_usable_storage.get();
     }
 
-    if (physical_masked_usable.IsEmpty()) {
+    if (physical_masked_usable->IsEmpty()) {
       LOG(trace) << "{VmRandomMappingStrategy::AllocatePhysicalPage} usable page aligned is empty after subtracting parts beyond max physical address." << endl;
       return false;
     }
@@ -111,7 +115,7 @@ namespace Force {
     uint64 pa_target = 0x0ull;
     if (pPageReq->GetAttributeValue(EPageRequestAttributeType::PA, pa_target)) {
       uint64 page_num = (pa_target >> page_shift);
-      if (physical_masked_usable.ContainsValue(page_num)) {
+      if (physical_masked_usable->ContainsValue(page_num)) {
         LOG(trace) << "{VmRandomMappingStrategy::AllocatePhysicalPage} specified PA 0x" << hex << pa_target << " works." << endl;
         rSizeInfo.UpdatePhysicalStart(pa_target);
         return true;
@@ -120,14 +124,28 @@ namespace Force {
       return false;
     }
 
+    uint64 pa_preferred = 0x0ull;
+    if (pPageReq->GetAttributeValue(EPageRequestAttributeType::PreferredPA, pa_preferred) and (((pa_preferred ^ VA) & rSizeInfo.mPageMask) == 0)) {
+      uint64 page_num = (pa_preferred >> page_shift);
+      if (physical_masked_usable->ContainsValue(page_num) and pBoundary->ContainsValue(pa_preferred)) {
+        LOG(trace) << "{VmRandomMappingStrategy::AllocatePhysicalPage} preferred PA 0x" << hex << pa_preferred << " works." << endl;
+        rSizeInfo.UpdatePhysicalStart(pa_preferred);
+        return true;
+      }
+    }
+
     try {
       while (true) {
-        uint64 page_num = physical_masked_usable.ChooseValue();
+        uint64 page_num = physical_masked_usable->ChooseValue();
         uint64 pa_start = (page_num << page_shift);
         rSizeInfo.UpdatePhysicalStart(pa_start);
         uint64 pa_translated = (VA & rSizeInfo.mPageMask) | pa_start;
         if (not pBoundary->ContainsValue(pa_translated)) {
-          physical_masked_usable.SubValue(page_num);
+          if (not masked_usable_storage) {
+            masked_usable_storage.reset(new ConstraintSet(*pUsablePageAligned));
+            physical_masked_usable = masked_usable_storage.get();
+          }
+          masked_usable_storage->SubValue(page_num);
           LOG(trace) << "{VmRandomMappingStrategy::AllocatePhysicalPage} translated PA 0x" << hex << pa_translated << " not in proper boundary." << endl;
           continue;
         }
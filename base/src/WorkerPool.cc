@@ -0,0 +1,197 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "WorkerPool.h"
+
+#include <sstream>
+
+#include "Log.h"
+
+using namespace std;
+
+/*!
+  \file WorkerPool.cc
+  \brief Code for the worker thread pool
+*/
+
+namespace Force {
+
+  WorkerPool* WorkerPool::mspWorkerPool = nullptr;
+
+  static thread_local bool stInJob = false; //!< Indicate the thread is working on a job.
+
+  void WorkerPool::Initialize()
+  {
+    if (nullptr == mspWorkerPool) {
+      mspWorkerPool = new WorkerPool();
+    }
+  }
+
+  void WorkerPool::Destroy()
+  {
+    delete mspWorkerPool;
+    mspWorkerPool = nullptr;
+  }
+
+  WorkerPool::WorkerPool()
+    : mThreadCount(1), mWorkers(), mRunMutex(), mMutex(), mJobCondition(), mDoneCondition(), mpTask(nullptr), mTaskCount(0), mNextTask(0), mJobNumber(0), mBusyWorkers(0), mTaskOutputs(), mException(), mExceptionTask(0), mStopping(false)
+  {
+  }
+
+  WorkerPool::~WorkerPool()
+  {
+    StopWorkers();
+  }
+
+  void WorkerPool::SetThreadCount(uint32 threadCount)
+  {
+    lock_guard<mutex> run_lock(mRunMutex);
+    StopWorkers();
+    mThreadCount = (threadCount > 0) ? threadCount : 1;
+    LOG(info) << "{WorkerPool::SetThreadCount} " << dec << mThreadCount << " threads." << endl;
+  }
+
+  void WorkerPool::Run(uint32 taskCount, const Task& rTask)
+  {
+    // run the tasks on the calling thread if there is nothing to share, if called from a task, or if another thread is
+    // running a job.
+    unique_lock<mutex> run_lock(mRunMutex, defer_lock);
+    if ((mThreadCount < 2) or (taskCount < 2) or stInJob or (not run_lock.try_lock())) {
+      for (uint32 i = 0; i < taskCount; ++ i) {
+        rTask(i);
+      }
+      return;
+    }
+
+    if (mWorkers.empty()) {
+      StartWorkers();
+    }
+
+    {
+      lock_guard<mutex> lock(mMutex);
+      mpTask = &rTask;
+      mTaskCount = taskCount;
+      mNextTask = 0;
+      mBusyWorkers = mWorkers.size();
+      mTaskOutputs.assign(taskCount, string());
+      mException = nullptr;
+      ++ mJobNumber;
+    }
+    mJobCondition.notify_all();
+
+    stInJob = true;
+    RunTasks();
+    stInJob = false;
+
+    exception_ptr task_exception;
+    {
+      unique_lock<mutex> lock(mMutex);
+      mDoneCondition.wait(lock, [this] { return mBusyWorkers == 0; });
+      mpTask = nullptr;
+      task_exception = mException;
+    }
+
+    for (const auto& task_output : mTaskOutputs) {
+      if (not task_output.empty()) {
+        gLog->Output(task_output);
+      }
+    }
+    mTaskOutputs.clear();
+
+    if (task_exception) {
+      try {
+        rethrow_exception(task_exception);
+      }
+      catch (const DeferredFailure& rFailure) {
+        rFailure.Report();
+      }
+    }
+  }
+
+  void WorkerPool::StartWorkers()
+  {
+    mStopping = false;
+    for (uint32 i = 1; i < mThreadCount; ++ i) {
+      mWorkers.emplace_back(&WorkerPool::WorkerLoop, this, mJobNumber);
+    }
+  }
+
+  void WorkerPool::StopWorkers()
+  {
+    {
+      lock_guard<mutex> lock(mMutex);
+      mStopping = true;
+    }
+    mJobCondition.notify_all();
+
+    for (auto& worker : mWorkers) {
+      worker.join();
+    }
+    mWorkers.clear();
+  }
+
+  void WorkerPool::WorkerLoop(uint64 jobNumber)
+  {
+    stInJob = true;
+    uint64 job_number = jobNumber;
+    while (true) {
+      {
+        unique_lock<mutex> lock(mMutex);
+        mJobCondition.wait(lock, [this, job_number] { return mStopping or (mJobNumber != job_number); });
+        if (mStopping) {
+          return;
+        }
+        job_number = mJobNumber;
+      }
+
+      RunTasks();
+
+      bool last_worker = false;
+      {
+        lock_guard<mutex> lock(mMutex);
+        last_worker = (-- mBusyWorkers == 0);
+      }
+      if (last_worker) {
+        mDoneCondition.notify_one();
+      }
+    }
+  }
+
+  void WorkerPool::RunTasks()
+  {
+    ostringstream log_stream;
+    Logger::CaptureThreadOutput(&log_stream);
+
+    uint32 task_index = 0;
+    while ((task_index = mNextTask ++) < mTaskCount) {
+      try {
+        (*mpTask)(task_index);
+      }
+      catch (...) {
+        lock_guard<mutex> lock(mMutex);
+        if ((not mException) or (task_index < mExceptionTask)) {
+          mException = current_exception();
+          mExceptionTask = task_index;
+        }
+      }
+
+      mTaskOutputs[task_index] = log_stream.str();
+      log_stream.str("");
+    }
+
+    Logger::CaptureThreadOutput(nullptr);
+  }
+
+}
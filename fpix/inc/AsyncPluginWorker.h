@@ -0,0 +1,77 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef Fpix_AsyncPluginWorker_H
+#define Fpix_AsyncPluginWorker_H
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Defines.h"
+#include "EnumsFPIX.h"
+#include "PluginEventQueue.h"
+
+namespace Force {
+
+  class DeferredFailure;
+  class SimPlugin;
+  class SimThreadEvent;
+
+  /*!
+   \class AsyncPluginWorker
+   \brief Worker thread replaying the events of one sim-thread to its asynchronous plugins.
+
+   Events are copied into a PluginEventQueue by the sim-thread and replayed, in order, on the worker thread. The worker never writes to the
+   output streams; log output of the plugins is captured and written by the sim-thread, the next time it queues or drains events. A FAIL
+   raised by a plugin is reported by the sim-thread as well, the remaining events are dropped.
+   */
+  class AsyncPluginWorker {
+  public:
+    AsyncPluginWorker(const std::map<ESimThreadEventType, std::vector<SimPlugin *> >& rSubscribers, uint32_t queueDepth); //!< Constructor, start the worker thread.
+    ~AsyncPluginWorker(); //!< Destructor, stop the worker thread.
+    ASSIGNMENT_OPERATOR_ABSENT(AsyncPluginWorker);
+    COPY_CONSTRUCTOR_ABSENT(AsyncPluginWorker);
+
+    bool IsSubscribed(ESimThreadEventType eventType) const { return mSubscribers.count(eventType) > 0; } //!< Return true if some plugin of the worker handles the event type.
+    void Queue(SimThreadEvent& rEvent, uint64 pc); //!< Copy the event for the worker, waiting while the queue is full.
+    void Drain(); //!< Wait for the worker to replay all queued events, then write their log output.
+    void Stop(); //!< Replay all queued events, then stop the worker thread.
+    void WriteOutput(); //!< Write the log output captured on the worker so far, then report a failure raised on the worker.
+    int ReturnCode() const { return mReturnCode.load(std::memory_order_acquire); } //!< Return the first non-zero plugin return code, 0 if none.
+    uint64_t EventCount() const { return mEventCount; } //!< Return the number of events queued.
+    uint64_t FullWaits() const { return mQueue.FullWaits(); } //!< Return the number of times the queue was full.
+  private:
+    void Run(); //!< Worker thread body.
+  private:
+    std::map<ESimThreadEventType, std::vector<SimPlugin *> > mSubscribers; //!< Plugins handling each event type.
+    PluginEventQueue mQueue; //!< Events waiting for the worker.
+    std::atomic<bool> mStop; //!< Set to stop the worker once the queue is empty.
+    std::atomic<int> mReturnCode; //!< First non-zero return code from a plugin.
+    uint64_t mEventCount; //!< Number of events queued.
+    std::mutex mOutputMutex; //!< Guards mOutput.
+    std::string mOutput; //!< Log output of the worker not yet written.
+    std::unique_ptr<DeferredFailure> mpFailure; //!< Failure raised by a plugin on the worker, guarded by mOutputMutex.
+    std::atomic<bool> mOutputPending; //!< True if mOutput is not empty or mpFailure is set.
+    std::thread mThread; //!< Worker thread, started last.
+  };
+
+}
+
+#endif
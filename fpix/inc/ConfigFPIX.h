@@ -69,7 +69,9 @@ namespace Force {
         mVectorRegLen(-1),  //!< Command line option is vlen
         mMaxVectorElemWidth(-1),  //!< Command line option is elen
         mExitOnBranchToSelf(-1),  //!< Command line option is exit_loop
-        mAutoInitMem(false)  //!< Command line option is auto_init_mem
+        mAutoInitMem(false),  //!< Command line option is auto_init_mem
+        mStepQuantum(1),  //!< Command line option is step_quantum
+        mAsyncPluginQueueDepth(0)  //!< Command line option is async_plugins
     {};
     virtual ~ConfigFPIX() {};
 
@@ -112,6 +114,12 @@ namespace Force {
     bool AutoInitMem() const { return mAutoInitMem; };
     void SetAutoInitMem(bool AutoInitMem) { mAutoInitMem = AutoInitMem; };
 
+    int StepQuantum() const { return mStepQuantum; };
+    void SetStepQuantum(int StepQuantum) { mStepQuantum = StepQuantum; };
+
+    int AsyncPluginQueueDepth() const { return mAsyncPluginQueueDepth; };
+    void SetAsyncPluginQueueDepth(int AsyncPluginQueueDepth) { mAsyncPluginQueueDepth = AsyncPluginQueueDepth; };
+
     // virtual class methods - sub-class accessor methods or remove call to OptionTBD if related feature is supported in simulator...
 
     void OptionTBD() const { throw std::runtime_error("Internal Error: Reference to unsupported simulator option."); };
@@ -177,6 +185,8 @@ namespace Force {
     int mMaxVectorElemWidth;  //!< Command line option is elen
     int mExitOnBranchToSelf; //!< Command line option is exit_loop
     bool mAutoInitMem; //!< Command line option is auto_init_mem
+    int mStepQuantum; //!< Command line option is step_quantum
+    int mAsyncPluginQueueDepth; //!< Command line option is async_plugins
     
     friend class ConfigParserFPIX;
  };
@@ -74,6 +74,8 @@ namespace Force {
     PLUGIN = 13,
     PLUGINS_OPTIONS = 14,
     AUTO_INIT_MEM_OPT = 15,
+    STEP_QUANTUM_OPT = 16,
+    ASYNC_PLUGINS_OPT = 17,
   };
   extern unsigned char EOptionIndexSize;
   extern const std::string EOptionIndex_to_string(EOptionIndex in_enum); //!< Get string name for enum.
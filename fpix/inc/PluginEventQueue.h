@@ -0,0 +1,81 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef Fpix_PluginEventQueue_H
+#define Fpix_PluginEventQueue_H
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "Defines.h"
+#include "EnumsFPIX.h"
+#include "SimAPI.h"
+
+namespace Force {
+
+  class SimThreadEvent;
+
+  /*!
+   \struct PluginEventRecord
+   \brief Self-contained copy of a sim-thread event, replayed to asynchronous plugins on a worker thread.
+
+   Single register/memory/mmu/exception updates are stored as one element vectors.
+   */
+  struct PluginEventRecord {
+    PluginEventRecord() : mEventType(ESimThreadEventType::UNKNOWN_EVENT), mCpuId(0), mPC(0), mRegUpdates(), mMemUpdates(), mMmuEvents(), mExcUpdates() { }
+
+    void Assign(SimThreadEvent& rEvent, uint64 pc); //!< Copy event data, reusing the storage of this record.
+
+    ESimThreadEventType mEventType; //!< Event type.
+    uint32_t mCpuId; //!< Cpu ID the event was signaled on.
+    uint64 mPC; //!< PC of the cpu at the time the event was signaled, only captured for PRE_STEP events.
+    std::vector<RegUpdate> mRegUpdates; //!< Register updates.
+    std::vector<MemUpdate> mMemUpdates; //!< Memory updates.
+    std::vector<MmuEvent> mMmuEvents; //!< MMU events.
+    std::vector<ExceptionUpdate> mExcUpdates; //!< Exception updates.
+  };
+
+  /*!
+   \class PluginEventQueue
+   \brief Bounded single-producer, single-consumer ring of plugin event records.
+
+   The sim-thread is the only producer and the plugin worker the only consumer, so records are delivered in the order they were
+   signaled. Records are filled and consumed in place; a full ring blocks the producer until the worker catches up.
+   */
+  class PluginEventQueue {
+  public:
+    explicit PluginEventQueue(uint32_t depth); //!< Constructor, depth is rounded up to a power of 2.
+    ~PluginEventQueue() { } //!< Destructor.
+    ASSIGNMENT_OPERATOR_ABSENT(PluginEventQueue);
+    COPY_CONSTRUCTOR_ABSENT(PluginEventQueue);
+
+    PluginEventRecord& BeginPush(); //!< Producer: wait for a free slot and return it for filling.
+    void EndPush(); //!< Producer: publish the slot returned by BeginPush.
+    PluginEventRecord* Front(); //!< Consumer: return the oldest published record, or nullptr if the queue is empty.
+    void Pop(); //!< Consumer: release the record returned by Front.
+    bool Empty() const { return mHead.load(std::memory_order_acquire) == mTail.load(std::memory_order_acquire); } //!< Return true if all records were consumed.
+    uint64_t FullWaits() const { return mFullWaits; } //!< Return number of times the producer had to wait for a free slot.
+  private:
+    std::vector<PluginEventRecord> mRecords; //!< Ring storage.
+    uint64_t mMask; //!< Ring index mask.
+    std::atomic<uint64_t> mHead; //!< Index of the next record to consume.
+    std::atomic<uint64_t> mTail; //!< Index of the next record to publish.
+    uint64_t mFullWaits; //!< Producer back-pressure count.
+  };
+
+}
+
+#endif
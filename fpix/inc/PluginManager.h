@@ -31,14 +31,19 @@ namespace Force {
   /*!
    \class PluginManager
    \brief Simulator plugins manager class.
+
+   With a non-zero async queue depth, plugins that declare themselves asynchronous are not signaled from the sim-thread. Their events
+   are copied into a bounded queue and replayed, in order, by an AsyncPluginWorker owned by this manager. Test end is the exception: it is
+   signaled to them on the sim-thread, once the worker has replayed all earlier events.
    */
 
     class SimThreadEvent;
+    class AsyncPluginWorker;
 
   class PluginManager {
   public:
-    PluginManager(std::vector<ESimThreadEventType> event_types);  //!< create/hook-up plugin instances, senders for a sim-thread
-    ~PluginManager();                        //!< delete event senders
+    PluginManager(std::vector<ESimThreadEventType> event_types, uint32_t asyncQueueDepth = 0);  //!< create/hook-up plugin instances, senders for a sim-thread
+    ~PluginManager();                        //!< stop async plugin worker, delete event senders
 
     ASSIGNMENT_OPERATOR_ABSENT(PluginManager);
     COPY_CONSTRUCTOR_ABSENT(PluginManager);
@@ -53,11 +58,15 @@ namespace Force {
 
     void Signal(SimThreadEvent &pData);  //!< event 'payload' data is required...
 
+  private:
+    void SignalAsync(SimThreadEvent &pData); //!< pass event on to the async plugins
   private:
     std::vector<SimPlugin *> mPlugins;  //!< plugin instances for a particular sim-thread
     //std::map<std::string, Force::plugin_node> * mpPluginNodesMap; //!< pointer to map by plugin name that can provide options strings that were specified in the config file.
     //std::string * mpGlobalPluginsOptions; //!< pointer to universal plugins options from config file as well as universal and specific options collected from the command line.
     std::map<ESimThreadEventType, Sender<ESimThreadEventType> *> mSenders;   //<! a separate sender entry for each sim event type. index is event type
+    std::vector<SimPlugin *> mAsyncTestEndPlugins; //!< async plugin instances subscribed to test end, signaled on the sim-thread
+    AsyncPluginWorker *mpAsyncWorker;    //!< worker replaying events to async plugins, nullptr if no plugin runs asynchronously
   };
 
 }
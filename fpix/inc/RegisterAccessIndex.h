@@ -0,0 +1,120 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef Fpix_RegisterAccessIndex_H
+#define Fpix_RegisterAccessIndex_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "EnumsFPIX.h"
+
+namespace Force {
+
+  /*!
+   \class RegisterAccessIndex
+   \brief Last access table for register dependency plugins.
+
+   The access history is a sequence of numbered slots, eg, one per stepped instruction, of which only the most recent
+   WindowSize() are visible. Instead of keeping the history and scanning it for the latest access to a register, the
+   index remembers, per cpu and register file, the slot and type of each register's latest access. A lookup is then a
+   table access plus a window check, independent of the window size.
+
+   Header only, so the plugin shared objects can use it without linking fpix sources.
+   */
+  class RegisterAccessIndex {
+  public:
+    struct LastAccess {
+      LastAccess() : mSlot(0), mAccessType(EAccessAgeType::Invalid) { }
+
+      uint64_t mSlot; //!< Slot number of the access, 0 if the register was never accessed.
+      EAccessAgeType mAccessType; //!< Type of the access.
+    };
+
+    RegisterAccessIndex() : mCurrentSlot(0), mWindowSize(0), mHarts() { } //!< Constructor.
+
+    uint64_t CurrentSlot() const { return mCurrentSlot; } //!< Return number of the most recent slot.
+    uint64_t WindowSize() const { return mWindowSize; } //!< Return number of visible slots.
+
+    void NewSlot() //!< Start a new history slot, growing the window by one.
+    {
+      ++ mCurrentSlot;
+      ++ mWindowSize;
+    }
+
+    void DropOldestSlot() //!< Shrink the window by one, hiding the oldest visible slot.
+    {
+      if (mWindowSize) {
+        -- mWindowSize;
+      }
+    }
+
+    void Record(uint64_t cpuId, EOperandType regType, uint32_t regNum, EAccessAgeType accessType) //!< Record an access in the current slot.
+    {
+      LastAccess& last_access = Entry(cpuId, regType, regNum);
+      last_access.mSlot = mCurrentSlot;
+      last_access.mAccessType = accessType;
+    }
+
+    //!< Return the latest access to the register if it is visible, nullptr otherwise. rDistance is 1 for the current slot, 2 for the one before...
+    const LastAccess* Lookup(uint64_t cpuId, EOperandType regType, uint32_t regNum, uint64_t& rDistance) const
+    {
+      auto hart_iter = mHarts.find(cpuId);
+      if (hart_iter == mHarts.end()) {
+        return nullptr;
+      }
+
+      const auto& reg_files = hart_iter->second;
+      EOperandTypeBaseType file_index = EOperandTypeBaseType(regType);
+      if (file_index >= reg_files.size() or regNum >= reg_files[file_index].size()) {
+        return nullptr;
+      }
+
+      const LastAccess& last_access = reg_files[file_index][regNum];
+      if (last_access.mSlot == 0 or last_access.mSlot + mWindowSize <= mCurrentSlot) {
+        return nullptr;
+      }
+
+      rDistance = mCurrentSlot - last_access.mSlot + 1;
+      return &last_access;
+    }
+
+  private:
+    LastAccess& Entry(uint64_t cpuId, EOperandType regType, uint32_t regNum) //!< Return table entry of a register, growing the tables as needed.
+    {
+      auto& reg_files = mHarts[cpuId];
+      EOperandTypeBaseType file_index = EOperandTypeBaseType(regType);
+      if (file_index >= reg_files.size()) {
+        reg_files.resize(file_index + 1);
+      }
+
+      auto& reg_file = reg_files[file_index];
+      if (regNum >= reg_file.size()) {
+        reg_file.resize(regNum + 1);
+      }
+
+      return reg_file[regNum];
+    }
+
+  private:
+    uint64_t mCurrentSlot; //!< Number of the most recent slot, slots are numbered from 1.
+    uint64_t mWindowSize; //!< Number of visible slots.
+    std::unordered_map<uint64_t, std::vector<std::vector<LastAccess>>> mHarts; //!< Per cpu, per register file, latest access of each register.
+  };
+
+}
+
+#endif
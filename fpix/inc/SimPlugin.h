@@ -26,6 +26,8 @@ using namespace std;
 
 namespace Force {
 
+  struct PluginEventRecord;
+
   /*!
    \class SimPlugin
    \brief Simulator plugin base class.
@@ -38,7 +40,8 @@ namespace Force {
     SimPlugin() : 
       mCpuID(0),    //!< current cpu ID, sim-ptr
       mSimPtr(0),   //!< NOTE: updated each time from HandleNotification
-      mReturnCode(-1)    //!< plugin return code
+      mReturnCode(-1),    //!< plugin return code
+      mRecordPC(0)   //!< PC captured with a replayed pre-step event
     {};
     virtual ~SimPlugin() {};
 
@@ -50,12 +53,21 @@ namespace Force {
 
     virtual void parsePluginsOptions(std::map<std::string, std::string> &aRPluginsOptions) = 0; //!< sub-class must supply this method
 
+    //!< an asynchronous plugin may be run on a worker thread, from copies of the sim events. A plugin can declare itself asynchronous
+    //!< if its event methods only look at the updates passed to them and at CurrentPC(), and only write output through LOG, which the
+    //!< sim-thread writes out for the worker. It must not use SimPtr(), which is nullptr while events are replayed, and its return
+    //!< codes reach the sim-thread a few events late. atTestEnd() is still called on the sim-thread, after all earlier events...
+
+    virtual bool IsAsynchronous() const { return false; };
+
     //<! handle sim event notification...
 
     void HandleNotification(const Sender<ESimThreadEventType>* sender, ESimThreadEventType eventType, Object* pPayload); 
+    int HandleRecord(PluginEventRecord &rRecord); //!< replay a copied sim event, return the plugin return code
 
     uint32_t CpuID() const { return mCpuID; };    //!< current cpu ID
     SimAPI  *SimPtr() const { return mSimPtr; };  //!<   "     sim-ptr
+    uint64 CurrentPC() const;                     //!< PC of current cpu, valid from onPreStep in both sync and async modes
 
     //!< plugins can optionally set a return code should some error be detected
 
@@ -79,11 +91,16 @@ namespace Force {
 
     virtual void atTestEnd() { };         //!< at test ends, after last instruction was stepped
 
+  private:
+    void Dispatch(ESimThreadEventType eventType, std::vector<RegUpdate> *reg_updates, std::vector<MemUpdate> *mem_updates,
+                  std::vector<MmuEvent> *mmu_events, std::vector<ExceptionUpdate> *exceptions, RegUpdate *reg_update,
+                  MemUpdate *mem_update, ExceptionUpdate *exception); //!< call the event method for this event type
   private:
     uint32_t mCpuID;    //!< current cpu ID, sim-ptr
     SimAPI  *mSimPtr;   //!< NOTE: updated each time from HandleNotification
 
     int mReturnCode;    //!< plugin return code
+    uint64 mRecordPC;   //!< PC captured with a replayed pre-step event
   };
 
 }
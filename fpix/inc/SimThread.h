@@ -44,6 +44,7 @@ namespace Force {
 
       bool Done() const;            //!< return true if no more events to process
       bool EndTestReached() const;  //!<   "      "  if a thread has hit end-test condition
+      bool NextEventIsLocal() const; //!<   "      "  if the next event is a step the simulator reports as local to this cpu
 
       bool GetPC(uint64_t &PC, std::vector<RegUpdate> &reg_updates) const {
          return SimUtils::GetRegisterUpdate(PC,reg_updates,"PC", "write");
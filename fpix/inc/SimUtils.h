@@ -58,6 +58,7 @@ class SimUtils {
 
  private:
   static bool LoadTestFromELF(uint64_t &entry_point, SimAPI *sim_ptr, std::string &elf_file, bool is_secondary = false);   //!< load from a single ELF file, return entry-point
+  static bool LoadTestFromImage(uint64_t &entry_point, SimAPI *sim_ptr, std::string &image_file);                           //!< load from a single memory mapped image, return entry-point
   static SimAPI* mspSimAPI; //!< Pointer to SimAPI object.
 };
 
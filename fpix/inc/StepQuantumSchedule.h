@@ -0,0 +1,65 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef Fpix_StepQuantumSchedule_H
+#define Fpix_StepQuantumSchedule_H
+
+#include <cstdint>
+#include <vector>
+
+#include "Defines.h"
+
+namespace Force {
+
+  /*!
+   \class StepQuantumSchedule
+   \brief Decide which events each sim-thread may process in its turn, so that stepping with a quantum keeps the round-robin order of
+   every event that can interact with other cpus.
+
+   Strict round-robin processes event p of every sim-thread in pass p, in cpu order. Here a sim-thread always processes its own
+   event of the current pass. Within the same turn it may then run ahead, up to the quantum, but only over steps the simulator reports
+   as local before stepping them, ie, steps that neither access memory nor change state other cpus can observe. Any other event
+   waits for its own pass, and passes in which no sim-thread has its own event left are skipped. Events that can interact with other cpus are thus processed in exactly the round-robin order, and the
+   all-stop signal each sim-thread sees is the one round-robin would give it.
+   */
+  class StepQuantumSchedule {
+  public:
+    StepQuantumSchedule(uint32_t threadCount, uint32_t quantum); //!< Constructor, a quantum of 1 is strict round-robin.
+    ~StepQuantumSchedule() { } //!< Destructor.
+    ASSIGNMENT_OPERATOR_ABSENT(StepQuantumSchedule);
+    COPY_CONSTRUCTOR_ABSENT(StepQuantumSchedule);
+
+    bool InOwnPass(uint32_t threadIndex) const { return mPositions[threadIndex] == mPass; } //!< Return true if the next event of the sim-thread is its event of the current pass.
+    bool MayProcess(uint32_t threadIndex, uint32_t turnEvents, bool nextEventIsLocal) const; //!< Return true if the sim-thread may process its next event, having processed turnEvents events in this turn.
+    bool AllStop(uint32_t threadIndex) const; //!< Return the all-stop signal for the next event of the sim-thread, ie, whether every sim-thread reached end-test in an earlier pass.
+    void EventProcessed(uint32_t threadIndex, bool endTestReached); //!< Record that the sim-thread processed its next event, and whether it has reached end-test.
+    void ThreadFinished(uint32_t threadIndex) { mFinished[threadIndex] = true; } //!< Record that the sim-thread has no more events.
+    void EndPass(); //!< Move on to the next pass in which some unfinished sim-thread has its own event.
+    uint64_t Pass() const { return mPass; } //!< Return the current pass.
+    uint64_t Position(uint32_t threadIndex) const { return mPositions[threadIndex]; } //!< Return the number of events the sim-thread has processed.
+    uint64_t RunAheadCount() const { return mRunAheadCount; } //!< Return the number of events processed ahead of their pass.
+  private:
+    static const uint64_t NOT_REACHED = uint64_t(-1); //!< End-test pass of a sim-thread that has not reached end-test.
+    uint32_t mQuantum; //!< Maximum number of events a sim-thread processes per turn.
+    uint64_t mPass; //!< Current round-robin pass.
+    uint64_t mRunAheadCount; //!< Number of events processed ahead of their pass.
+    std::vector<uint64_t> mPositions; //!< Number of events processed by each sim-thread, ie, the pass of its next event.
+    std::vector<bool> mFinished; //!< Whether each sim-thread has no more events.
+    std::vector<uint64_t> mEndTestPasses; //!< Pass of the event after which each sim-thread reached end-test, NOT_REACHED if it has not.
+  };
+
+}
+
+#endif
@@ -24,6 +24,7 @@
 #include "EnumsFPIX.h"
 #include "Log.h"
 #include "ParseGuide.h"
+#include "RegisterAccessIndex.h"
 #include "SimAPI.h"
 #include "SimEvent.h"
 #include "SimPlugin.h"
@@ -229,8 +230,7 @@ class RegDepCounter : public Force::SimPlugin
 {
     public:
         RegDepCounter() : 
-          _mRegisterAccesses(),
-          _mAccessStages(),
+          _mAccessIndex(),
           _mDepDepth(30),
           _mNumBins(4),
           _mBasicDependencyCounts(),
@@ -253,6 +253,8 @@ class RegDepCounter : public Force::SimPlugin
             _mInRandomInstructions = false; // set to true when we appear to be in random code
         };
       
+        bool IsAsynchronous() const { return true; };
+
         bool IsSupported(ESimThreadEventType eventType) const 
         { 
             bool is_supported = false;
@@ -317,10 +319,7 @@ class RegDepCounter : public Force::SimPlugin
             } 
             else 
             {
-                uint64 rval = 0;
-                uint64 rmask = 0;
-                SimPtr()->ReadRegister(CpuID(),"PC",&rval,&rmask);
-                if (rval >= _mRandomInstructionsStart) 
+                if (CurrentPC() >= _mRandomInstructionsStart) 
                   _mInRandomInstructions = true;
             }
         }
@@ -386,8 +385,8 @@ class RegDepCounter : public Force::SimPlugin
                 }
             }
       
-            //push back a new access stage
-            _mAccessStages.push_back(std::vector<struct RegAccess>());
+            //start a new access stage
+            _mAccessIndex.NewSlot();
       
             // record all new accesses...
             for (auto i = new_accesses.begin(); i != new_accesses.end(); i++) 
@@ -404,78 +403,67 @@ class RegDepCounter : public Force::SimPlugin
         {
             LOG(debug) << "RegDepCounter: GP reg access: " << Force::EOperandType_to_string(arRegAccess.mRegisterType) << std::to_string(arRegAccess.mRegisterNumber) << "/" << Force::EAccessAgeType_to_string(arRegAccess.mAccessType) << endl;
       
-            _mRegisterAccesses.push_back(arRegAccess);
-            _mAccessStages.back().push_back(arRegAccess);
+            _mAccessIndex.Record(arRegAccess.mCpuID, arRegAccess.mRegisterType, arRegAccess.mRegisterNumber, arRegAccess.mAccessType);
             
-            // track only last N dependencies...
-            if (_mRegisterAccesses.size() > _mDepDepth) 
+            // track only last N access stages...
+            if(_mAccessIndex.WindowSize() > _mDepDepth)
             {
-                _mRegisterAccesses.erase(_mRegisterAccesses.begin());
-            }
-      
-            if(_mAccessStages.size() > _mDepDepth)
-            {
-                _mAccessStages.erase(_mAccessStages.begin());
+                _mAccessIndex.DropOldestSlot();
             }
         }
       
         bool CheckForDependency(const struct RegAccess & arRegAccess) 
         {
-            LOG(debug) << "RegDepCounter: pipe size: " << _mRegisterAccesses.size() << ". Checking for new dependencies..." << endl;
+            LOG(debug) << "RegDepCounter: window size: " << _mAccessIndex.WindowSize() << ". Checking for new dependencies..." << endl;
       
-            //Iterate from the most recent to oldest accesses
-            for(auto stage = _mAccessStages.rbegin(); stage != _mAccessStages.rend(); ++stage)
+            //A dependency is counted when a register is accessed again in the same access history window. The index holds the most recent access of each register.
+            uint64_t distance = 0;
+            const RegisterAccessIndex::LastAccess* last_access = _mAccessIndex.Lookup(arRegAccess.mCpuID, arRegAccess.mRegisterType, arRegAccess.mRegisterNumber, distance);
+            if(last_access != nullptr)
             {
-                for(auto i = (*stage).begin(); i != (*stage).end(); ++i)
-                {  
-                    //A dependency is counted when a register is accessed again in the same access history window
-                    if((*i).is_same_register(arRegAccess)) 
-                    {
-                        string access_sequence = Force::EAccessAgeType_to_string(arRegAccess.mAccessType) + " After " + Force::EAccessAgeType_to_string((*i).mAccessType);
+                string access_sequence = Force::EAccessAgeType_to_string(arRegAccess.mAccessType) + " After " + Force::EAccessAgeType_to_string(last_access->mAccessType);
 
-                        if(_mBasicDependencyCounts.find(access_sequence) == _mBasicDependencyCounts.end())
-                        {
-                            _mBasicDependencyCounts[access_sequence] = 1;
-                        }
-                        else
-                        {
-                            _mBasicDependencyCounts[access_sequence] += 1;
-                        }
-      
-                        //Compute dependency depth
-                        uint32_t depth = std::distance(_mAccessStages.rbegin(), stage) + 1;
-      
-                        //Translate access sequence to EDependencyType 
-                        Force::EDependencyType dep_type;
-                        if((*i).mAccessType == Force::EAccessAgeType::Write)
-                        {
-                            dep_type = Force::EDependencyType::OnTarget;
-                        }
-                        else if((*i).mAccessType == Force::EAccessAgeType::Read)
-                        {
-                            dep_type = Force::EDependencyType::OnSource;
-                        }
-                        
-                        //Create a record to search the dependency record for matches 
-                        Force::EOperandType reg_type = arRegAccess.mRegisterType;
-                        uint16_t reg_num = arRegAccess.mRegisterNumber;
-                        DependencyRecord search_record(depth, reg_type, reg_num, arRegAccess.mAccessType, dep_type,  arRegAccess.mCpuID, 1, _mInstructionCount);
-      
-                        //If we find a match to the record in the collection, increment the record already in the collection.
-                        //Otherwise we should insert the newly created record at the lower bound iterator for the container, thereby keeping it sorted.
-                        auto lb = std::lower_bound(_mDependencyRecords.begin(), _mDependencyRecords.end(), search_record);
-                        if(lb != _mDependencyRecords.end() and search_record == (*lb))
-                        {
-                            (*lb).countDependency(_mInstructionCount);
-                        }
-                        else
-                        {
-                            _mDependencyRecords.insert(lb, search_record);  
-                        }
-      
-                        return true;
-                    }
+                if(_mBasicDependencyCounts.find(access_sequence) == _mBasicDependencyCounts.end())
+                {
+                    _mBasicDependencyCounts[access_sequence] = 1;
+                }
+                else
+                {
+                    _mBasicDependencyCounts[access_sequence] += 1;
+                }
+
+                //Dependency depth is the distance back to the access stage of the earlier access
+                uint32_t depth = distance;
+
+                //Translate access sequence to EDependencyType 
+                Force::EDependencyType dep_type;
+                if(last_access->mAccessType == Force::EAccessAgeType::Write)
+                {
+                    dep_type = Force::EDependencyType::OnTarget;
+                }
+                else if(last_access->mAccessType == Force::EAccessAgeType::Read)
+                {
+                    dep_type = Force::EDependencyType::OnSource;
+                }
+                
+                //Create a record to search the dependency record for matches 
+                Force::EOperandType reg_type = arRegAccess.mRegisterType;
+                uint16_t reg_num = arRegAccess.mRegisterNumber;
+                DependencyRecord search_record(depth, reg_type, reg_num, arRegAccess.mAccessType, dep_type,  arRegAccess.mCpuID, 1, _mInstructionCount);
+
+                //If we find a match to the record in the collection, increment the record already in the collection.
+                //Otherwise we should insert the newly created record at the lower bound iterator for the container, thereby keeping it sorted.
+                auto lb = std::lower_bound(_mDependencyRecords.begin(), _mDependencyRecords.end(), search_record);
+                if(lb != _mDependencyRecords.end() and search_record == (*lb))
+                {
+                    (*lb).countDependency(_mInstructionCount);
                 }
+                else
+                {
+                    _mDependencyRecords.insert(lb, search_record);  
+                }
+
+                return true;
             }
       
             return false;
@@ -636,8 +624,7 @@ class RegDepCounter : public Force::SimPlugin
         };
     
     private:
-        vector<struct RegAccess> _mRegisterAccesses;
-        std::vector<std::vector<struct RegAccess>> _mAccessStages;
+        RegisterAccessIndex _mAccessIndex; //!< latest access of each register within the last _mDepDepth access stages
         uint32_t _mDepDepth;
         uint32_t _mNumBins;
         map<string, int> _mBasicDependencyCounts;
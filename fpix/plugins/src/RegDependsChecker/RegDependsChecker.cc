@@ -23,6 +23,7 @@
 
 #include "Log.h"
 #include "ParseGuide.h"
+#include "RegisterAccessIndex.h"
 #include "SimAPI.h"
 #include "SimEvent.h"
 #include "SimPlugin.h"
@@ -38,19 +39,11 @@ using namespace Force;
 
 namespace Force
 {
-    struct RegAccess
-    {
-        RegAccess(const string &arRname, const string &arAcctype) : mRname(arRname),mAcctype(arAcctype) {};
-        string mRname;
-        string mAcctype;
-    };
-
-
 class RegDependsChecker : public Force::SimPlugin
 {
     public:
         RegDependsChecker() :
-          _mRegisterAccesses(),
+          _mAccessIndex(),
           _mDepDepth(-1),
           _mDependencyCounts(),
           _mInRandomInstructions(false),
@@ -69,6 +62,8 @@ class RegDependsChecker : public Force::SimPlugin
             _mInRandomInstructions = false; // set to true when we appear to be in random code
         };
 
+        bool IsAsynchronous() const { return true; };
+
         bool IsSupported(ESimThreadEventType eventType) const
         {
             bool is_supported = false;
@@ -128,10 +123,7 @@ class RegDependsChecker : public Force::SimPlugin
             }
             else
             {
-                uint64 rval = 0;
-                uint64 rmask = 0;
-                SimPtr()->ReadRegister(CpuID(),"PC",&rval,&rmask);
-                if (rval >= _mRandomInstructionsStart)
+                if (CurrentPC() >= _mRandomInstructionsStart)
                     _mInRandomInstructions = true;
             }
         }
@@ -189,31 +181,38 @@ class RegDependsChecker : public Force::SimPlugin
             }
         }
 
+        // the register number of a GP register name, ie, X<number>...
+        uint32_t GPRegNumber(const string& arRegName)
+        {
+            return std::stoul(arRegName.substr(1));
+        }
+
         void RecordRegisterAccess(const string& arRegName, const string &arAccessType)
         {
             LOG(debug) << "RegDependsChecker: GP reg access: " << arRegName << "/" << arAccessType << endl;
 
-            _mRegisterAccesses.push_back(RegAccess(arRegName,arAccessType));
+            // each access takes a history slot...
+            _mAccessIndex.NewSlot();
+            _mAccessIndex.Record(CpuID(), EOperandType::GPR, GPRegNumber(arRegName), (arAccessType == "READ") ? EAccessAgeType::Read : EAccessAgeType::Write);
 
             // track only last N dependencies...
-            if (_mRegisterAccesses.size() > _mDepDepth) {
-                _mRegisterAccesses.erase( _mRegisterAccesses.begin() );
+            if (_mAccessIndex.WindowSize() > _mDepDepth) {
+                _mAccessIndex.DropOldestSlot();
             }
         }
 
         void CheckForHazard(const string& aPName, const string& aPAccessType)
         {
-            LOG(debug) << "RegDependsChecker: pipe size: " << _mRegisterAccesses.size() << ". Checking for new hazards..." << endl;
-
-            for (auto i = _mRegisterAccesses.rbegin(); i != _mRegisterAccesses.rend(); i++) {
-                if ( (*i).mRname == aPName) {
-                    string access_sequence = aPAccessType + " AFTER " + (*i).mAcctype;
-                    if (_mDependencyCounts.find(access_sequence) == _mDependencyCounts.end())
-                        _mDependencyCounts[access_sequence] = 1;
-                    else
-                        _mDependencyCounts[access_sequence] += 1;
-                    break;
-                }
+            LOG(debug) << "RegDependsChecker: window size: " << _mAccessIndex.WindowSize() << ". Checking for new hazards..." << endl;
+
+            uint64_t distance = 0;
+            const RegisterAccessIndex::LastAccess* last_access = _mAccessIndex.Lookup(CpuID(), EOperandType::GPR, GPRegNumber(aPName), distance);
+            if (last_access != nullptr) {
+                string access_sequence = aPAccessType + " AFTER " + (last_access->mAccessType == EAccessAgeType::Read ? "READ" : "WRITE");
+                if (_mDependencyCounts.find(access_sequence) == _mDependencyCounts.end())
+                    _mDependencyCounts[access_sequence] = 1;
+                else
+                    _mDependencyCounts[access_sequence] += 1;
             }
 
             return;
@@ -230,7 +229,7 @@ class RegDependsChecker : public Force::SimPlugin
         };
 
     private:
-        vector<struct RegAccess> _mRegisterAccesses;
+        RegisterAccessIndex _mAccessIndex; //!< latest access of each GP register within the last _mDepDepth accesses
         uint32_t _mDepDepth;
         map<string, int> _mDependencyCounts;
         bool _mInRandomInstructions;
@@ -0,0 +1,145 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "AsyncPluginWorker.h"
+
+#include <chrono>
+#include <sstream>
+
+#include "Log.h"
+#include "SimPlugin.h"
+
+using namespace std;
+
+namespace Force {
+
+  AsyncPluginWorker::AsyncPluginWorker(const map<ESimThreadEventType, vector<SimPlugin *> >& rSubscribers, uint32_t queueDepth)
+    : mSubscribers(rSubscribers), mQueue(queueDepth), mStop(false), mReturnCode(0), mEventCount(0), mOutputMutex(), mOutput(),
+      mpFailure(), mOutputPending(false), mThread()
+  {
+    mThread = thread(&AsyncPluginWorker::Run, this);
+  }
+
+  AsyncPluginWorker::~AsyncPluginWorker()
+  {
+    Stop();
+  }
+
+  void AsyncPluginWorker::Queue(SimThreadEvent& rEvent, uint64 pc)
+  {
+    PluginEventRecord& record = mQueue.BeginPush();
+    record.Assign(rEvent, pc);
+    mQueue.EndPush();
+    ++ mEventCount;
+  }
+
+  void AsyncPluginWorker::Drain()
+  {
+    while (not mQueue.Empty()) {
+      this_thread::yield();
+    }
+    WriteOutput();
+  }
+
+  void AsyncPluginWorker::Stop()
+  {
+    if (mThread.joinable()) {
+      mStop.store(true, memory_order_release);
+      mThread.join();
+    }
+    WriteOutput();
+  }
+
+  void AsyncPluginWorker::WriteOutput()
+  {
+    if (not mOutputPending.load(memory_order_acquire)) {
+      return;
+    }
+
+    string output;
+    unique_ptr<DeferredFailure> failure;
+    {
+      lock_guard<mutex> lock(mOutputMutex);
+      output.swap(mOutput);
+      failure.swap(mpFailure);
+      mOutputPending.store(false, memory_order_release);
+    }
+    gLog->Output(output);
+
+    if (failure) {
+      failure->Report();
+    }
+  }
+
+  void AsyncPluginWorker::Run()
+  {
+    ostringstream log_stream;
+    Logger::CaptureThreadOutput(&log_stream);
+    uint32_t idle_polls = 0;
+    bool failed = false;
+
+    while (true) {
+      bool stopping = mStop.load(memory_order_acquire);
+      PluginEventRecord* record = mQueue.Front();
+      if (record == nullptr) {
+        if (stopping) {
+          break;
+        }
+        // spin briefly while the sim-thread is stepping, then back off...
+        if (++ idle_polls < 64) {
+          this_thread::yield();
+        }
+        else {
+          this_thread::sleep_for(chrono::microseconds(20));
+        }
+        continue;
+      }
+      idle_polls = 0;
+
+      unique_ptr<DeferredFailure> failure;
+      try {
+        for (auto plugin : mSubscribers.at(record->mEventType)) {
+          if (failed) {
+            break;
+          }
+          int rcode = plugin->HandleRecord(*record);
+          int no_error = 0;
+          if (rcode) {
+            mReturnCode.compare_exchange_strong(no_error, rcode, memory_order_acq_rel);
+          }
+        }
+      }
+      catch (const DeferredFailure& rFailure) {
+        failure.reset(new DeferredFailure(rFailure));
+        failed = true;
+      }
+
+      // hand the output over before the record is released, so it has been handed over once the queue drains...
+      if ((log_stream.tellp() > 0) or failure) {
+        lock_guard<mutex> lock(mOutputMutex);
+        mOutput += log_stream.str();
+        if (failure) {
+          mpFailure.swap(failure);
+        }
+        mOutputPending.store(true, memory_order_release);
+        log_stream.str("");
+      }
+      mQueue.Pop();
+    }
+
+    Logger::CaptureThreadOutput(nullptr);
+  }
+
+}
@@ -205,7 +205,7 @@ namespace Force {
   }
 
 
-  unsigned char EOptionIndexSize = 16;
+  unsigned char EOptionIndexSize = 18;
 
   const string EOptionIndex_to_string(EOptionIndex in_enum)
   {
@@ -226,6 +226,8 @@ namespace Force {
     case EOptionIndex::PLUGIN: return "PLUGIN";
     case EOptionIndex::PLUGINS_OPTIONS: return "PLUGINS_OPTIONS";
     case EOptionIndex::AUTO_INIT_MEM_OPT: return "AUTO_INIT_MEM_OPT";
+    case EOptionIndex::STEP_QUANTUM_OPT: return "STEP_QUANTUM_OPT";
+    case EOptionIndex::ASYNC_PLUGINS_OPT: return "ASYNC_PLUGINS_OPT";
     default:
       unknown_enum_value("EOptionIndex", (unsigned char)(in_enum));
     }
@@ -236,57 +238,63 @@ namespace Force {
   {
     string enum_type_name = "EOptionIndex";
     size_t size = in_str.size();
-    char hash_value = in_str.at(3 < size ? 3 : 3 % size) ^ in_str.at(10 < size ? 10 : 10 % size);
+    char hash_value = in_str.at(8 < size ? 8 : 8 % size) ^ in_str.at(11 < size ? 11 : 11 % size) ^ in_str.at(18 < size ? 18 : 18 % size);
 
     switch (hash_value) {
-    case 0:
-      validate(in_str, "UNKNOWN", enum_type_name);
-      return EOptionIndex::UNKNOWN;
-    case 1:
-      validate(in_str, "SEED", enum_type_name);
-      return EOptionIndex::SEED;
-    case 2:
-      validate(in_str, "AUTO_INIT_MEM_OPT", enum_type_name);
-      return EOptionIndex::AUTO_INIT_MEM_OPT;
-    case 3:
-      validate(in_str, "RAILHOUSE_OPT", enum_type_name);
-      return EOptionIndex::RAILHOUSE_OPT;
-    case 5:
-      validate(in_str, "CFG", enum_type_name);
-      return EOptionIndex::CFG;
-    case 7:
+    case 64:
       validate(in_str, "PA_SIZE_OPT", enum_type_name);
       return EOptionIndex::PA_SIZE_OPT;
-    case 11:
+    case 65:
+      validate(in_str, "PLUGINS_OPTIONS", enum_type_name);
+      return EOptionIndex::PLUGINS_OPTIONS;
+    case 66:
+      validate(in_str, "CLUSTER_NUM_OPT", enum_type_name);
+      return EOptionIndex::CLUSTER_NUM_OPT;
+    case 67:
+      validate(in_str, "CFG", enum_type_name);
+      return EOptionIndex::CFG;
+    case 68:
+      validate(in_str, "AUTO_INIT_MEM_OPT", enum_type_name);
+      return EOptionIndex::AUTO_INIT_MEM_OPT;
+    case 69:
+      validate(in_str, "DECODING_OPT", enum_type_name);
+      return EOptionIndex::DECODING_OPT;
+    case 70:
+      validate(in_str, "STEP_QUANTUM_OPT", enum_type_name);
+      return EOptionIndex::STEP_QUANTUM_OPT;
+    case 71:
       validate(in_str, "LOGLEVEL", enum_type_name);
       return EOptionIndex::LOGLEVEL;
-    case 14:
+    case 72:
+      validate(in_str, "ASYNC_PLUGINS_OPT", enum_type_name);
+      return EOptionIndex::ASYNC_PLUGINS_OPT;
+    case 75:
       validate(in_str, "PLUGIN", enum_type_name);
       return EOptionIndex::PLUGIN;
-    case 16:
-      validate(in_str, "MAX_INSTS_OPT", enum_type_name);
-      return EOptionIndex::MAX_INSTS_OPT;
-    case 19:
-      validate(in_str, "PLUGINS_OPTIONS", enum_type_name);
-      return EOptionIndex::PLUGINS_OPTIONS;
-    case 21:
-      validate(in_str, "CORE_NUM_OPT", enum_type_name);
-      return EOptionIndex::CORE_NUM_OPT;
-    case 23:
-      validate(in_str, "THREADS_PER_CPU_OPT", enum_type_name);
-      return EOptionIndex::THREADS_PER_CPU_OPT;
-    case 27:
+    case 76:
       validate(in_str, "EXIT_LOOP_OPT", enum_type_name);
       return EOptionIndex::EXIT_LOOP_OPT;
-    case 28:
+    case 77:
+      validate(in_str, "MAX_INSTS_OPT", enum_type_name);
+      return EOptionIndex::MAX_INSTS_OPT;
+    case 78:
+      validate(in_str, "UNKNOWN", enum_type_name);
+      return EOptionIndex::UNKNOWN;
+    case 82:
+      validate(in_str, "SEED", enum_type_name);
+      return EOptionIndex::SEED;
+    case 84:
       validate(in_str, "HELP", enum_type_name);
       return EOptionIndex::HELP;
-    case 30:
-      validate(in_str, "CLUSTER_NUM_OPT", enum_type_name);
-      return EOptionIndex::CLUSTER_NUM_OPT;
-    case 31:
-      validate(in_str, "DECODING_OPT", enum_type_name);
-      return EOptionIndex::DECODING_OPT;
+    case 90:
+      validate(in_str, "RAILHOUSE_OPT", enum_type_name);
+      return EOptionIndex::RAILHOUSE_OPT;
+    case 91:
+      validate(in_str, "THREADS_PER_CPU_OPT", enum_type_name);
+      return EOptionIndex::THREADS_PER_CPU_OPT;
+    case 94:
+      validate(in_str, "CORE_NUM_OPT", enum_type_name);
+      return EOptionIndex::CORE_NUM_OPT;
     default:
       unknown_enum_name(enum_type_name, in_str);
     }
@@ -297,57 +305,63 @@ namespace Force {
   {
     okay = true;
     size_t size = in_str.size();
-    char hash_value = in_str.at(3 < size ? 3 : 3 % size) ^ in_str.at(10 < size ? 10 : 10 % size);
+    char hash_value = in_str.at(8 < size ? 8 : 8 % size) ^ in_str.at(11 < size ? 11 : 11 % size) ^ in_str.at(18 < size ? 18 : 18 % size);
 
     switch (hash_value) {
-    case 0:
-      okay = (in_str == "UNKNOWN");
-      return EOptionIndex::UNKNOWN;
-    case 1:
-      okay = (in_str == "SEED");
-      return EOptionIndex::SEED;
-    case 2:
-      okay = (in_str == "AUTO_INIT_MEM_OPT");
-      return EOptionIndex::AUTO_INIT_MEM_OPT;
-    case 3:
-      okay = (in_str == "RAILHOUSE_OPT");
-      return EOptionIndex::RAILHOUSE_OPT;
-    case 5:
-      okay = (in_str == "CFG");
-      return EOptionIndex::CFG;
-    case 7:
+    case 64:
       okay = (in_str == "PA_SIZE_OPT");
       return EOptionIndex::PA_SIZE_OPT;
-    case 11:
+    case 65:
+      okay = (in_str == "PLUGINS_OPTIONS");
+      return EOptionIndex::PLUGINS_OPTIONS;
+    case 66:
+      okay = (in_str == "CLUSTER_NUM_OPT");
+      return EOptionIndex::CLUSTER_NUM_OPT;
+    case 67:
+      okay = (in_str == "CFG");
+      return EOptionIndex::CFG;
+    case 68:
+      okay = (in_str == "AUTO_INIT_MEM_OPT");
+      return EOptionIndex::AUTO_INIT_MEM_OPT;
+    case 69:
+      okay = (in_str == "DECODING_OPT");
+      return EOptionIndex::DECODING_OPT;
+    case 70:
+      okay = (in_str == "STEP_QUANTUM_OPT");
+      return EOptionIndex::STEP_QUANTUM_OPT;
+    case 71:
       okay = (in_str == "LOGLEVEL");
       return EOptionIndex::LOGLEVEL;
-    case 14:
+    case 72:
+      okay = (in_str == "ASYNC_PLUGINS_OPT");
+      return EOptionIndex::ASYNC_PLUGINS_OPT;
+    case 75:
       okay = (in_str == "PLUGIN");
       return EOptionIndex::PLUGIN;
-    case 16:
-      okay = (in_str == "MAX_INSTS_OPT");
-      return EOptionIndex::MAX_INSTS_OPT;
-    case 19:
-      okay = (in_str == "PLUGINS_OPTIONS");
-      return EOptionIndex::PLUGINS_OPTIONS;
-    case 21:
-      okay = (in_str == "CORE_NUM_OPT");
-      return EOptionIndex::CORE_NUM_OPT;
-    case 23:
-      okay = (in_str == "THREADS_PER_CPU_OPT");
-      return EOptionIndex::THREADS_PER_CPU_OPT;
-    case 27:
+    case 76:
       okay = (in_str == "EXIT_LOOP_OPT");
       return EOptionIndex::EXIT_LOOP_OPT;
-    case 28:
+    case 77:
+      okay = (in_str == "MAX_INSTS_OPT");
+      return EOptionIndex::MAX_INSTS_OPT;
+    case 78:
+      okay = (in_str == "UNKNOWN");
+      return EOptionIndex::UNKNOWN;
+    case 82:
+      okay = (in_str == "SEED");
+      return EOptionIndex::SEED;
+    case 84:
       okay = (in_str == "HELP");
       return EOptionIndex::HELP;
-    case 30:
-      okay = (in_str == "CLUSTER_NUM_OPT");
-      return EOptionIndex::CLUSTER_NUM_OPT;
-    case 31:
-      okay = (in_str == "DECODING_OPT");
-      return EOptionIndex::DECODING_OPT;
+    case 90:
+      okay = (in_str == "RAILHOUSE_OPT");
+      return EOptionIndex::RAILHOUSE_OPT;
+    case 91:
+      okay = (in_str == "THREADS_PER_CPU_OPT");
+      return EOptionIndex::THREADS_PER_CPU_OPT;
+    case 94:
+      okay = (in_str == "CORE_NUM_OPT");
+      return EOptionIndex::CORE_NUM_OPT;
     default:
       okay = false;
       return EOptionIndex::UNKNOWN;
@@ -0,0 +1,91 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "PluginEventQueue.h"
+
+#include <thread>
+
+#include "SimEvent.h"
+
+using namespace std;
+
+namespace Force {
+
+  template <typename T>
+  static void assign_updates(vector<T>& rDest, const vector<T>* pSrc, const T* pSingle)
+  {
+    rDest.clear();
+    if (pSrc != nullptr) {
+      rDest.assign(pSrc->begin(), pSrc->end());
+    }
+    else if (pSingle != nullptr) {
+      rDest.push_back(*pSingle);
+    }
+  }
+
+  void PluginEventRecord::Assign(SimThreadEvent& rEvent, uint64 pc)
+  {
+    mEventType = rEvent.Type();
+    mCpuId = rEvent.CpuId();
+    mPC = pc;
+    assign_updates(mRegUpdates, rEvent.RegisterUpdates(), rEvent.RegisterUpdate());
+    assign_updates(mMemUpdates, rEvent.MemoryUpdates(), rEvent.MemoryUpdate());
+    assign_updates(mMmuEvents, rEvent.MmuEvents(), rEvent.MMUEvent());
+    assign_updates(mExcUpdates, rEvent.ExceptionUpdates(), rEvent.ExceptUpdate());
+  }
+
+  PluginEventQueue::PluginEventQueue(uint32_t depth)
+    : mRecords(), mMask(0), mHead(0), mTail(0), mFullWaits(0)
+  {
+    uint64_t size = 2;
+    while (size < depth) {
+      size <<= 1;
+    }
+    mRecords.resize(size);
+    mMask = size - 1;
+  }
+
+  PluginEventRecord& PluginEventQueue::BeginPush()
+  {
+    uint64_t tail = mTail.load(memory_order_relaxed);
+    if (tail - mHead.load(memory_order_acquire) > mMask) {
+      ++ mFullWaits;
+      while (tail - mHead.load(memory_order_acquire) > mMask) {
+        this_thread::yield();
+      }
+    }
+    return mRecords[tail & mMask];
+  }
+
+  void PluginEventQueue::EndPush()
+  {
+    mTail.store(mTail.load(memory_order_relaxed) + 1, memory_order_release);
+  }
+
+  PluginEventRecord* PluginEventQueue::Front()
+  {
+    uint64_t head = mHead.load(memory_order_relaxed);
+    if (head == mTail.load(memory_order_acquire)) {
+      return nullptr;
+    }
+    return &mRecords[head & mMask];
+  }
+
+  void PluginEventQueue::Pop()
+  {
+    mHead.store(mHead.load(memory_order_relaxed) + 1, memory_order_release);
+  }
+
+}
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 
+#include "AsyncPluginWorker.h"
 #include "Log.h"
 #include "SimEvent.h"
 #include "StringUtils.h"
@@ -175,9 +176,11 @@ void PluginManager::Destroy() {
 
 //!< create/hook-up plugin instances...
 
-PluginManager::PluginManager(vector<ESimThreadEventType> event_types) :
+PluginManager::PluginManager(vector<ESimThreadEventType> event_types, uint32_t asyncQueueDepth) :
 mPlugins(), 
-mSenders()
+mSenders(),
+mAsyncTestEndPlugins(),
+mpAsyncWorker(nullptr)
 {
   for (auto pi = mPluginInterfaces->begin(); pi != mPluginInterfaces->end(); pi++) {
      SimPlugin *plugin_instance = (*pi)->CreateInstance();
@@ -187,7 +190,10 @@ mSenders()
   // Foreach event type:
   //    1. Create sender.
   //    2. Foreach plugin instance (shared and non-shared):
-  //       Subscribe to this event, ie, attach plugin receiver to sender
+  //       Subscribe to this event, ie, attach plugin receiver to sender, or if the plugin is to run asynchronously,
+  //       record it as a subscriber of the async plugin worker instead
+
+  std::map<ESimThreadEventType, std::vector<SimPlugin *> > async_subscribers;
 
   for (auto ev = event_types.begin(); ev != event_types.end(); ev++) {
      LOG(debug) << "Allocating sender for event type: '" << ESimThreadEventType_to_string(*ev) << "'..." << endl;
@@ -195,16 +201,33 @@ mSenders()
      // allow plugins to subscribe to this event...
      for (auto pi = mPlugins.begin(); pi != mPlugins.end(); pi++) {
        if ((*pi)->IsSupported(*ev)) {
+         if (asyncQueueDepth && (*pi)->IsAsynchronous()) {
+           LOG(debug) << "   Plugin '" << (*pi)->Name() << "' has subscribed to this event, asynchronously!" << endl;
+           if (*ev == ESimThreadEventType::END_TEST)
+             mAsyncTestEndPlugins.push_back(*pi);
+           else
+             async_subscribers[*ev].push_back(*pi);
+           continue;
+         }
          LOG(debug) << "   Plugin '" << (*pi)->Name() << "' has subscribed to this event!" << endl;
          mSenders[*ev]->SignUp(*pi);
        }
      }
   }
+
+  if (!async_subscribers.empty() || !mAsyncTestEndPlugins.empty())
+    mpAsyncWorker = new AsyncPluginWorker(async_subscribers, asyncQueueDepth);
 }
     
-//!< delete event senders...
+//!< stop async plugin worker, delete event senders...
 
 PluginManager::~PluginManager() {
+  if (mpAsyncWorker != nullptr) {
+    mpAsyncWorker->Stop();
+    LOG(info) << "Async plugins: " << dec << mpAsyncWorker->EventCount() << " events queued, " << mpAsyncWorker->FullWaits() << " waits on a full queue." << endl;
+    delete mpAsyncWorker;
+  }
+
   // discard event senders...
   for (auto ev = mSenders.begin(); ev != mSenders.end(); ev++) {
     delete ev->second;
@@ -216,6 +239,38 @@ PluginManager::~PluginManager() {
 void PluginManager::Signal(SimThreadEvent &pData) {
   LOG(debug) << "Sending sim-event '" << pData.ToString() << "' (Id: " << ESimThreadEventType_to_string(pData.Type()) << ") to connected plugins..." << endl;
   mSenders[pData.Type()]->SendNotification(pData.Type(),&pData);
+
+  if (mpAsyncWorker != nullptr)
+    SignalAsync(pData);
+}
+
+//!< pass sim-event on to the async plugins. Async plugin errors are reported on the next event signaled after they occur...
+
+void PluginManager::SignalAsync(SimThreadEvent &pData) {
+  if (pData.Type() == ESimThreadEventType::END_TEST) {
+    // test end output goes straight to the output streams, so it is produced here, once the worker has caught up...
+    mpAsyncWorker->Drain();
+    int rcode = pData.ReturnCode();
+    for (auto pi = mAsyncTestEndPlugins.begin(); pi != mAsyncTestEndPlugins.end(); pi++) {
+      (*pi)->HandleNotification(nullptr, pData.Type(), &pData);
+      rcode = rcode ? rcode : pData.ReturnCode();
+    }
+    pData.SetReturnCode(rcode);
+  }
+  else if (mpAsyncWorker->IsSubscribed(pData.Type())) {
+    uint64 pc = 0;
+    if (pData.Type() == ESimThreadEventType::PRE_STEP) {
+      uint64 pc_mask = 0;
+      pData.SimPtr()->ReadRegister(pData.CpuId(),"PC",&pc,&pc_mask);
+    }
+    mpAsyncWorker->Queue(pData, pc);
+  }
+
+  mpAsyncWorker->WriteOutput();
+
+  int async_rcode = mpAsyncWorker->ReturnCode();
+  if (async_rcode && !pData.ReturnCode())
+    pData.SetReturnCode(async_rcode);
 }
 
 }
@@ -16,6 +16,7 @@
 #include "SimPlugin.h"
 
 #include "Log.h"
+#include "PluginEventQueue.h"
 #include "SimEvent.h"
 
 namespace Force {
@@ -32,6 +33,48 @@ void SimPlugin::HandleNotification(const Sender<ESimThreadEventType>* sender, ES
 
   LOG(debug) << "SimPlugin '" << Name() << "': Handling sim-event notification, type: " << ESimThreadEventType_to_string(eventType) << "..." << endl;
 
+  Dispatch(eventType, ev->RegisterUpdates(), ev->MemoryUpdates(), ev->MmuEvents(), ev->ExceptionUpdates(),
+           ev->RegisterUpdate(), ev->MemoryUpdate(), ev->ExceptUpdate());
+
+  ev->SetReturnCode(mReturnCode);
+}
+
+//<! replay a copied sim event, on the plugin worker thread...
+
+int SimPlugin::HandleRecord(PluginEventRecord &rRecord) {
+  mCpuID    = rRecord.mCpuId;
+  mSimPtr   = nullptr;        //!< the simulator is busy stepping on the sim-thread
+  mRecordPC = rRecord.mPC;
+
+  mReturnCode = 0;
+
+  RegUpdate *reg_update = rRecord.mRegUpdates.empty() ? nullptr : &rRecord.mRegUpdates.front();
+  MemUpdate *mem_update = rRecord.mMemUpdates.empty() ? nullptr : &rRecord.mMemUpdates.front();
+  ExceptionUpdate *exception = rRecord.mExcUpdates.empty() ? nullptr : &rRecord.mExcUpdates.front();
+
+  Dispatch(rRecord.mEventType, &rRecord.mRegUpdates, &rRecord.mMemUpdates, &rRecord.mMmuEvents, &rRecord.mExcUpdates,
+           reg_update, mem_update, exception);
+
+  return mReturnCode;
+}
+
+//!< PC of current cpu...
+
+uint64 SimPlugin::CurrentPC() const {
+  if (mSimPtr == nullptr)
+    return mRecordPC;
+
+  uint64 rval = 0;
+  uint64 rmask = 0;
+  mSimPtr->ReadRegister(mCpuID,"PC",&rval,&rmask);
+  return rval;
+}
+
+//!< call the event method for this event type...
+
+void SimPlugin::Dispatch(ESimThreadEventType eventType, std::vector<RegUpdate> *reg_updates, std::vector<MemUpdate> *mem_updates,
+                         std::vector<MmuEvent> *mmu_events, std::vector<ExceptionUpdate> *exceptions, RegUpdate *reg_update,
+                         MemUpdate *mem_update, ExceptionUpdate *exception) {
   switch(eventType) {
     case ESimThreadEventType::START_TEST:
       atTestStart();
@@ -52,22 +95,20 @@ void SimPlugin::HandleNotification(const Sender<ESimThreadEventType>* sender, ES
       onPreStep();
       break;
     case ESimThreadEventType::POST_STEP:
-      onStep( ev->RegisterUpdates(),ev->MemoryUpdates(),ev->MmuEvents(),ev->ExceptionUpdates() );
+      onStep( reg_updates,mem_updates,mmu_events,exceptions );
       break;
     case ESimThreadEventType::EXCEPTION_EVENT:
-      onException( ev->ExceptUpdate() );
+      onException( exception );
       break;
     case ESimThreadEventType::REGISTER_UPDATE:
-      onRegisterUpdate( ev->RegisterUpdate() );
+      onRegisterUpdate( reg_update );
       break;
     case ESimThreadEventType::MEMORY_UPDATE:
-      onMemoryUpdate( ev->MemoryUpdate() );
+      onMemoryUpdate( mem_update );
       break;
     default:
       break;
   }
-
-  ev->SetReturnCode(mReturnCode);
 }
 
 }
@@ -64,7 +64,7 @@ void SimThread::Init() {
                               ESimThreadEventType::INTERRUPT, ESimThreadEventType::EXCEPTION_EVENT
                               };
 
-  mPluginsMgr = new PluginManager(event_types);
+  mPluginsMgr = new PluginManager(event_types, mSimCfg->AsyncPluginQueueDepth());
 
   // at start, these are the only known events. Other events may be inserted during simulation...
   mEvents.push_back( new SimThreadStartTestEvent( *this ) );
@@ -121,6 +121,15 @@ bool SimThread::EndTestReached() const {
   return mHitEndTest; 
 }; 
 
+//!< return true if the next event steps an instruction that neither accesses memory nor changes state other cpus observe
+
+bool SimThread::NextEventIsLocal() const {
+  if ( Done() || mHitEndTest || ((mEvents.front())->Type() != ESimThreadEventType::STEP) )
+    return false;
+
+  return SimPtr()->NextInstructionIsLocal(mCpuId);
+}
+
 //!< based on conditions, update event queue...
 
 int SimThread::UpdateEventSchedule() {
@@ -23,6 +23,7 @@
 
 #include "elfio/elfio.h"
 
+#include "BinaryImage.h"
 #include "ConfigFPIX.h"
 #include "Log.h"
 #include "Random.h"
@@ -100,7 +101,10 @@ bool SimUtils::LoadTest(uint64_t &entry_point, SimAPI *sim_ptr, vector<string> *
     string next_test_file = *i;
     uint64_t next_entry_point = 0;
 
-    if (next_test_file.find(".Secondary.ELF") != string::npos) {
+    if (BinaryImageFile::IsBinaryImage(next_test_file)) {
+      success = LoadTestFromImage(next_entry_point, sim_ptr, next_test_file);
+    }
+    else if (next_test_file.find(".Secondary.ELF") != string::npos) {
       success = LoadTestFromELF(next_entry_point, sim_ptr, next_test_file, true);
     } 
     else {
@@ -187,6 +191,57 @@ bool SimUtils::LoadTestFromELF(uint64_t &entry_point, SimAPI *sim_ptr, string &e
   return true;
 }
 
+//***************************************************************************************************************
+//!< load from a single binary memory image, return entry-point
+//***************************************************************************************************************
+
+bool SimUtils::LoadTestFromImage(uint64_t &entry_point, SimAPI *sim_ptr, string &image_file) {
+  LOG(debug) << "   Loading test from binary memory image '" << image_file << "'..." << endl;
+
+  BinaryImageFile image;
+  const BinaryImageSection* sections = nullptr;
+  try {
+    image.Load(image_file);
+    sections = image.Sections();
+  }
+  catch (const std::exception&) {
+    LOG(fail) << "Problems loading memory image: " << image_file << endl;
+    return false;
+  }
+
+  const BinaryImageHeader* header = image.Header();
+  if (header->mSectionCount == 0) {
+    LOG(fail) << "No memory sections in image: " << image_file << ", a registers image can't be loaded as a test." << endl;
+    return false;
+  }
+
+  entry_point = header->mEntryPoint;
+
+  LOG(debug) << "   Entry point: 0x" << hex << entry_point << ", " << dec << header->mSectionCount << " sections." << endl;
+
+  //!< the section data is handed to the simulator straight from the mapped file
+  for (uint32_t i = 0; i < header->mSectionCount; i++) {
+    const BinaryImageSection& section = sections[i];
+    const uint8_t* data = nullptr;
+    try {
+      data = image.Payload(section.mDataOffset, section.mSize);
+    }
+    catch (const std::exception&) {
+      LOG(fail) << "Problems loading memory image: " << image_file << endl;
+      return false;
+    }
+    for (uint64_t offset = 0; offset < section.mSize; ) {
+      uint32_t size = (section.mSize - offset > MAX_UINT32) ? MAX_UINT32 : (section.mSize - offset);
+      sim_ptr->WritePhysicalMemory(header->mMemoryBank, section.mAddress + offset, size, data + offset);
+      offset += size;
+    }
+  }
+
+  LOG(debug) << "done." << endl;
+
+  return true;
+}
+
 //***************************************************************************************************************
 //!< load Force-generated test 'markers'
 //***************************************************************************************************************
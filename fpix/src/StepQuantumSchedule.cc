@@ -0,0 +1,71 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "StepQuantumSchedule.h"
+
+#include <algorithm>
+
+using namespace std;
+
+namespace Force {
+
+  const uint64_t StepQuantumSchedule::NOT_REACHED;
+
+  StepQuantumSchedule::StepQuantumSchedule(uint32_t threadCount, uint32_t quantum)
+    : mQuantum((quantum > 1) ? quantum : 1), mPass(0), mRunAheadCount(0), mPositions(threadCount, 0), mFinished(threadCount, false), mEndTestPasses(threadCount, NOT_REACHED)
+  {
+  }
+
+  bool StepQuantumSchedule::MayProcess(uint32_t threadIndex, uint32_t turnEvents, bool nextEventIsLocal) const
+  {
+    if (turnEvents >= mQuantum) {
+      return false;
+    }
+
+    // a sim-thread that reached end-test waits for all-stop, which only its own pass can tell...
+    return InOwnPass(threadIndex) or (nextEventIsLocal and (mEndTestPasses[threadIndex] == NOT_REACHED));
+  }
+
+  bool StepQuantumSchedule::AllStop(uint32_t threadIndex) const
+  {
+    uint64_t position = mPositions[threadIndex];
+    return all_of(mEndTestPasses.cbegin(), mEndTestPasses.cend(), [position](uint64_t endTestPass) { return endTestPass < position; });
+  }
+
+  void StepQuantumSchedule::EventProcessed(uint32_t threadIndex, bool endTestReached)
+  {
+    if (not InOwnPass(threadIndex)) {
+      ++ mRunAheadCount;
+    }
+
+    if (endTestReached and (mEndTestPasses[threadIndex] == NOT_REACHED)) {
+      mEndTestPasses[threadIndex] = mPositions[threadIndex];
+    }
+    ++ mPositions[threadIndex];
+  }
+
+  void StepQuantumSchedule::EndPass()
+  {
+    // every unfinished sim-thread processed its event of this pass, so the next pass is the earliest position left...
+    uint64_t next_pass = NOT_REACHED;
+    for (uint32_t thread_index = 0; thread_index < mPositions.size(); ++ thread_index) {
+      if (not mFinished[thread_index]) {
+        next_pass = min(next_pass, mPositions[thread_index]);
+      }
+    }
+    mPass = (next_pass == NOT_REACHED) ? (mPass + 1) : next_pass;
+  }
+
+}
@@ -91,6 +91,8 @@ struct Arg: public option::Arg
       {EOptionIndexBaseType(EOptionIndex::PA_SIZE_OPT), 0, "P", "pa_size", Arg::Numeric, "  --pa_size, -P \tdefualt pa size is 44 bits"},
       {EOptionIndexBaseType(EOptionIndex::EXIT_LOOP_OPT), 0, "X", "exit_loop", Arg::Numeric, "  --exit_loop, -X \texit when an instruction jumps to itself"},
       {EOptionIndexBaseType(EOptionIndex::AUTO_INIT_MEM_OPT), 0, "", "auto_init_mem", Arg::None, "  --auto_init_mem  \tautomatically initialize simulator memory on access; enabling this could potentially mask errors in the test"},
+      {EOptionIndexBaseType(EOptionIndex::STEP_QUANTUM_OPT), 0, "q", "step_quantum", Arg::Numeric, "  --step_quantum, -q \tmaximum number of instructions a cpu steps before switching to the next cpu, defaults to one"},
+      {EOptionIndexBaseType(EOptionIndex::ASYNC_PLUGINS_OPT), 0, "", "async_plugins", Arg::Numeric, "  --async_plugins \trun asynchronous plugins on a worker thread per cpu, with an event queue of this depth"},
       {EOptionIndexBaseType(EOptionIndex::UNKNOWN), 0, "", "", Arg::None, "\nExamples:\n"
                                                          "  fpix -i 10000 -D \n"
                                                          "  fpix --unknown -- --this_is_no_option\n"},
@@ -306,6 +308,27 @@ struct Arg: public option::Arg
       LOG(info) << "      'auto_init_mem' : enabled" << endl;
     }
 
+    if (options[EOptionIndexBaseType(EOptionIndex::STEP_QUANTUM_OPT)])
+    {
+      option::Option* my_opt = options[EOptionIndexBaseType(EOptionIndex::STEP_QUANTUM_OPT)].last();
+      unsigned int nval = parse_uint64(my_opt->arg);
+      if (nval == 0)
+      {
+        LOG(fail) << "step_quantum needs to be at least one." << endl;
+        exit(-1);
+      }
+      arCfg.SetStepQuantum(nval);
+      LOG(info) << "      'step_quantum' : " << nval << endl;
+    }
+
+    if (options[EOptionIndexBaseType(EOptionIndex::ASYNC_PLUGINS_OPT)])
+    {
+      option::Option* my_opt = options[EOptionIndexBaseType(EOptionIndex::ASYNC_PLUGINS_OPT)].last();
+      unsigned int nval = parse_uint64(my_opt->arg);
+      arCfg.SetAsyncPluginQueueDepth(nval);
+      LOG(info) << "      'async_plugins' : " << nval << endl;
+    }
+
     if (options[EOptionIndexBaseType(EOptionIndex::PA_SIZE_OPT)])
     {
       option::Option* my_opt = options[EOptionIndexBaseType(EOptionIndex::PA_SIZE_OPT)].last();
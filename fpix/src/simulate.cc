@@ -13,6 +13,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
 #include <iostream>
@@ -24,6 +25,7 @@
 #include "PluginManager.h"
 #include "SimAPI.h"
 #include "SimThread.h"
+#include "StepQuantumSchedule.h"
 
 using namespace Force;
 using namespace std;
@@ -46,6 +48,12 @@ int simulate(SimAPI* pSimAPI, ConfigFPIX *cfg, vector<string> *test_files) {
   vector<uint32_t> cpu_ids;
   SimUtils::AssignCpuIDs( cpu_ids,cfg->ClusterCount(),cfg->NumberOfCores(),cfg->ThreadsPerCpu() );
 
+  // with a step quantum > 1, each sim-thread may step several instructions per turn, but only over steps the simulator reports, before
+  // stepping them, as local to the cpu. Every other event waits for its round-robin pass, so cpus interact in the same order whatever
+  // the quantum...
+
+  uint32_t step_quantum = (cfg->StepQuantum() > 1) ? cfg->StepQuantum() : 1;
+
   vector<SimThread *> sim_threads;
 
   for (auto cpu_id = cpu_ids.begin(); cpu_id != cpu_ids.end(); cpu_id++) {
@@ -58,35 +66,50 @@ int simulate(SimAPI* pSimAPI, ConfigFPIX *cfg, vector<string> *test_files) {
 
   int rcode = 0; // any non-zero value will represent an error...
 
+  StepQuantumSchedule schedule(sim_threads.size(), step_quantum);
+  uint64_t turn_count = 0;
+  auto start_time = chrono::steady_clock::now();
+
   while( processing_events && !rcode ) {
 
     bool more_to_do = false; // will be true if at least one sim-thread has more work to do...
 
-    bool all_stop = true;
-    for (auto st = sim_threads.begin(); st != sim_threads.end() && !rcode; st++) {
-      all_stop &= (*st)->EndTestReached();  // can only be true if all threads have hit end-test
-    }
-
-    // one iteration on each sim-thread...
+    // one turn on each sim-thread...
 
-    for (auto st = sim_threads.begin(); st != sim_threads.end() && !rcode; st++) {
-      if ((*st)->Done()) {
+    for (uint32_t st_index = 0; st_index < sim_threads.size() && !rcode; st_index++) {
+      SimThread *st = sim_threads[st_index];
+      if (st->Done()) {
         // this thread is done...
         continue;
       } 
 
-      if ( (rcode = (*st)->ProcessNextEvent(all_stop)) != 0 ) {
-        // any error (non-zero return code) will cause simulation to abort...
-      } 
-      else {
-        more_to_do = true; // will assume this sim-thread is NOT done...
+      uint32_t turn_events = 0;
+      while (!st->Done() && schedule.MayProcess(st_index, turn_events, (step_quantum > 1) && st->NextEventIsLocal())) {
+        // all-stop can only be true if all threads have hit end-test...
+        if ( (rcode = st->ProcessNextEvent(schedule.AllStop(st_index))) != 0 ) {
+          // any error (non-zero return code) will cause simulation to abort...
+          break;
+        } 
+
+        schedule.EventProcessed(st_index, st->EndTestReached());
+        ++turn_events;
       }
+      ++turn_count;
 
+      if (st->Done()) {
+        schedule.ThreadFinished(st_index);
+      }
+      more_to_do = true; // will assume this sim-thread is NOT done...
     }
 
+    schedule.EndPass();
     processing_events = more_to_do; // theres more to do, ie, more events to process, if at least one thread is not done...
   }
 
+  chrono::duration<double> elapsed_time = chrono::steady_clock::now() - start_time;
+  LOG(notice) << "Simulated " << dec << sim_threads.size() << " cpu(s) in " << elapsed_time.count() << " seconds, step quantum " << step_quantum
+              << ", " << turn_count << " turns, " << schedule.RunAheadCount() << " steps run ahead." << endl;
+
   // discard sim-thread objects...
 
   for (auto st = sim_threads.begin(); st != sim_threads.end(); st++) {
@@ -37,6 +37,11 @@ namespace Force {
 #define  MEM_BYTES       8                         //!< memory bytes, fixed as 8 bytes so far
 #define  ADDR_ALIGN(a)   ((a) & ~(MEM_BYTES - 1))
 #define  ADDR_OFFSET(a)  ((a) & (MEM_BYTES - 1))
+#define  FRAME_SHIFT     12
+#define  FRAME_BYTES     (1ull << FRAME_SHIFT)     //!< page frame bytes
+#define  FRAME_CHUNKS    (FRAME_BYTES / MEM_BYTES) //!< memory chunks per page frame
+#define  FRAME_NUMBER(a) ((a) >> FRAME_SHIFT)
+#define  CHUNK_INDEX(a)  (((a) & (FRAME_BYTES - 1)) / MEM_BYTES)
 
 #define MASK(len, pos)   ((len == 64) ? (-1ull << pos) : (((1ull << len) - 1) << pos))
 
@@ -103,6 +108,8 @@ namespace Force {
 
     ~MemoryBytes() { }      //!< Destructor, empty.
 
+    bool IsEmpty() const { return mAttributes == 0; } //!< Return true if no byte of the chunk is initialized.
+
     /*!
       Initialize a memory chunk.
      */
@@ -238,7 +245,7 @@ namespace Force {
     /*!
       Read initial value in big-endian. If a byte is not initialized, randomize it if randomPattern is true; otherwise, set it to the value in valuePattern.
     */
-    uint64 ReadInitialWithPattern(cbool randomPattern, cuint64 valuePattern)
+    uint64 ReadInitialWithPattern(cbool randomPattern, cuint64 valuePattern) const
     {
       return ApplyPattern(mInitialValue, randomPattern, valuePattern);
     }
@@ -408,6 +415,26 @@ namespace Force {
     uint64 mAddress;       //!< Memory bytes starting address.
   };
 
+  /*!
+    \class MemoryFrame
+    \brief class for a page frame of memory chunks.
+  */
+  class MemoryFrame {
+  public:
+    explicit MemoryFrame(uint64 frameAddress) : mChunks() //!< Constructor.
+    {
+      mChunks.reserve(FRAME_CHUNKS);
+      for (uint64 i = 0; i < FRAME_CHUNKS; i ++) {
+        mChunks.emplace_back(frameAddress + i * MEM_BYTES);
+      }
+    }
+
+    MemoryBytes& Chunk(uint64 address) { return mChunks[CHUNK_INDEX(address)]; } //!< Return the memory chunk containing the address.
+    const MemoryBytes& Chunk(uint64 address) const { return mChunks[CHUNK_INDEX(address)]; } //!< Return the memory chunk containing the address.
+  private:
+    vector<MemoryBytes> mChunks; //!< memory chunks in increasing address order.
+  };
+
   bool Section::Intersects(const Section& rOther) const
   {
     if ((GetEndAddress() >= rOther.mAddress) and (rOther.GetEndAddress() >= mAddress)) {
@@ -442,8 +469,6 @@ namespace Force {
 
   Memory::~Memory()
   {
-    for (auto &map_item : mContent)
-      delete map_item.second;
   }
 
   /*!
@@ -577,6 +602,12 @@ namespace Force {
       FAIL("unsupported-number-of-bytes");
     }
 
+    // fast path, the access resides in one chunk
+    if (ADDR_OFFSET(address) + nBytes <= MEM_BYTES) {
+      const MemoryBytes* chunk = FindChunk(address);
+      return (chunk != nullptr) && chunk->IsInitialized(ADDR_OFFSET(address), nBytes);
+    }
+
     // handle crossing part
     uint32 nSize = ADDR_ALIGN(address + MEM_BYTES - 1) - address;
     if (nSize) {
@@ -620,6 +651,14 @@ namespace Force {
       FAIL("unsupported-number-of-bytes");
     }
 
+    // fast path, the access resides in one initialized chunk
+    if (ADDR_OFFSET(address) + nBytes <= mem_bytes) {
+      const MemoryBytes* chunk = FindChunk(address);
+      if ((chunk != nullptr) && chunk->IsInitialized(ADDR_OFFSET(address), nBytes)) {
+        return chunk->Read(ADDR_OFFSET(address), nBytes);
+      }
+    }
+
     EnsureInitialization(address, nBytes);
 
     uint32 nbytes = (ADDR_OFFSET(address) + nBytes <= mem_bytes) ?
@@ -646,6 +685,16 @@ namespace Force {
       FAIL("value-out-of-byte-range ");
     }
 
+    // fast path, the access resides in one initialized chunk
+    if (ADDR_OFFSET(address) + nBytes <= mem_bytes) {
+      MemoryBytes* chunk = FindWritableChunk(address, false);
+      if ((chunk != nullptr) && chunk->IsInitialized(ADDR_OFFSET(address), nBytes)) {
+        Unreserve(address, nBytes);
+        chunk->Write(ADDR_OFFSET(address), value, nBytes);
+        return;
+      }
+    }
+
     EnsureInitialization(address, nBytes);
 
     Unreserve(address, nBytes);
@@ -716,6 +765,10 @@ namespace Force {
 
   void Memory::Unreserve(uint64 address, uint32 nBytes)
   {
+    if (mReservedRanges.empty()) {
+      return;
+    }
+
     // Remove all reserved Sections that intersect the input Section; the first Section that could
     // intersect is the one immediately preceding the input Seciton's upper bound
     Section section(address, nBytes, EMemDataType::Both);
@@ -779,9 +832,19 @@ namespace Force {
   void Memory::Dump(ostream& out_str) const
   {
     DumpTitle(out_str);
-    for (auto const& map_item : mContent) {
-      out_str << "0x" << fmtx0(map_item.first, 16) << " : ";
-      map_item.second->Dump(out_str);
+
+    vector<uint64> frame_numbers;
+    GetFrameNumbers(frame_numbers);
+    for (auto frame_number : frame_numbers) {
+      uint64 frame_address = frame_number << FRAME_SHIFT;
+      const MemoryFrame& frame = *(mFrames.find(frame_number)->second);
+      for (uint64 addr = frame_address; addr < frame_address + FRAME_BYTES; addr += MEM_BYTES) {
+        const MemoryBytes& chunk = frame.Chunk(addr);
+        if (!chunk.IsEmpty()) {
+          out_str << "0x" << fmtx0(addr, 16) << " : ";
+          chunk.Dump(out_str);
+        }
+      }
     }
   }
 
@@ -799,10 +862,10 @@ namespace Force {
     DumpTitle(out_str);
 
     for (uint64 addr = address; addr < address + nBytes; addr += MEM_BYTES) {
-      auto it = mContent.find(addr);
-      if (it != mContent.end()) {
-        out_str << "0x" << fmtx0(it->first, 16) << " : ";
-        it->second->Dump(out_str);
+      const MemoryBytes* chunk = FindChunk(addr);
+      if (chunk != nullptr) {
+        out_str << "0x" << fmtx0(addr, 16) << " : ";
+        chunk->Dump(out_str);
       }
     }
 
@@ -810,21 +873,14 @@ namespace Force {
 
   void Memory::InitializeMemoryBytes(const MetaAccess& rMetaAccess, EMemDataType type)
   {
-    auto it = mContent.find(rMetaAccess.mAddress);
-    if (it == mContent.end()) {
-      MemoryBytes *mb = new MemoryBytes(rMetaAccess.mAddress);
-      mb->Initialize(rMetaAccess.mOffset, rMetaAccess.mData, rMetaAccess.mAttrs, rMetaAccess.mSize, type);
-      mContent[rMetaAccess.mAddress] = mb;
-    }
-    else {
-      it->second->Initialize(rMetaAccess.mOffset, rMetaAccess.mData, rMetaAccess.mAttrs, rMetaAccess.mSize, type);
-    }
+    MemoryBytes* chunk = FindWritableChunk(rMetaAccess.mAddress, true);
+    chunk->Initialize(rMetaAccess.mOffset, rMetaAccess.mData, rMetaAccess.mAttrs, rMetaAccess.mSize, type);
   }
 
   bool Memory::IsInitializedMemoryBytes(const MetaAccess& rMetaAccess) const
   {
-    auto it = mContent.find(ADDR_ALIGN(rMetaAccess.mAddress));
-    if (it == mContent.end() || !it->second->IsInitialized(rMetaAccess.mOffset, rMetaAccess.mSize)) {
+    const MemoryBytes* chunk = FindChunk(rMetaAccess.mAddress);
+    if (chunk == nullptr || !chunk->IsInitialized(rMetaAccess.mOffset, rMetaAccess.mSize)) {
       return false;
     }
 
@@ -847,32 +903,32 @@ namespace Force {
 
   void Memory::ReadMemoryBytes(MetaAccess& rMetaAccess) const
   {
-    auto it = mContent.find(rMetaAccess.mAddress);
-    if (it == mContent.end()) {
+    const MemoryBytes* chunk = FindChunk(rMetaAccess.mAddress);
+    if (chunk == nullptr) {
       LOG(fail) << "Failed to read memory 0x" << hex << rMetaAccess.mAddress << "." << "No matched memory bytes object, please initialize first" << endl;
       FAIL("no-matched-memory-bytes");
     }
-    rMetaAccess.mData = it->second->Read(rMetaAccess.mOffset, rMetaAccess.mSize);
+    rMetaAccess.mData = chunk->Read(rMetaAccess.mOffset, rMetaAccess.mSize);
   }
 
   void Memory::WriteMemoryBytes(const MetaAccess& rMetaAccess)
   {
-    auto it = mContent.find(rMetaAccess.mAddress);
-    if (it == mContent.end()) {
+    MemoryBytes* chunk = FindWritableChunk(rMetaAccess.mAddress, false);
+    if (chunk == nullptr) {
       LOG(fail) << "Failed to write memory 0x" << hex << rMetaAccess.mAddress << ". " << "No matched memory bytes object, please initialize first" << endl;
       FAIL("no-matched-memory-bytes");
     }
-    it->second->Write(rMetaAccess.mOffset, rMetaAccess.mData, rMetaAccess.mSize);
+    chunk->Write(rMetaAccess.mOffset, rMetaAccess.mData, rMetaAccess.mSize);
   }
 
   void Memory::ReadInitialValue(MetaAccess& rMetaAccess) const
   {
-    auto it = mContent.find(rMetaAccess.mAddress);
-    if (it == mContent.end()) {
+    const MemoryBytes* chunk = FindChunk(rMetaAccess.mAddress);
+    if (chunk == nullptr) {
       LOG(fail) << "Failed to init memory 0x" << hex << rMetaAccess.mAddress << ". " << "No matched memory bytes object, please initialize first" << endl;
       FAIL("no-matched-memory-bytes");
     }
-    rMetaAccess.mData = it->second->ReadInitialValue(rMetaAccess.mOffset, rMetaAccess.mSize);
+    rMetaAccess.mData = chunk->ReadInitialValue(rMetaAccess.mOffset, rMetaAccess.mSize);
 
   }
 
@@ -880,7 +936,7 @@ namespace Force {
   {
     uint32 attrs_read = 0;
     uint64 current_base_address = ADDR_ALIGN(address);
-    auto it = mContent.find(current_base_address);
+    const MemoryBytes* chunk = FindChunk(current_base_address);
     uint64 offset = ADDR_OFFSET(address);
     while (attrs_read < nBytes) {
       uint32 length = MEM_BYTES - offset;
@@ -890,9 +946,9 @@ namespace Force {
         length = nBytes - attrs_read;
       }
 
-      if (it != mContent.end()) {
+      if (chunk != nullptr) {
         for (uint32 i = 0; i < length; i++) {
-          memAttrs[attrs_read] = it->second->GetMemoryAttributes(offset + i);
+          memAttrs[attrs_read] = chunk->GetMemoryAttributes(offset + i);
           attrs_read++;
         }
       }
@@ -903,9 +959,8 @@ namespace Force {
         }
       }
 
-      // The next entry in the map may not be contiguous, so we can't just increment the iterator here
       current_base_address += 8;
-      it = mContent.find(current_base_address);
+      chunk = FindChunk(current_base_address);
 
       offset = 0;
     }
@@ -913,12 +968,11 @@ namespace Force {
 
   uint8 Memory::GetByteMemoryAttributes(cuint64 address) const
   {
-    uint64 aligned_addr = ADDR_ALIGN(address);
-    auto it = mContent.find(aligned_addr);
-    if (it == mContent.end()) {
+    const MemoryBytes* chunk = FindChunk(address);
+    if (chunk == nullptr) {
       return 0;
     }
-    return it->second->GetMemoryAttributes(ADDR_OFFSET(address));
+    return chunk->GetMemoryAttributes(ADDR_OFFSET(address));
   }
 
   //!< the data stream is byte ordering, data[0] responds to the lowerest address.
@@ -931,20 +985,19 @@ namespace Force {
       FAIL("unsupported-number-of-bytes");
     }
 
-    auto it = mContent.find(address);
-    if (it == mContent.end()) {
-      LOG(fail) << "Failed to read memory 0x" << hex << address << "." << "No matched memory bytes object, please initialize first" << endl;
-      FAIL("no-matched-memory-bytes");
-    }
-
     for (auto i = 0u; i< nBytes; i += MEM_BYTES) {
-      auto initialValue = it->second->ReadInitialWithPattern(Memory::msRandomPattern, Memory::msValuePattern);  // in big-endian format
+      const MemoryBytes* chunk = FindChunk(address + i);
+      if (chunk == nullptr) {
+        LOG(fail) << "Failed to read memory 0x" << hex << (address + i) << "." << "No matched memory bytes object, please initialize first" << endl;
+        FAIL("no-matched-memory-bytes");
+      }
+
+      auto initialValue = chunk->ReadInitialWithPattern(Memory::msRandomPattern, Memory::msValuePattern);  // in big-endian format
       for (int j = 0; j < MEM_BYTES; j ++) {
         data[j] = (initialValue >> ((MEM_BYTES - 1 - j) << 3)) & 0xffu;
       }
 
       data += MEM_BYTES;
-      it ++;
     }
 
   }
@@ -953,7 +1006,7 @@ namespace Force {
   {
     uint32 bytes_read = 0;
     uint64 current_base_address = ADDR_ALIGN(address);
-    auto it = mContent.find(current_base_address);
+    const MemoryBytes* chunk = FindChunk(current_base_address);
     uint64 offset = ADDR_OFFSET(address);
     while (bytes_read < nBytes) {
       uint32 length = MEM_BYTES - offset;
@@ -964,16 +1017,15 @@ namespace Force {
       }
 
       uint64 value = 0x0;
-      if (it != mContent.end()) {
-        value = it->second->ReadWithPattern(offset, length, false, 0x0);
+      if (chunk != nullptr) {
+        value = chunk->ReadWithPattern(offset, length, false, 0x0);
       }
 
       value_to_data_array_big_endian(value, length, data + bytes_read);
       bytes_read += length;
 
-      // The next entry in the map may not be contiguous, so we can't just increment the iterator here
       current_base_address += 8;
-      it = mContent.find(current_base_address);
+      chunk = FindChunk(current_base_address);
 
       offset = 0;
     }
@@ -981,36 +1033,128 @@ namespace Force {
 
   void Memory::GetSections(std::vector<Section>& rSections) const
   {
-    if (mContent.empty()) {
+    if (mFrames.empty()) {
       LOG(warn) << "{Memory::GetSections} memory contents empty." << endl;
       return;
     }
-    map<uint64, MemoryBytes *>::const_iterator mem_iter = mContent.begin();
-    uint64 address = mem_iter->first;
-    EMemDataType type = mem_iter->second->GetUniformedType();
-    uint32 size = MEM_BYTES;
-    uint64 next_addr = address + MEM_BYTES;
-    ++ mem_iter;
-
-    for (; mem_iter != mContent.end(); ++ mem_iter) {
-      // LOG(debug) << "{GetSections} item address: 0x" << hex << mem_iter->first << " section start: 0x" << address << " data type: " << EMemDataType_to_string(type) << endl;
-      auto dataType = mem_iter->second->GetUniformedType();
-      if ((dataType == type) && (mem_iter->first == next_addr)) {
-        size += MEM_BYTES;
-        next_addr += MEM_BYTES;
-      }
-      else  {
-        Section section(address, size, type);
-        rSections.push_back(section);
-        address = mem_iter->first;
+
+    vector<uint64> frame_numbers;
+    GetFrameNumbers(frame_numbers);
+
+    bool in_section = false;
+    uint64 address = 0;
+    EMemDataType type = EMemDataType::Init;
+    uint32 size = 0;
+    uint64 next_addr = 0;
+
+    for (auto frame_number : frame_numbers) {
+      uint64 frame_address = frame_number << FRAME_SHIFT;
+      const MemoryFrame& frame = *(mFrames.find(frame_number)->second);
+      for (uint64 chunk_addr = frame_address; chunk_addr < frame_address + FRAME_BYTES; chunk_addr += MEM_BYTES) {
+        const MemoryBytes& chunk = frame.Chunk(chunk_addr);
+        if (chunk.IsEmpty()) {
+          continue;
+        }
+
+        auto dataType = chunk.GetUniformedType();
+        if (in_section && (dataType == type) && (chunk_addr == next_addr)) {
+          size += MEM_BYTES;
+          next_addr += MEM_BYTES;
+          continue;
+        }
+
+        if (in_section) {
+          Section section(address, size, type);
+          rSections.push_back(section);
+        }
+        in_section = true;
+        address = chunk_addr;
         size = MEM_BYTES;
         next_addr = address + MEM_BYTES;
         type = dataType;
       }
     }
     // push the last one
-    Section section(address, size, type);
-    rSections.push_back(section);
+    if (in_section) {
+      Section section(address, size, type);
+      rSections.push_back(section);
+    }
+  }
+
+  void Memory::TakeSnapshot(MemorySnapshot& rSnapshot)
+  {
+    rSnapshot.mFrames = mFrames;
+    rSnapshot.mReservedRanges = mReservedRanges;
+
+    // all frames are shared with the snapshot now, so the cached writable frame has to be copied on its next write.
+    mpWriteFrame = nullptr;
+  }
+
+  void Memory::RestoreSnapshot(const MemorySnapshot& rSnapshot)
+  {
+    mFrames = rSnapshot.mFrames;
+    mReservedRanges = rSnapshot.mReservedRanges;
+    InvalidateFrameCache();
+  }
+
+  const MemoryBytes* Memory::FindChunk(uint64 address) const
+  {
+    uint64 frame_number = FRAME_NUMBER(address);
+    if ((mpReadFrame == nullptr) || (mReadFrameNumber != frame_number)) {
+      auto it = mFrames.find(frame_number);
+      if (it == mFrames.end()) {
+        return nullptr;
+      }
+      mpReadFrame = it->second.get();
+      mReadFrameNumber = frame_number;
+    }
+
+    const MemoryBytes& chunk = mpReadFrame->Chunk(address);
+    return chunk.IsEmpty() ? nullptr : &chunk;
+  }
+
+  MemoryBytes* Memory::FindWritableChunk(uint64 address, bool create)
+  {
+    uint64 frame_number = FRAME_NUMBER(address);
+    if ((mpWriteFrame == nullptr) || (mWriteFrameNumber != frame_number)) {
+      auto it = mFrames.find(frame_number);
+      if (it == mFrames.end()) {
+        if (!create) {
+          return nullptr;
+        }
+        it = mFrames.emplace(frame_number, make_shared<MemoryFrame>(frame_number << FRAME_SHIFT)).first;
+      }
+      else if (it->second.use_count() > 1) {
+        // copy on write, the frame is shared with a snapshot.
+        it->second = make_shared<MemoryFrame>(*(it->second));
+        if (mReadFrameNumber == frame_number) {
+          mpReadFrame = nullptr;
+        }
+      }
+      mpWriteFrame = it->second.get();
+      mWriteFrameNumber = frame_number;
+    }
+
+    MemoryBytes& chunk = mpWriteFrame->Chunk(address);
+    if (!create && chunk.IsEmpty()) {
+      return nullptr;
+    }
+    return &chunk;
+  }
+
+  void Memory::GetFrameNumbers(std::vector<uint64>& rFrameNumbers) const
+  {
+    rFrameNumbers.reserve(mFrames.size());
+    for (auto const& frame_item : mFrames) {
+      rFrameNumbers.push_back(frame_item.first);
+    }
+    sort(rFrameNumbers.begin(), rFrameNumbers.end());
+  }
+
+  void Memory::InvalidateFrameCache()
+  {
+    mpReadFrame = nullptr;
+    mpWriteFrame = nullptr;
   }
 
 //#ifndef UNIT_TEST
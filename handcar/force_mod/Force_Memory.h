@@ -19,7 +19,8 @@
 
 #include <iosfwd>
 #include <list>
-#include <map>
+#include <memory>
+#include <unordered_map>
 #include <vector>
 
 #include "Force_Defines.h"
@@ -28,6 +29,7 @@
 namespace Force {
 
   class MemoryBytes;
+  class MemoryFrame;
   struct MetaAccess;
 
   /*!
@@ -48,9 +50,30 @@ namespace Force {
       uint64 GetEndAddress() const; //!< Return the last address of the memory range.
   };
 
+  typedef std::unordered_map<uint64, std::shared_ptr<MemoryFrame> > MemoryFrameTable;
+
+  /*!
+    \class MemorySnapshot
+    \brief A copy-on-write snapshot of the contents of a Memory object.
+
+    The snapshot shares the page frames with the memory it was taken from; a frame is only copied when the memory writes to it afterwards.
+  */
+  class MemorySnapshot {
+  public:
+    MemorySnapshot() : mFrames(), mReservedRanges() { } //!< Constructor.
+    bool IsEmpty() const { return mFrames.empty(); } //!< Return if the snapshot holds no memory content.
+  private:
+    MemoryFrameTable mFrames; //!< page frames shared with the memory object.
+    std::list<Section> mReservedRanges; //!< reserved memory ranges at the time of the snapshot.
+    friend class Memory;
+  };
+
   /*!
     \class Memory
     \brief A memory model to record memory data and states.
+
+    Memory content is held in page frames of 8-byte chunks, looked up by frame number in a hash table. The most recently used frame is
+    cached so that accesses residing in one chunk resolve without a table lookup.
   */
   class Memory {
   public:
@@ -73,11 +96,15 @@ namespace Force {
     void Dump(std::ostream& out_str) const;                  //!< dump memory model for debug
     void Dump (std::ostream& out_str, uint64 address, uint64 nBytes) const; //!< dump memory range
     void GetSections(std::vector<Section>& rSections) const;    //!< Get sections the memory object contained, by address ascending order
+    void TakeSnapshot(MemorySnapshot& rSnapshot); //!< Record the current memory content into the snapshot without copying it.
+    void RestoreSnapshot(const MemorySnapshot& rSnapshot); //!< Restore the memory content recorded in the snapshot.
 
-    Memory(EMemBankType bankType, bool autoInit) : mBankType(bankType), mContent(), mAutoInit(autoInit) { }  //!< Constructor.
+    Memory(EMemBankType bankType, bool autoInit) : mBankType(bankType), mFrames(), mReservedRanges(), mAutoInit(autoInit), mpReadFrame(nullptr), mReadFrameNumber(0), mpWriteFrame(nullptr), mWriteFrameNumber(0) { }  //!< Constructor.
     ~Memory(); //!< Destructor.
+    COPY_CONSTRUCTOR_ABSENT(Memory);
+    ASSIGNMENT_OPERATOR_ABSENT(Memory);
     EMemBankType MemoryBankType() const { return mBankType; } //!< Return memory bank type.
-    bool IsEmpty() const { return mContent.empty(); } //!< Return if the memory module is empty.
+    bool IsEmpty() const { return mFrames.empty(); } //!< Return if the memory module is empty.
 //#ifndef UNIT_TEST
 //    static void InitializeFillPattern(); //!< initialize fill pattern
 //#endif
@@ -89,11 +116,19 @@ namespace Force {
     void WriteMemoryBytes(const MetaAccess& rMetaAccess);         //!< write memory bytes on meta access
     void ReadInitialValue(MetaAccess& rMetaAccess) const;         //!< read initial value on meta access
     void DumpTitle(std::ostream& out_str) const; //!< dump title
+    const MemoryBytes* FindChunk(uint64 address) const; //!< Return the initialized memory chunk containing the address, nullptr if there is none.
+    MemoryBytes* FindWritableChunk(uint64 address, bool create); //!< Return the memory chunk containing the address for modification, copying a frame shared with a snapshot first; create the frame if requested, otherwise return nullptr if the chunk is not initialized.
+    void GetFrameNumbers(std::vector<uint64>& rFrameNumbers) const; //!< Get the numbers of all frames in ascending order.
+    void InvalidateFrameCache(); //!< Drop the cached frames.
   private:
     EMemBankType mBankType;
-    std::map<uint64, MemoryBytes *> mContent;  //!< map containing all memory content, increasing order by the key
+    MemoryFrameTable mFrames;  //!< page frames containing all memory content, keyed by frame number
     std::list<Section> mReservedRanges; //!< List of reserved memory ranges sorted by start address
     bool mAutoInit; //!< Flag indicating memory should be automatically initialized on access if not already initialized
+    mutable const MemoryFrame* mpReadFrame; //!< most recently read frame
+    mutable uint64 mReadFrameNumber; //!< number of the most recently read frame
+    MemoryFrame* mpWriteFrame; //!< most recently written frame, never shared with a snapshot
+    uint64 mWriteFrameNumber; //!< number of the most recently written frame
     static bool msRandomPattern; //!< memory fill rondom pattern
     static uint64 msValuePattern;  //!< memory fill value pattern in big endian
  };
@@ -15,6 +15,7 @@
 //
 
 #include <algorithm>
+#include <chrono>
 #include <cstring>
 #include <iostream>
 #include <map>
@@ -902,6 +903,55 @@ CASE("Test 7, translate_virtual_address(...) api") {
 
 },
 
+CASE("Test 8, step simulator throughput") {
+
+  SETUP("Load SimDllApi Object")  {
+    SimDllApi sim_api;
+    EXPECT(not open_sim_dll(handcar_path, &sim_api));
+
+    int status = 0;
+
+    SECTION("Test 8, 0: report instructions per second of a load/store loop") {
+      sim_api.initialize_simulator("--auto-init-mem");
+
+      uint8_t target_addr[8] = {0x0, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0};
+      status = sim_api.write_simulator_register(0, "x1", target_addr, 8);
+      EXPECT(status == 0);
+
+      uint64_t instr_addr = 0x1000;
+      uint8_t loop_instr_data[16] = {
+        0x93, 0x82, 0x12, 0x00,  // ADDI x5 x5 1
+        0x23, 0xB0, 0x50, 0x00,  // SD x5 0(x1)
+        0x03, 0xB3, 0x00, 0x00,  // LD x6 0(x1)
+        0x6F, 0xF0, 0x5F, 0xFF   // JAL x0 -12
+      };
+      status = sim_api.write_simulator_memory(0, &instr_addr, 16, loop_instr_data);
+      EXPECT(status == 0);
+
+      const uint64_t instr_count = 200000;
+      int stx_failed = 0;
+      int step_status = 0;
+      auto start_time = std::chrono::steady_clock::now();
+      for (uint64_t i = 0; i < instr_count; ++ i) {
+        step_status |= sim_api.step_simulator(0, 1, stx_failed);
+      }
+      std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start_time;
+      EXPECT(step_status == 0);
+
+      uint8_t loop_count[8];
+      status = sim_api.read_simulator_register(0, "x6", loop_count, 8);
+      EXPECT(status == 0);
+      EXPECT(loop_count[0] == uint8_t((instr_count / 4) & 0xff));
+
+      double instrs_per_second = (elapsed.count() > 0.0) ? (instr_count / elapsed.count()) : 0.0;
+      std::cout << "Stepped " << std::dec << instr_count << " instructions in " << elapsed.count() << " seconds, " << uint64_t(instrs_per_second) << " instructions per second." << std::endl;
+
+      sim_api.terminate_simulator();
+      close_sim_dll(&sim_api);
+    }
+  }
+
+},
 
 };
 
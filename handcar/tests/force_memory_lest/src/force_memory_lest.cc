@@ -0,0 +1,137 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <vector>
+
+#include "lest/lest.hpp"
+
+#include "Force_Memory.h"
+
+using text = std::string;
+using namespace Force;
+
+const lest::test specification[] = {
+
+CASE("Test Force_Memory copy-on-write snapshots") {
+
+  SETUP("Setup Memory")  {
+    Memory mem(EMemBankType::Default, false);
+    mem.Initialize(0x1000, 0x1122334455667788ull, 8, EMemDataType::Data);
+    mem.Initialize(0x1008, 0x99aabbccddeeff00ull, 8, EMemDataType::Data);
+    mem.Initialize(0x5000, 0x0123456789abcdefull, 8, EMemDataType::Data);
+
+    SECTION("Test writing a frame shared with a snapshot leaves the snapshot unchanged") {
+      MemorySnapshot snapshot;
+      EXPECT(snapshot.IsEmpty());
+      mem.TakeSnapshot(snapshot);
+      EXPECT_NOT(snapshot.IsEmpty());
+
+      mem.Write(0x1000, 0xa5a5a5a5a5a5a5a5ull, 8);
+      EXPECT(mem.Read(0x1000, 8) == 0xa5a5a5a5a5a5a5a5ull);
+      EXPECT(mem.Read(0x1008, 8) == 0x99aabbccddeeff00ull);
+      EXPECT(mem.ReadInitialValue(0x1000, 8) == 0x1122334455667788ull);
+
+      mem.RestoreSnapshot(snapshot);
+      EXPECT(mem.Read(0x1000, 8) == 0x1122334455667788ull);
+      EXPECT(mem.Read(0x5000, 8) == 0x0123456789abcdefull);
+    }
+
+    SECTION("Test the cached write frame is copied after taking a snapshot") {
+      // the first write caches the frame as writable, the snapshot has to drop that cache.
+      mem.Write(0x1000, 0x1ull, 8);
+      MemorySnapshot snapshot;
+      mem.TakeSnapshot(snapshot);
+      mem.Write(0x1004, 0x2ull, 4);
+      mem.Write(0x1008, 0x3ull, 8);
+      EXPECT(mem.Read(0x1000, 8) == 0x2ull);
+      EXPECT(mem.Read(0x1008, 8) == 0x3ull);
+
+      mem.RestoreSnapshot(snapshot);
+      EXPECT(mem.Read(0x1000, 8) == 0x1ull);
+      EXPECT(mem.Read(0x1008, 8) == 0x99aabbccddeeff00ull);
+    }
+
+    SECTION("Test the cached read frame is dropped when its frame is copied") {
+      MemorySnapshot snapshot;
+      EXPECT(mem.Read(0x1008, 8) == 0x99aabbccddeeff00ull);
+      mem.TakeSnapshot(snapshot);
+      mem.Write(0x1008, 0x4ull, 8);
+      EXPECT(mem.Read(0x1008, 8) == 0x4ull);
+      std::vector<uint8> data(8);
+      mem.ReadPartiallyInitialized(0x1008, 8, data.data());
+      EXPECT(data[7] == 0x4);
+    }
+
+    SECTION("Test a restored snapshot stays shared and can be restored again") {
+      MemorySnapshot snapshot;
+      mem.TakeSnapshot(snapshot);
+      for (uint64 value = 0; value < 4; ++ value) {
+        mem.RestoreSnapshot(snapshot);
+        EXPECT(mem.Read(0x5000, 8) == 0x0123456789abcdefull);
+        mem.Write(0x5000, value, 8);
+        EXPECT(mem.Read(0x5000, 8) == value);
+      }
+      mem.RestoreSnapshot(snapshot);
+      EXPECT(mem.Read(0x5000, 8) == 0x0123456789abcdefull);
+    }
+
+    SECTION("Test memory initialized after a snapshot is dropped on restore") {
+      MemorySnapshot snapshot;
+      mem.TakeSnapshot(snapshot);
+      mem.Initialize(0x1010, 0x5ull, 8, EMemDataType::Data);
+      mem.Initialize(0x9000, 0x6ull, 8, EMemDataType::Data);
+      EXPECT(mem.IsInitialized(0x1010, 8));
+      EXPECT(mem.IsInitialized(0x9000, 8));
+
+      mem.RestoreSnapshot(snapshot);
+      EXPECT_NOT(mem.IsInitialized(0x1010, 8));
+      EXPECT_NOT(mem.IsInitialized(0x9000, 8));
+      EXPECT(mem.IsInitialized(0x1000, 16));
+    }
+
+    SECTION("Test two snapshots of diverging memory content") {
+      MemorySnapshot first_snapshot;
+      mem.TakeSnapshot(first_snapshot);
+      mem.Write(0x1000, 0x7ull, 8);
+      MemorySnapshot second_snapshot;
+      mem.TakeSnapshot(second_snapshot);
+      mem.Write(0x1000, 0x8ull, 8);
+
+      mem.RestoreSnapshot(first_snapshot);
+      EXPECT(mem.Read(0x1000, 8) == 0x1122334455667788ull);
+      mem.RestoreSnapshot(second_snapshot);
+      EXPECT(mem.Read(0x1000, 8) == 0x7ull);
+    }
+
+    SECTION("Test reserved ranges are restored") {
+      mem.Reserve(0x1000, 8);
+      MemorySnapshot snapshot;
+      mem.TakeSnapshot(snapshot);
+      mem.Write(0x1000, 0x9ull, 8);
+      EXPECT_NOT(mem.IsReserved(0x1000, 8));
+
+      mem.RestoreSnapshot(snapshot);
+      EXPECT(mem.IsReserved(0x1000, 8));
+    }
+  }
+},
+
+};
+
+int main(int argc, char* argv[])
+{
+  return lest::run(specification, argc, argv);
+}
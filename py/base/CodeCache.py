@@ -0,0 +1,150 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+import hashlib
+import json
+import os
+import sys
+import tempfile
+
+
+#  This class stores generated code in a directory shared between generator
+#  runs, so that code which comes out the same for every seed of a
+#  configuration, like the exception handlers, is only generated once. Each
+#  entry holds the instructions along with whatever else the code's owner
+#  needs to place it. Entries are looked up by a key hashed from everything
+#  the code depends on, so an entry is only reused when the generated code
+#  would be identical apart from its location.
+class CodeCache(object):
+
+    cFormatVersion = 2  # bump when the entry layout changes
+
+    def __init__(self, aCacheDir):
+        self._mCacheDir = aCacheDir
+        self._mSourceDigests = {}
+
+    # Return the key for the specified key items.
+    #
+    #  @param aKeyItems A dictionary of JSON serializable values the code
+    #       depends on.
+    #  @param aModules The modules whose source the code depends on. All
+    #       Python sources in the directories of these modules are hashed into
+    #       the key, so editing any of them invalidates the cache.
+    def computeKey(self, aKeyItems, aModules):
+        key_items = dict(aKeyItems)
+        key_items["FormatVersion"] = CodeCache.cFormatVersion
+        key_items["Sources"] = self._hashSourceDirectories(aModules)
+
+        key_text = json.dumps(key_items, sort_keys=True)
+        return hashlib.sha256(key_text.encode()).hexdigest()
+
+    # Return the cached entry for the specified key, or None if there is no
+    # usable entry.
+    #
+    #  @param aKey A key returned by computeKey().
+    def load(self, aKey):
+        try:
+            with open(self._getEntryPath(aKey), "r") as entry_file:
+                entry = json.load(entry_file)
+        except (OSError, ValueError):
+            return None
+
+        if entry.get("FormatVersion") != CodeCache.cFormatVersion:
+            return None
+
+        return entry
+
+    # Store an entry under the specified key. The entry is written to a
+    # temporary file and renamed, so that concurrent generator runs sharing
+    # the cache directory never read a partially written entry.
+    #
+    #  @param aKey A key returned by computeKey().
+    #  @param aEntry A dictionary of JSON serializable values.
+    def store(self, aKey, aEntry):
+        entry = dict(aEntry)
+        entry["FormatVersion"] = CodeCache.cFormatVersion
+
+        os.makedirs(self._mCacheDir, exist_ok=True)
+        (fd, temp_path) = tempfile.mkstemp(dir=self._mCacheDir, suffix=".tmp")
+        try:
+            with os.fdopen(fd, "w") as entry_file:
+                json.dump(entry, entry_file)
+            os.replace(temp_path, self._getEntryPath(aKey))
+        except OSError:
+            if os.path.exists(temp_path):
+                os.remove(temp_path)
+            raise
+
+    # Return the instructions with the specified record IDs coalesced into
+    # blocks of consecutive instructions of the same size. Each block is a
+    # list of the memory bank, the physical address, the instruction size,
+    # the opcodes, the instruction names and the assembly texts.
+    #
+    #  @param aSequence The Sequence that generated the instructions.
+    #  @param aInstructionRecordIds Record IDs of the generated instructions.
+    #  @param aGetInstructionSize A function returning the size of an opcode.
+    @staticmethod
+    def coalesceInstructions(aSequence, aInstructionRecordIds, aGetInstructionSize):
+        instructions = {}
+        for rec_id in aInstructionRecordIds:
+            instr_record = aSequence.queryInstructionRecord(rec_id)
+            instructions[(instr_record["Bank"], instr_record["PA"])] = (
+                instr_record["Opcode"],
+                instr_record["Name"],
+                instr_record["Assembly"],
+            )
+
+        instruction_blocks = []
+        block = None
+        for ((bank, pa), (opcode, name, asm_text)) in sorted(instructions.items()):
+            instr_size = aGetInstructionSize(opcode)
+            if (
+                (block is None)
+                or (block[0] != bank)
+                or (block[2] != instr_size)
+                or (block[1] + len(block[3]) * instr_size != pa)
+            ):
+                block = [bank, pa, instr_size, [], [], []]
+                instruction_blocks.append(block)
+            block[3].append(opcode)
+            block[4].append(name)
+            block[5].append(asm_text)
+
+        return instruction_blocks
+
+    def _getEntryPath(self, aKey):
+        return os.path.join(self._mCacheDir, "%s.json" % aKey)
+
+    def _hashSourceDirectories(self, aModules):
+        source_dirs = set()
+        for module in aModules:
+            module_file = getattr(sys.modules.get(module), "__file__", None)
+            if module_file is not None:
+                source_dirs.add(os.path.dirname(os.path.abspath(module_file)))
+
+        return [self._hashSourceDirectory(source_dir) for source_dir in sorted(source_dirs)]
+
+    def _hashSourceDirectory(self, aSourceDir):
+        if aSourceDir not in self._mSourceDigests:
+            source_hash = hashlib.sha256()
+            for file_name in sorted(os.listdir(aSourceDir)):
+                if file_name.endswith(".py"):
+                    source_hash.update(file_name.encode())
+                    with open(os.path.join(aSourceDir, file_name), "rb") as source_file:
+                        source_hash.update(source_file.read())
+
+            self._mSourceDigests[aSourceDir] = source_hash.hexdigest()
+
+        return self._mSourceDigests[aSourceDir]
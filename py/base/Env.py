@@ -138,6 +138,7 @@ class Env(object):
 
     # Start all the generator threads
     def generate(self):
+        Log.phase("init")
         for seq in self.beforeSequences:
             seq.genThread = self.mGenMain
             seq.run()
@@ -150,8 +151,10 @@ class Env(object):
                 at_mgr = self.mGenMain.addressTableManager
                 gen_thread.addressTableManager = at_mgr.createShallowCopy(gen_thread)
 
+        Log.phase("threads")
         self.executor.executeGenThreads(self.genThreads)
 
+        Log.phase("summary")
         for seq in self.afterSequences:
             seq.genThread = self.mGenMain
             seq.run()
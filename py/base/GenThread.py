@@ -102,6 +102,7 @@ class GenThread(object):
         self.setupComplete = False
         self.exceptionHandlerManager = None
         self.fastMode = None
+        self.instructionRecordIds = None  # record IDs of generated instructions, when recording
 
     def addSequence(self, seq):
         self.sequences.append(seq)
@@ -178,7 +179,21 @@ class GenThread(object):
                 return False
 
     def genInstruction(self, instr_name, kargs):
-        return self.interface.genInstruction(self.genThreadID, instr_name, kargs)
+        rec_id = self.interface.genInstruction(self.genThreadID, instr_name, kargs)
+        if self.instructionRecordIds is not None:
+            self.instructionRecordIds.append(rec_id)
+        return rec_id
+
+    # Start collecting the record IDs of the generated instructions
+    def startInstructionRecording(self):
+        self.instructionRecordIds = []
+
+    # Stop collecting and return the record IDs of the instructions generated
+    # since startInstructionRecording() was called
+    def stopInstructionRecording(self):
+        rec_ids = self.instructionRecordIds
+        self.instructionRecordIds = None
+        return rec_ids
 
     def genMetaInstruction(self, instr_name, kargs):
         return self.interface.genMetaInstruction(self.genThreadID, instr_name, kargs)
@@ -260,6 +275,11 @@ class GenThread(object):
             self.genThreadID, addr, bank, size, data, is_instr, is_virtual
         )
 
+    def initializeInstructions(self, addr, bank, instr_size, opcodes, names, asm_texts):
+        self.interface.initializeInstructions(
+            self.genThreadID, addr, bank, instr_size, opcodes, names, asm_texts
+        )
+
     def addSetupModifier(self, mod_class):
         """Add a ChoicesModifier to be applied before the sequences in the
         setup stage of the generator thread"""
@@ -383,6 +403,17 @@ class GenThread(object):
             sample_list.append(item)
         return sample_list
 
+    # Draw random values from a stream with the specified seed, until
+    # endDetachedRandomStream() is called. The values drawn meanwhile leave
+    # the values drawn afterwards alone.
+    def beginDetachedRandomStream(self, seed):
+        self.interface.beginDetachedRandomStream(seed)
+
+    # Go back to the random stream in use before the matching call to
+    # beginDetachedRandomStream()
+    def endDetachedRandomStream(self):
+        self.interface.endDetachedRandomStream()
+
     # Random choose one item from given item list
     # the item list could be dictionary, list, str, or tuple
     # (Note: assume the length of the item list is less than 32-bit integer)
@@ -160,6 +160,12 @@ class Sequence(object):
     def initializeMemory(self, addr, bank, size, data, is_instr, is_virtual):
         self.genThread.initializeMemory(addr, bank, size, data, is_instr, is_virtual)
 
+    # Place a block of consecutive instructions, given by their opcodes, at a
+    # physical address without generating them. The instruction names and
+    # assembly texts are listed in the test output like generated ones.
+    def initializeInstructions(self, addr, bank, instr_size, opcodes, names, asm_texts):
+        self.genThread.initializeInstructions(addr, bank, instr_size, opcodes, names, asm_texts)
+
     # Page related API
     def genPA(self, **kargs):
         return self.genThread.genPA(kargs)
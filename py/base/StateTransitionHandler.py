@@ -118,12 +118,20 @@ class StateTransitionHandler(Sequence):
             if byte_count > alignment:
                 alignment = byte_count
 
-        mem_block_start_addr = self.genVA(Size=mem_block_size, Align=alignment, Type="D")
+        mem_block_start_addr = self.allocateMemoryBlock(mem_block_size, alignment)
         self._initializeMemoryWithStateElementValues(mem_block_start_addr, aStateElems)
 
         load_gpr64_seq = LoadGPR64(self.genThread)
         load_gpr64_seq.load(aMemBlockPtrIndex, mem_block_start_addr)
 
+    # Return the starting virtual address of a block of memory to hold
+    # StateElement values. A random data address is chosen by default.
+    #
+    #  @param aSize The size of the memory block in bytes.
+    #  @param aAlign The alignment of the memory block in bytes.
+    def allocateMemoryBlock(self, aSize, aAlign):
+        return self.genVA(Size=aSize, Align=aAlign, Type="D")
+
     # Initialize a prepared block of memory with the values contained in the
     # specified StateElements. The memory block that begins as the specified
     # starting address is assumed to be large enough to hold all StateElement
@@ -14,6 +14,7 @@
 # limitations under the License.
 #
 import copy
+from base.CodeCache import CodeCache
 from base.Sequence import Sequence
 from base.exception_handlers.MemoryBankHandlerRegistry import (
     MemoryBankHandlerRegistryRepository,
@@ -37,11 +38,23 @@ from base.exception_handlers.ExceptionHandlerAssignment import (
 #
 #  *note: maps in the sense that the vector base address registers for the
 #         thread are initialized to addresses within the exception-set memory.
+#
+# The exception-sets can be cached across generator runs by specifying a cache
+# directory with the handlers_cache option. Without the option, the
+# exception-sets are generated from the random values of the seed as usual.
+# With it, a cached exception-set is placed in the exception-set memory instead
+# of being generated, when the handler assignments, the registers the handlers
+# use and the handler sources are the same. The registers are picked from the
+# random values of the seed, and each register choice gets its own cache entry.
+# The rest of a cached exception-set is generated with random values of its
+# own, see _generateDetached(). Cached handler instructions are listed in the
+# assembly file like generated ones.
 
 
 class ExceptionHandlerManager(Sequence):
 
     cSharedHandlerSetGenerated = False  # indicate if the shared code has been generated.
+    cHandlerRandomSeed = 0x5EED  # seed of the random values the exception-set is generated with
 
     def __init__(self, gen_thread, factory):
         super().__init__(gen_thread)
@@ -56,6 +69,7 @@ class ExceptionHandlerManager(Sequence):
 
         self.address_table = None
         self.spIndex = None
+        self.gen_mode = None
 
         # Force provides two default exception handler sets: 'Comprehensive'
         # and 'Fast'
@@ -76,12 +90,17 @@ class ExceptionHandlerManager(Sequence):
     def setup(self, **kargs):
         super().setup()
 
-        self.genThread.modifyGenMode("NoEscape,SimOff,NoJump,NoSkip,DelayInit")
+        self.gen_mode = "NoEscape,SimOff,NoJump,NoSkip,DelayInit"
+        # the handler branches save no Bnt nodes when the handlers are cached,
+        # as handlers placed from the cache could not save them either
+        if self._handlersCached():
+            self.gen_mode += ",NoBnt"
+        self.genThread.modifyGenMode(self.gen_mode)
 
     def cleanUp(self, **kargs):
         super().cleanUp()
 
-        self.genThread.revertGenMode("NoEscape,SimOff,NoJump,NoSkip,DelayInit")
+        self.genThread.revertGenMode(self.gen_mode)
 
     def debugPrint(self, msg):
         self.debug("DEBUG [ExceptionHandlerManager]: %s" % msg)
@@ -140,11 +159,7 @@ class ExceptionHandlerManager(Sequence):
 
             self.configureHandlerMemory()
 
-            self.thread_handler_set.generate(
-                exceptions_stack=self.exceptions_stack,
-                address_table=self.address_table,
-                default_set_name=self.default_set_name,
-            )
+            self.generateThreadHandlerSet()
 
         self.initializeVectorBaseAddressRegisters()
 
@@ -164,6 +179,75 @@ class ExceptionHandlerManager(Sequence):
             {"Function": "FastMode", "is_fast_mode": self.fastMode()},
         )
 
+    # Generate the shared exception-set, or place a cached copy of it
+    def generateThreadHandlerSet(self):
+        handler_set_args = {
+            "exceptions_stack": self.exceptions_stack,
+            "address_table": self.address_table,
+            "default_set_name": self.default_set_name,
+        }
+
+        handler_cache = self._createHandlerCache()
+        if handler_cache is None:
+            self.thread_handler_set.generate(**handler_set_args)
+            return
+
+        # the scratch registers are part of the cache key, so they are picked
+        # before the handlers are generated or placed from the cache
+        self.thread_handler_set.pickScratchRegisters(**handler_set_args)
+        cache_key = handler_cache.computeKey(
+            self.getHandlerCacheKeyItems(), self.getHandlerCacheModules()
+        )
+        cache_entry = handler_cache.load(cache_key)
+        if cache_entry is not None:
+            self.notice("[ExceptionHandlerManager] using cached handlers %s" % cache_key)
+            self.thread_handler_set.emplaceCacheEntry(cache_entry, **handler_set_args)
+        else:
+            self.notice("[ExceptionHandlerManager] caching handlers %s" % cache_key)
+            self.genThread.startInstructionRecording()
+            self._generateDetached(handler_set_args)
+            rec_ids = self.genThread.stopInstructionRecording()
+            handler_cache.store(cache_key, self.thread_handler_set.createCacheEntry(rec_ids))
+
+    # return the configuration items the generated handler code depends on
+    def getHandlerCacheConfigItems(self):
+        return {"HandlerSet": self.default_set_name}
+
+    # return everything besides the handler sources the generated handler code
+    # depends on
+    def getHandlerCacheKeyItems(self):
+        table_index = None
+        if self.address_table is not None:
+            table_index = self.address_table.tableIndex()
+
+        key_items = self.getHandlerCacheConfigItems()
+        key_items["Assignments"] = self.thread_handler_set.getHandlerAssignmentKeyItems()
+        key_items["VectorBasePaddings"] = self.thread_handler_set.getVectorBasePaddings()
+        key_items["StackPointerIndex"] = self.spIndex
+        key_items["AddressTableIndex"] = table_index
+        key_items["ScratchRegisters"] = self.thread_handler_set.scratch_registers
+        return key_items
+
+    # return the modules the generated handler code depends on
+    def getHandlerCacheModules(self):
+        handler_objects = [
+            self,
+            self.factory,
+            self.thread_handler_set,
+            self.exceptions_stack,
+            self.factory.createAssemblyHelper(self),
+        ]
+        for registry in self.memBankHandlerRegistryRepo.getMemoryBankHandlerRegistries():
+            handler_objects.append(registry.mHandlerSubroutineGenerator)
+            handler_objects.extend(registry.getExceptionHandlers())
+
+        modules = set()
+        for handler_object in handler_objects:
+            for handler_class in type(handler_object).__mro__:
+                modules.add(handler_class.__module__)
+
+        return sorted(modules)
+
     def registerDefaultExceptionHandlers(self):
         assignment_file_path = self.getDefaultAssignmentFilePath(self.default_set_name)
         assignment_parser = ExceptionHandlerAssignmentParser()
@@ -214,3 +298,31 @@ class ExceptionHandlerManager(Sequence):
 
     def getMemoryBanks(self):
         raise NotImplementedError
+
+    def _createHandlerCache(self):
+        (cache_dir, valid) = self.getOption("handlers_cache")
+        if not valid:
+            return None
+
+        # user-defined dispatch code can not be identified for the cache key
+        if self.thread_handler_set.user_sync_dispatcher is not None:
+            self.notice("[ExceptionHandlerManager] handlers with user-defined dispatch not cached")
+            return None
+
+        return CodeCache(cache_dir)
+
+    # return True if the exception-set is generated to be cached or placed
+    # from the cache, see _createHandlerCache()
+    def _handlersCached(self):
+        (_, valid) = self.getOption("handlers_cache")
+        return valid and (self.thread_handler_set.user_sync_dispatcher is None)
+
+    # Generate the exception-set to be cached with random values of its own,
+    # so it comes out the same for every seed and the test draws the same
+    # values whether the exception-set is generated or placed from the cache.
+    def _generateDetached(self, aHandlerSetArgs):
+        self.genThread.beginDetachedRandomStream(self.cHandlerRandomSeed)
+        try:
+            self.thread_handler_set.generate(**aHandlerSetArgs)
+        finally:
+            self.genThread.endDetachedRandomStream()
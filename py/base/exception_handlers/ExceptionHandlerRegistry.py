@@ -30,6 +30,10 @@ class ExceptionHandlerRegistry(object):
     def getExceptionHandler(self, aExceptionHandlerClassName):
         return self._mExceptionHandlers[aExceptionHandlerClassName]
 
+    # Return all exception handler instances.
+    def getExceptionHandlers(self):
+        return list(self._mExceptionHandlers.values())
+
     # Search for the specified exception handler by name. If an instance
     # exists, return it; otherwise, create a new instance and store it for
     # future retrieval. It is assumed that no two exception handler classes
@@ -59,6 +59,10 @@ class MemoryBankHandlerRegistry(object):
     def getExceptionHandler(self, aExceptionHandlerClassName):
         return self._mHandlerRegistry.getExceptionHandler(aExceptionHandlerClassName)
 
+    # Return all exception handler instances.
+    def getExceptionHandlers(self):
+        return self._mHandlerRegistry.getExceptionHandlers()
+
     # Search for the specified exception handler by name. If an instance
     # exists, return it; otherwise, create a new instance and store it for
     # future retrieval. It is assumed that no two exception handler classes
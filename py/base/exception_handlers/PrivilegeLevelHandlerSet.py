@@ -55,6 +55,7 @@ class PrivilegeLevelHandlerSet(Sequence):
         self.default_set_name = None
         self.master_async_handler_name = None
         self.nextCodeAddresses = None
+        self.addrTableErrorCodes = []  # error codes of handlers using the address table
 
     # the generate method sets up table and code addresses, and registers
     # all default exception handlers.
@@ -205,6 +206,23 @@ class PrivilegeLevelHandlerSet(Sequence):
         handler = mem_bank_handler_registry.getExceptionHandler(assignment.mHandlerClassName)
         return handler
 
+    # Return the synchronous exception handler assignments of all security
+    # states, in a form that can be hashed into a handler cache key.
+    def getHandlerAssignmentKeyItems(self):
+        key_items = []
+        for security_state in self.getSecurityStates():
+            security_state_handler_set = self.security_state_handler_sets[security_state]
+            ss_handlers = security_state_handler_set
+            handler_assignments = ss_handlers.getSynchronousExceptionHandlerAssignments()
+            key_items.append(
+                [
+                    security_state.name,
+                    self._getAssignmentKeyItems(handler_assignments),
+                ]
+            )
+
+        return key_items
+
     def getHandlerBoundaries(self, mem_bank):
         raise NotImplementedError
 
@@ -314,6 +332,7 @@ class PrivilegeLevelHandlerSet(Sequence):
         if hasattr(handler, "use_addr_table") and (handler.use_addr_table):
             info_set = {"Function": "AddrTableEC", "EC": err_code}
             self.exceptionRequest("UpdateHandlerInfo", info_set)
+            self.addrTableErrorCodes.append(err_code)
 
     def _generateJumpTable(self, aSortedHandlerAssignments, aDispatchAddresses):
         assembly_helper = self.factory.createAssemblyHelper(self)
@@ -357,6 +376,17 @@ class PrivilegeLevelHandlerSet(Sequence):
         # Update the dictionary with the new addresses
         self.recordSpecificHandlerBoundary(aMemBank, aErrCode, start_addr, end_addr)
 
+    def _getAssignmentKeyItems(self, aHandlerAssignments):
+        return [
+            [
+                str(exception_class),
+                handler_assignment.mMemBank.name,
+                handler_assignment.mHandlerClassName,
+                self._getAssignmentKeyItems(handler_assignment.getSubassignments()),
+            ]
+            for (exception_class, handler_assignment) in sorted(aHandlerAssignments.items())
+        ]
+
     def _genJumpToSynchronousHandler(self, aHandlerClassName, aMemBank):
         repo = self.memBankHandlerRegistryRepo
         registry = repo.getMemoryBankHandlerRegistry(aMemBank)
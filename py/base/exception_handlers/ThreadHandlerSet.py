@@ -15,6 +15,7 @@
 #
 import copy
 
+from base.CodeCache import CodeCache
 from base.Sequence import Sequence
 
 
@@ -70,6 +71,7 @@ class ThreadHandlerSet(Sequence):
         self.handler_memory = {}
         self.scratch_registers = None  # all generated handlers in set will use
         # the same set of scratch registers
+        self.scratch_register_sets = None
 
         self.default_set_name = None  # may be 'Fast', 'Comprehensive', etc.
         self.user_sync_dispatcher = None
@@ -86,35 +88,170 @@ class ThreadHandlerSet(Sequence):
             )
 
     def generate(self, **kwargs):
-        self.address_table = kwargs[
-            "address_table"
-        ]  # handlers can use address table to get recovery address
+        self._setupHandlerMemory(**kwargs)
+
+        # generate exception handlers, vector offset branches, etc. for all
+        # exception levels/memory-bank combinations
+        self._genExcepHandlerCombos()
+
+        self._notifyHandlerBoundaries()
+
+    # Pick the scratch registers all handlers in the set use, before the
+    # handlers are generated or placed from a cache entry.
+    def pickScratchRegisters(self, **kwargs):
+        # the handlers of the last privilege level are generated first
+        handler_set = self.priv_level_handler_sets[self.getPrivilegeLevels()[-1]]
+        handler_set.address_table = kwargs["address_table"]
+        handler_set.default_set_name = kwargs["default_set_name"]
+        handler_set.setupScratchRegisters()
+        self.scratch_registers = handler_set.scratchRegisters()
+
+    # Place the handlers of a cache entry created by createCacheEntry() in
+    # the handler memory, instead of generating them, and restore the state
+    # generating them would have left behind.
+    def emplaceCacheEntry(self, aCacheEntry, **kwargs):
+        self._setupHandlerMemory(**kwargs)
+        handler_memory_starts = self._getHandlerMemoryStarts()
+
+        mem_banks = {mem_bank.name: mem_bank for mem_bank in self.getMemoryBanks()}
+        for (bank_name, offset, instr_size, opcodes, names, asm_texts) in aCacheEntry[
+            "Instructions"
+        ]:
+            mem_bank = mem_banks[bank_name]
+            self.initializeInstructions(
+                handler_memory_starts[mem_bank] + offset,
+                mem_bank.value,
+                instr_size,
+                opcodes,
+                names,
+                asm_texts,
+            )
+
+        for priv_level in self.getPrivilegeLevels():
+            for security_state in self.getSupportedSecurityStates(priv_level):
+                offset = aCacheEntry["VectorBaseOffsets"][
+                    "%s/%s" % (priv_level.name, security_state.name)
+                ]
+                default_mem_bank = security_state.getDefaultMemoryBank()
+                self.vector_offset_tables[(priv_level, security_state)] = (
+                    handler_memory_starts[default_mem_bank] + offset
+                )
+
+        if self.fastMode():
+            self._reserveScratchRegisters()
+        self.scratch_register_sets = aCacheEntry["ScratchRegisterSets"]
+
+        for err_code in aCacheEntry["AddrTableErrorCodes"]:
+            self.exceptionRequest("UpdateHandlerInfo", {"Function": "AddrTableEC", "EC": err_code})
 
-        self.memBankHandlerRegistries = (
-            self.memBankHandlerRegistryRepo.getMemoryBankHandlerRegistries()
-        )
         for mem_bank_handler_registry in self.memBankHandlerRegistries:
-            self.debugPrint(
-                "MEMORY POOL ADDR: (%s) 0x%x"
-                % (
-                    mem_bank_handler_registry.mMemBank,
-                    mem_bank_handler_registry.mStartAddr,
+            mem_bank = mem_bank_handler_registry.mMemBank
+            for (handler_name, start_offset, end_offset) in aCacheEntry["HandlerBoundaries"][
+                mem_bank.name
+            ]:
+                self._recordSpecificHandlerBoundary(
+                    mem_bank,
+                    handler_name,
+                    handler_memory_starts[mem_bank] + start_offset,
+                    handler_memory_starts[mem_bank] + end_offset,
                 )
+
+        self._notifyHandlerBoundaries()
+
+    # Return a cache entry describing the generated handlers, with addresses
+    # relative to the start of the handler memory. Call this method after
+    # generate, with the record IDs of the instructions it generated.
+    def createCacheEntry(self, aInstructionRecordIds):
+        handler_memory_starts = self._getHandlerMemoryStarts()
+        mem_banks = {mem_bank.value: mem_bank for mem_bank in self.getMemoryBanks()}
+        instruction_blocks = []
+        for (bank, pa, instr_size, opcodes, names, asm_texts) in CodeCache.coalesceInstructions(
+            self, aInstructionRecordIds, self.getInstructionSize
+        ):
+            mem_bank = mem_banks[bank]
+            offset = pa - handler_memory_starts[mem_bank]
+            instruction_blocks.append(
+                [mem_bank.name, offset, instr_size, opcodes, names, asm_texts]
             )
 
-            self.handler_memory[
-                mem_bank_handler_registry.mMemBank
-            ] = mem_bank_handler_registry.mStartAddr
+        vector_base_offsets = {}
+        for ((priv_level, security_state), vector_base_addr) in self.vector_offset_tables.items():
+            default_mem_bank = security_state.getDefaultMemoryBank()
+            vector_base_offsets["%s/%s" % (priv_level.name, security_state.name)] = (
+                vector_base_addr - handler_memory_starts[default_mem_bank]
+            )
 
-        self.default_set_name = kwargs[
-            "default_set_name"
-        ]  # default handler set impacts scratch registers, handler generation
+        addr_table_err_codes = []
+        for priv_level in self.getPrivilegeLevels():
+            addr_table_err_codes.extend(
+                self.priv_level_handler_sets[priv_level].addrTableErrorCodes
+            )
 
-        # generate exception handlers, vector offset branches, etc. for all
-        # exception levels/memory-bank combinations
-        self._genExcepHandlerCombos()
+        handler_boundaries = {}
+        for mem_bank_handler_registry in self.memBankHandlerRegistries:
+            mem_bank = mem_bank_handler_registry.mMemBank
+            handler_boundaries[mem_bank.name] = [
+                (
+                    handler_name,
+                    handler_start_addr - handler_memory_starts[mem_bank],
+                    handler_end_addr - handler_memory_starts[mem_bank],
+                )
+                for (
+                    handler_name,
+                    handler_start_addr,
+                    handler_end_addr,
+                ) in mem_bank_handler_registry.getHandlerBoundaries()
+            ]
+
+        return {
+            "Instructions": instruction_blocks,
+            "VectorBaseOffsets": vector_base_offsets,
+            "ScratchRegisters": self.scratch_registers,
+            "ScratchRegisterSets": None if self.fastMode() else self.getScratchRegisterSets(),
+            "AddrTableErrorCodes": addr_table_err_codes,
+            "HandlerBoundaries": handler_boundaries,
+        }
+
+    # Return the handler assignments of all privilege levels and security
+    # states, in a form that can be hashed into a handler cache key.
+    def getHandlerAssignmentKeyItems(self):
+        key_items = []
+        for priv_level in self.getPrivilegeLevels():
+            priv_level_handler_set = self.priv_level_handler_sets[priv_level]
+            key_items.append(
+                [
+                    priv_level.name,
+                    priv_level_handler_set.master_async_handler_name,
+                    priv_level_handler_set.getHandlerAssignmentKeyItems(),
+                ]
+            )
+
+        return key_items
+
+    # Return the padding between the start of the handler memory and the
+    # first vector table, for each memory bank.
+    def getVectorBasePaddings(self):
+        vector_base_paddings = {}
+        repo = self.memBankHandlerRegistryRepo
+        for mem_bank_handler_registry in repo.getMemoryBankHandlerRegistries():
+            start_addr = mem_bank_handler_registry.mStartAddr
+            vector_base_paddings[mem_bank_handler_registry.mMemBank.name] = (
+                self.getNextVectorBaseAddress(start_addr) - start_addr
+            )
+
+        return vector_base_paddings
 
-        # Notify the backend about the generated handlers and their addresses
+    # Return the start of the handler memory for each memory bank. Generating
+    # the handlers advances the addresses in handler_memory, so the cache
+    # entries are relative to these instead.
+    def _getHandlerMemoryStarts(self):
+        return {
+            mem_bank_handler_registry.mMemBank: mem_bank_handler_registry.mStartAddr
+            for mem_bank_handler_registry in self.memBankHandlerRegistries
+        }
+
+    # Notify the backend about the generated handlers and their addresses
+    def _notifyHandlerBoundaries(self):
         info_set = {}
         address_pair_format = "%s:%s:%s"
         for mem_bank_handler_registry in self.memBankHandlerRegistries:
@@ -140,6 +277,31 @@ class ThreadHandlerSet(Sequence):
         info_set["Function"] = "RecordExceptionSpecificAddressBounds"
         self.exceptionRequest("UpdateHandlerInfo", info_set)
 
+    def _setupHandlerMemory(self, **kwargs):
+        self.address_table = kwargs[
+            "address_table"
+        ]  # handlers can use address table to get recovery address
+
+        self.memBankHandlerRegistries = (
+            self.memBankHandlerRegistryRepo.getMemoryBankHandlerRegistries()
+        )
+        for mem_bank_handler_registry in self.memBankHandlerRegistries:
+            self.debugPrint(
+                "MEMORY POOL ADDR: (%s) 0x%x"
+                % (
+                    mem_bank_handler_registry.mMemBank,
+                    mem_bank_handler_registry.mStartAddr,
+                )
+            )
+
+            self.handler_memory[
+                mem_bank_handler_registry.mMemBank
+            ] = mem_bank_handler_registry.mStartAddr
+
+        self.default_set_name = kwargs[
+            "default_set_name"
+        ]  # default handler set impacts scratch registers, handler generation
+
     # register any custom exception handlers BEFORE generate is called
     def assignSynchronousExceptionHandler(self, aAssignmentRequest):
         for priv_level in aAssignmentRequest.mPrivLevels:
@@ -166,6 +328,14 @@ class ThreadHandlerSet(Sequence):
     # return set of scratch (gpr) registers for a handler set.
     # NOTE: call this method after handlers are generated
     def getScratchRegisterSets(self):
+        if self.scratch_register_sets is None:
+            self.scratch_register_sets = self.collectScratchRegisterSets()
+
+        return dict(self.scratch_register_sets)
+
+    # collect the scratch registers for a handler set from the generated
+    # handlers
+    def collectScratchRegisterSets(self):
         raise NotImplementedError
 
     def getVectorBaseAddressSets(self):
@@ -205,6 +375,10 @@ class ThreadHandlerSet(Sequence):
     def getVectorEntryErrorCode(self):
         raise NotImplementedError
 
+    # return the size in bytes of the instruction with the given opcode
+    def getInstructionSize(self, aOpcode):
+        raise NotImplementedError
+
     # use this method to lay down a relative branch
     def genRelativeBranchAtAddr(self, br_address, br_target_address):
         raise NotImplementedError
@@ -0,0 +1,285 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+from Enums import EStateElementType
+
+import riscv.PcConfig as PcConfig
+from base.CodeCache import CodeCache
+from base.StateTransitionHandler import StateTransitionHandler
+from riscv.StateTransitionHandlerRISCV import (
+    FloatingPointRegisterStateTransitionHandlerRISCV,
+    GprStateTransitionHandlerRISCV,
+    SystemRegisterStateTransitionHandlerRISCV,
+    VectorRegisterStateTransitionHandlerRISCV,
+)
+from riscv.Utils import LoadGPR64, get_instruction_size
+
+
+#  This class makes a StateTransitionHandler generate the same code for every
+#  seed, by placing its memory block in the table assigned by the boot
+#  template and by picking helper GPRs in index order. Without an assigned
+#  table, the handler behaves as usual.
+class BootTemplateLayoutMixin(object):
+
+    cMaxHelperGprCount = 3  # the most helper GPRs a handler acquires at once
+
+    def __init__(self, aGenThread):
+        super().__init__(aGenThread)
+
+        self.mTableAddr = None
+
+    def allocateMemoryBlock(self, aSize, aAlign):
+        if self.mTableAddr is None:
+            return super().allocateMemoryBlock(aSize, aAlign)
+
+        return self.mTableAddr
+
+    def getArbitraryGprs(self, aGprCount, aExclude=None):
+        if self.mTableAddr is None:
+            return super().getArbitraryGprs(aGprCount, aExclude)
+
+        arbitrary_gpr_indices = sorted(self.getAllArbitraryGprs(aExclude))
+        if aGprCount > len(arbitrary_gpr_indices):
+            return None
+
+        return arbitrary_gpr_indices[:aGprCount]
+
+    # Initialize the GPRs getArbitraryGprs() may return as helpers. The code
+    # reads the helpers without simulating their earlier writes, so they
+    # would otherwise be initialized while the code is generated, and not at
+    # all when it is copied from the cache.
+    def initializeHelperGprs(self):
+        helper_gpr_indices = sorted(self.getAllArbitraryGprs(aExclude=(0, 1, 2)))
+        for gpr_index in helper_gpr_indices[: self.cMaxHelperGprCount]:
+            self.randomInitializeRegister("x%d" % gpr_index)
+
+
+class BootSystemRegisterStateTransitionHandlerRISCV(
+    BootTemplateLayoutMixin, SystemRegisterStateTransitionHandlerRISCV
+):
+    pass
+
+
+class BootFloatingPointRegisterStateTransitionHandlerRISCV(
+    BootTemplateLayoutMixin, FloatingPointRegisterStateTransitionHandlerRISCV
+):
+    pass
+
+
+class BootVectorRegisterStateTransitionHandlerRISCV(
+    BootTemplateLayoutMixin, VectorRegisterStateTransitionHandlerRISCV
+):
+    pass
+
+
+class BootGprStateTransitionHandlerRISCV(BootTemplateLayoutMixin, GprStateTransitionHandlerRISCV):
+    pass
+
+
+#  This class generates the boot code from templates kept in a CodeCache.
+#
+#  The boot registers are loaded from tables of values, one table per
+#  StateElement type, placed in the boot table region reserved after the boot
+#  region. The code loading a table only depends on the names of the
+#  registers, so it is the same for every seed of a configuration. The first
+#  run generates the code and stores it; later runs copy it into the boot
+#  region and only fill in the table with the register values of the seed.
+#  The code is generated with random values of its own, so the test draws the
+#  same values whether the code is generated or copied from the cache.
+#
+#  The register types are processed in the order given by
+#  cStateElementTypeOrder. GPRs come last, so all other GPRs can serve as
+#  helper registers for the tables of the other types.
+class BootTemplateStateTransitionHandlerRISCV(StateTransitionHandler):
+
+    cStateElementTypeOrder = (
+        EStateElementType.SystemRegister,
+        EStateElementType.FloatingPointRegister,
+        EStateElementType.VectorRegister,
+        EStateElementType.GPR,
+        EStateElementType.Memory,
+        EStateElementType.VmContext,
+        EStateElementType.PrivilegeLevel,
+        EStateElementType.PC,
+        EStateElementType.PredicateRegister,
+    )
+
+    cBootRandomSeed = 0xB007  # seed of the random values the boot code is generated with
+
+    def __init__(self, aGenThread, aCodeCache):
+        super().__init__(aGenThread)
+
+        self._mCodeCache = aCodeCache
+        self._mStateTransHandlers = {
+            EStateElementType.SystemRegister: BootSystemRegisterStateTransitionHandlerRISCV(
+                aGenThread
+            ),
+            EStateElementType.FloatingPointRegister: (
+                BootFloatingPointRegisterStateTransitionHandlerRISCV(aGenThread)
+            ),
+            EStateElementType.VectorRegister: BootVectorRegisterStateTransitionHandlerRISCV(
+                aGenThread
+            ),
+            EStateElementType.GPR: BootGprStateTransitionHandlerRISCV(aGenThread),
+        }
+
+        # the tables are allocated downwards from the end of the boot table
+        # region, reserved by GenThreadSetupSeqRISCV.setupBootRegion()
+        self._mTableAreaStart = PcConfig.get_boot_table_region_start(aGenThread.genThreadID)
+        self._mTableAreaEnd = self._mTableAreaStart + PcConfig.get_boot_table_region_size()
+
+    # Return the StateElement types this StateTransitionHandler processes.
+    def getStateElementTypes(self):
+        return tuple(self._mStateTransHandlers.keys())
+
+    # StateElements are only processed in groups of the same type.
+    #
+    #  @param aStateElem A StateElement object.
+    def processStateElement(self, aStateElem):
+        return False
+
+    # Execute the State changes represented by the StateElements, from a
+    # cached template when one is available.
+    #
+    #  @param aStateElems A list of all StateElement objects of a particular
+    #       type.
+    def processStateElements(self, aStateElems):
+        state_elem_type = aStateElems[0].getStateElementType()
+        state_trans_handler = self._mStateTransHandlers[state_elem_type]
+        state_trans_handler.mStateTransType = self.mStateTransType
+
+        start_pc = self.getPEstate("PC")
+        state_trans_handler.mTableAddr = self._allocateTable(aStateElems)
+        if state_trans_handler.mTableAddr is None:
+            self.notice("[BootTemplate] no room for a %s table" % state_elem_type.name)
+            state_trans_handler.setArbitraryGprs(self.getAllArbitraryGprs())
+            state_trans_handler.processStateElements(aStateElems)
+            return
+
+        if state_elem_type == EStateElementType.GPR:
+            state_trans_handler.setArbitraryGprs(self.getAllArbitraryGprs())
+        else:
+            # the GPRs are loaded afterwards, so any of them can help here
+            state_trans_handler.setArbitraryGprs(tuple(range(1, 32)))
+
+        state_trans_handler.initializeHelperGprs()
+        cache_key = self._mCodeCache.computeKey(
+            self._getKeyItems(state_trans_handler, start_pc, aStateElems),
+            self._getModules(state_trans_handler),
+        )
+        cache_entry = self._mCodeCache.load(cache_key)
+        if cache_entry is not None:
+            self.notice("[BootTemplate] using cached %s boot code" % state_elem_type.name)
+            for (offset, instr_size, opcodes, names, asm_texts) in cache_entry["Instructions"]:
+                self.initializeInstructions(
+                    cache_entry["PA"] + offset,
+                    cache_entry["Bank"],
+                    instr_size,
+                    opcodes,
+                    names,
+                    asm_texts,
+                )
+            self._initializeMemoryWithStateElementValues(
+                state_trans_handler.mTableAddr, aStateElems
+            )
+            self.setPEstate("PC", start_pc + cache_entry["CodeSize"])
+        else:
+            self.genThread.startInstructionRecording()
+            self.genThread.beginDetachedRandomStream(self.cBootRandomSeed)
+            try:
+                state_trans_handler.processStateElements(aStateElems)
+            finally:
+                self.genThread.endDetachedRandomStream()
+            rec_ids = self.genThread.stopInstructionRecording()
+
+            cache_entry = self._createCacheEntry(rec_ids, self.getPEstate("PC") - start_pc)
+            if cache_entry is not None:
+                self.notice("[BootTemplate] caching %s boot code" % state_elem_type.name)
+                self._mCodeCache.store(cache_key, cache_entry)
+
+        state_trans_handler.mTableAddr = None
+
+    # Return the address of a table for the StateElement values, or None if
+    # the table does not fit in the remaining boot table region.
+    #
+    #  @param aStateElems A list of StateElement objects of a particular type.
+    def _allocateTable(self, aStateElems):
+        table_size = 0
+        alignment = 8
+        for state_elem in aStateElems:
+            byte_count = len(state_elem.getValues()) * 8
+            table_size += byte_count
+            alignment = max(alignment, byte_count)
+
+        table_addr = (self._mTableAreaEnd - table_size) & ~(alignment - 1)
+        if table_addr < self._mTableAreaStart:
+            return None
+
+        self._mTableAreaEnd = table_addr
+        return table_addr
+
+    def _getKeyItems(self, aStateTransHandler, aStartPc, aStateElems):
+        return {
+            "StateElementType": aStateElems[0].getStateElementType().name,
+            "StateElements": [
+                [
+                    state_elem.getName(),
+                    state_elem.getRegisterIndex(),
+                    len(state_elem.getValues()),
+                ]
+                for state_elem in aStateElems
+            ],
+            "StartPC": aStartPc,
+            "TableAddress": aStateTransHandler.mTableAddr,
+            "ArbitraryGprs": sorted(aStateTransHandler.getAllArbitraryGprs()),
+            "AppRegisterWidth": self.getGlobalState("AppRegisterWidth"),
+        }
+
+    def _getModules(self, aStateTransHandler):
+        modules = {handler_class.__module__ for handler_class in type(aStateTransHandler).__mro__}
+        modules.add(LoadGPR64.__module__)
+        return sorted(modules)
+
+    # Return a cache entry holding the generated code, or None if the code is
+    # not one contiguous stretch of the given size.
+    #
+    #  @param aInstructionRecordIds Record IDs of the generated instructions.
+    #  @param aCodeSize The number of bytes the PC advanced by.
+    def _createCacheEntry(self, aInstructionRecordIds, aCodeSize):
+        instruction_blocks = CodeCache.coalesceInstructions(
+            self, aInstructionRecordIds, get_instruction_size
+        )
+        if not instruction_blocks:
+            return None
+
+        (bank, start_pa) = instruction_blocks[0][:2]
+        code_size = 0
+        for (block_bank, pa, instr_size, opcodes, _, _) in instruction_blocks:
+            if (block_bank != bank) or (pa != start_pa + code_size):
+                return None
+            code_size += instr_size * len(opcodes)
+
+        if code_size != aCodeSize:
+            return None
+
+        return {
+            "PA": start_pa,
+            "Bank": bank,
+            "Instructions": [
+                [pa - start_pa, instr_size, opcodes, names, asm_texts]
+                for (_, pa, instr_size, opcodes, names, asm_texts) in instruction_blocks
+            ],
+            "CodeSize": code_size,
+        }
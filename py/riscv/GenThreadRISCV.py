@@ -14,13 +14,19 @@
 # limitations under the License.
 #
 import StateTransition
-from Enums import EStateElementType
+from Enums import (
+    EStateElementType,
+    EStateTransitionOrderMode,
+    EStateTransitionType,
+)
 
 import riscv.PcConfig as PcConfig
+from base.CodeCache import CodeCache
 from base.GenThread import (
     GenThread,
     GenThreadSetupSequence,
 )
+from riscv.BootTemplateRISCV import BootTemplateStateTransitionHandlerRISCV
 from riscv.StateTransitionHandlerRISCV import *
 from riscv.exception_handlers.ExceptionHandlerManagerRISCV import (
     ExceptionHandlerManagerRISCV,
@@ -49,6 +55,17 @@ class GenThreadSetupSeqRISCV(GenThreadSetupSequence):
             },
         )
 
+        # reserve the boot table region before anything else is allocated, so
+        # the tables are at the same address for every seed
+        boot_cache_dir, valid = self.getOption("boot_cache")
+        if valid:
+            self.reserveMemoryRange(
+                "BootTableRegion_0x%x" % self.genThread.genThreadID,
+                PcConfig.get_boot_table_region_start(self.genThread.genThreadID),
+                PcConfig.get_boot_table_region_size(),
+                0,
+            )
+
     def setupEssentials(self):
         """Setup essentials like key register fields, etc"""
         self.genSequence("InitialSetup")
@@ -106,6 +123,24 @@ class GenThreadSetupSeqRISCV(GenThreadSetupSequence):
             EStateElementType.FloatingPointRegister,
         )
 
+        # generate the boot code from cached templates when a cache directory
+        # is specified
+        boot_cache_dir, valid = self.getOption("boot_cache")
+        if valid:
+            boot_template_handler = BootTemplateStateTransitionHandlerRISCV(
+                self.genThread, CodeCache(boot_cache_dir)
+            )
+            StateTransition.registerStateTransitionHandler(
+                boot_template_handler,
+                EStateTransitionType.Boot,
+                boot_template_handler.getStateElementTypes(),
+            )
+            StateTransition.setDefaultStateTransitionOrderMode(
+                EStateTransitionType.Boot,
+                EStateTransitionOrderMode.ByStateElementType,
+                boot_template_handler.cStateElementTypeOrder,
+            )
+
 
 #  GenThreadRISCV class
 #  RISCV class representing generator thread
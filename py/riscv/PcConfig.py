@@ -35,6 +35,16 @@ def get_boot_region_size():
     return 0x1000
 
 
+# The boot code generated from cached templates loads the register values
+# from tables in a region following the boot region.
+def get_boot_table_region_start(thread_id):
+    return get_boot_pc(thread_id) + get_boot_region_size()
+
+
+def get_boot_table_region_size():
+    return 0x1000
+
+
 def get_base_initial_pc():
     return 0x80011000
 
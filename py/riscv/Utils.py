@@ -303,3 +303,10 @@ class LoopControl(LoopControlBase):
     # control instructions.
     def getRandomGprForLoopControl(self):
         return self.getRandomGPR(exclude="0,1,2")
+
+
+#  Return the size in bytes of the instruction with the specified opcode.
+#
+#  @param aOpcode An instruction opcode.
+def get_instruction_size(aOpcode):
+    return 4 if ((aOpcode & 0x3) == 0x3) else 2
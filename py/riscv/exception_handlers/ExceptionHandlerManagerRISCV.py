@@ -133,6 +133,11 @@ class ExceptionHandlerManagerRISCV(ExceptionHandlerManager):
         }
         self.exceptionRequest("UpdateHandlerInfo", exception_bounds_info_set)
 
+    def getHandlerCacheConfigItems(self):
+        config_items = super().getHandlerCacheConfigItems()
+        config_items["AppRegisterWidth"] = self.getGlobalState("AppRegisterWidth")
+        return config_items
+
     def getDefaultAssignmentFilePath(self, defaultSetName):
         assignment_file_name = "default_%s_exception_handlers.json" % defaultSetName.lower()
         assignment_file_path = os.path.join(os.path.dirname(__file__), assignment_file_name)
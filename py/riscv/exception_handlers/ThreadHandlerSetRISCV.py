@@ -17,6 +17,7 @@ from base.exception_handlers.ThreadHandlerSet import ThreadHandlerSet
 from riscv.MemoryBank import MemoryBankRISCV
 from riscv.PrivilegeLevel import PrivilegeLevelRISCV
 from riscv.SecurityState import SecurityStateRISCV
+from riscv.Utils import get_instruction_size
 from riscv.exception_handlers.ExceptionClass import ExceptionClassRISCV
 
 
@@ -26,9 +27,9 @@ class ThreadHandlerSetRISCV(ThreadHandlerSet):
 
         self.currentPrivLevel = None
 
-    # return set of scratch (gpr) registers for a handler set.
-    # NOTE: call this method after handlers are generated
-    def getScratchRegisterSets(self):
+    # collect the scratch (gpr) registers for a handler set from the
+    # environment call handler
+    def collectScratchRegisterSets(self):
         scratch_register_sets = {}
 
         handler = self.priv_level_handler_sets[
@@ -106,6 +107,9 @@ class ThreadHandlerSetRISCV(ThreadHandlerSet):
     def getVectorEntryErrorCode(self):
         return 65
 
+    def getInstructionSize(self, aOpcode):
+        return get_instruction_size(aOpcode)
+
     # use this method to lay down a relative branch
     def genRelativeBranchAtAddr(self, br_address, br_target_address):
         save_pc = self.getPEstate("PC")
@@ -275,6 +275,13 @@ namespace Force {
     FlatMap = 4,
     MatchedHandler = 5,
     SkipBootCode = 6,
+    LazyAddressSolving = 7,
+    AddressSolvingThreads = 8,
+    SchedulingQuantum = 9,
+    MemoryReport = 10,
+    MemoryReportInterval = 11,
+    CompactionInterval = 12,
+    ExceptionRecordLimit = 13,
   };
   extern unsigned char ESystemOptionTypeSize;
   extern const std::string ESystemOptionType_to_string(ESystemOptionType in_enum); //!< Get string name for enum.
@@ -1123,7 +1123,7 @@ namespace Force {
   }
 
 
-  unsigned char ESystemOptionTypeSize = 7;
+  unsigned char ESystemOptionTypeSize = 14;
 
   const string ESystemOptionType_to_string(ESystemOptionType in_enum)
   {
@@ -1135,6 +1135,13 @@ namespace Force {
     case ESystemOptionType::FlatMap: return "FlatMap";
     case ESystemOptionType::MatchedHandler: return "MatchedHandler";
     case ESystemOptionType::SkipBootCode: return "SkipBootCode";
+    case ESystemOptionType::LazyAddressSolving: return "LazyAddressSolving";
+    case ESystemOptionType::AddressSolvingThreads: return "AddressSolvingThreads";
+    case ESystemOptionType::SchedulingQuantum: return "SchedulingQuantum";
+    case ESystemOptionType::MemoryReport: return "MemoryReport";
+    case ESystemOptionType::MemoryReportInterval: return "MemoryReportInterval";
+    case ESystemOptionType::CompactionInterval: return "CompactionInterval";
+    case ESystemOptionType::ExceptionRecordLimit: return "ExceptionRecordLimit";
     default:
       unknown_enum_value("ESystemOptionType", (unsigned char)(in_enum));
     }
@@ -1145,30 +1152,51 @@ namespace Force {
   {
     string enum_type_name = "ESystemOptionType";
     size_t size = in_str.size();
-    char hash_value = in_str.at(7 < size ? 7 : 7 % size);
+    char hash_value = in_str.at(3 < size ? 3 : 3 % size) ^ in_str.at(20 < size ? 20 : 20 % size);
 
     switch (hash_value) {
-    case 70:
+    case 0:
+      validate(in_str, "SchedulingQuantum", enum_type_name);
+      return ESystemOptionType::SchedulingQuantum;
+    case 1:
+      validate(in_str, "AddressSolvingThreads", enum_type_name);
+      return ESystemOptionType::AddressSolvingThreads;
+    case 3:
+      validate(in_str, "LazyAddressSolving", enum_type_name);
+      return ESystemOptionType::LazyAddressSolving;
+    case 4:
       validate(in_str, "FlatMap", enum_type_name);
       return ESystemOptionType::FlatMap;
-    case 72:
+    case 7:
       validate(in_str, "MatchedHandler", enum_type_name);
       return ESystemOptionType::MatchedHandler;
-    case 80:
-      validate(in_str, "DisablePaging", enum_type_name);
-      return ESystemOptionType::DisablePaging;
-    case 101:
-      validate(in_str, "NoHandler", enum_type_name);
-      return ESystemOptionType::NoHandler;
-    case 103:
+    case 19:
       validate(in_str, "PrivilegeLevel", enum_type_name);
       return ESystemOptionType::PrivilegeLevel;
-    case 111:
-      validate(in_str, "NoSkip", enum_type_name);
-      return ESystemOptionType::NoSkip;
-    case 116:
+    case 29:
+      validate(in_str, "CompactionInterval", enum_type_name);
+      return ESystemOptionType::CompactionInterval;
+    case 31:
+      validate(in_str, "MemoryReport", enum_type_name);
+      return ESystemOptionType::MemoryReport;
+    case 32:
+      validate(in_str, "ExceptionRecordLimit", enum_type_name);
+      return ESystemOptionType::ExceptionRecordLimit;
+    case 34:
+      validate(in_str, "MemoryReportInterval", enum_type_name);
+      return ESystemOptionType::MemoryReportInterval;
+    case 41:
+      validate(in_str, "NoHandler", enum_type_name);
+      return ESystemOptionType::NoHandler;
+    case 49:
+      validate(in_str, "DisablePaging", enum_type_name);
+      return ESystemOptionType::DisablePaging;
+    case 51:
       validate(in_str, "SkipBootCode", enum_type_name);
       return ESystemOptionType::SkipBootCode;
+    case 56:
+      validate(in_str, "NoSkip", enum_type_name);
+      return ESystemOptionType::NoSkip;
     default:
       unknown_enum_name(enum_type_name, in_str);
     }
@@ -1179,30 +1207,51 @@ namespace Force {
   {
     okay = true;
     size_t size = in_str.size();
-    char hash_value = in_str.at(7 < size ? 7 : 7 % size);
+    char hash_value = in_str.at(3 < size ? 3 : 3 % size) ^ in_str.at(20 < size ? 20 : 20 % size);
 
     switch (hash_value) {
-    case 70:
+    case 0:
+      okay = (in_str == "SchedulingQuantum");
+      return ESystemOptionType::SchedulingQuantum;
+    case 1:
+      okay = (in_str == "AddressSolvingThreads");
+      return ESystemOptionType::AddressSolvingThreads;
+    case 3:
+      okay = (in_str == "LazyAddressSolving");
+      return ESystemOptionType::LazyAddressSolving;
+    case 4:
       okay = (in_str == "FlatMap");
       return ESystemOptionType::FlatMap;
-    case 72:
+    case 7:
       okay = (in_str == "MatchedHandler");
       return ESystemOptionType::MatchedHandler;
-    case 80:
-      okay = (in_str == "DisablePaging");
-      return ESystemOptionType::DisablePaging;
-    case 101:
-      okay = (in_str == "NoHandler");
-      return ESystemOptionType::NoHandler;
-    case 103:
+    case 19:
       okay = (in_str == "PrivilegeLevel");
       return ESystemOptionType::PrivilegeLevel;
-    case 111:
-      okay = (in_str == "NoSkip");
-      return ESystemOptionType::NoSkip;
-    case 116:
+    case 29:
+      okay = (in_str == "CompactionInterval");
+      return ESystemOptionType::CompactionInterval;
+    case 31:
+      okay = (in_str == "MemoryReport");
+      return ESystemOptionType::MemoryReport;
+    case 32:
+      okay = (in_str == "ExceptionRecordLimit");
+      return ESystemOptionType::ExceptionRecordLimit;
+    case 34:
+      okay = (in_str == "MemoryReportInterval");
+      return ESystemOptionType::MemoryReportInterval;
+    case 41:
+      okay = (in_str == "NoHandler");
+      return ESystemOptionType::NoHandler;
+    case 49:
+      okay = (in_str == "DisablePaging");
+      return ESystemOptionType::DisablePaging;
+    case 51:
       okay = (in_str == "SkipBootCode");
       return ESystemOptionType::SkipBootCode;
+    case 56:
+      okay = (in_str == "NoSkip");
+      return ESystemOptionType::NoSkip;
     default:
       okay = false;
       return ESystemOptionType::PrivilegeLevel;
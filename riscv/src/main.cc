@@ -13,25 +13,43 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+#include "Architectures.h"
+#include "Config.h"
 #include "Dump.h"
 #include "Log.h"
+#include "MultiSeedRunner.h"
 #include "Scheduler.h"
 #include "TopLevelResourcesRISCV.h"
 
 using namespace Force;
 using namespace std;
 
-int main(int argc, char* argv[])
+static void generate_test()
 {
-  initialize_top_level_resources_RISCV(argc, argv);
-
   Scheduler::Initialize();
   Scheduler* master_scheduler = Scheduler::Instance();
   master_scheduler->Run();
   Dump::Instance()->DumpInfo(false); // not partial
   Scheduler::Destroy();
+}
+
+int main(int argc, char* argv[])
+{
+  initialize_top_level_resources_RISCV(argc, argv);
+
+  int exit_code = 0;
+  Config* config_ptr = Config::Instance();
+  if (config_ptr->SeedCount() > 1) {
+    // Load the architecture data once, to be shared by all seeds.
+    Architectures::Instance()->SetupGeneratorTemplates();
+    MultiSeedRunner seed_runner(config_ptr->TestSeed(), config_ptr->SeedCount(), config_ptr->ParallelJobs());
+    exit_code = seed_runner.Run(&generate_test);
+  }
+  else {
+    generate_test();
+  }
 
   destroy_top_level_resources_RISCV();
 
-  return 0;
+  return exit_code;
 }
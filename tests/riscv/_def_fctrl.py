@@ -178,4 +178,8 @@ control_items = [
         "fname": "rv64/_noiss_fctrl.py",
         "generator": {"--cfg": "config/riscv_rv64.config"},
     },
+    {
+        "fname": "performance/_noiss_fctrl.py",
+        "generator": {"--cfg": "config/riscv_rv64.config"},
+    },
 ]
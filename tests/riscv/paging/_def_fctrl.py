@@ -45,6 +45,13 @@ control_items = [
             "--dump": "PageMemAttrJSON",
         },
     },
+    {
+        "fname": "paging_range_physical_allocation_force.py",
+        "options": {"max-instr": 10000},
+        "generator": {
+            "--options": '"PrivilegeLevel=1"',
+        },
+    },
     {
         "fname": "paging_force.py",
         "options": {"max-instr": 10000},
@@ -22,6 +22,10 @@ control_items = [
         "fname": "paging_loadstore_force.py",
         "generator": {"--options": '"PrivilegeLevel=1"', "--noiss": None},
     },
+    {
+        "fname": "paging_range_physical_allocation_force.py",
+        "generator": {"--options": '"PrivilegeLevel=1"', "--noiss": None},
+    },
     {
         "fname": "paging_force.py",
         "generator": {
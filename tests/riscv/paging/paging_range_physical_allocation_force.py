@@ -0,0 +1,83 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+from base.ChoicesModifier import ChoicesModifier
+from base.Sequence import Sequence
+from riscv.EnvRISCV import EnvRISCV
+from riscv.GenThreadRISCV import GenThreadRISCV
+
+
+# This test verifies that a large virtual address range mapped with 4K pages
+# is backed by contiguous physical memory when the Range Physical Allocation
+# paging choice selects contiguous allocation, and that it can still be
+# mapped page by page otherwise.
+class MainSequence(Sequence):
+    def generate(self, **kwargs):
+        choices_mod = ChoicesModifier(self.genThread)
+        satp_info = self.getRegisterInfo("satp", self.getRegisterIndex("satp"))
+        if satp_info["Width"] == 32:
+            choices_mod.modifyPagingChoices("Page size#4K granule#S#stage 1", {"4K": 10, "4M": 0})
+        else:
+            choices_mod.modifyPagingChoices(
+                "Page size#4K granule#S#stage 1",
+                {"4K": 10, "2M": 0, "1G": 0, "512G": 0},
+            )
+
+        choices_mod.modifyPagingChoices(
+            "Range Physical Allocation", {"RandomPerPage": 0, "Contiguous": 10}
+        )
+        choices_mod.commitSet()
+
+        range_size = 0x100000
+        for _ in range(2):
+            range_start = self.genVA(Size=range_size, Align=0x1000, Type="D")
+            self._checkPhysicalRange(range_start, range_size)
+
+        choices_mod.modifyPagingChoices(
+            "Range Physical Allocation", {"RandomPerPage": 10, "Contiguous": 0}
+        )
+        choices_mod.commitSet()
+
+        range_start = self.genVA(Size=range_size, Align=0x1000, Type="D")
+        self._checkMapped(range_start, range_size)
+
+    # Check that each 4K page of the range follows the previous page in
+    # physical memory.
+    def _checkPhysicalRange(self, aStart, aSize):
+        expected_pa = self._getPhysicalLower(aStart)
+        for page_va in range(aStart, aStart + aSize, 0x1000):
+            page_pa = self._getPhysicalLower(page_va)
+            if page_pa != expected_pa:
+                self.error(
+                    "Page at VA 0x%x is at PA 0x%x instead of 0x%x"
+                    % (page_va, page_pa, expected_pa)
+                )
+            expected_pa = page_pa + 0x1000
+
+    def _checkMapped(self, aStart, aSize):
+        for page_va in range(aStart, aStart + aSize, 0x1000):
+            self._getPhysicalLower(page_va)
+
+    def _getPhysicalLower(self, aVa):
+        page_info = self.getPageInfo(aVa, "VA", 0)
+        if "Page" not in page_info:
+            self.error("Page at VA 0x%x is not mapped" % aVa)
+
+        return page_info["Page"]["PhysicalLower"]
+
+
+MainSequenceClass = MainSequence
+GenThreadClass = GenThreadRISCV
+EnvClass = EnvRISCV
@@ -0,0 +1,36 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+control_items = [
+    {"fname": "*_throughput_force.py", "generator": {"--noiss": None}},
+    {
+        "fname": "dispatch_overhead_force.py",
+        "options": {"num-cores": 4},
+        "generator": {"--noiss": None},
+    },
+    {
+        "fname": "dispatch_overhead_force.py",
+        "options": {"num-chips": 4, "num-cores": 4, "num-threads": 2},
+        "generator": {"--noiss": None},
+    },
+    {
+        "fname": "dispatch_overhead_force.py",
+        "options": {"num-chips": 4, "num-cores": 4, "num-threads": 2},
+        "generator": {
+            "--noiss": None,
+            "--options": '"SchedulingQuantum=8"',
+        },
+    },
+]
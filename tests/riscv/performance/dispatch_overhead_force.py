@@ -0,0 +1,51 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+import time
+
+from base.Sequence import Sequence
+from riscv.EnvRISCV import EnvRISCV
+from riscv.GenThreadRISCV import GenThreadRISCV
+
+
+# This test measures the overhead of dispatching back end requests among
+# generator threads. It is intended to be run with --noiss and varying thread
+# counts. Each thread makes a fixed number of inexpensive back end calls, each
+# of which hands the dispatcher over to the next scheduled thread, and reports
+# the rate of requests dispatched across all threads.
+class MainSequence(Sequence):
+    def generate(self, **kargs):
+        request_count = 2000
+        thread_count = self.getThreadNumber()
+
+        start_time = time.perf_counter()
+        for _ in range(request_count):
+            self.getOption("SchedulingQuantum")
+        elapsed_time = time.perf_counter() - start_time
+
+        self.notice(
+            "Dispatch throughput with %d threads: %d requests in %.3f s, %.1f requests/second"
+            % (
+                thread_count,
+                request_count * thread_count,
+                elapsed_time,
+                request_count * thread_count / elapsed_time,
+            )
+        )
+
+
+MainSequenceClass = MainSequence
+GenThreadClass = GenThreadRISCV
+EnvClass = EnvRISCV
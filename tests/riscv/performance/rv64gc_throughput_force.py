@@ -0,0 +1,47 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+import time
+
+from DV.riscv.trees.instruction_tree import RV_G_instructions, RV_C_instructions
+from base.Sequence import Sequence
+from riscv.EnvRISCV import EnvRISCV
+from riscv.GenThreadRISCV import GenThreadRISCV
+
+
+# This test measures instruction generation throughput for a random mix of
+# RV64GC instructions. It is intended to be run with --noiss, and reports the
+# rate of the main sequence in instructions per second.
+class MainSequence(Sequence):
+    def generate(self, **kargs):
+        instr_count = 5000
+        instrs = dict(RV_G_instructions)
+        instrs.update(RV_C_instructions)
+
+        start_time = time.perf_counter()
+        for _ in range(instr_count):
+            instr = self.pickWeighted(instrs)
+            self.genInstruction(instr)
+        elapsed_time = time.perf_counter() - start_time
+
+        self.notice(
+            "Generation throughput: %d instructions in %.3f s, %.1f instructions/second"
+            % (instr_count, elapsed_time, instr_count / elapsed_time)
+        )
+
+
+MainSequenceClass = MainSequence
+GenThreadClass = GenThreadRISCV
+EnvClass = EnvRISCV
@@ -0,0 +1,75 @@
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+import time
+
+from base.Sequence import Sequence
+from riscv.EnvRISCV import EnvRISCV
+from riscv.GenThreadRISCV import GenThreadRISCV
+
+
+# This test measures instruction generation throughput for a random mix of
+# vector arithmetic, mask, reduction and load/store instructions. It is
+# intended to be run with --noiss, and reports the rate of the main sequence in
+# instructions per second.
+class MainSequence(Sequence):
+    def generate(self, **kargs):
+        instr_count = 5000
+        instrs = {
+            "VADD.VV##RISCV": 10,
+            "VADD.VX##RISCV": 10,
+            "VADD.VI##RISCV": 10,
+            "VSUB.VV##RISCV": 10,
+            "VAND.VV##RISCV": 10,
+            "VOR.VX##RISCV": 10,
+            "VXOR.VI##RISCV": 10,
+            "VSLL.VV##RISCV": 10,
+            "VSRL.VX##RISCV": 10,
+            "VSRA.VI##RISCV": 10,
+            "VMUL.VV##RISCV": 10,
+            "VMULH.VX##RISCV": 10,
+            "VMIN.VV##RISCV": 10,
+            "VMAXU.VX##RISCV": 10,
+            "VMSEQ.VV##RISCV": 10,
+            "VMSLT.VX##RISCV": 10,
+            "VMERGE.VVM##RISCV": 10,
+            "VMV.V.V##RISCV": 10,
+            "VREDSUM.VS##RISCV": 10,
+            "VREDMAX.VS##RISCV": 10,
+            "VMAND.MM##RISCV": 10,
+            "VMXOR.MM##RISCV": 10,
+            "VWADD.VV##RISCV": 10,
+            "VNSRL.WV##RISCV": 10,
+            "VLE32.V##RISCV": 20,
+            "VSE32.V##RISCV": 20,
+            "VLSE32.V##RISCV": 10,
+            "VLUXEI32.V##RISCV": 10,
+        }
+
+        start_time = time.perf_counter()
+        for _ in range(instr_count):
+            instr = self.pickWeighted(instrs)
+            self.genInstruction(instr)
+        elapsed_time = time.perf_counter() - start_time
+
+        self.notice(
+            "Generation throughput: %d instructions in %.3f s, %.1f instructions/second"
+            % (instr_count, elapsed_time, instr_count / elapsed_time)
+        )
+
+
+MainSequenceClass = MainSequence
+GenThreadClass = GenThreadRISCV
+EnvClass = EnvRISCV
@@ -0,0 +1,250 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "BntNode.h"
+
+#include <algorithm>
+
+#include "lest/lest.hpp"
+
+#include "BntNodeManager.h"
+#include "Constraint.h"
+#include "Generator.h"
+#include "Log.h"
+#include "MemoryManager.h"
+#include "Register.h"
+#include "SimplePeState.h"
+
+using text = std::string;
+
+using namespace std;
+using namespace Force;
+
+namespace Force {
+
+  // BntNode.cc and ResourcePeState.cc refer to these methods when preserving paths and restoring states through a generator, which
+  // the tests do not construct.
+  void Generator::ReserveMemory(const std::string& name, uint64 start, uint64 size, uint32 bank, bool isVirtual) { }
+  void Generator::UnreserveMemory(const std::string& name, uint64 start, uint64 size, uint32 bank, bool isVirtual) { }
+  uint64 Generator::LastPC() const { return 0; }
+  void Generator::SetDependenceInstance(ResourceDependence* pDependence) { }
+  void MemoryBank::WriteMemory(uint64 address, cuint8* data, uint32 nBytes) { }
+  void MemoryManager::BankOutOfBound(uint32 bank) const { }
+
+}
+
+/*!
+  \class BntNodeTest
+  \brief Non-taken conditional Bnt node with a preserved not-taken path and PE state given directly.
+*/
+class BntNodeTest : public BntNode {
+public:
+  BntNodeTest(uint64 brTarget, uint64 nextPC, uint64 notTakenPa, const vector<Register* >& rRegContext)
+    : BntNode(brTarget, false, true)
+  {
+    SetNextPC(nextPC);
+    mNotTakenPa = notTakenPa;
+    mNotTakenBank = 0;
+    mNotTakenPaValid = true;
+    mpPeState = new SimplePeState();
+    mpPeState->SaveState(nullptr, rRegContext);
+  }
+
+  ~BntNodeTest()
+  {
+    msDeletedTargets.push_back(mBranchTarget);
+  }
+
+  ASSIGNMENT_OPERATOR_ABSENT(BntNodeTest);
+  COPY_CONSTRUCTOR_ABSENT(BntNodeTest);
+
+  static vector<uint64> msDeletedTargets; //!< Branch targets of the deleted nodes.
+};
+
+vector<uint64> BntNodeTest::msDeletedTargets;
+
+// Return the branch targets of the nodes in the manager, and delete the nodes.
+vector<uint64> take_bnt_nodes(BntNodeManager& rBntNodeManager)
+{
+  vector<BntNode* > bnt_nodes;
+  rBntNodeManager.SwapBntNodes(bnt_nodes);
+
+  vector<uint64> branch_targets;
+  for (BntNode* bnt_node : bnt_nodes) {
+    branch_targets.push_back(bnt_node->BranchTarget());
+    delete bnt_node;
+  }
+
+  BntNodeTest::msDeletedTargets.clear();
+  return branch_targets;
+}
+
+const lest::test specification[] = {
+
+CASE("Test SimplePeState covering another state") {
+
+  SETUP("Setup registers")  {
+    Register reg_a;
+    Register reg_b;
+    Register reg_c;
+
+    SimplePeState state_ab;
+    state_ab.SaveState(nullptr, {&reg_a, &reg_b});
+
+    SECTION("Cover states with the same registers or fewer") {
+      SimplePeState other_ab;
+      other_ab.SaveState(nullptr, {&reg_a, &reg_b});
+      EXPECT(state_ab.CoversState(other_ab));
+
+      SimplePeState other_a;
+      other_a.SaveState(nullptr, {&reg_a});
+      EXPECT(state_ab.CoversState(other_a));
+
+      SimplePeState other_empty;
+      EXPECT(state_ab.CoversState(other_empty));
+    }
+
+    SECTION("Do not cover states with partly overlapping registers") {
+      SimplePeState other_ac;
+      other_ac.SaveState(nullptr, {&reg_a, &reg_c});
+      EXPECT_NOT(state_ab.CoversState(other_ac));
+
+      SimplePeState other_bc;
+      other_bc.SaveState(nullptr, {&reg_b, &reg_c});
+      EXPECT_NOT(state_ab.CoversState(other_bc));
+
+      SimplePeState other_abc;
+      other_abc.SaveState(nullptr, {&reg_a, &reg_b, &reg_c});
+      EXPECT_NOT(state_ab.CoversState(other_abc));
+      EXPECT(other_abc.CoversState(state_ab));
+
+      SimplePeState other_c;
+      other_c.SaveState(nullptr, {&reg_c});
+      EXPECT_NOT(state_ab.CoversState(other_c));
+    }
+  }
+},
+
+CASE("Test Bnt node retirability") {
+
+  SETUP("Setup free memory")  {
+    Register reg_a;
+    ConstraintSet free_constr("0x1000-0x3fff");
+    vector<const ConstraintSet* > free_constraints = {&free_constr};
+    cuint64 min_space = 0x1000;
+
+    SECTION("Keep a node whose not-taken path is still free") {
+      BntNodeTest range_start_node(0x80001000, 0x80000004, 0x1000, {&reg_a});
+      EXPECT_NOT(range_start_node.IsRetirable(free_constraints, min_space));
+
+      BntNodeTest range_middle_node(0x80002000, 0x80000004, 0x2000, {&reg_a});
+      EXPECT_NOT(range_middle_node.IsRetirable(free_constraints, min_space));
+
+      BntNodeTest range_end_node(0x80003000, 0x80000004, 0x3000, {&reg_a});
+      EXPECT_NOT(range_end_node.IsRetirable(free_constraints, min_space));
+    }
+
+    SECTION("Retire a node whose not-taken path is no longer free") {
+      BntNodeTest used_node(0x80004000, 0x80000004, 0x4000, {&reg_a});
+      EXPECT(used_node.IsRetirable(free_constraints, min_space));
+
+      BntNodeTest small_range_node(0x80003800, 0x80000004, 0x3800, {&reg_a});
+      EXPECT(small_range_node.IsRetirable(free_constraints, min_space));
+    }
+
+    SECTION("Retire a node whose paths are the same") {
+      BntNodeTest same_paths_node(0x80000004, 0x80000004, 0x1000, {&reg_a});
+      EXPECT(same_paths_node.IsRetirable(free_constraints, min_space));
+    }
+
+    SECTION("Keep accurate nodes and nodes in unknown memory banks") {
+      BntNodeTest accurate_node(0x80004000, 0x80000004, 0x4000, {&reg_a});
+      accurate_node.SetAccurate(true);
+      EXPECT_NOT(accurate_node.IsRetirable(free_constraints, min_space));
+
+      BntNodeTest used_node(0x80004000, 0x80000004, 0x4000, {&reg_a});
+      EXPECT_NOT(used_node.IsRetirable(vector<const ConstraintSet* >(), min_space));
+    }
+  }
+},
+
+CASE("Test retiring Bnt nodes") {
+
+  SETUP("Setup Bnt node manager")  {
+    Register reg_a;
+    Register reg_b;
+    Register reg_c;
+    ConstraintSet free_constr("0x10000-0x1ffff");
+    vector<const ConstraintSet* > free_constraints = {&free_constr};
+    cuint64 min_space = 0x1000;
+    cuint64 free_pa = 0x10000;
+    cuint64 used_pa = 0x4000;
+
+    BntNodeManager bnt_node_manager;
+    BntNodeTest::msDeletedTargets.clear();
+
+    SECTION("Delete a node only when the next kept node covers its state") {
+      bnt_node_manager.SaveBntNode(new BntNodeTest(0x1, 0x80000004, used_pa, {&reg_a, &reg_b}));
+      bnt_node_manager.SaveBntNode(new BntNodeTest(0x2, 0x80000004, free_pa, {&reg_a, &reg_b}));
+      bnt_node_manager.SaveBntNode(new BntNodeTest(0x3, 0x80000004, used_pa, {&reg_a, &reg_c}));
+      bnt_node_manager.SaveBntNode(new BntNodeTest(0x4, 0x80000004, used_pa, {&reg_a, &reg_b}));
+      bnt_node_manager.SaveBntNode(new BntNodeTest(0x5, 0x80000004, used_pa, {&reg_a, &reg_b}));
+
+      EXPECT(bnt_node_manager.RetireBntNodes(free_constraints, min_space) == 2u);
+      EXPECT((BntNodeTest::msDeletedTargets == vector<uint64>({0x4, 0x1})));
+      EXPECT((take_bnt_nodes(bnt_node_manager) == vector<uint64>({0x2, 0x3, 0x5})));
+    }
+
+    SECTION("Keep a node the next kept node does not cover") {
+      bnt_node_manager.SaveBntNode(new BntNodeTest(0x1, 0x80000004, used_pa, {&reg_a, &reg_b, &reg_c}));
+      bnt_node_manager.SaveBntNode(new BntNodeTest(0x2, 0x80000004, used_pa, {&reg_a, &reg_b}));
+      bnt_node_manager.SaveBntNode(new BntNodeTest(0x3, 0x80000004, used_pa, {&reg_a, &reg_b}));
+
+      EXPECT(bnt_node_manager.RetireBntNodes(free_constraints, min_space) == 1u);
+      EXPECT((BntNodeTest::msDeletedTargets == vector<uint64>({0x2})));
+      EXPECT((take_bnt_nodes(bnt_node_manager) == vector<uint64>({0x1, 0x3})));
+    }
+
+    SECTION("Always keep the last node") {
+      bnt_node_manager.SaveBntNode(new BntNodeTest(0x1, 0x80000004, used_pa, {&reg_a}));
+      EXPECT(bnt_node_manager.RetireBntNodes(free_constraints, min_space) == 0u);
+
+      bnt_node_manager.SaveBntNode(new BntNodeTest(0x2, 0x80000004, used_pa, {&reg_a}));
+      EXPECT(bnt_node_manager.RetireBntNodes(free_constraints, min_space) == 1u);
+      EXPECT((BntNodeTest::msDeletedTargets == vector<uint64>({0x1})));
+      EXPECT((take_bnt_nodes(bnt_node_manager) == vector<uint64>({0x2})));
+    }
+
+    SECTION("Keep nodes whose not-taken paths are still free") {
+      bnt_node_manager.SaveBntNode(new BntNodeTest(0x1, 0x80000004, free_pa, {&reg_a}));
+      bnt_node_manager.SaveBntNode(new BntNodeTest(0x2, 0x80000004, free_pa + 0x1000, {&reg_a}));
+      bnt_node_manager.SaveBntNode(new BntNodeTest(0x3, 0x80000004, used_pa, {&reg_a}));
+
+      EXPECT(bnt_node_manager.RetireBntNodes(free_constraints, min_space) == 0u);
+      EXPECT(BntNodeTest::msDeletedTargets.empty());
+      EXPECT((take_bnt_nodes(bnt_node_manager) == vector<uint64>({0x1, 0x2, 0x3})));
+    }
+  }
+},
+
+};
+
+int main(int argc, char* argv[])
+{
+  Force::Logger::Initialize();
+  int ret = lest::run(specification, argc, argv);
+  Force::Logger::Destroy();
+  return ret;
+}
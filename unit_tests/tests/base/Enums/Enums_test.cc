@@ -1729,6 +1729,7 @@ CASE( "tests for EPageRequestAttributeType" ) {
       EXPECT(EPageRequestAttributeType_to_string(EPageRequestAttributeType::MemAttrArch) == "MemAttrArch");
       EXPECT(EPageRequestAttributeType_to_string(EPageRequestAttributeType::MemAttrImpl) == "MemAttrImpl");
       EXPECT(EPageRequestAttributeType_to_string(EPageRequestAttributeType::AliasPageId) == "AliasPageId");
+      EXPECT(EPageRequestAttributeType_to_string(EPageRequestAttributeType::PreferredPA) == "PreferredPA");
     }
 
     SECTION( "test string to enum conversion" ) {
@@ -1739,6 +1740,7 @@ CASE( "tests for EPageRequestAttributeType" ) {
       EXPECT(string_to_EPageRequestAttributeType("MemAttrArch") == EPageRequestAttributeType::MemAttrArch);
       EXPECT(string_to_EPageRequestAttributeType("MemAttrImpl") == EPageRequestAttributeType::MemAttrImpl);
       EXPECT(string_to_EPageRequestAttributeType("AliasPageId") == EPageRequestAttributeType::AliasPageId);
+      EXPECT(string_to_EPageRequestAttributeType("PreferredPA") == EPageRequestAttributeType::PreferredPA);
     }
 
     SECTION( "test string to enum conversion with non-matching string" ) {
@@ -1761,6 +1763,8 @@ CASE( "tests for EPageRequestAttributeType" ) {
       EXPECT(okay);
       EXPECT(try_string_to_EPageRequestAttributeType("AliasPageId", okay) == EPageRequestAttributeType::AliasPageId);
       EXPECT(okay);
+      EXPECT(try_string_to_EPageRequestAttributeType("PreferredPA", okay) == EPageRequestAttributeType::PreferredPA);
+      EXPECT(okay);
     }
 
     SECTION( "test non-throwing string to enum conversion with non-matching string" ) {
@@ -2193,6 +2197,7 @@ CASE( "tests for EGenModeType" ) {
       EXPECT(EGenModeType_to_string(EGenModeType::AddressShortage) == "AddressShortage");
       EXPECT(EGenModeType_to_string(EGenModeType::RecordingState) == "RecordingState");
       EXPECT(EGenModeType_to_string(EGenModeType::RestoreStateLoop) == "RestoreStateLoop");
+      EXPECT(EGenModeType_to_string(EGenModeType::NoBnt) == "NoBnt");
     }
 
     SECTION( "test string to enum conversion" ) {
@@ -2211,6 +2216,7 @@ CASE( "tests for EGenModeType" ) {
       EXPECT(string_to_EGenModeType("AddressShortage") == EGenModeType::AddressShortage);
       EXPECT(string_to_EGenModeType("RecordingState") == EGenModeType::RecordingState);
       EXPECT(string_to_EGenModeType("RestoreStateLoop") == EGenModeType::RestoreStateLoop);
+      EXPECT(string_to_EGenModeType("NoBnt") == EGenModeType::NoBnt);
     }
 
     SECTION( "test string to enum conversion with non-matching string" ) {
@@ -2249,6 +2255,8 @@ CASE( "tests for EGenModeType" ) {
       EXPECT(okay);
       EXPECT(try_string_to_EGenModeType("RestoreStateLoop", okay) == EGenModeType::RestoreStateLoop);
       EXPECT(okay);
+      EXPECT(try_string_to_EGenModeType("NoBnt", okay) == EGenModeType::NoBnt);
+      EXPECT(okay);
     }
 
     SECTION( "test non-throwing string to enum conversion with non-matching string" ) {
@@ -0,0 +1,111 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "ExceptionRecords.h"
+
+#include "lest/lest.hpp"
+
+#include "Log.h"
+
+using text = std::string;
+
+using namespace std;
+using namespace Force;
+
+ExceptionRecord make_exception_record(EExceptionClassType exceptionClass, uint64 pc)
+{
+  ExceptionRecord exception_record;
+  exception_record.exception_code = EExceptionClassTypeBaseType(exceptionClass);
+  exception_record.pc_value = pc;
+  exception_record.src_exception_level = 0;
+  exception_record.tgt_exception_level = 3;
+  exception_record.dfsc_ifsc_code = 0;
+  return exception_record;
+}
+
+const lest::test specification[] = {
+
+CASE("Test retiring exception records") {
+
+  SETUP("Setup ExceptionRecordManager")  {
+    ExceptionRecordManager record_manager;
+    record_manager.ReportNewExceptionRecord(make_exception_record(EExceptionClassType::IllegalInstr, 0x1000));
+    record_manager.ReportNewExceptionRecord(make_exception_record(EExceptionClassType::Breakpoint, 0x1004));
+    record_manager.ReportNewExceptionRecord(make_exception_record(EExceptionClassType::IllegalInstr, 0x1008));
+    record_manager.ReportNewExceptionRecord(make_exception_record(EExceptionClassType::EnvCallFromUMode, 0x100c));
+    record_manager.ReportNewExceptionRecord(make_exception_record(EExceptionClassType::IllegalInstr, 0x1010));
+
+    EXPECT(record_manager.RetiredRecordCount() == 0ull);
+    EXPECT(record_manager.ToString() == "ExceptionRecordManager records=5 retired=0");
+
+    SECTION("Keep the newest records") {
+      EXPECT(record_manager.RetireRecords(2) == 3u);
+      EXPECT(record_manager.RetiredRecordCount() == 3ull);
+      EXPECT(record_manager.ToString() == "ExceptionRecordManager records=2 retired=3 IllegalInstr:2 Breakpoint:1");
+
+      vector<ExceptionRecord> history;
+      record_manager.GetExceptionHistoryByArgs(map<string, string>(), history);
+      EXPECT(history.size() == 2ull);
+      EXPECT(history[0].pc_value == 0x100cull);
+      EXPECT(history[1].pc_value == 0x1010ull);
+
+      history.clear();
+      record_manager.GetExceptionHistoryByEC(EExceptionClassType::IllegalInstr, history);
+      EXPECT(history.size() == 1ull);
+      EXPECT(history[0].pc_value == 0x1010ull);
+    }
+
+    SECTION("Accumulate the retired counts") {
+      EXPECT(record_manager.RetireRecords(4) == 1u);
+      EXPECT(record_manager.ToString() == "ExceptionRecordManager records=4 retired=1 IllegalInstr:1");
+
+      record_manager.ReportNewExceptionRecord(make_exception_record(EExceptionClassType::Breakpoint, 0x1014));
+      EXPECT(record_manager.RetireRecords(1) == 4u);
+      EXPECT(record_manager.RetiredRecordCount() == 5ull);
+      EXPECT(record_manager.ToString() == "ExceptionRecordManager records=1 retired=5 IllegalInstr:3 Breakpoint:1 EnvCallFromUMode:1");
+
+      vector<ExceptionRecord> history;
+      record_manager.GetExceptionHistoryByArgs({{"Last", "True"}}, history);
+      EXPECT(history.size() == 1ull);
+      EXPECT(history[0].pc_value == 0x1014ull);
+    }
+
+    SECTION("Keep all records when there are no more than the keep count") {
+      EXPECT(record_manager.RetireRecords(5) == 0u);
+      EXPECT(record_manager.RetireRecords(8) == 0u);
+      EXPECT(record_manager.RetiredRecordCount() == 0ull);
+      EXPECT(record_manager.ToString() == "ExceptionRecordManager records=5 retired=0");
+    }
+
+    SECTION("Retire all records") {
+      EXPECT(record_manager.RetireRecords(0) == 5u);
+      EXPECT(record_manager.ToString() == "ExceptionRecordManager records=0 retired=5 IllegalInstr:3 Breakpoint:1 EnvCallFromUMode:1");
+
+      vector<ExceptionRecord> history;
+      record_manager.GetExceptionHistoryByEC(EExceptionClassType::IllegalInstr, history);
+      EXPECT(history.empty());
+    }
+  }
+},
+
+};
+
+int main(int argc, char* argv[])
+{
+  Force::Logger::Initialize();
+  int ret = lest::run(specification, argc, argv);
+  Force::Logger::Destroy();
+  return ret;
+}
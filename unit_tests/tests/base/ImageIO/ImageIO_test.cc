@@ -15,11 +15,15 @@
 //
 #include "ImageIO.h"
 
+#include <algorithm>
 #include <cstdio>
+#include <fstream>
 #include <map>
+#include <vector>
 
 #include "lest/lest.hpp"
 
+#include "BinaryImage.h"
 #include "Memory.h"
 #include "Register.h"
 
@@ -136,3 +140,159 @@ CASE ("Test write register to image file, PrintRegistersImage")
   remove(output_file_path.c_str());
   delete image_printer;
 }
+
+CASE("Test binary memory image file")
+{
+  Memory write_mem(EMemBankType::Default);
+  write_mem.Initialize(0x0000ffff0040, 0x8a0080d2ull, 4, EMemDataType::Instruction);
+  write_mem.Initialize(0x0000ffff0044, 0x2a0500f8ull, 4, EMemDataType::Instruction);
+  write_mem.Initialize(0xfffffffffff0, 0x0001020304050607ull, 8, EMemDataType::Data);
+  write_mem.Initialize(0x0000abcd0008, 0x08090a0b0c0d0e0full, 8, EMemDataType::Data);
+  for (uint64 offset = 0; offset < 0x100; offset += 8) {
+    write_mem.Initialize(0x0000ffff1000 + offset, 0x1122334455667788ull + offset, 8, EMemDataType::Data);
+  }
+
+  ImageIO image_printer(true);
+  const std::string output_file_path = "./image_printer_binary_memory_test.img";
+  image_printer.PrintMemoryImage(output_file_path, &write_mem);
+  EXPECT(ImageIO::IsBinaryImage(output_file_path));
+
+  Memory read_mem(EMemBankType::Default);
+  image_printer.LoadMemoryImage(output_file_path, &read_mem);
+
+  EXPECT(write_mem.ReadInitialValue(0x0000ffff0040, 8) == read_mem.ReadInitialValue(0x0000ffff0040, 8));
+  EXPECT(write_mem.ReadInitialValue(0xfffffffffff0, 8) == read_mem.ReadInitialValue(0xfffffffffff0, 8));
+  EXPECT(write_mem.ReadInitialValue(0x0000abcd0008, 8) == read_mem.ReadInitialValue(0x0000abcd0008, 8));
+  EXPECT(write_mem.ReadInitialValue(0x0000ffff1000, 8) == read_mem.ReadInitialValue(0x0000ffff1000, 8));
+  EXPECT(write_mem.ReadInitialValue(0x0000ffff10f8, 8) == read_mem.ReadInitialValue(0x0000ffff10f8, 8));
+  std::vector<Section> write_sections;
+  std::vector<Section> read_sections;
+  write_mem.GetSections(write_sections);
+  read_mem.GetSections(read_sections);
+  EXPECT(read_sections.size() == write_sections.size());
+  bool sections_match = true;
+  for (uint32 i = 0; (i < read_sections.size()) and (i < write_sections.size()); ++ i) {
+    sections_match = sections_match and (read_sections[i].mAddress == write_sections[i].mAddress) and (read_sections[i].mSize == write_sections[i].mSize) and (read_sections[i].mType == write_sections[i].mType);
+  }
+  EXPECT(sections_match);
+  remove(output_file_path.c_str());
+
+  const std::string text_file_path = "./image_printer_text_memory_test.img";
+  ImageIO text_printer;
+  text_printer.PrintMemoryImage(text_file_path, &write_mem);
+  EXPECT(ImageIO::IsBinaryImage(text_file_path) == false);
+  remove(text_file_path.c_str());
+}
+
+CASE("Test binary memory image file mapped in place")
+{
+  Memory write_mem(EMemBankType::Default);
+  write_mem.Initialize(0x0000ffff0040, 0x8a0080d2ull, 4, EMemDataType::Instruction);
+  write_mem.Initialize(0x0000ffff0044, 0x2a0500f8ull, 4, EMemDataType::Instruction);
+  write_mem.Initialize(0x0000abcd0008, 0x08090a0b0c0d0e0full, 8, EMemDataType::Data);
+
+  ImageIO image_printer(true);
+  const std::string output_file_path = "./image_file_binary_memory_test.img";
+  image_printer.PrintMemoryImage(output_file_path, &write_mem, 0x0000ffff0040);
+
+  BinaryImageFile image_file;
+  image_file.Load(output_file_path);
+  EXPECT(image_file.IsLoaded(output_file_path));
+  const BinaryImageHeader* header = image_file.Header();
+  EXPECT(header->mEntryPoint == 0x0000ffff0040ull);
+  EXPECT(header->mMemoryBank == uint32(EMemBankType::Default));
+  EXPECT(header->mRegisterCount == 0u);
+  EXPECT(header->mByteOrder == 0x01020304u);
+
+  std::vector<Section> write_sections;
+  write_mem.GetSections(write_sections);
+  EXPECT(header->mSectionCount == write_sections.size());
+  const BinaryImageSection* sections = image_file.Sections();
+  bool data_match = true;
+  for (uint32 i = 0; (i < header->mSectionCount) and (i < write_sections.size()); ++ i) {
+    std::vector<uint8> write_data(write_sections[i].mSize);
+    write_mem.ReadPartiallyInitialized(write_sections[i].mAddress, write_sections[i].mSize, write_data.data());
+    const uint8* image_data = image_file.Payload(sections[i].mDataOffset, sections[i].mSize);
+    data_match = data_match and (sections[i].mAddress == write_sections[i].mAddress) and (sections[i].mSize == write_sections[i].mSize);
+    data_match = data_match and std::equal(write_data.begin(), write_data.end(), image_data);
+  }
+  EXPECT(data_match);
+  EXPECT_FAIL(image_file.Payload(header->mFileSize - 4, 8), "invalid-binary-image");
+
+  std::vector<char> swapped_image(reinterpret_cast<const char*>(header), reinterpret_cast<const char*>(header) + header->mFileSize);
+  BinaryImageHeader* swapped_header = reinterpret_cast<BinaryImageHeader*>(swapped_image.data());
+  swapped_header->mByteOrder = 0x04030201u;
+  const std::string swapped_file_path = "./image_file_swapped_memory_test.img";
+  std::ofstream swapped_file(swapped_file_path, std::ios::binary);
+  swapped_file.write(swapped_image.data(), swapped_image.size());
+  swapped_file.close();
+  BinaryImageFile swapped_image_file;
+  EXPECT_FAIL(swapped_image_file.Load(swapped_file_path), "binary-image-byte-order-mismatch");
+  remove(swapped_file_path.c_str());
+
+  image_file.Unload();
+  EXPECT(image_file.IsLoaded(output_file_path) == false);
+  remove(output_file_path.c_str());
+
+  const std::string text_file_path = "./image_file_text_memory_test.img";
+  ImageIO text_printer;
+  text_printer.PrintMemoryImage(text_file_path, &write_mem);
+  EXPECT_FAIL(image_file.Load(text_file_path), "invalid-binary-image");
+  remove(text_file_path.c_str());
+}
+
+CASE("Test binary registers image file")
+{
+  RegisterFile* read_register_file = dynamic_cast<RegisterFile*>(register_file_top->Clone());
+  read_register_file->Setup();
+
+  RegisterFile* write_register_file = dynamic_cast<RegisterFile*>(register_file_top->Clone());
+  write_register_file->Setup();
+
+  write_register_file->InitializeRegister("mstatus", 0xffffffffffffffff, nullptr);
+  std::vector<uint64> x1_data = {0x8f2f2bfc499919f4};
+  write_register_file->InitializeRegister("x1", x1_data, nullptr);
+  std::vector<uint64> s1_data = {0x59ab6f56};
+  write_register_file->InitializeRegister("S1", s1_data, nullptr);
+  std::vector<uint64> v0_data = {0xfedcba9876543210, 0x0123456789abcdef};
+  write_register_file->InitializeRegister("v0", v0_data, nullptr);
+
+  ImageIO image_printer(true);
+  const std::string output_file_path = "./image_printer_binary_register_test.img";
+  remove(output_file_path.c_str());
+  for (uint32 thread_id = 0; thread_id < 2; ++ thread_id) {
+    std::map<std::string, uint64> write_thread_info;
+    write_thread_info["ThreadID"] = thread_id;
+    write_thread_info["BootPC"] = 0x80000000 + thread_id;
+    write_thread_info["InitialPC"] = 0x80001000;
+    image_printer.PrintRegistersImage(output_file_path, write_thread_info, write_register_file);
+  }
+  std::ifstream unwritten_file(output_file_path);
+  EXPECT(unwritten_file.is_open() == false);
+  image_printer.Close();
+  EXPECT(ImageIO::IsBinaryImage(output_file_path));
+
+  std::map<std::string, uint64> read_thread_info;
+  read_thread_info["ThreadID"] = 1;
+  image_printer.LoadRegistersImage(output_file_path, read_thread_info, read_register_file);
+  EXPECT(read_thread_info["BootPC"] == 0x80000001ull);
+  EXPECT(read_thread_info["InitialPC"] == 0x80001000ull);
+
+  read_thread_info["ThreadID"] = 0;
+  image_printer.LoadRegistersImage(output_file_path, read_thread_info, read_register_file);
+  EXPECT(read_thread_info["BootPC"] == 0x80000000ull);
+
+  std::map<std::string, uint64> phys_masks = {{"mstatus", MAX_UINT64}, {"x1", MAX_UINT64}, {"f1_0", MAX_UINT32}, {"v0_0", MAX_UINT64}, {"v0_1", MAX_UINT64}};
+  for (auto const& phys_mask : phys_masks) {
+    PhysicalRegister* w_phy = write_register_file->PhysicalRegisterLookup(phys_mask.first);
+    PhysicalRegister* r_phy = read_register_file->PhysicalRegisterLookup(phys_mask.first);
+    EXPECT(w_phy->InitialValue(phys_mask.second) == r_phy->InitialValue(phys_mask.second));
+  }
+
+  read_thread_info["ThreadID"] = 2;
+  EXPECT_FAIL(image_printer.LoadRegistersImage(output_file_path, read_thread_info, read_register_file), "can-not-find-thread");
+
+  remove(output_file_path.c_str());
+  delete read_register_file;
+  delete write_register_file;
+}
@@ -0,0 +1,400 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "Microbenchmark.h"
+
+#include <memory>
+
+#include "Architectures.h"
+#include "BaseOffsetConstraint.h"
+#include "Choices.h"
+#include "Config.h"
+#include "Constraint.h"
+#include "Enums.h"
+#include "FreePageRangeResolver.h"
+#include "InstructionStructure.h"
+#include "Log.h"
+#include "Memory.h"
+#include "ObjectRegistry.h"
+#include "Random.h"
+#include "Register.h"
+#include "UnitTestUtilities.h"
+
+using namespace Force;
+
+// Data sizes are chosen to resemble a mid-sized test: a few thousand mapped 4K pages in the free/usable physical
+// page constraints and a few thousand initialized memory locations.
+static const uint32 PAGE_COUNT = 4096;
+static const uint64 PAGE_SIZE = 0x1000;
+static const uint32 LOOKUP_COUNT = 100000;
+
+static std::vector<uint64> random_page_addresses(uint32 count)
+{
+  std::vector<uint64> page_addresses;
+  page_addresses.reserve(count);
+  for (uint32 i = 0; i < count; ++ i) {
+    page_addresses.push_back(Random::Instance()->Random64(0, 0xffffffffull) * PAGE_SIZE);
+  }
+  return page_addresses;
+}
+
+static void copy_constraint_sets(const ConstraintSet& rSource, uint32 count, std::vector<ConstraintSet>& rCopies)
+{
+  rCopies.clear();
+  rCopies.reserve(count);
+  for (uint32 i = 0; i < count; ++ i) {
+    rCopies.emplace_back(rSource);
+  }
+}
+
+// The virtual usable constraint of a mid-sized test: the lower 48-bit address space with the mapped pages taken out.
+static std::shared_ptr<ConstraintSet> fragmented_virtual_usable(const std::vector<uint64>& rPageAddresses)
+{
+  auto virtual_usable = std::make_shared<ConstraintSet>(0, 0xffffffffffffull);
+  for (uint64 page_address : rPageAddresses) {
+    virtual_usable->SubRange(page_address, page_address + PAGE_SIZE - 1);
+  }
+  return virtual_usable;
+}
+
+static void add_constraint_set_benchmarks(MicrobenchmarkSuite& rSuite)
+{
+  auto page_addresses = std::make_shared<std::vector<uint64>>(random_page_addresses(PAGE_COUNT));
+  auto fragmented = std::make_shared<ConstraintSet>();
+  for (uint64 page_address : *page_addresses) {
+    fragmented->AddRange(page_address, page_address + PAGE_SIZE - 1);
+  }
+
+  auto work_set = std::make_shared<ConstraintSet>();
+  rSuite.Add("ConstraintSet/AddRange", PAGE_COUNT,
+    [work_set]() { work_set->Clear(); },
+    [work_set, page_addresses]() {
+      for (uint64 page_address : *page_addresses) {
+        work_set->AddRange(page_address, page_address + PAGE_SIZE - 1);
+      }
+    });
+
+  rSuite.Add("ConstraintSet/SubRange", PAGE_COUNT,
+    [work_set]() {
+      work_set->Clear();
+      work_set->AddRange(0, 0xfffffffffffull);
+    },
+    [work_set, page_addresses]() {
+      for (uint64 page_address : *page_addresses) {
+        work_set->SubRange(page_address, page_address + PAGE_SIZE - 1);
+      }
+    });
+
+  auto lookup_values = std::make_shared<std::vector<uint64>>();
+  for (uint32 i = 0; i < LOOKUP_COUNT; ++ i) {
+    lookup_values->push_back((*page_addresses)[i % PAGE_COUNT] + Random::Instance()->Random64(0, 2 * PAGE_SIZE));
+  }
+  rSuite.Add("ConstraintSet/ContainsValue", LOOKUP_COUNT, []() { },
+    [fragmented, lookup_values]() {
+      for (uint64 value : *lookup_values) {
+        MicrobenchmarkSuite::KeepValue(fragmented->ContainsValue(value));
+      }
+    });
+
+  // ChooseValue walks the Constraint vector, so fewer operations keep the repetition time in line with the others.
+  const uint32 choose_count = 2000;
+  rSuite.Add("ConstraintSet/ChooseValue", choose_count, []() { },
+    [fragmented]() {
+      for (uint32 i = 0; i < choose_count; ++ i) {
+        MicrobenchmarkSuite::KeepValue(fragmented->ChooseValue());
+      }
+    });
+
+  const uint32 copy_count = 100;
+  rSuite.Add("ConstraintSet/Copy", copy_count, []() { },
+    [fragmented]() {
+      for (uint32 i = 0; i < copy_count; ++ i) {
+        ConstraintSet copy(*fragmented);
+        MicrobenchmarkSuite::KeepValue(copy.Size());
+      }
+    });
+
+  // A typical address constraint: a handful of ranges applied to the fragmented page set.
+  auto apply_set = std::make_shared<ConstraintSet>();
+  for (uint32 i = 0; i < 16; ++ i) {
+    uint64 lower = Random::Instance()->Random64(0, 0xfffff) * PAGE_SIZE * 0x1000;
+    apply_set->AddRange(lower, lower + 0x40000000ull);
+  }
+  auto work_sets = std::make_shared<std::vector<ConstraintSet>>();
+  rSuite.Add("ConstraintSet/ApplyConstraintSet", copy_count,
+    [work_sets, fragmented]() { copy_constraint_sets(*fragmented, copy_count, *work_sets); },
+    [work_sets, apply_set]() {
+      for (auto& constr_set : *work_sets) {
+        constr_set.ApplyConstraintSet(*apply_set);
+      }
+    });
+
+  rSuite.Add("ConstraintSet/SubConstraintSet", copy_count,
+    [work_sets, fragmented]() { copy_constraint_sets(*fragmented, copy_count, *work_sets); },
+    [work_sets, apply_set]() {
+      for (auto& constr_set : *work_sets) {
+        constr_set.SubConstraintSet(*apply_set);
+      }
+    });
+}
+
+static void add_choice_tree_benchmarks(MicrobenchmarkSuite& rSuite)
+{
+  // Instruction and operand choice trees range from a few to several hundred entries.
+  auto choice_tree = std::make_shared<ChoiceTree>("Benchmark choices", 0, 10);
+  for (uint32 i = 0; i < 256; ++ i) {
+    choice_tree->AddChoice(new Choice("choice " + std::to_string(i), i, Random::Instance()->Random32(0, 100)));
+  }
+
+  rSuite.Add("ChoiceTree/Choose", LOOKUP_COUNT, []() { },
+    [choice_tree]() {
+      for (uint32 i = 0; i < LOOKUP_COUNT; ++ i) {
+        MicrobenchmarkSuite::KeepValue(choice_tree->Choose()->Value());
+      }
+    });
+
+  auto hard_constr = std::make_shared<ConstraintSet>("0x10-0x2f,0x80-0xbf");
+  const uint32 constr_choose_count = 10000;
+  auto work_tree = std::make_shared<std::unique_ptr<ChoiceTree>>();
+  rSuite.Add("ChoiceTree/ChooseValueWithHardConstraint", constr_choose_count,
+    [work_tree, choice_tree]() { work_tree->reset(dynamic_cast<ChoiceTree*>(choice_tree->Clone())); },
+    [work_tree, hard_constr]() {
+      for (uint32 i = 0; i < constr_choose_count; ++ i) {
+        MicrobenchmarkSuite::KeepValue((*work_tree)->ChooseValueWithHardConstraint(*hard_constr));
+      }
+    });
+}
+
+static void add_memory_benchmarks(MicrobenchmarkSuite& rSuite)
+{
+  auto addresses = std::make_shared<std::vector<uint64>>();
+  auto page_addresses = random_page_addresses(64);
+  for (uint32 i = 0; i < PAGE_COUNT; ++ i) {
+    addresses->push_back(page_addresses[i % page_addresses.size()] + Random::Instance()->Random64(0, PAGE_SIZE / 8 - 1) * 8);
+  }
+
+  auto memory = std::make_shared<std::unique_ptr<Memory>>();
+  rSuite.Add("Memory/Initialize", PAGE_COUNT,
+    [memory]() { memory->reset(new Memory(EMemBankType::Default)); },
+    [memory, addresses]() {
+      for (uint64 address : *addresses) {
+        if (not (*memory)->IsInitialized(address, 8)) {
+          (*memory)->Initialize(address, address, 8, EMemDataType::Data);
+        }
+      }
+    });
+
+  auto initialized = std::make_shared<Memory>(EMemBankType::Default);
+  for (uint64 address : *addresses) {
+    if (not initialized->IsInitialized(address, 8)) {
+      initialized->Initialize(address, address, 8, EMemDataType::Data);
+    }
+  }
+
+  rSuite.Add("Memory/Read", LOOKUP_COUNT, []() { },
+    [initialized, addresses]() {
+      for (uint32 i = 0; i < LOOKUP_COUNT; ++ i) {
+        MicrobenchmarkSuite::KeepValue(initialized->Read((*addresses)[i % PAGE_COUNT], 8));
+      }
+    });
+
+  rSuite.Add("Memory/Write", LOOKUP_COUNT, []() { },
+    [initialized, addresses]() {
+      for (uint32 i = 0; i < LOOKUP_COUNT; ++ i) {
+        initialized->Write((*addresses)[i % PAGE_COUNT], i, 8);
+      }
+    });
+
+  rSuite.Add("Memory/ReadInitialValue", LOOKUP_COUNT, []() { },
+    [initialized, addresses]() {
+      for (uint32 i = 0; i < LOOKUP_COUNT; ++ i) {
+        MicrobenchmarkSuite::KeepValue(initialized->ReadInitialValue((*addresses)[i % PAGE_COUNT], 8));
+      }
+    });
+}
+
+// RegisterFile needs the register definitions of the architecture, so these benchmarks load the RV64 register files from FORCE_PATH.
+static void add_register_file_benchmarks(MicrobenchmarkSuite& rSuite)
+{
+  const char* force_path = getenv("FORCE_PATH");
+  if (nullptr == force_path) {
+    std::cerr << "FORCE_PATH not set, skipping the RegisterFile benchmarks." << std::endl;
+    return;
+  }
+
+  std::vector<ArchInfo* > arch_info_objs;
+  arch_info_objs.push_back(new ArchInfoTest("MicrobenchmarkTest"));
+  Architectures::Initialize();
+  Architectures::Instance()->AssignArchInfoObjects(arch_info_objs);
+  Config::Initialize();
+
+  ObjectRegistry::Initialize();
+  ObjectRegistry* obj_reg = ObjectRegistry::Instance();
+  obj_reg->RegisterObject(new PhysicalRegister());
+  obj_reg->RegisterObject(new ConfigureRegister());
+  obj_reg->RegisterObject(new LargeRegister());
+  obj_reg->RegisterObject(new Register());
+  obj_reg->RegisterObject(new ReadOnlyRegister());
+  obj_reg->RegisterObject(new ReadOnlyZeroRegister());
+  obj_reg->RegisterObject(new RegisterField());
+  obj_reg->RegisterObject(new RegisterFieldRes0());
+  obj_reg->RegisterObject(new RegisterFieldRes1());
+  obj_reg->RegisterObject(new PhysicalRegisterRazwi());
+
+  std::string reg_path = std::string(force_path) + "/riscv/arch_data/reg/";
+  auto register_file = std::make_shared<RegisterFile>();
+  register_file->LoadRegisterFiles({reg_path + "app_registers_rv64.xml", reg_path + "system_registers_rv64.xml"});
+  register_file->Setup();
+
+  // Operand and state lookups are by name, mostly GPRs with some FPRs, vector registers and CSRs.
+  auto register_names = std::make_shared<std::vector<std::string>>();
+  for (uint32 i = 1; i < 32; ++ i) {
+    register_names->push_back("x" + std::to_string(i));
+  }
+  for (uint32 i = 0; i < 32; i += 4) {
+    register_names->push_back("D" + std::to_string(i));
+    register_names->push_back("v" + std::to_string(i));
+  }
+  for (const char* csr_name : {"mstatus", "mepc", "mtvec", "satp", "sstatus", "sepc", "fcsr", "vl", "vtype"}) {
+    register_names->push_back(csr_name);
+  }
+
+  rSuite.Add("RegisterFile/RegisterLookup", LOOKUP_COUNT, []() { },
+    [register_file, register_names]() {
+      for (uint32 i = 0; i < LOOKUP_COUNT; ++ i) {
+        MicrobenchmarkSuite::KeepValue(register_file->RegisterLookup((*register_names)[i % register_names->size()])->IndexValue());
+      }
+    });
+
+  auto physical_names = std::make_shared<std::vector<std::string>>();
+  for (uint32 i = 1; i < 32; ++ i) {
+    physical_names->push_back("x" + std::to_string(i));
+    physical_names->push_back("f" + std::to_string(i) + "_0");
+  }
+  rSuite.Add("RegisterFile/PhysicalRegisterLookup", LOOKUP_COUNT, []() { },
+    [register_file, physical_names]() {
+      for (uint32 i = 0; i < LOOKUP_COUNT; ++ i) {
+        MicrobenchmarkSuite::KeepValue(register_file->PhysicalRegisterLookup((*physical_names)[i % physical_names->size()])->IndexValue());
+      }
+    });
+
+  auto gprs = std::make_shared<std::vector<Register*>>();
+  for (uint32 i = 1; i < 32; ++ i) {
+    std::string gpr_name = "x" + std::to_string(i);
+    register_file->InitializeRegister(gpr_name, i, nullptr);
+    gprs->push_back(register_file->RegisterLookup(gpr_name));
+  }
+  rSuite.Add("RegisterFile/RegisterValue", LOOKUP_COUNT, []() { },
+    [gprs]() {
+      for (uint32 i = 0; i < LOOKUP_COUNT; ++ i) {
+        Register* gpr = (*gprs)[i % gprs->size()];
+        gpr->SetValue(gpr->Value() + i);
+      }
+    });
+
+  // Every generator thread starts from a clone of the register file.
+  const uint32 clone_count = 10;
+  rSuite.Add("RegisterFile/Clone", clone_count, []() { },
+    [register_file]() {
+      for (uint32 i = 0; i < clone_count; ++ i) {
+        std::unique_ptr<Object> clone(register_file->Clone());
+        MicrobenchmarkSuite::KeepValue(clone.get() != nullptr);
+      }
+    });
+}
+
+// VmAddressSpace, AddressSolver and Instruction need a Generator, these benchmarks time the parts of them that can run standalone.
+static void add_address_benchmarks(MicrobenchmarkSuite& rSuite)
+{
+  auto page_addresses = random_page_addresses(PAGE_COUNT);
+  auto virtual_usable = fragmented_virtual_usable(page_addresses);
+
+  // Page range requests of genFreePagesRange, resolved against the virtual usable constraint by FreePageRangeClaimer.
+  auto page_size_tree = new ChoiceTree("Page size#4K granule", 0, 10);
+  page_size_tree->AddChoice(new Choice("4K", 0, 10));
+  page_size_tree->AddChoice(new Choice("2M", 1, 10));
+  page_size_tree->AddChoice(new Choice("1G", 2, 10));
+  auto granule_tree = std::make_shared<GranulePageSizeTree>(EPageGranuleType::G4K, page_size_tree);
+  const uint32 resolve_count = 100;
+  rSuite.Add("FreePageRangeResolver/ResolveFreePageRanges", resolve_count, []() { },
+    [virtual_usable, granule_tree]() {
+      for (uint32 i = 0; i < resolve_count; ++ i) {
+        FreePageRangeResolver resolver(virtual_usable->Clone(), *granule_tree);
+        ConstraintSet request_ranges;
+        std::vector<uint64> request_page_sizes = {0x1000, 0, 0x1000};
+        uint64 start_addr = 0;
+        ConstraintSet resolved_ranges;
+        std::vector<uint64> resolved_page_sizes;
+        MicrobenchmarkSuite::KeepValue(resolver.ResolveFreePageRanges(request_ranges, request_page_sizes, start_addr, resolved_ranges, resolved_page_sizes));
+      }
+    });
+
+  // The target constraint AddressSolver computes for each candidate base register of a load with a 12-bit signed offset.
+  auto base_values = std::make_shared<std::vector<uint64>>();
+  for (uint32 i = 0; i < 31; ++ i) {
+    base_values->push_back(page_addresses[i] + Random::Instance()->Random64(0, 4 * PAGE_SIZE));
+  }
+  auto pc_constr = std::make_shared<ConstraintSet>(page_addresses[0], page_addresses[0] + PAGE_SIZE - 1);
+  const uint32 solve_count = 1000;
+  rSuite.Add("AddressSolver/BaseTargetConstraint", solve_count, []() { },
+    [virtual_usable, base_values, pc_constr]() {
+      BaseOffsetConstraint bo_constr_builder(0, 12, 0, MAX_UINT64);
+      for (uint32 i = 0; i < solve_count; ++ i) {
+        ConstraintSet target_constr;
+        bo_constr_builder.GetConstraint((*base_values)[i % base_values->size()], 8, nullptr, target_constr);
+        target_constr.ApplyLargeConstraintSet(*virtual_usable);
+        target_constr.SubConstraintSet(*pc_constr);
+        MicrobenchmarkSuite::KeepValue(target_constr.Size());
+      }
+    });
+
+  // Instruction::Encode combines the operand encodings of an R-type instruction.
+  auto operand_structs = std::make_shared<std::vector<OperandStructure>>(3);
+  (*operand_structs)[0].SetBits("11-7");
+  (*operand_structs)[1].SetBits("19-15");
+  (*operand_structs)[2].SetBits("24-20");
+  rSuite.Add("Instruction/OperandEncoding", LOOKUP_COUNT, []() { },
+    [operand_structs]() {
+      for (uint32 i = 0; i < LOOKUP_COUNT; ++ i) {
+        uint32 opcode = 0x33;
+        for (auto& opr_struct : *operand_structs) {
+          opcode |= opr_struct.Encoding(i & 0x1f);
+        }
+        MicrobenchmarkSuite::KeepValue(opcode);
+      }
+    });
+}
+
+int main(int argc, char* argv[])
+{
+  Force::Logger::Initialize();
+  Force::Random::Initialize();
+  Force::Random::Instance()->Seed(0x12345678);
+
+  MicrobenchmarkSuite suite("base");
+  add_constraint_set_benchmarks(suite);
+  add_choice_tree_benchmarks(suite);
+  add_memory_benchmarks(suite);
+  add_register_file_benchmarks(suite);
+  add_address_benchmarks(suite);
+  int ret = suite.Run(argc, argv);
+
+  Force::ObjectRegistry::Destroy();
+  Force::Config::Destroy();
+  Force::Architectures::Destroy();
+  Force::Random::Destroy();
+  Force::Logger::Destroy();
+  return ret;
+}
@@ -0,0 +1,136 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "RandomUtils.h"
+
+#include <map>
+#include <vector>
+
+#include "lest/lest.hpp"
+
+#include "Log.h"
+#include "Random.h"
+
+using text = std::string;
+using namespace std;
+using namespace Force;
+
+class WeightedItem {
+public:
+  WeightedItem(uint32 weight, bool acceptable) : mWeight(weight), mAcceptable(acceptable) { }
+  uint32 Weight() const { return mWeight; }
+  bool Acceptable() const { return mAcceptable; }
+private:
+  uint32 mWeight;
+  bool mAcceptable;
+};
+
+const lest::test specification[] = {
+
+CASE("Test choose_weighted_item_lazily") {
+
+  SETUP("Setup weighted items")  {
+    vector<WeightedItem> items = { {10, true}, {20, false}, {30, true}, {40, false}, {50, true}, {60, true}, {70, false}, {80, true} };
+    vector<WeightedItem* > all_items;
+    for (auto& item : items) {
+      all_items.push_back(&item);
+    }
+    Random::Instance()->Seed(0x1234);
+
+    SECTION("Test only one item is tried when all the items are acceptable") {
+      vector<WeightedItem> good_items = { {10, true}, {20, true}, {30, true}, {40, true} };
+      uint32 try_count = 0;
+      for (uint32 i = 0; i < 100; ++ i) {
+        vector<WeightedItem* > pending = { &good_items[0], &good_items[1], &good_items[2], &good_items[3] };
+        WeightedItem* chosen = choose_weighted_item_lazily(pending, [&try_count](WeightedItem* pItem) { ++ try_count; return pItem->Acceptable(); });
+        EXPECT(chosen != nullptr);
+        EXPECT(pending.size() == 3u);
+      }
+      // solving all the items would try 400.
+      EXPECT(try_count == 100u);
+    }
+
+    SECTION("Test items are tried at most once and the unacceptable ones are skipped") {
+      uint32 try_count = 0;
+      uint32 max_try_count = 0;
+      for (uint32 i = 0; i < 1000; ++ i) {
+        vector<WeightedItem* > pending(all_items);
+        map<WeightedItem*, uint32> tried;
+        uint32 choice_tries = 0;
+        WeightedItem* chosen = choose_weighted_item_lazily(pending, [&](WeightedItem* pItem) { ++ tried[pItem]; ++ choice_tries; return pItem->Acceptable(); });
+        EXPECT(chosen != nullptr);
+        EXPECT(chosen->Acceptable());
+        EXPECT(pending.size() + choice_tries == all_items.size());
+        for (auto& tried_item : tried) {
+          EXPECT(tried_item.second == 1u);
+        }
+        try_count += choice_tries;
+        max_try_count = max(max_try_count, choice_tries);
+      }
+      // at most the 3 unacceptable items are tried before an acceptable one, and on average far fewer than all 8.
+      EXPECT(max_try_count <= 4u);
+      EXPECT(try_count < 2000u);
+    }
+
+    SECTION("Test nullptr is returned when no item is acceptable") {
+      vector<WeightedItem* > pending = { &items[1], &items[3], &items[6] };
+      uint32 try_count = 0;
+      EXPECT(choose_weighted_item_lazily(pending, [&try_count](WeightedItem* pItem) { ++ try_count; return pItem->Acceptable(); }) == nullptr);
+      EXPECT(try_count == 3u);
+      EXPECT(pending.empty());
+
+      vector<WeightedItem* > no_items;
+      EXPECT(choose_weighted_item_lazily(no_items, [](WeightedItem* pItem) { return true; }) == nullptr);
+    }
+
+    SECTION("Test the choices are distributed by weight among the acceptable items") {
+      map<uint32, uint32> lazy_counts;
+      map<uint32, uint32> full_counts;
+      uint32 draw_count = 20000;
+      vector<WeightedItem* > acceptable_items;
+      for (auto item : all_items) {
+        if (item->Acceptable()) {
+          acceptable_items.push_back(item);
+        }
+      }
+
+      for (uint32 i = 0; i < draw_count; ++ i) {
+        vector<WeightedItem* > pending(all_items);
+        ++ lazy_counts[choose_weighted_item_lazily(pending, [](WeightedItem* pItem) { return pItem->Acceptable(); })->Weight()];
+        ++ full_counts[choose_weighted_item(acceptable_items)->Weight()];
+      }
+
+      EXPECT(lazy_counts.size() == acceptable_items.size());
+      uint32 total_weight = 10 + 30 + 50 + 60 + 80;
+      for (auto item : acceptable_items) {
+        double expected = double(draw_count) * item->Weight() / total_weight;
+        EXPECT(abs(double(lazy_counts[item->Weight()]) - expected) < expected * 0.1);
+        EXPECT(abs(double(full_counts[item->Weight()]) - expected) < expected * 0.1);
+      }
+    }
+  }
+},
+
+};
+
+int main(int argc, char * argv[])
+{
+  Logger::Initialize();
+  Random::Initialize();
+  int ret = lest::run(specification, argc, argv);
+  Random::Destroy();
+  Logger::Destroy();
+  return ret;
+}
@@ -15,9 +15,12 @@
 //
 #include "Record.h"
 
+#include <cstring>
+
 #include "lest/lest.hpp"
 
 #include "Log.h"
+#include "MemoryFootprint.h"
 #include "UtilityFunctions.h"
 
 using text = std::string;
@@ -229,6 +232,121 @@ CASE( "Record with memory access type" ) {
   }
 },
 
+CASE( "Memory init log" ) {
+
+  SETUP( "Setup code for memory init log" )  {
+    cuint32 thread_id = 4;
+    RecordArchive record_archive;
+
+    SECTION( "Test adjacent initializations are merged" ) {
+      MemoryInitRecord* mem_init_data1 = record_archive.GetMemoryInitRecord(thread_id, 4, 4, EMemDataType::Instruction);
+      mem_init_data1->SetData(0x1000, 0, 0x11223344, 4, false);
+      MemoryInitRecord* mem_init_data2 = record_archive.GetMemoryInitRecord(thread_id, 4, 4, EMemDataType::Data);
+      mem_init_data2->SetData(0x1004, 0, 0x55667788, 4, false);
+      MemoryInitRecord* mem_init_data3 = record_archive.GetMemoryInitRecord(thread_id, 2, 2, EMemDataType::Data);
+      mem_init_data3->SetData(0x1008, 1, 0x99aa, 2, false);
+      MemoryInitRecord* mem_init_data4 = record_archive.GetMemoryInitRecord(thread_id, 2, 2, EMemDataType::Data);
+      mem_init_data4->SetData(0x2000, 1, 0xbbcc, 2, false);
+
+      const MemoryInitLog& mem_init_log = record_archive.FlushMemoryInitRecords();
+      const vector<MemoryInitLogEntry>& log_entries = mem_init_log.Entries();
+      EXPECT(log_entries.size() == 3u);
+      EXPECT(log_entries[0].mAddress == 0x1000ull);
+      EXPECT(log_entries[0].mSize == 8u);
+      EXPECT(log_entries[1].mMemoryId == 1u);
+      EXPECT(log_entries[2].mAddress == 0x2000ull);
+      EXPECT(mem_init_log.DataSize() == 12u);
+      EXPECT(mem_init_log.CopiedSize() == 8u);
+      EXPECT(mem_init_log.EntryData(log_entries[1]) == mem_init_data3->InitData());
+
+      cuint8 expected_data[8] = {0x44, 0x33, 0x22, 0x11, 0x88, 0x77, 0x66, 0x55};
+      EXPECT(memcmp(mem_init_log.EntryData(log_entries[0]), expected_data, 8) == 0);
+      EXPECT(mem_init_log.EntryData(log_entries[2])[0] == 0xcc);
+    }
+
+    SECTION( "Test records are recycled after a flush" ) {
+      MemoryInitRecord* mem_init_data1 = record_archive.GetMemoryInitRecord(thread_id, 8, 8, EMemDataType::Data);
+      mem_init_data1->SetData(0x3000, 0, 0x0102030405060708ull, 8, false);
+      const MemoryInitLog& mem_init_log = record_archive.FlushMemoryInitRecords();
+      EXPECT(mem_init_log.EntryData(mem_init_log.Entries()[0]) == mem_init_data1->InitData());
+      EXPECT(mem_init_log.CopiedSize() == 0u);
+
+      MemoryInitRecord* mem_init_data_next = record_archive.GetMemoryInitRecord(thread_id, 4, 4, EMemDataType::Data);
+      EXPECT(mem_init_data_next != mem_init_data1);
+      EXPECT(mem_init_log.EntryData(mem_init_log.Entries()[0])[0] == 0x08);
+      record_archive.DiscardMemoryInitRecords();
+
+      MemoryInitRecord* mem_init_data2 = record_archive.GetMemoryInitRecord(thread_id, 4, 2, EMemDataType::Instruction, EMemAccessType::Read);
+      EXPECT(mem_init_data2 == mem_init_data_next);
+      EXPECT(mem_init_data2->Id() == 2u);
+      EXPECT(mem_init_data2->Size() == 4u);
+      EXPECT(mem_init_data2->AccessType() == EMemAccessType::Read);
+      mem_init_data2->SetData(0x3000, 0, 0xa1b2c3d4, 4, false);
+      EXPECT(mem_init_data2->DataString() == "b2a1d4c3");
+
+      record_archive.DiscardMemoryInitRecords();
+      EXPECT(record_archive.FlushMemoryInitRecords().Entries().empty());
+      EXPECT_FAIL(record_archive.GetMemoryInitRecord(thread_id, 6, 4, EMemDataType::Data), "size-element-mod-check");
+    }
+
+    SECTION( "Test releasing unused storage keeps a reserve of recycled records" ) {
+      for (uint32 i = 0; i < 20; ++ i) {
+        MemoryInitRecord* mem_init_data = record_archive.GetMemoryInitRecord(thread_id, 4, 4, EMemDataType::Data);
+        mem_init_data->SetData(0x4000 + i * 4, 0, i, 4, false);
+      }
+      EXPECT(record_archive.FlushMemoryInitRecords().Entries().size() == 1u);
+
+      EXPECT(record_archive.ReleaseUnusedStorage() == 4u);
+      EXPECT(record_archive.ReleaseUnusedStorage() == 0u);
+
+      MemoryInitRecord* mem_init_data = record_archive.GetMemoryInitRecord(thread_id, 4, 4, EMemDataType::Data);
+      mem_init_data->SetData(0x5000, 0, 0x11223344, 4, false);
+      const MemoryInitLog& mem_init_log = record_archive.FlushMemoryInitRecords();
+      EXPECT(mem_init_log.Entries().size() == 1u);
+      EXPECT(mem_init_log.EntryData(mem_init_log.Entries()[0])[0] == 0x44);
+    }
+
+    SECTION( "Test records are recycled when released if not retained" ) {
+      MemoryInitRecord* mem_init_data1 = record_archive.GetMemoryInitRecord(thread_id, 4, 4, EMemDataType::Data);
+      record_archive.ReleaseMemoryInitRecord(mem_init_data1);
+      MemoryInitRecord* mem_init_data2 = record_archive.GetMemoryInitRecord(thread_id, 4, 4, EMemDataType::Data);
+      EXPECT(mem_init_data2 != mem_init_data1);
+
+      record_archive.DiscardMemoryInitRecords();
+      record_archive.SetRetainMemoryInitRecords(false);
+      MemoryInitRecord* mem_init_data3 = record_archive.GetMemoryInitRecord(thread_id, 8, 8, EMemDataType::Data);
+      mem_init_data3->SetData(0x6000, 0, 0x1122334455667788ull, 8, false);
+      EXPECT_FAIL(record_archive.GetMemoryInitRecord(thread_id, 4, 4, EMemDataType::Data), "memory-init-record-not-released");
+      EXPECT(mem_init_data3->DataString() == "8877665544332211");
+
+      record_archive.ReleaseMemoryInitRecord(mem_init_data3);
+      EXPECT_FAIL(record_archive.ReleaseMemoryInitRecord(mem_init_data3), "releasing-unknown-memory-init-record");
+      MemoryInitRecord* mem_init_data4 = record_archive.GetMemoryInitRecord(thread_id, 4, 4, EMemDataType::Data);
+      EXPECT(mem_init_data4 == mem_init_data3);
+      record_archive.ReleaseMemoryInitRecord(mem_init_data4);
+      EXPECT(record_archive.FlushMemoryInitRecords().Entries().empty());
+    }
+
+    SECTION( "Test the free list is bounded in length and record size" ) {
+      for (uint32 i = 0; i < 300; ++ i) {
+        MemoryInitRecord* mem_init_data = record_archive.GetMemoryInitRecord(thread_id, 4, 4, EMemDataType::Data);
+        mem_init_data->SetData(0x4000 + i * 8, 0, i, 4, false);
+      }
+      MemoryInitRecord* large_init_data = record_archive.GetMemoryInitRecord(thread_id, 0x2000, 1, EMemDataType::Data);
+      vector<uint8> large_data(0x2000, 0x5a);
+      large_init_data->SetData(0x10000, 0, new uint8[0x2000], 0x2000);
+      std::copy(large_data.begin(), large_data.end(), large_init_data->InitData());
+      EXPECT(record_archive.FlushMemoryInitRecords().Entries().size() == 301u);
+      record_archive.FlushMemoryInitRecords();
+
+      MemoryFootprint footprint;
+      record_archive.AccountMemoryFootprint(footprint);
+      EXPECT(footprint.Objects("Records") == 256u);
+      EXPECT(footprint.Bytes("Records") < 256u * (sizeof(MemoryInitRecord) + 2 * 0x1000));
+    }
+  }
+},
+
 };
 
 int main( int argc, char * argv[] )
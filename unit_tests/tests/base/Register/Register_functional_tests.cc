@@ -389,6 +389,35 @@ CASE("Test Register class lookups, interaction, and propogation")
   EXPECT(0x3u == bit->BitFieldValue());
   EXPECT(0x3u == satp_mode_fld->FieldValue());
 }
+CASE("PhysicalRegisterQueue logic")
+{
+  RegisterFile* test_register_file = dynamic_cast<RegisterFile*>(register_file_top->Clone());
+  test_register_file->Setup();
+  PhysicalRegister* f0_0 = test_register_file->PhysicalRegisterLookup("f0_0");
+  PhysicalRegister* f0_1 = test_register_file->PhysicalRegisterLookup("f0_1");
+  PhysicalRegister* v27_0 = test_register_file->PhysicalRegisterLookup("v27_0");
+  PhysicalRegister* v27_1 = test_register_file->PhysicalRegisterLookup("v27_1");
+
+  PhysicalRegisterQueue reg_queue;
+  reg_queue.Add(test_register_file->RegisterLookup("D0"));
+  reg_queue.Add(test_register_file->RegisterLookup("v27"));
+  reg_queue.Add(test_register_file->RegisterLookup("Q0"));
+  reg_queue.Add(test_register_file->RegisterLookup("D0"));
+  EXPECT(reg_queue.Registers() == (std::vector<PhysicalRegister*>{f0_0, v27_0, v27_1, f0_1}));
+  EXPECT(reg_queue.IsQueued(f0_1));
+  EXPECT_NOT(reg_queue.IsQueued(test_register_file->PhysicalRegisterLookup("f1_0")));
+
+  reg_queue.Clear();
+  EXPECT(reg_queue.Registers().empty());
+  EXPECT_NOT(reg_queue.IsQueued(f0_0));
+  EXPECT_NOT(reg_queue.IsQueued(v27_1));
+
+  reg_queue.Add(test_register_file->RegisterLookup("Q0"));
+  EXPECT(reg_queue.Registers() == (std::vector<PhysicalRegister*>{f0_0, f0_1}));
+
+  delete test_register_file;
+}
+
 CASE("Reset value logic")
 {
   RegisterFile* test_register_file = dynamic_cast<RegisterFile*>(register_file_top->Clone());
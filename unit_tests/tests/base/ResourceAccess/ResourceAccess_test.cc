@@ -122,6 +122,38 @@ private:
 
 const lest::test specification[] = {
 
+CASE( "Test ResourceAccessBits class" ) {
+
+  SETUP( "setup ResourceAccessBits" )  {
+    ResourceAccessBits access_bits;
+
+    SECTION( "test setting, testing and resetting bits up to the maximum entry count" ) {
+      EXPECT(access_bits.None());
+      access_bits.Set(0);
+      access_bits.Set(63);
+      access_bits.Set(64);
+      access_bits.Set(DEP_MAX_ENTRY_COUNT - 1);
+      EXPECT(access_bits.Count() == 4u);
+      EXPECT(access_bits.Test(DEP_MAX_ENTRY_COUNT - 1));
+      EXPECT_NOT(access_bits.Test(1));
+      access_bits.Reset(63);
+      EXPECT_NOT(access_bits.Test(63));
+
+      ConstraintSet constr;
+      access_bits.GetConstraint(constr);
+      EXPECT(constr.ToSimpleString() == "0x0,0x40,0xff");
+    }
+
+    SECTION( "test out of range resource indices fail" ) {
+      EXPECT_FAIL(access_bits.Set(DEP_MAX_ENTRY_COUNT), "resource-index-out-of-range");
+      EXPECT_FAIL(access_bits.Reset(DEP_MAX_ENTRY_COUNT + 64), "resource-index-out-of-range");
+      EXPECT_FAIL(access_bits.Test(0xffffffff), "resource-index-out-of-range");
+      EXPECT_FAIL(access_bits.SetConstraint(ConstraintSet("0xf0-0x100")), "resource-index-out-of-range");
+      EXPECT(access_bits.Count() == 0x10u);
+    }
+  }
+},
+
 CASE( "Test ResourceAccessStage class" ) {
 
   SETUP( "ResourceAccessStage test setup" )  {
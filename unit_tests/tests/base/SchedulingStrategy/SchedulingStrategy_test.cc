@@ -88,6 +88,38 @@ CASE( "test case for ShuffledRoundRobinSchedulingStrategy class" ) {
       EXPECT( scheduled_threads.Size() == scheduled_threads_num );
     }
 
+    SECTION( "test scheduling threads with a quantum" ) {
+      EXPECT( strategy_ptr->Quantum() == 1u );
+      strategy_ptr->SetQuantum(3);
+      EXPECT( strategy_ptr->Quantum() == 3u );
+      strategy_ptr->RefreshSchedule();
+
+      ConstraintSet scheduled_threads;
+      for (uint32 i = 0; i < scheduled_threads_num; ++ i) {
+        uint32 t_id = strategy_ptr->CurrentThreadId();
+        EXPECT( not scheduled_threads.ContainsValue(t_id) );
+        scheduled_threads.AddValue(t_id);
+        strategy_ptr->NextThread();
+        EXPECT( strategy_ptr->CurrentThreadId() == t_id );
+        strategy_ptr->NextThread();
+        EXPECT( strategy_ptr->CurrentThreadId() == t_id );
+        strategy_ptr->NextThread();
+      }
+      EXPECT( scheduled_threads.Size() == scheduled_threads_num );
+
+      strategy_ptr->SetQuantum(0);
+      EXPECT( strategy_ptr->Quantum() == 1u );
+    }
+
+    SECTION( "test removing the current thread ends its quantum" ) {
+      strategy_ptr->SetQuantum(4);
+      strategy_ptr->RefreshSchedule();
+      uint32 removed_thread_id = strategy_ptr->CurrentThreadId();
+      strategy_ptr->RemoveThreadId(removed_thread_id);
+      strategy_ptr->NextThread();
+      EXPECT( strategy_ptr->CurrentThreadId() != removed_thread_id );
+    }
+
     SECTION( "test base lock and unlock operations" ) {
       strategy_ptr->RefreshSchedule();
       uint32 locked_thread_id = strategy_ptr->CurrentThreadId();
@@ -0,0 +1,234 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "UopEvaluator.h"
+
+#include <vector>
+
+#include "lest/lest.hpp"
+
+#include "Constraint.h"
+#include "Log.h"
+#include "Random.h"
+
+using text = std::string;
+using namespace std;
+using namespace Force;
+
+const lest::test specification[] = {
+
+CASE("Test UopEvaluator single tuple evaluation") {
+
+  SETUP("Setup UopEvaluator")  {
+
+    SECTION("Test supported micro-ops") {
+      EXPECT(UopEvaluator::IsSupported(UopAddWithCarry));
+      EXPECT(UopEvaluator::IsSupported(UopSubWithCarry));
+      EXPECT(UopEvaluator::InputCount(UopMul) == 2u);
+      EXPECT(UopEvaluator::InputCount(UopDiv) == 3u);
+      EXPECT(UopEvaluator::InputCount(UopAndShift64) == 4u);
+      EXPECT(UopEvaluator::InputCount(UopMvnShift32) == 3u);
+      EXPECT_NOT(UopEvaluator::IsSupported(UopMsub64));
+      EXPECT_NOT(UopEvaluator::IsSupported(UopFpAdd));
+    }
+
+    SECTION("Test arithmetic micro-ops") {
+      uint64 add_carry_inputs[3] = {0xfffffffffffffff0ull, 0x10, 1};
+      EXPECT(UopEvaluator::Evaluate(UopAddWithCarry, add_carry_inputs, 3) == 1ull);
+
+      uint64 mul_add_inputs[3] = {0x1000, 0x30, 0x8};
+      EXPECT(UopEvaluator::Evaluate(UopMulAdd, mul_add_inputs, 3) == 0x30008ull);
+
+      uint64 sub_inputs[2] = {0x100, 0x200};
+      EXPECT(UopEvaluator::Evaluate(UopSub, sub_inputs, 2) == 0xffffffffffffff00ull);
+
+      uint64 sub_carry_inputs[3] = {0x100, 0x80, 0};
+      EXPECT(UopEvaluator::Evaluate(UopSubWithCarry, sub_carry_inputs, 3) == 0x7full);
+      sub_carry_inputs[2] = 1;
+      EXPECT(UopEvaluator::Evaluate(UopSubWithCarry, sub_carry_inputs, 3) == 0x80ull);
+    }
+
+    SECTION("Test division micro-op") {
+      uint64 div_inputs[3] = {0xfffffffffffffff0ull, 0x4, 0};
+      EXPECT(UopEvaluator::Evaluate(UopDiv, div_inputs, 3) == 0x3ffffffffffffffcull);
+      div_inputs[2] = 1;
+      EXPECT(UopEvaluator::Evaluate(UopDiv, div_inputs, 3) == 0xfffffffffffffffcull);
+
+      div_inputs[1] = 0;
+      EXPECT(UopEvaluator::Evaluate(UopDiv, div_inputs, 3) == MAX_UINT64);
+      div_inputs[2] = 0;
+      EXPECT(UopEvaluator::Evaluate(UopDiv, div_inputs, 3) == MAX_UINT64);
+      div_inputs[2] = 1;
+
+      div_inputs[0] = 0x8000000000000000ull;
+      div_inputs[1] = MAX_UINT64;
+      EXPECT(UopEvaluator::Evaluate(UopDiv, div_inputs, 3) == 0x8000000000000000ull);
+    }
+
+    SECTION("Test shifted register micro-ops") {
+      uint64 shift_inputs[4] = {0x1000, 0x3, 0, 4};
+      EXPECT(UopEvaluator::Evaluate(UopAddShift64, shift_inputs, 4) == 0x1030ull);
+      EXPECT(UopEvaluator::Evaluate(UopSubShift64, shift_inputs, 4) == 0xfd0ull);
+
+      shift_inputs[1] = 0x8000000000000010ull;
+      shift_inputs[2] = 1;
+      EXPECT(UopEvaluator::Evaluate(UopAddShift64, shift_inputs, 4) == 0x0800000000001001ull);
+      shift_inputs[2] = 2;
+      EXPECT(UopEvaluator::Evaluate(UopAddShift64, shift_inputs, 4) == 0xf800000000001001ull);
+      shift_inputs[2] = 3;
+      EXPECT(UopEvaluator::Evaluate(UopEorShift64, shift_inputs, 4) == 0x0800000000001001ull);
+
+      uint64 shift32_inputs[4] = {0xfffffff0, 0x80000010, 2, 4};
+      EXPECT(UopEvaluator::Evaluate(UopAddShift32, shift32_inputs, 4) == 0xf7fffff1ull);
+      EXPECT(UopEvaluator::Evaluate(UopAndShift32, shift32_inputs, 4) == 0xf8000000ull);
+      EXPECT(UopEvaluator::Evaluate(UopBicShift32, shift32_inputs, 4) == 0x07fffff0ull);
+      EXPECT(UopEvaluator::Evaluate(UopOrnShift32, shift32_inputs, 4) == 0xfffffffeull);
+      shift32_inputs[2] = 0;
+      EXPECT(UopEvaluator::Evaluate(UopOrrShift32, shift32_inputs, 4) == 0xfffffff0ull);
+      EXPECT(UopEvaluator::Evaluate(UopEonShift32, shift32_inputs, 4) == 0x10full);
+
+      uint64 mvn_inputs[3] = {0xf, 0, 8};
+      EXPECT(UopEvaluator::Evaluate(UopMvnShift32, mvn_inputs, 3) == 0xfffff0ffull);
+      EXPECT(UopEvaluator::Evaluate(UopMvnShift64, mvn_inputs, 3) == 0xfffffffffffff0ffull);
+    }
+
+    SECTION("Test unsupported micro-op and wrong input count") {
+      uint64 inputs[3] = {1, 2, 3};
+      EXPECT_FAIL(UopEvaluator::Evaluate(UopMsub32, inputs, 3), "unsupported-uop");
+      EXPECT_FAIL(UopEvaluator::Evaluate(UopAdd, inputs, 3), "unexpected-uop-input-count");
+    }
+  }
+},
+
+CASE("Test UopEvaluator batch evaluation") {
+
+  SETUP("Setup UopEvaluator")  {
+    Random* random = Random::Instance();
+    uint32 batch_size = 37;
+
+    SECTION("Test batch results match single tuple results") {
+      bool batch_matches = true;
+      for (EUop uop : {UopAddWithCarry, UopMul, UopMulAdd, UopDiv, UopAdd, UopSub, UopSubWithCarry, UopAddShift32, UopSubShift64, UopEorShift64, UopOrnShift32, UopMvnShift64}) {
+        uint32 input_count = UopEvaluator::InputCount(uop);
+        vector<vector<uint64> > input_columns(input_count, vector<uint64>(batch_size));
+        for (uint32 i = 0; i < batch_size; i++) {
+          input_columns[0][i] = random->Random64();
+          input_columns[1][i] = random->Random64(0, 0xff);
+          if (input_count > 2) {
+            input_columns[2][i] = random->Random64(0, 3);
+          }
+          if (input_count > 3) {
+            input_columns[3][i] = random->Random64(0, 63);
+          }
+        }
+
+        vector<uint64> results;
+        UopEvaluator::EvaluateBatch(uop, input_columns, results);
+        batch_matches = batch_matches and (results.size() == batch_size);
+
+        for (uint32 i = 0; i < batch_size; i++) {
+          uint64 inputs[4] = {input_columns[0][i], input_columns[1][i], (input_count > 2) ? input_columns[2][i] : 0, (input_count > 3) ? input_columns[3][i] : 0};
+          batch_matches = batch_matches and (results[i] == UopEvaluator::Evaluate(uop, inputs, input_count));
+        }
+      }
+      EXPECT(batch_matches);
+    }
+
+    SECTION("Test batch with mismatched input columns") {
+      vector<vector<uint64> > input_columns = {{1, 2, 3}, {4, 5}};
+      vector<uint64> results;
+      EXPECT_FAIL(UopEvaluator::EvaluateBatch(UopAdd, input_columns, results), "mismatched-uop-input-columns");
+    }
+  }
+},
+
+CASE("Test UopEvaluator inversion") {
+
+  SETUP("Setup UopEvaluator")  {
+    Random* random = Random::Instance();
+
+    SECTION("Test invertible inputs") {
+      EXPECT(UopEvaluator::IsInvertible(UopAdd, 0));
+      EXPECT(UopEvaluator::IsInvertible(UopSub, 1));
+      EXPECT(UopEvaluator::IsInvertible(UopSubWithCarry, 1));
+      EXPECT(UopEvaluator::IsInvertible(UopMulAdd, 2));
+      EXPECT_NOT(UopEvaluator::IsInvertible(UopMulAdd, 0));
+      EXPECT_NOT(UopEvaluator::IsInvertible(UopAddWithCarry, 2));
+      EXPECT_NOT(UopEvaluator::IsInvertible(UopMul, 0));
+      EXPECT_NOT(UopEvaluator::IsInvertible(UopDiv, 1));
+      EXPECT(UopEvaluator::IsInvertible(UopAddShift64, 0));
+      EXPECT(UopEvaluator::IsInvertible(UopSubShift64, 0));
+      EXPECT_NOT(UopEvaluator::IsInvertible(UopAddShift64, 1));
+      EXPECT_NOT(UopEvaluator::IsInvertible(UopAddShift32, 0));
+      EXPECT_NOT(UopEvaluator::IsInvertible(UopEorShift64, 0));
+    }
+
+    SECTION("Test inverted values reproduce the result") {
+      bool inverse_matches = true;
+      vector<pair<EUop, uint32> > invertible_inputs = {{UopAdd, 0}, {UopAdd, 1}, {UopAddWithCarry, 0}, {UopAddWithCarry, 1}, {UopMulAdd, 2}, {UopSub, 0}, {UopSub, 1}, {UopSubWithCarry, 0}, {UopSubWithCarry, 1}, {UopAddShift64, 0}, {UopSubShift64, 0}};
+      for (const auto& invertible_input : invertible_inputs) {
+        EUop uop = invertible_input.first;
+        uint32 input_index = invertible_input.second;
+        uint32 input_count = UopEvaluator::InputCount(uop);
+        for (uint32 trial = 0; trial < 20; trial++) {
+          uint64 inputs[4] = {random->Random64(), random->Random64(), random->Random64(0, 1), random->Random64(0, 63)};
+          uint64 result = random->Random64();
+          inputs[input_index] = UopEvaluator::InvertValue(uop, input_index, inputs, input_count, result);
+          inverse_matches = inverse_matches and (UopEvaluator::Evaluate(uop, inputs, input_count) == result);
+        }
+      }
+      EXPECT(inverse_matches);
+    }
+
+    SECTION("Test inverted constraint of a subtrahend") {
+      ConstraintSet target_constr(0x1000, 0x1fff);
+      uint64 inputs[2] = {0x5000, 0};
+      UopEvaluator::InvertConstraint(UopSub, 1, inputs, 2, target_constr);
+      EXPECT(target_constr.ToSimpleString() == "0x3001-0x4000");
+    }
+
+    SECTION("Test inverted constraint of an addend") {
+      ConstraintSet target_constr(0x1000, 0x1fff);
+      uint64 inputs[3] = {0x2000, 0, 1};
+      UopEvaluator::InvertConstraint(UopAddWithCarry, 1, inputs, 3, target_constr);
+      EXPECT(target_constr.ToSimpleString() == "0xffffffffffffefff-0xfffffffffffffffe");
+    }
+
+    SECTION("Test inverted constraint of a shifted register addend") {
+      ConstraintSet target_constr(0x1000, 0x1fff);
+      uint64 inputs[4] = {0, 0x10, 0, 8};
+      UopEvaluator::InvertConstraint(UopAddShift64, 0, inputs, 4, target_constr);
+      EXPECT(target_constr.ToSimpleString() == "0x0-0xfff");
+    }
+
+    SECTION("Test inverting a non-invertible input") {
+      ConstraintSet target_constr(0x1000, 0x1fff);
+      uint64 inputs[2] = {0x10, 0};
+      EXPECT_FAIL(UopEvaluator::InvertConstraint(UopMul, 1, inputs, 2, target_constr), "uop-not-invertible");
+    }
+  }
+},
+
+};
+
+int main(int argc, char * argv[])
+{
+  Logger::Initialize();
+  Random::Initialize();
+  int ret = lest::run(specification, argc, argv);
+  Random::Destroy();
+  Logger::Destroy();
+  return ret;
+}
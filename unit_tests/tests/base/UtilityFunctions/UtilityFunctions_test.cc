@@ -257,6 +257,9 @@ CASE( "Test set 2 for Utility Functions" ) {
     baseVal = 14;
     genModeString = get_gen_mode_name (baseVal);
     EXPECT ( genModeString == "Linear" );
+    baseVal = 0x8002;
+    genModeString = get_gen_mode_name (baseVal);
+    EXPECT ( genModeString == "NoBnt,SimOff" );
 
     // test is complete
     LOG(notice) << "Complete Utility Functions Test Set 2." << endl;
@@ -56,7 +56,7 @@ void ReadRegister(uint32 CpuID, const char *regname, uint64 *rval, uint64 *rmask
 
 void PartialReadLargeRegister(uint32 CpuID, const char* regname, uint8_t* bytes, uint32_t length, uint32_t offset) override
 {
-    memcpy(bytes, &registerValue[0] + offset, length); 
+    memcpy(bytes, reinterpret_cast<uint8_t*>(&registerValue[0]) + offset, length);
 }
 
 void InitializeIss(const ApiSimConfig& rConfig, const std::string &rSimSoFile, const std::string& rApiTraceFile) override {} 
@@ -368,7 +368,38 @@ CASE( "Testing VectorElementUpdate::translateElementToRegisterUpdates(...)" ) {
           verify_reg_update(lest_env, regUpdates[0], processorId, "v1_1", MAX_UINT64, "read");
           verify_reg_update(lest_env, regUpdates[1], processorId, "v1_1", MAX_UINT64, "write");
         }
-       
+
+        SECTION("Insert read updates, each physical register keeps the value from its first read") {
+          const char aAccessType[] = "read";
+          const uint8_t firstRegValue[] = {0x11u, 0x11u, 0x11u, 0x11u, 0x11u, 0x11u, 0x11u, 0x11u, 0x22u, 0x22u, 0x22u, 0x22u, 0x22u, 0x22u, 0x22u, 0x22u};
+          const uint8_t secondRegValue[] = {0x33u, 0x33u, 0x33u, 0x33u, 0x33u, 0x33u, 0x33u, 0x33u, 0x44u, 0x44u, 0x44u, 0x44u, 0x44u, 0x44u, 0x44u, 0x44u};
+
+          vecEltUpdates[0].insert(processorId, aRegName, 0, aEltByteWidth, firstRegValue, aRegByteWidth, aAccessType);
+          vecEltUpdates[0].insert(processorId, aRegName, 1, aEltByteWidth, secondRegValue, aRegByteWidth, aAccessType);
+          vecEltUpdates[0].insert(processorId, aRegName, 3, aEltByteWidth, secondRegValue, aRegByteWidth, aAccessType);
+
+          std::vector<RegUpdate> regUpdates;
+          vecEltUpdates[0].translateElementToRegisterUpdates(*apihandle, regUpdates);
+
+          EXPECT(regUpdates.size() == 2ull);
+          verify_reg_update(lest_env, regUpdates[0], processorId, "v1_1", 0x1111111111111111ull, "read");
+          verify_reg_update(lest_env, regUpdates[1], processorId, "v1_2", 0x4444444444444444ull, "read");
+        }
+
+        SECTION("Insert a write update to the second physical register, only that register is read from the simulator") {
+          const char aAccessType[] = "write";
+          stub.registerValue[0] = 0x5555555555555555ull;
+          stub.registerValue[1] = 0x6666666666666666ull;
+
+          vecEltUpdates[0].insert(processorId, aRegName, 2, aEltByteWidth, aEntireRegValue, aRegByteWidth, aAccessType);
+
+          std::vector<RegUpdate> regUpdates;
+          vecEltUpdates[0].translateElementToRegisterUpdates(*apihandle, regUpdates);
+
+          EXPECT(regUpdates.size() == 1ull);
+          verify_reg_update(lest_env, regUpdates[0], processorId, "v1_2", MAX_UINT64, "write");
+          EXPECT(regUpdates[0].rval == 0x6666666666666666ull);
+        }
     }
 },
 
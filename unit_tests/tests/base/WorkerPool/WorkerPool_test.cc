@@ -0,0 +1,177 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "WorkerPool.h"
+
+#include <atomic>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <vector>
+
+#include "lest/lest.hpp"
+
+#include "Constraint.h"
+#include "Log.h"
+
+using namespace std;
+using namespace Force;
+
+using text = std::string;
+
+const lest::test specification[] = {
+
+CASE( "test case for WorkerPool class" ) {
+
+  SETUP( "setup WorkerPool" ) {
+    WorkerPool::Initialize();
+    WorkerPool* worker_pool = WorkerPool::Instance();
+
+    SECTION( "test running tasks on the calling thread" ) {
+      worker_pool->SetThreadCount(1);
+      EXPECT( worker_pool->ThreadCount() == 1u );
+
+      vector<uint32> task_order;
+      worker_pool->Run(5, [&task_order](uint32 taskIndex) { task_order.push_back(taskIndex); });
+      EXPECT( task_order == vector<uint32>({0, 1, 2, 3, 4}) );
+    }
+
+    SECTION( "test every task runs once" ) {
+      worker_pool->SetThreadCount(4);
+      EXPECT( worker_pool->ThreadCount() == 4u );
+
+      for (uint32 job = 0; job < 100; job++) {
+        vector<atomic<uint32>> run_counts(job + 1);
+        worker_pool->Run(run_counts.size(), [&run_counts](uint32 taskIndex) { ++ run_counts[taskIndex]; });
+
+        bool each_once = true;
+        for (const auto& run_count : run_counts) {
+          each_once = each_once and (run_count == 1);
+        }
+        EXPECT( each_once );
+      }
+    }
+
+    SECTION( "test results stored by task index" ) {
+      worker_pool->SetThreadCount(3);
+
+      vector<uint64> results(1000, 0);
+      worker_pool->Run(results.size(), [&results](uint32 taskIndex) { results[taskIndex] = uint64(taskIndex) * taskIndex; });
+
+      bool results_ordered = true;
+      for (uint32 i = 0; i < results.size(); i++) {
+        results_ordered = results_ordered and (results[i] == uint64(i) * i);
+      }
+      EXPECT( results_ordered );
+    }
+
+    SECTION( "test task exception rethrown on the calling thread" ) {
+      worker_pool->SetThreadCount(4);
+
+      atomic<uint32> run_count(0);
+      EXPECT_THROWS_AS( worker_pool->Run(50, [&run_count](uint32 taskIndex) {
+        ++ run_count;
+        if (taskIndex == 17) {
+          throw runtime_error("task-failed");
+        }
+      }), runtime_error );
+      EXPECT( run_count == 50u );
+
+      // the pool is still usable after a failed job.
+      atomic<uint32> second_count(0);
+      worker_pool->Run(10, [&second_count](uint32 taskIndex) { ++ second_count; });
+      EXPECT( second_count == 10u );
+    }
+
+    SECTION( "test nested job runs on the calling thread" ) {
+      worker_pool->SetThreadCount(2);
+
+      atomic<uint32> inner_count(0);
+      worker_pool->Run(4, [worker_pool, &inner_count](uint32 taskIndex) {
+        worker_pool->Run(3, [&inner_count](uint32 innerIndex) { ++ inner_count; });
+      });
+      EXPECT( inner_count == 12u );
+    }
+
+    SECTION( "test task log output written in task order by the calling thread" ) {
+      worker_pool->SetThreadCount(4);
+
+      ostringstream output;
+      streambuf* cout_buffer = cout.rdbuf(output.rdbuf());
+      worker_pool->Run(20, [](uint32 taskIndex) { LOG(notice) << "task " << dec << taskIndex << endl; });
+      cout.rdbuf(cout_buffer);
+
+      ostringstream expected;
+      for (uint32 i = 0; i < 20; i++) {
+        expected << "[notice]task " << i << endl;
+      }
+      EXPECT( output.str() == expected.str() );
+    }
+
+    SECTION( "test FAIL in a task reported on the calling thread" ) {
+      worker_pool->SetThreadCount(4);
+
+      ostringstream output;
+      streambuf* cout_buffer = cout.rdbuf(output.rdbuf());
+      atomic<uint32> run_count(0);
+      EXPECT_FAIL( worker_pool->Run(30, [&run_count](uint32 taskIndex) {
+        ++ run_count;
+        if (taskIndex == 5) {
+          LOG(notice) << "failing task 5" << endl;
+          FAIL("first-task-failed");
+        }
+        else if (taskIndex == 20) {
+          FAIL("second-task-failed");
+        }
+      }), "first-task-failed" );
+      cout.rdbuf(cout_buffer);
+
+      EXPECT( run_count == 30u );
+      EXPECT( output.str() == "[notice]failing task 5\n" );
+    }
+
+    SECTION( "test constraint sets deleted on worker threads" ) {
+      worker_pool->SetThreadCount(4);
+
+      auto delete_constraint_set = [](uint32 taskIndex) {
+        ConstraintSet* constr_set = new ConstraintSet();
+        constr_set->AddRange(uint64(taskIndex) * 0x10, uint64(taskIndex) * 0x10 + 3);
+        constr_set->AddValue(uint64(taskIndex) * 0x10 + 8);
+        delete constr_set;
+      };
+
+      ConstraintSet::msConstraintDeleteCount = 0;
+      delete_constraint_set(0);
+      uint32 task_delete_count = ConstraintSet::msConstraintDeleteCount;
+      EXPECT( task_delete_count > 0u );
+
+      ConstraintSet::msConstraintDeleteCount = 0;
+      worker_pool->Run(1000, delete_constraint_set);
+      EXPECT( ConstraintSet::msConstraintDeleteCount == 1000u * task_delete_count );
+    }
+
+    WorkerPool::Destroy();
+  }
+},
+
+};
+
+int main( int argc, char * argv[] )
+{
+  Logger::Initialize();
+  int ret = lest::run( specification, argc, argv );
+  Logger::Destroy();
+  return ret;
+}
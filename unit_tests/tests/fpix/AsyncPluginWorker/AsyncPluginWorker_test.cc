@@ -0,0 +1,183 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "AsyncPluginWorker.h"
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "lest/lest.hpp"
+
+#include "Log.h"
+#include "SimEvent.h"
+#include "SimPlugin.h"
+
+using text = std::string;
+using namespace Force;
+using namespace std;
+
+namespace Force {
+
+  //!< Asynchronous plugin recording the PCs of the pre-step events it is replayed, and failing at a given PC...
+  class PreStepRecorder : public SimPlugin {
+  public:
+    explicit PreStepRecorder(uint64 failPc = -1ull, uint64 abortPc = -1ull) : SimPlugin(), mPCs(), mThreadIds(), mFailPc(failPc), mAbortPc(abortPc) { }
+    const std::string Name() const override { return "PreStepRecorder"; }
+    bool IsSupported(ESimThreadEventType eventType) const override { return eventType == ESimThreadEventType::PRE_STEP; }
+    void parsePluginsClargs(std::vector<std::string> &plugins_cl_args) override { }
+    void parsePluginsOptions(std::map<std::string, std::string> &aRPluginsOptions) override { }
+    bool IsAsynchronous() const override { return true; }
+
+    void onPreStep() override
+    {
+      mPCs.push_back(CurrentPC());
+      mThreadIds.push_back(this_thread::get_id());
+      LOG(notice) << "pre-step 0x" << hex << CurrentPC() << dec << endl;
+      if (CurrentPC() == mFailPc) {
+        SetReturnCode(3);
+      }
+      if (CurrentPC() == mAbortPc) {
+        LOG(fail) << "pre-step abort 0x" << hex << CurrentPC() << dec << endl;
+        FAIL("pre-step-abort");
+      }
+    }
+
+    vector<uint64> mPCs; //!< PCs of the replayed events, in replay order.
+    vector<thread::id> mThreadIds; //!< Threads the events were replayed on.
+  private:
+    uint64 mFailPc; //!< PC to return an error code at.
+    uint64 mAbortPc; //!< PC to FAIL at.
+  };
+
+}
+
+//!< Queue a pre-step event with the given PC...
+static void queue_pre_step(AsyncPluginWorker& rWorker, uint64 pc)
+{
+  SimThreadEvent event;
+  event.Init(ESimThreadEventType::PRE_STEP, 0, nullptr, nullptr);
+  rWorker.Queue(event, pc);
+}
+
+const lest::test specification[] = {
+
+CASE( "Test AsyncPluginWorker" ) {
+
+  SETUP( "Setup AsyncPluginWorker" ) {
+    ostringstream output;
+    streambuf* cout_buffer = cout.rdbuf(output.rdbuf());
+
+    SECTION( "Test events are replayed in order on the worker thread" ) {
+      PreStepRecorder plugin;
+      AsyncPluginWorker worker({{ESimThreadEventType::PRE_STEP, {&plugin}}}, 4);
+      EXPECT(worker.IsSubscribed(ESimThreadEventType::PRE_STEP));
+      EXPECT_NOT(worker.IsSubscribed(ESimThreadEventType::STEP));
+
+      for (uint64 pc = 0; pc < 1000; ++ pc) {
+        queue_pre_step(worker, pc);
+      }
+      worker.Drain();
+
+      EXPECT(worker.EventCount() == 1000ull);
+      EXPECT(plugin.mPCs.size() == 1000u);
+      bool in_order = true;
+      bool on_worker = true;
+      for (uint64 pc = 0; pc < plugin.mPCs.size(); ++ pc) {
+        in_order = in_order and (plugin.mPCs[pc] == pc);
+        on_worker = on_worker and (plugin.mThreadIds[pc] != this_thread::get_id());
+      }
+      EXPECT(in_order);
+      EXPECT(on_worker);
+      EXPECT(worker.ReturnCode() == 0);
+    }
+
+    SECTION( "Test log output of the worker is written once drained" ) {
+      PreStepRecorder plugin;
+      AsyncPluginWorker worker({{ESimThreadEventType::PRE_STEP, {&plugin}}}, 2);
+      queue_pre_step(worker, 0x10);
+      queue_pre_step(worker, 0x14);
+      worker.Drain();
+      EXPECT(output.str() == "[notice]pre-step 0x10\n[notice]pre-step 0x14\n");
+    }
+
+    SECTION( "Test stopping replays the events still queued" ) {
+      PreStepRecorder plugin;
+      {
+        AsyncPluginWorker worker({{ESimThreadEventType::PRE_STEP, {&plugin}}}, 64);
+        for (uint64 pc = 0; pc < 50; ++ pc) {
+          queue_pre_step(worker, pc);
+        }
+        worker.Stop();
+        EXPECT(plugin.mPCs.size() == 50u);
+        worker.Stop();
+      }
+      EXPECT(plugin.mPCs.size() == 50u);
+      EXPECT(output.str().find("pre-step 0x31") != string::npos);
+    }
+
+    SECTION( "Test the first plugin error is latched" ) {
+      PreStepRecorder plugin(5);
+      PreStepRecorder other_plugin;
+      AsyncPluginWorker worker({{ESimThreadEventType::PRE_STEP, {&plugin, &other_plugin}}}, 8);
+      for (uint64 pc = 0; pc < 10; ++ pc) {
+        queue_pre_step(worker, pc);
+      }
+      worker.Drain();
+      EXPECT(worker.ReturnCode() == 3);
+      EXPECT(other_plugin.mPCs.size() == 10u);
+    }
+
+    SECTION( "Test a FAIL on the worker is reported by the draining thread" ) {
+      PreStepRecorder plugin(-1ull, 3);
+      AsyncPluginWorker worker({{ESimThreadEventType::PRE_STEP, {&plugin}}}, 4);
+      for (uint64 pc = 0; pc < 10; ++ pc) {
+        queue_pre_step(worker, pc);
+      }
+      EXPECT_FAIL(worker.Drain(), "pre-step-abort");
+      EXPECT(plugin.mPCs.size() == 4u);
+      EXPECT(output.str().find("[fail]pre-step abort 0x3\n") != string::npos);
+      worker.Stop();
+    }
+
+    SECTION( "Test a thread capturing its log output does not write to the output stream" ) {
+      ostringstream captured;
+      thread worker_thread([&captured]() {
+        Logger::CaptureThreadOutput(&captured);
+        LOG(notice) << "captured" << endl;
+        Logger::CaptureThreadOutput(nullptr);
+      });
+      worker_thread.join();
+      EXPECT(captured.str() == "[notice]captured\n");
+      EXPECT(output.str().empty());
+      gLog->Output(captured.str());
+      EXPECT(output.str() == "[notice]captured\n");
+    }
+
+    cout.rdbuf(cout_buffer);
+  }
+},
+
+};
+
+int main(int argc, char* argv[])
+{
+  Logger::Initialize();
+  int ret = lest::run(specification, argc, argv);
+  Logger::Destroy();
+  return ret;
+}
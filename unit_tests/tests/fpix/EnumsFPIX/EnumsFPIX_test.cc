@@ -140,6 +140,8 @@ CASE( "tests for EOptionIndex" ) {
       EXPECT(EOptionIndex_to_string(EOptionIndex::PLUGIN) == "PLUGIN");
       EXPECT(EOptionIndex_to_string(EOptionIndex::PLUGINS_OPTIONS) == "PLUGINS_OPTIONS");
       EXPECT(EOptionIndex_to_string(EOptionIndex::AUTO_INIT_MEM_OPT) == "AUTO_INIT_MEM_OPT");
+      EXPECT(EOptionIndex_to_string(EOptionIndex::STEP_QUANTUM_OPT) == "STEP_QUANTUM_OPT");
+      EXPECT(EOptionIndex_to_string(EOptionIndex::ASYNC_PLUGINS_OPT) == "ASYNC_PLUGINS_OPT");
     }
 
     SECTION( "test string to enum conversion" ) {
@@ -159,6 +161,8 @@ CASE( "tests for EOptionIndex" ) {
       EXPECT(string_to_EOptionIndex("PLUGIN") == EOptionIndex::PLUGIN);
       EXPECT(string_to_EOptionIndex("PLUGINS_OPTIONS") == EOptionIndex::PLUGINS_OPTIONS);
       EXPECT(string_to_EOptionIndex("AUTO_INIT_MEM_OPT") == EOptionIndex::AUTO_INIT_MEM_OPT);
+      EXPECT(string_to_EOptionIndex("STEP_QUANTUM_OPT") == EOptionIndex::STEP_QUANTUM_OPT);
+      EXPECT(string_to_EOptionIndex("ASYNC_PLUGINS_OPT") == EOptionIndex::ASYNC_PLUGINS_OPT);
     }
 
     SECTION( "test string to enum conversion with non-matching string" ) {
@@ -199,6 +203,10 @@ CASE( "tests for EOptionIndex" ) {
       EXPECT(okay);
       EXPECT(try_string_to_EOptionIndex("AUTO_INIT_MEM_OPT", okay) == EOptionIndex::AUTO_INIT_MEM_OPT);
       EXPECT(okay);
+      EXPECT(try_string_to_EOptionIndex("STEP_QUANTUM_OPT", okay) == EOptionIndex::STEP_QUANTUM_OPT);
+      EXPECT(okay);
+      EXPECT(try_string_to_EOptionIndex("ASYNC_PLUGINS_OPT", okay) == EOptionIndex::ASYNC_PLUGINS_OPT);
+      EXPECT(okay);
     }
 
     SECTION( "test non-throwing string to enum conversion with non-matching string" ) {
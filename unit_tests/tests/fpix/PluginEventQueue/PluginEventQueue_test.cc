@@ -0,0 +1,110 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "PluginEventQueue.h"
+
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "lest/lest.hpp"
+
+#include "Log.h"
+
+using text = std::string;
+using namespace Force;
+using namespace std;
+
+const lest::test specification[] = {
+
+CASE( "Test PluginEventQueue" ) {
+
+  SETUP( "Setup PluginEventQueue" ) {
+
+    SECTION( "Test records are consumed in the order they were published" ) {
+      PluginEventQueue queue(4);
+      EXPECT(queue.Empty());
+      EXPECT(queue.Front() == nullptr);
+
+      for (uint64 pc = 0; pc < 3; ++ pc) {
+        queue.BeginPush().mPC = pc;
+        queue.EndPush();
+      }
+      EXPECT_NOT(queue.Empty());
+      for (uint64 pc = 0; pc < 3; ++ pc) {
+        PluginEventRecord* record = queue.Front();
+        EXPECT(record != nullptr);
+        EXPECT(record->mPC == pc);
+        queue.Pop();
+      }
+      EXPECT(queue.Empty());
+      EXPECT(queue.FullWaits() == 0ull);
+    }
+
+    SECTION( "Test the depth is rounded up to a power of 2" ) {
+      PluginEventQueue queue(3);
+      for (uint64 pc = 0; pc < 4; ++ pc) {
+        queue.BeginPush().mPC = pc;
+        queue.EndPush();
+      }
+      EXPECT(queue.FullWaits() == 0ull);
+      EXPECT(queue.Front()->mPC == 0ull);
+    }
+
+    SECTION( "Test a consumer thread sees all records in order across wrap arounds" ) {
+      PluginEventQueue queue(2);
+      const uint64 record_count = 10000;
+      vector<uint64> consumed;
+      consumed.reserve(record_count);
+
+      thread consumer([&queue, &consumed, record_count]() {
+        while (consumed.size() < record_count) {
+          PluginEventRecord* record = queue.Front();
+          if (record == nullptr) {
+            this_thread::yield();
+            continue;
+          }
+          consumed.push_back(record->mPC);
+          queue.Pop();
+        }
+      });
+
+      for (uint64 pc = 0; pc < record_count; ++ pc) {
+        PluginEventRecord& record = queue.BeginPush();
+        record.mPC = pc;
+        queue.EndPush();
+      }
+      consumer.join();
+
+      EXPECT(queue.Empty());
+      EXPECT(consumed.size() == record_count);
+      bool in_order = true;
+      for (uint64 pc = 0; pc < consumed.size(); ++ pc) {
+        in_order = in_order and (consumed[pc] == pc);
+      }
+      EXPECT(in_order);
+    }
+  }
+},
+
+};
+
+int main(int argc, char* argv[])
+{
+  Logger::Initialize();
+  int ret = lest::run(specification, argc, argv);
+  Logger::Destroy();
+  return ret;
+}
@@ -0,0 +1,112 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "RegisterAccessIndex.h"
+
+#include "lest/lest.hpp"
+
+#include "Log.h"
+
+using text = std::string;
+using namespace Force;
+
+const lest::test specification[] = {
+
+CASE( "tests for RegisterAccessIndex" ) {
+
+  SETUP ( "setup RegisterAccessIndex" )  {
+    RegisterAccessIndex access_index;
+    uint64_t distance = 0;
+
+    SECTION( "test lookup of a register never accessed" ) {
+      EXPECT(access_index.Lookup(0, EOperandType::GPR, 5, distance) == nullptr);
+      access_index.NewSlot();
+      access_index.Record(0, EOperandType::GPR, 5, EAccessAgeType::Write);
+      EXPECT(access_index.Lookup(0, EOperandType::GPR, 6, distance) == nullptr);
+      EXPECT(access_index.Lookup(0, EOperandType::VECREG, 5, distance) == nullptr);
+      EXPECT(access_index.Lookup(1, EOperandType::GPR, 5, distance) == nullptr);
+    }
+
+    SECTION( "test latest access and distance" ) {
+      access_index.NewSlot();
+      access_index.Record(0, EOperandType::GPR, 5, EAccessAgeType::Write);
+      access_index.NewSlot();
+      access_index.Record(0, EOperandType::GPR, 5, EAccessAgeType::Read);
+      access_index.NewSlot();
+      access_index.Record(0, EOperandType::GPR, 7, EAccessAgeType::Write);
+
+      const RegisterAccessIndex::LastAccess* last_access = access_index.Lookup(0, EOperandType::GPR, 5, distance);
+      EXPECT(last_access != nullptr);
+      EXPECT(last_access->mAccessType == EAccessAgeType::Read);
+      EXPECT(distance == 2u);
+
+      last_access = access_index.Lookup(0, EOperandType::GPR, 7, distance);
+      EXPECT(last_access != nullptr);
+      EXPECT(last_access->mAccessType == EAccessAgeType::Write);
+      EXPECT(distance == 1u);
+    }
+
+    SECTION( "test accesses leaving the window" ) {
+      access_index.NewSlot();
+      access_index.Record(0, EOperandType::GPR, 1, EAccessAgeType::Write);
+      for (uint32_t i = 0; i < 3; i++) {
+        access_index.NewSlot();
+        access_index.Record(0, EOperandType::GPR, 2, EAccessAgeType::Write);
+        if (access_index.WindowSize() > 3) {
+          access_index.DropOldestSlot();
+        }
+      }
+
+      EXPECT(access_index.WindowSize() == 3u);
+      EXPECT(access_index.Lookup(0, EOperandType::GPR, 1, distance) == nullptr);
+      EXPECT(access_index.Lookup(0, EOperandType::GPR, 2, distance) != nullptr);
+    }
+
+    SECTION( "test window growing over slots without accesses" ) {
+      access_index.NewSlot();
+      access_index.Record(0, EOperandType::GPR, 3, EAccessAgeType::Read);
+      access_index.NewSlot();
+      access_index.NewSlot();
+
+      EXPECT(access_index.WindowSize() == 3u);
+      EXPECT(access_index.Lookup(0, EOperandType::GPR, 3, distance) != nullptr);
+      EXPECT(distance == 3u);
+
+      access_index.DropOldestSlot();
+      EXPECT(access_index.Lookup(0, EOperandType::GPR, 3, distance) == nullptr);
+    }
+
+    SECTION( "test separate cpus and register files" ) {
+      access_index.NewSlot();
+      access_index.Record(0, EOperandType::GPR, 4, EAccessAgeType::Write);
+      access_index.Record(1, EOperandType::GPR, 4, EAccessAgeType::Read);
+      access_index.Record(0, EOperandType::VECREG, 4, EAccessAgeType::Read);
+
+      EXPECT(access_index.Lookup(0, EOperandType::GPR, 4, distance)->mAccessType == EAccessAgeType::Write);
+      EXPECT(access_index.Lookup(1, EOperandType::GPR, 4, distance)->mAccessType == EAccessAgeType::Read);
+      EXPECT(access_index.Lookup(0, EOperandType::VECREG, 4, distance)->mAccessType == EAccessAgeType::Read);
+    }
+  }
+},
+
+};
+
+int main(int argc, char* argv[])
+{
+  Logger::Initialize();
+  int ret = lest::run(specification, argc, argv);
+  Logger::Destroy();
+  return ret;
+}
@@ -0,0 +1,139 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "RegisterAccessIndex.h"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "lest/lest.hpp"
+
+#include "Log.h"
+
+using text = std::string;
+using namespace Force;
+using namespace std::chrono;
+
+struct TraceAccess {
+  uint32_t mRegNum;
+  EAccessAgeType mAccessType;
+};
+
+//!< a long trace of instruction steps, each reading two GP registers and writing one...
+void gen_trace(std::vector<std::vector<TraceAccess>>& rTrace, size_t stepCount)
+{
+  std::mt19937 rand_gen(1);
+  std::uniform_int_distribution<uint32_t> reg_dist(1, 31);
+
+  rTrace.resize(stepCount);
+  for (auto& step : rTrace) {
+    step.push_back({reg_dist(rand_gen), EAccessAgeType::Read});
+    step.push_back({reg_dist(rand_gen), EAccessAgeType::Read});
+    step.push_back({reg_dist(rand_gen), EAccessAgeType::Write});
+  }
+}
+
+//!< dependency check as previously done by the plugins, scanning the access history from the most recent step...
+uint64_t count_dependencies_by_scan(const std::vector<std::vector<TraceAccess>>& rTrace, uint32_t depDepth, uint64_t& rDepthSum)
+{
+  std::vector<std::vector<TraceAccess>> stages;
+  uint64_t dep_count = 0;
+  for (const auto& step : rTrace) {
+    for (const auto& access : step) {
+      for (auto stage = stages.rbegin(); stage != stages.rend(); ++stage) {
+        auto match = std::find_if(stage->begin(), stage->end(), [&access](const TraceAccess& other) { return other.mRegNum == access.mRegNum; });
+        if (match != stage->end()) {
+          ++ dep_count;
+          rDepthSum += std::distance(stages.rbegin(), stage) + 1;
+          break;
+        }
+      }
+    }
+    stages.push_back(step);
+    if (stages.size() > depDepth) {
+      stages.erase(stages.begin());
+    }
+  }
+  return dep_count;
+}
+
+uint64_t count_dependencies_by_index(const std::vector<std::vector<TraceAccess>>& rTrace, uint32_t depDepth, uint64_t& rDepthSum)
+{
+  RegisterAccessIndex access_index;
+  uint64_t dep_count = 0;
+  uint64_t distance = 0;
+  for (const auto& step : rTrace) {
+    for (const auto& access : step) {
+      if (access_index.Lookup(0, EOperandType::GPR, access.mRegNum, distance) != nullptr) {
+        ++ dep_count;
+        rDepthSum += distance;
+      }
+    }
+    access_index.NewSlot();
+    for (const auto& access : step) {
+      access_index.Record(0, EOperandType::GPR, access.mRegNum, access.mAccessType);
+    }
+    if (access_index.WindowSize() > depDepth) {
+      access_index.DropOldestSlot();
+    }
+  }
+  return dep_count;
+}
+
+const lest::test specification[] = {
+
+CASE( "performance tests for RegisterAccessIndex" ) {
+
+  SETUP ( "setup RegisterAccessIndex" )  {
+    std::vector<std::vector<TraceAccess>> trace;
+    gen_trace(trace, 200000);
+
+    SECTION( "test scaling of dependency lookup with the dependency depth" ) {
+      for (uint32_t dep_depth : {4u, 30u, 300u, 3000u}) {
+        uint64_t scan_depth_sum = 0;
+        high_resolution_clock::time_point start_time = high_resolution_clock::now();
+        uint64_t scan_count = count_dependencies_by_scan(trace, dep_depth, scan_depth_sum);
+        duration<double> scan_time = duration_cast<duration<double>>(high_resolution_clock::now() - start_time);
+
+        uint64_t index_depth_sum = 0;
+        start_time = high_resolution_clock::now();
+        uint64_t index_count = count_dependencies_by_index(trace, dep_depth, index_depth_sum);
+        duration<double> index_time = duration_cast<duration<double>>(high_resolution_clock::now() - start_time);
+
+        EXPECT(index_count == scan_count);
+        EXPECT(index_depth_sum == scan_depth_sum);
+
+        std::cout << "dep_depth " << dep_depth << ": history scan " << scan_time.count() << " s, access index " << index_time.count() << " s" << std::endl;
+
+#ifdef PERF_ASSERT
+        EXPECT(index_time.count() < 0.05);
+#endif
+      }
+    }
+  }
+}
+
+};
+
+int main( int argc, char * argv[] )
+{
+    Logger::Initialize();
+    int ret = lest::run( specification, argc, argv );
+    Logger::Destroy();
+    return ret;
+}
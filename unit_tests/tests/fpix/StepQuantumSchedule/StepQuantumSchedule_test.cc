@@ -0,0 +1,179 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "StepQuantumSchedule.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "lest/lest.hpp"
+
+#include "Log.h"
+
+using text = std::string;
+using namespace Force;
+using namespace std;
+
+//!< Drive the schedule the way the simulate loop does over threads whose events are given as strings: 'l' is a local step, 's' a
+//!< step that is not local and 'e' a step after which the thread is at end-test. Return the non-local events in processing order,
+//!< as (thread index, event index) pairs...
+static vector<pair<uint32_t, uint32_t>> run_schedule(const vector<string>& rEvents, uint32_t quantum, uint64_t& rTurns, uint64_t& rRunAhead)
+{
+  StepQuantumSchedule schedule(rEvents.size(), quantum);
+  vector<pair<uint32_t, uint32_t>> order;
+  rTurns = 0;
+
+  bool more_to_do = true;
+  while (more_to_do) {
+    more_to_do = false;
+    for (uint32_t thread_index = 0; thread_index < rEvents.size(); ++ thread_index) {
+      const string& events = rEvents[thread_index];
+      if (schedule.Position(thread_index) >= events.size()) {
+        continue;
+      }
+
+      uint32_t turn_events = 0;
+      while (schedule.Position(thread_index) < events.size()) {
+        uint64_t event_index = schedule.Position(thread_index);
+        char event = events[event_index];
+        bool end_test_reached = (event_index > 0) and (events.find('e') < event_index);
+        if (not schedule.MayProcess(thread_index, turn_events, (event == 'l') and (not end_test_reached))) {
+          break;
+        }
+        if (event != 'l') {
+          order.push_back(make_pair(thread_index, uint32_t(event_index)));
+        }
+        schedule.EventProcessed(thread_index, (event == 'e') or end_test_reached);
+        ++ turn_events;
+      }
+      ++ rTurns;
+      if (schedule.Position(thread_index) == events.size()) {
+        schedule.ThreadFinished(thread_index);
+      }
+      more_to_do = true;
+    }
+    schedule.EndPass();
+  }
+
+  rRunAhead = schedule.RunAheadCount();
+  return order;
+}
+
+const lest::test specification[] = {
+
+CASE( "Test StepQuantumSchedule" ) {
+
+  SETUP( "Setup StepQuantumSchedule" ) {
+
+    SECTION( "Test a quantum of 1 is strict round-robin" ) {
+      StepQuantumSchedule schedule(2, 1);
+      EXPECT(schedule.MayProcess(0, 0, false));
+      EXPECT(schedule.MayProcess(0, 0, true));
+      EXPECT_NOT(schedule.MayProcess(0, 1, true));
+      schedule.EventProcessed(0, false);
+      EXPECT_NOT(schedule.MayProcess(0, 1, true));
+      EXPECT(schedule.MayProcess(1, 0, false));
+      schedule.EventProcessed(1, false);
+      schedule.EndPass();
+      EXPECT(schedule.Pass() == 1ull);
+      EXPECT(schedule.InOwnPass(0));
+      EXPECT(schedule.RunAheadCount() == 0ull);
+    }
+
+    SECTION( "Test passes without events of their own are skipped" ) {
+      StepQuantumSchedule schedule(2, 4);
+      for (uint32_t i = 0; i < 3; ++ i) {
+        schedule.EventProcessed(0, false);
+      }
+      schedule.EventProcessed(1, false);
+      schedule.EventProcessed(1, false);
+      schedule.EndPass();
+      EXPECT(schedule.Pass() == 2ull);
+      EXPECT(schedule.InOwnPass(1));
+      schedule.ThreadFinished(1);
+      schedule.EndPass();
+      EXPECT(schedule.Pass() == 3ull);
+      EXPECT(schedule.InOwnPass(0));
+    }
+
+    SECTION( "Test running ahead is limited to local steps within the quantum" ) {
+      StepQuantumSchedule schedule(2, 4);
+      schedule.EventProcessed(0, false);
+      EXPECT_NOT(schedule.InOwnPass(0));
+      EXPECT_NOT(schedule.MayProcess(0, 1, false));
+      EXPECT(schedule.MayProcess(0, 1, true));
+      EXPECT_NOT(schedule.MayProcess(0, 4, true));
+      schedule.EventProcessed(0, false);
+      EXPECT(schedule.RunAheadCount() == 1ull);
+      EXPECT(schedule.Position(0) == 2ull);
+    }
+
+    SECTION( "Test a thread at end-test does not run ahead" ) {
+      StepQuantumSchedule schedule(2, 4);
+      schedule.EventProcessed(0, true);
+      EXPECT_NOT(schedule.MayProcess(0, 1, true));
+    }
+
+    SECTION( "Test all-stop is given in the pass after every thread reached end-test" ) {
+      StepQuantumSchedule schedule(2, 1);
+      schedule.EventProcessed(0, true);
+      EXPECT_NOT(schedule.AllStop(1));
+      schedule.EventProcessed(1, true);
+      schedule.EndPass();
+      EXPECT(schedule.AllStop(0));
+      EXPECT(schedule.AllStop(1));
+    }
+
+    SECTION( "Test the order of non-local events does not depend on the quantum" ) {
+      vector<string> events = {"llslllsllllllse", "sllsllllllsllllsllle", "lllllllle"};
+      uint64_t turns = 0;
+      uint64_t run_ahead = 0;
+      vector<pair<uint32_t, uint32_t>> round_robin_order = run_schedule(events, 1, turns, run_ahead);
+      uint64_t round_robin_turns = turns;
+      EXPECT(run_ahead == 0ull);
+      EXPECT(round_robin_order.size() == 10u);
+
+      for (uint32_t quantum : {2u, 3u, 8u, 100u}) {
+        vector<pair<uint32_t, uint32_t>> order = run_schedule(events, quantum, turns, run_ahead);
+        EXPECT(order == round_robin_order);
+        EXPECT(turns < round_robin_turns);
+        EXPECT(run_ahead > 0ull);
+      }
+    }
+
+    SECTION( "Test threads without local steps keep strict round-robin" ) {
+      vector<string> events = {"ssse", "sssssse"};
+      uint64_t turns = 0;
+      uint64_t run_ahead = 0;
+      vector<pair<uint32_t, uint32_t>> round_robin_order = run_schedule(events, 1, turns, run_ahead);
+      uint64_t round_robin_turns = turns;
+      vector<pair<uint32_t, uint32_t>> order = run_schedule(events, 16, turns, run_ahead);
+      EXPECT(order == round_robin_order);
+      EXPECT(turns == round_robin_turns);
+      EXPECT(run_ahead == 0ull);
+    }
+  }
+},
+
+};
+
+int main(int argc, char* argv[])
+{
+  Logger::Initialize();
+  int ret = lest::run(specification, argc, argv);
+  Logger::Destroy();
+  return ret;
+}
@@ -719,6 +719,13 @@ CASE( "tests for ESystemOptionType" ) {
       EXPECT(ESystemOptionType_to_string(ESystemOptionType::FlatMap) == "FlatMap");
       EXPECT(ESystemOptionType_to_string(ESystemOptionType::MatchedHandler) == "MatchedHandler");
       EXPECT(ESystemOptionType_to_string(ESystemOptionType::SkipBootCode) == "SkipBootCode");
+      EXPECT(ESystemOptionType_to_string(ESystemOptionType::LazyAddressSolving) == "LazyAddressSolving");
+      EXPECT(ESystemOptionType_to_string(ESystemOptionType::AddressSolvingThreads) == "AddressSolvingThreads");
+      EXPECT(ESystemOptionType_to_string(ESystemOptionType::SchedulingQuantum) == "SchedulingQuantum");
+      EXPECT(ESystemOptionType_to_string(ESystemOptionType::MemoryReport) == "MemoryReport");
+      EXPECT(ESystemOptionType_to_string(ESystemOptionType::MemoryReportInterval) == "MemoryReportInterval");
+      EXPECT(ESystemOptionType_to_string(ESystemOptionType::CompactionInterval) == "CompactionInterval");
+      EXPECT(ESystemOptionType_to_string(ESystemOptionType::ExceptionRecordLimit) == "ExceptionRecordLimit");
     }
 
     SECTION( "test string to enum conversion" ) {
@@ -729,6 +736,13 @@ CASE( "tests for ESystemOptionType" ) {
       EXPECT(string_to_ESystemOptionType("FlatMap") == ESystemOptionType::FlatMap);
       EXPECT(string_to_ESystemOptionType("MatchedHandler") == ESystemOptionType::MatchedHandler);
       EXPECT(string_to_ESystemOptionType("SkipBootCode") == ESystemOptionType::SkipBootCode);
+      EXPECT(string_to_ESystemOptionType("LazyAddressSolving") == ESystemOptionType::LazyAddressSolving);
+      EXPECT(string_to_ESystemOptionType("AddressSolvingThreads") == ESystemOptionType::AddressSolvingThreads);
+      EXPECT(string_to_ESystemOptionType("SchedulingQuantum") == ESystemOptionType::SchedulingQuantum);
+      EXPECT(string_to_ESystemOptionType("MemoryReport") == ESystemOptionType::MemoryReport);
+      EXPECT(string_to_ESystemOptionType("MemoryReportInterval") == ESystemOptionType::MemoryReportInterval);
+      EXPECT(string_to_ESystemOptionType("CompactionInterval") == ESystemOptionType::CompactionInterval);
+      EXPECT(string_to_ESystemOptionType("ExceptionRecordLimit") == ESystemOptionType::ExceptionRecordLimit);
     }
 
     SECTION( "test string to enum conversion with non-matching string" ) {
@@ -751,6 +765,20 @@ CASE( "tests for ESystemOptionType" ) {
       EXPECT(okay);
       EXPECT(try_string_to_ESystemOptionType("SkipBootCode", okay) == ESystemOptionType::SkipBootCode);
       EXPECT(okay);
+      EXPECT(try_string_to_ESystemOptionType("LazyAddressSolving", okay) == ESystemOptionType::LazyAddressSolving);
+      EXPECT(okay);
+      EXPECT(try_string_to_ESystemOptionType("AddressSolvingThreads", okay) == ESystemOptionType::AddressSolvingThreads);
+      EXPECT(okay);
+      EXPECT(try_string_to_ESystemOptionType("SchedulingQuantum", okay) == ESystemOptionType::SchedulingQuantum);
+      EXPECT(okay);
+      EXPECT(try_string_to_ESystemOptionType("MemoryReport", okay) == ESystemOptionType::MemoryReport);
+      EXPECT(okay);
+      EXPECT(try_string_to_ESystemOptionType("MemoryReportInterval", okay) == ESystemOptionType::MemoryReportInterval);
+      EXPECT(okay);
+      EXPECT(try_string_to_ESystemOptionType("CompactionInterval", okay) == ESystemOptionType::CompactionInterval);
+      EXPECT(okay);
+      EXPECT(try_string_to_ESystemOptionType("ExceptionRecordLimit", okay) == ESystemOptionType::ExceptionRecordLimit);
+      EXPECT(okay);
     }
 
     SECTION( "test non-throwing string to enum conversion with non-matching string" ) {
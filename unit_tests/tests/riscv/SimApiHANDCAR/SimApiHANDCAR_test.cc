@@ -0,0 +1,233 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#include "SimApiHANDCAR.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "lest/lest.hpp"
+
+#include "Enums.h"
+#include "GenException.h"
+#include "Log.h"
+
+PICKY_IGNORE_BLOCK_START
+#include "SimLoader.h"
+PICKY_IGNORE_BLOCK_END
+
+using text = std::string;
+using namespace Force;
+using namespace std;
+
+namespace {
+
+  vector<string> sCalls; //!< Simulator calls made through the stubs, in call order.
+  int sReturnCode = 0; //!< Return code of the register write stubs.
+  uint64_t sPc = 0; //!< PC returned by the register read stub.
+  uint64_t sPa = 0; //!< Physical address the PC translates to.
+  uint32_t sEncoding = 0; //!< Instruction encoding at sPa.
+  int sTranslateCode = 0; //!< Return code of the translation stub.
+
+  int stub_read_register(uint32_t targetId, const char* registerName, uint64_t* value, uint64_t* mask)
+  {
+    *value = (string(registerName) == "PC") ? sPc : 0;
+    *mask = MAX_UINT64;
+    return 0;
+  }
+
+  int stub_write_register(uint32_t targetId, const char* registerName, uint64_t value, uint64_t mask)
+  {
+    stringstream call_stream;
+    call_stream << "write " << registerName << " 0x" << hex << value;
+    sCalls.push_back(call_stream.str());
+    return sReturnCode;
+  }
+
+  int stub_partial_write_large_register(int targetId, const char* registerName, const uint8_t* pBytes, uint32_t length, uint32_t offset)
+  {
+    stringstream call_stream;
+    call_stream << "partial " << registerName << " +" << dec << offset;
+    sCalls.push_back(call_stream.str());
+    return sReturnCode;
+  }
+
+  int stub_write_registers(uint32_t targetId, const SimRegisterWrite* pWrites, uint32_t count)
+  {
+    stringstream call_stream;
+    call_stream << "batch";
+    for (uint32_t i = 0; i < count; ++ i) {
+      call_stream << " " << dec << pWrites[i].category << ":" << pWrites[i].index << "+" << pWrites[i].offset << "=0x" << hex << pWrites[i].value;
+    }
+    sCalls.push_back(call_stream.str());
+    return sReturnCode;
+  }
+
+  int stub_translate(int targetId, const uint64_t* vaddr, int intent, uint64_t* paddr, uint64_t* memattrs)
+  {
+    *paddr = sPa;
+    *memattrs = 0;
+    return sTranslateCode;
+  }
+
+  int stub_read_memory(int targetId, const uint64_t* addr, int length, uint8_t* data)
+  {
+    uint64_t offset = *addr - sPa;
+    for (int i = 0; i < length; ++ i) {
+      data[i] = ((offset + i) < 4) ? uint8_t(sEncoding >> ((offset + i) * 8)) : 0;
+    }
+    return 0;
+  }
+
+  uint32 register_id(ERegisterType regType, uint32 index)
+  {
+    return (uint32(regType) << 28) | index;
+  }
+
+  void install_stubs(SimDllApi* pSimDllApi)
+  {
+    pSimDllApi->read_simulator_register = stub_read_register;
+    pSimDllApi->write_simulator_register = stub_write_register;
+    pSimDllApi->partial_write_large_register = stub_partial_write_large_register;
+    pSimDllApi->write_simulator_registers = stub_write_registers;
+    pSimDllApi->translate_virtual_address = stub_translate;
+    pSimDllApi->read_simulator_memory = stub_read_memory;
+    sCalls.clear();
+    sReturnCode = 0;
+    sTranslateCode = 0;
+  }
+
+  bool next_instruction_is_local(SimApiHANDCAR& rSimApi, uint64_t pc, uint32_t encoding)
+  {
+    sPc = pc;
+    sPa = 0x80000000 + (pc & 0xfff);
+    sEncoding = encoding;
+    return rSimApi.NextInstructionIsLocal(0);
+  }
+
+}
+
+const lest::test specification[] = {
+
+CASE("Test SimApiHANDCAR batched register writes") {
+
+  SETUP("Setup SimApiHANDCAR with stub simulator entry points") {
+    SimApiHANDCAR sim_api;
+    install_stubs(sim_api.GetSimDllApi());
+
+    SECTION("Registers with Handcar categories are written in one call") {
+      vector<RegisterWrite> writes = {
+        {"x1", register_id(ERegisterType::GPR, 1), 0, 0x11, MAX_UINT64},
+        {"f2_0", register_id(ERegisterType::FPR, 2), 0, 0x22, MAX_UINT64},
+        {"v3_1", register_id(ERegisterType::VECREG, 3), 1, 0x33, MAX_UINT64},
+        {"mstatus", register_id(ERegisterType::SysReg, 0x300), 0, 0x44, MAX_UINT64},
+      };
+      sim_api.WriteRegisters(0, writes.data(), writes.size());
+      EXPECT(sCalls == (vector<string>{"batch 1:1+0=0x11 2:2+0=0x22 3:3+8=0x33 0:768+0=0x44"}));
+    }
+
+    SECTION("Registers known only by name flush the batch first to keep the write order") {
+      vector<RegisterWrite> writes = {
+        {"x1", register_id(ERegisterType::GPR, 1), 0, 0x11, MAX_UINT64},
+        {"x2", register_id(ERegisterType::GPR, 2), 0, 0x12, MAX_UINT64},
+        {"PC", register_id(ERegisterType::PC, 0), 0, 0x80001000, MAX_UINT64},
+        {"x3", register_id(ERegisterType::GPR, 3), 0, 0x13, MAX_UINT64},
+      };
+      sim_api.WriteRegisters(0, writes.data(), writes.size());
+      EXPECT(sCalls == (vector<string>{"batch 1:1+0=0x11 1:2+0=0x12", "write PC 0x80001000", "batch 1:3+0=0x13"}));
+    }
+
+    SECTION("Each call only writes its own registers") {
+      vector<RegisterWrite> first_writes = {{"x1", register_id(ERegisterType::GPR, 1), 0, 0x11, MAX_UINT64}};
+      vector<RegisterWrite> second_writes = {{"x2", register_id(ERegisterType::GPR, 2), 0, 0x12, MAX_UINT64}};
+      sim_api.WriteRegisters(0, first_writes.data(), first_writes.size());
+      sim_api.WriteRegisters(0, second_writes.data(), second_writes.size());
+      sim_api.WriteRegisters(0, second_writes.data(), 0);
+      EXPECT(sCalls == (vector<string>{"batch 1:1+0=0x11", "batch 1:2+0=0x12"}));
+    }
+
+    SECTION("A failed batch throws, and the next call does not resend it") {
+      vector<RegisterWrite> first_writes = {{"x1", register_id(ERegisterType::GPR, 1), 0, 0x11, MAX_UINT64}};
+      vector<RegisterWrite> second_writes = {{"x2", register_id(ERegisterType::GPR, 2), 0, 0x12, MAX_UINT64}};
+      sReturnCode = 1;
+      EXPECT_THROWS_AS(sim_api.WriteRegisters(0, first_writes.data(), first_writes.size()), SimulationError);
+      sReturnCode = 0;
+      sim_api.WriteRegisters(0, second_writes.data(), second_writes.size());
+      EXPECT(sCalls == (vector<string>{"batch 1:1+0=0x11", "batch 1:2+0=0x12"}));
+    }
+
+    SECTION("Registers are written one at a time by name without write_simulator_registers") {
+      sim_api.GetSimDllApi()->write_simulator_registers = nullptr;
+      vector<RegisterWrite> writes = {
+        {"x1", register_id(ERegisterType::GPR, 1), 0, 0x11, MAX_UINT64},
+        {"f2_0", register_id(ERegisterType::FPR, 2), 0, 0x22, MAX_UINT64},
+        {"v3_1", register_id(ERegisterType::VECREG, 3), 1, 0x33, MAX_UINT64},
+      };
+      sim_api.WriteRegisters(0, writes.data(), writes.size());
+      EXPECT(sCalls == (vector<string>{"write x1 0x11", "write f2 0x22", "partial v3 +8"}));
+    }
+  }
+},
+
+CASE("Test SimApiHANDCAR next instruction locality") {
+
+  SETUP("Setup SimApiHANDCAR with stub simulator entry points") {
+    SimApiHANDCAR sim_api;
+    install_stubs(sim_api.GetSimDllApi());
+
+    SECTION("Computation and control transfer instructions are local") {
+      EXPECT(next_instruction_is_local(sim_api, 0x1000, 0x00100093)); // addi x1, x0, 1
+      EXPECT(next_instruction_is_local(sim_api, 0x1000, 0x0000006f)); // jal x0, 0
+      EXPECT(next_instruction_is_local(sim_api, 0x1000, 0x02208033)); // mul x0, x1, x2
+      EXPECT(next_instruction_is_local(sim_api, 0x1000, 0x0505)); // c.addi x10, 1
+      EXPECT(next_instruction_is_local(sim_api, 0x1000, 0x0028)); // c.addi4spn x10, 8
+      EXPECT(next_instruction_is_local(sim_api, 0x1000, 0x050a)); // c.slli x10, 2
+    }
+
+    SECTION("Memory accessing and system instructions are not local") {
+      EXPECT_NOT(next_instruction_is_local(sim_api, 0x1000, 0x0000a083)); // lw x1, 0(x1)
+      EXPECT_NOT(next_instruction_is_local(sim_api, 0x1000, 0x0020a023)); // sw x2, 0(x1)
+      EXPECT_NOT(next_instruction_is_local(sim_api, 0x1000, 0x0000a007)); // flw f0, 0(x1)
+      EXPECT_NOT(next_instruction_is_local(sim_api, 0x1000, 0x0000000f)); // fence
+      EXPECT_NOT(next_instruction_is_local(sim_api, 0x1000, 0x0820a0af)); // amoswap.w
+      EXPECT_NOT(next_instruction_is_local(sim_api, 0x1000, 0x00000073)); // ecall
+      EXPECT_NOT(next_instruction_is_local(sim_api, 0x1000, 0x4108)); // c.lw x10, 0(x10)
+      EXPECT_NOT(next_instruction_is_local(sim_api, 0x1000, 0x4502)); // c.lwsp x10, 0(sp)
+      EXPECT_NOT(next_instruction_is_local(sim_api, 0x1000, 0x9002)); // c.ebreak
+      EXPECT_NOT(next_instruction_is_local(sim_api, 0x1000, 0x0000)); // illegal
+    }
+
+    SECTION("Instructions that may fault on fetch are not local") {
+      EXPECT_NOT(next_instruction_is_local(sim_api, 0x1ffe, 0x00100093)); // crosses into the next page
+      EXPECT(next_instruction_is_local(sim_api, 0x1ffe, 0x0505)); // compressed at the page end
+      sTranslateCode = 1;
+      EXPECT_NOT(next_instruction_is_local(sim_api, 0x1000, 0x00100093));
+      sTranslateCode = 0;
+      sim_api.GetSimDllApi()->translate_virtual_address = nullptr;
+      EXPECT_NOT(next_instruction_is_local(sim_api, 0x1000, 0x00100093));
+    }
+  }
+},
+
+};
+
+int main(int argc, char* argv[])
+{
+  Logger::Initialize();
+  int ret = lest::run(specification, argc, argv);
+  Logger::Destroy();
+  return ret;
+}
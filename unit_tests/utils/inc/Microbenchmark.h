@@ -0,0 +1,215 @@
+//
+// Copyright (C) [2020] Futurewei Technologies, Inc.
+//
+// FORCE-RISCV is licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+// THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER
+// EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY OR
+// FIT FOR A PARTICULAR PURPOSE.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+#ifndef Force_Microbenchmark_H
+#define Force_Microbenchmark_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Defines.h"
+
+namespace Force {
+
+  /*!
+    \class MicrobenchmarkResult
+    \brief Timing statistics of one microbenchmark, in nanoseconds per operation.
+  */
+  struct MicrobenchmarkResult {
+    std::string mName; //!< Benchmark name.
+    uint32 mOperations; //!< Number of operations timed in each repetition.
+    uint32 mRepetitions; //!< Number of timed repetitions.
+    double mMin; //!< Fastest repetition.
+    double mMedian; //!< Median repetition.
+    double mMean; //!< Mean of all repetitions.
+    double mStdDev; //!< Standard deviation of all repetitions.
+    std::vector<double> mSamples; //!< All repetitions in ascending order, for comparing runs with a significance test.
+
+    MicrobenchmarkResult(const std::string& name, uint32 operations) //!< Constructor with benchmark name and operation count.
+      : mName(name), mOperations(operations), mRepetitions(0), mMin(0.0), mMedian(0.0), mMean(0.0), mStdDev(0.0), mSamples()
+    {
+    }
+  };
+
+  /*!
+    \class Microbenchmark
+    \brief A named operation batch with an untimed setup step run before each repetition.
+  */
+  struct Microbenchmark {
+    std::string mName; //!< Benchmark name, "<module>/<operation>".
+    uint32 mOperations; //!< Number of operations performed by one call of mBody.
+    std::function<void()> mSetup; //!< Untimed preparation, restores the state mBody consumes.
+    std::function<void()> mBody; //!< Timed batch of mOperations operations.
+  };
+
+  /*!
+    \class MicrobenchmarkSuite
+    \brief Run registered microbenchmarks with warmup and repetition, report statistics as text and optionally JSON.
+
+    Command line options: --repeat <n>, --warmup <n>, --filter <substring>, --json <path>.
+  */
+  class MicrobenchmarkSuite {
+  public:
+    explicit MicrobenchmarkSuite(const std::string& name) //!< Constructor with suite name.
+      : mName(name), mBenchmarks(), mRepeat(15), mWarmup(2), mFilter(), mJsonPath()
+    {
+    }
+
+    void Add(const std::string& name, uint32 operations, std::function<void()> setup, std::function<void()> body) //!< Register a benchmark.
+    {
+      mBenchmarks.push_back(Microbenchmark{name, operations, setup, body});
+    }
+
+    int Run(int argc, char* argv[]) //!< Parse the command line, run all selected benchmarks and return the process exit code.
+    {
+      if (not ParseArguments(argc, argv)) {
+        std::cerr << "Usage: " << argv[0] << " [--repeat <n>] [--warmup <n>] [--filter <substring>] [--json <path>]" << std::endl;
+        return 1;
+      }
+
+      std::vector<MicrobenchmarkResult> results;
+      std::cout << std::left << std::setw(44) << "benchmark" << std::right << std::setw(12) << "min ns/op" << std::setw(12) << "median" << std::setw(12) << "mean" << std::setw(10) << "stddev" << std::endl;
+      for (auto& bench : mBenchmarks) {
+        if ((not mFilter.empty()) and (bench.mName.find(mFilter) == std::string::npos)) {
+          continue;
+        }
+
+        results.push_back(Measure(bench));
+        const MicrobenchmarkResult& result = results.back();
+        std::cout << std::left << std::setw(44) << result.mName << std::right << std::fixed << std::setprecision(1) << std::setw(12) << result.mMin << std::setw(12) << result.mMedian << std::setw(12) << result.mMean << std::setw(10) << result.mStdDev << std::endl;
+      }
+
+      if (not mJsonPath.empty()) {
+        return WriteJson(results) ? 0 : 1;
+      }
+      return 0;
+    }
+
+    template <typename T>
+    static void KeepValue(const T& rValue) //!< Prevent the compiler from discarding a computed value.
+    {
+      static volatile uint64 sink;
+      sink = sink + static_cast<uint64>(rValue);
+    }
+  private:
+    bool ParseArguments(int argc, char* argv[]) //!< Parse command line options, return false on error.
+    {
+      for (int i = 1; i < argc; ++ i) {
+        if (i + 1 == argc) {
+          return false;
+        }
+
+        const char* value = argv[++ i];
+        if (strcmp(argv[i - 1], "--repeat") == 0) {
+          mRepeat = std::max(1, atoi(value));
+        }
+        else if (strcmp(argv[i - 1], "--warmup") == 0) {
+          mWarmup = std::max(0, atoi(value));
+        }
+        else if (strcmp(argv[i - 1], "--filter") == 0) {
+          mFilter = value;
+        }
+        else if (strcmp(argv[i - 1], "--json") == 0) {
+          mJsonPath = value;
+        }
+        else {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    MicrobenchmarkResult Measure(Microbenchmark& rBench) const //!< Time one benchmark.
+    {
+      for (int i = 0; i < mWarmup; ++ i) {
+        rBench.mSetup();
+        rBench.mBody();
+      }
+
+      std::vector<double> samples;
+      samples.reserve(mRepeat);
+      for (int i = 0; i < mRepeat; ++ i) {
+        rBench.mSetup();
+        auto start_time = std::chrono::steady_clock::now();
+        rBench.mBody();
+        auto end_time = std::chrono::steady_clock::now();
+        double elapsed = std::chrono::duration<double, std::nano>(end_time - start_time).count();
+        samples.push_back(elapsed / rBench.mOperations);
+      }
+
+      std::sort(samples.begin(), samples.end());
+      MicrobenchmarkResult result(rBench.mName, rBench.mOperations);
+      result.mRepetitions = samples.size();
+      result.mMin = samples.front();
+      size_t mid = samples.size() / 2;
+      result.mMedian = (samples.size() % 2) ? samples[mid] : (samples[mid - 1] + samples[mid]) / 2;
+      double sum = 0.0;
+      for (double sample : samples) {
+        sum += sample;
+      }
+      result.mMean = sum / samples.size();
+      double square_sum = 0.0;
+      for (double sample : samples) {
+        square_sum += (sample - result.mMean) * (sample - result.mMean);
+      }
+      result.mStdDev = (samples.size() > 1) ? std::sqrt(square_sum / (samples.size() - 1)) : 0.0;
+      result.mSamples.swap(samples);
+      return result;
+    }
+
+    bool WriteJson(const std::vector<MicrobenchmarkResult>& rResults) const //!< Write results to the JSON file, return false on error.
+    {
+      std::ofstream json_file(mJsonPath);
+      if (not json_file) {
+        std::cerr << "Failed to open benchmark output file: " << mJsonPath << std::endl;
+        return false;
+      }
+
+      json_file << "{\n  \"suite\": \"" << mName << "\",\n  \"unit\": \"ns/op\",\n  \"benchmarks\": [";
+      json_file << std::setprecision(6) << std::fixed;
+      for (size_t i = 0; i < rResults.size(); ++ i) {
+        const MicrobenchmarkResult& result = rResults[i];
+        json_file << ((i == 0) ? "\n" : ",\n");
+        json_file << "    {\"name\": \"" << result.mName << "\", \"operations\": " << result.mOperations << ", \"repetitions\": " << result.mRepetitions;
+        json_file << ", \"min\": " << result.mMin << ", \"median\": " << result.mMedian << ", \"mean\": " << result.mMean << ", \"stddev\": " << result.mStdDev << ", \"samples\": [";
+        for (size_t j = 0; j < result.mSamples.size(); ++ j) {
+          json_file << ((j == 0) ? "" : ", ") << result.mSamples[j];
+        }
+        json_file << "]}";
+      }
+      json_file << "\n  ]\n}\n";
+      return true;
+    }
+  private:
+    std::string mName; //!< Suite name.
+    std::vector<Microbenchmark> mBenchmarks; //!< Registered benchmarks in run order.
+    int mRepeat; //!< Number of timed repetitions.
+    int mWarmup; //!< Number of untimed warmup repetitions.
+    std::string mFilter; //!< Only run benchmarks whose name contains this substring.
+    std::string mJsonPath; //!< Path of the JSON output file, empty for none.
+  };
+
+}
+
+#endif  // Force_Microbenchmark_H
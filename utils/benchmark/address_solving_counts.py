@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+#  address_solving_counts.py
+#
+#  Count the addressing modes solved by the address solver with full and with
+#  lazy address solving.
+#
+#  Each corpus template is generated with fixed seeds, once with
+#  LazyAddressSolving=0 and once with LazyAddressSolving=1. The solved and
+#  available mode counts are summed from the info level solver messages. The
+#  script fails if lazy solving doesn't solve fewer modes on the corpus.
+#
+#  Example:
+#    address_solving_counts.py --seeds 0x2,0x4 --output counts.json
+
+import argparse
+import json
+import os
+import re
+import subprocess
+import sys
+
+REPO_ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+
+# Templates that solve instructions with several addressing mode choices, the
+# other address solving templates only solve a single mode per instruction.
+CORPUS = [
+    "tests/riscv/address_solving/address_solving_address_reuse_force.py",
+]
+
+DEFAULT_SEEDS = ["0x2", "0x4", "0xa"]
+
+SOLVED_PATTERN = re.compile(
+    r"\{AddressSolver::(SolveWithModes|SolveLazily)\} solved (\d+) of (\d+) modes"
+)
+
+
+def setup_arguments():
+    arg_parser = argparse.ArgumentParser(
+        description="Count the addressing modes solved with full and lazy address solving"
+    )
+    arg_parser.add_argument(
+        "--force-path",
+        default=os.environ.get("FORCE_PATH", REPO_ROOT),
+        help="FORCE installation to measure, defaults to $FORCE_PATH or this repository",
+    )
+    arg_parser.add_argument(
+        "--work-dir",
+        default="address_solving_runs",
+        help="directory the generator runs in, defaults to ./address_solving_runs",
+    )
+    arg_parser.add_argument(
+        "--seeds",
+        default=",".join(DEFAULT_SEEDS),
+        help="comma separated seeds, defaults to %s" % ",".join(DEFAULT_SEEDS),
+    )
+    arg_parser.add_argument("--output", help="write the results to this file")
+    return arg_parser
+
+
+#  Run the generator once and return the solved and available mode counts, or
+#  None if it failed.
+#
+#  @param force_path FORCE root directory.
+#  @param run_dir Directory to run the generator in.
+#  @param cmd Generator command line.
+def count_solved_modes(force_path, run_dir, cmd):
+    os.makedirs(run_dir, exist_ok=True)
+    proc = subprocess.run(
+        cmd,
+        cwd=run_dir,
+        env=dict(os.environ, FORCE_PATH=force_path),
+        stdout=subprocess.PIPE,
+        stderr=subprocess.STDOUT,
+        universal_newlines=True,
+    )
+    with open(os.path.join(run_dir, "gen.log"), "w") as log_file:
+        log_file.write(proc.stdout)
+    if proc.returncode != 0:
+        return None
+
+    counts = {"solves": 0, "solved_modes": 0, "available_modes": 0}
+    for match in SOLVED_PATTERN.finditer(proc.stdout):
+        counts["solves"] += 1
+        counts["solved_modes"] += int(match.group(2))
+        counts["available_modes"] += int(match.group(3))
+    return counts
+
+
+def run_corpus(args):
+    totals = {}
+    failures = []
+    for template in CORPUS:
+        template_name = os.path.basename(template).replace("_force.py", "")
+        for seed in args.seeds.split(","):
+            for lazy in (0, 1):
+                run_name = "%s.%s.lazy%d" % (template_name, seed, lazy)
+                cmd = [
+                    os.path.join(args.force_path, "bin", "friscv"),
+                    "-t",
+                    os.path.join(REPO_ROOT, template),
+                    "-s",
+                    seed,
+                    "--noiss",
+                    "-l",
+                    "info",
+                    "--options",
+                    "LazyAddressSolving=%d" % lazy,
+                ]
+                counts = count_solved_modes(
+                    args.force_path, os.path.join(args.work_dir, run_name), cmd
+                )
+                if counts is None:
+                    failures.append(run_name)
+                    print("%-64s failed" % run_name)
+                    continue
+
+                print(
+                    "%-64s %6d solves %8d of %8d modes solved"
+                    % (
+                        run_name,
+                        counts["solves"],
+                        counts["solved_modes"],
+                        counts["available_modes"],
+                    )
+                )
+                mode_totals = totals.setdefault(
+                    lazy, {"solves": 0, "solved_modes": 0, "available_modes": 0}
+                )
+                for count_name, count in counts.items():
+                    mode_totals[count_name] += count
+
+    return (totals, failures)
+
+
+if __name__ == "__main__":
+    args = setup_arguments().parse_args()
+    totals, failures = run_corpus(args)
+
+    for lazy, mode_totals in sorted(totals.items()):
+        print(
+            "%-6s %8d solves %10d of %10d modes solved"
+            % (
+                "lazy" if lazy else "full",
+                mode_totals["solves"],
+                mode_totals["solved_modes"],
+                mode_totals["available_modes"],
+            )
+        )
+
+    if args.output:
+        with open(args.output, "w") as output_file:
+            json.dump({"totals": totals, "failures": failures}, output_file, indent=2)
+
+    reduced = (len(totals) == 2) and (totals[1]["solved_modes"] < totals[0]["solved_modes"])
+    if failures:
+        print("%d run(s) failed" % len(failures))
+    elif not reduced:
+        print("lazy address solving didn't reduce the solved modes")
+    sys.exit(0 if (reduced and not failures) else 1)
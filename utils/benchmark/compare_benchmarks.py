@@ -0,0 +1,219 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+#  compare_benchmarks.py
+#
+#  Compare two benchmark result files and report regressions.
+#
+#  The result files hold a "benchmarks" list whose entries have a "name",
+#  one numeric field per statistic and a "samples" list with the time of each
+#  repetition, as written by the microbenchmark suites in unit_tests. Lower
+#  values are better unless an entry sets "higher_is_better" to true.
+#
+#  Example:
+#    Microbenchmark_test --json baseline.json
+#    ... apply change, rebuild ...
+#    Microbenchmark_test --json current.json
+#    compare_benchmarks.py baseline.json current.json --threshold 5
+#
+#  A benchmark regressed when its best repetition got worse by more than the
+#  threshold, and a one-sided Mann-Whitney U test finds the current samples
+#  worse than the baseline samples at the given significance level. The best
+#  repetition is the one least disturbed by other load on the machine: the
+#  minimum, or the maximum for entries where higher is better.
+#  Entries with fewer than MIN_SAMPLES samples are judged by the threshold
+#  alone. The test cannot tell a code change from a change in machine load,
+#  so run both suites back to back on an otherwise idle machine. The script
+#  exits with status 1 when any benchmark regressed, so it can gate a release
+#  build.
+
+import argparse
+import json
+import math
+import sys
+
+MIN_SAMPLES = 5
+
+
+def setup_arguments():
+    arg_parser = argparse.ArgumentParser(
+        description="Compare two benchmark result files and report regressions"
+    )
+    arg_parser.add_argument("baseline", help="baseline result file")
+    arg_parser.add_argument("current", help="current result file")
+    arg_parser.add_argument(
+        "--metric",
+        default="best",
+        help="statistic to compare, defaults to best",
+    )
+    arg_parser.add_argument(
+        "--threshold",
+        type=float,
+        default=10.0,
+        help="percentage change treated as a regression, defaults to 10",
+    )
+    arg_parser.add_argument(
+        "--alpha",
+        type=float,
+        default=0.01,
+        help="significance level of the Mann-Whitney U test, defaults to 0.01",
+    )
+    return arg_parser
+
+
+#  Load a result file and return its benchmarks keyed by name.
+#
+#  @param file_path Path of the result file.
+def load_results(file_path):
+    with open(file_path) as result_file:
+        results = json.load(result_file)
+
+    return {bench["name"]: bench for bench in results["benchmarks"]}
+
+
+#  Return the compared statistic of a benchmark entry. "best" is the minimum,
+#  or the maximum for entries where higher is better.
+#
+#  @param bench Benchmark entry.
+#  @param metric Name of the statistic.
+def metric_value(bench, metric):
+    if metric == "best":
+        metric = "max" if bench.get("higher_is_better", False) else "min"
+
+    return bench[metric]
+
+
+#  Return the change from baseline to current in percent, positive when the
+#  current result is worse.
+#
+#  @param base_bench Baseline benchmark entry.
+#  @param cur_bench Current benchmark entry.
+#  @param metric Name of the statistic to compare.
+def percent_worse(base_bench, cur_bench, metric):
+    base_value = metric_value(base_bench, metric)
+    cur_value = metric_value(cur_bench, metric)
+    if base_value == 0:
+        return 0.0
+
+    change = (cur_value - base_value) * 100.0 / base_value
+    if base_bench.get("higher_is_better", False):
+        change = -change
+
+    return change
+
+
+#  Return the one-sided p-value of the Mann-Whitney U test for the worse
+#  samples being drawn from a larger distribution than the better samples.
+#  Uses the normal approximation with tie and continuity correction, which is
+#  close enough for the 15 repetitions the suites run by default.
+#
+#  @param better_samples Samples expected to be smaller.
+#  @param worse_samples Samples expected to be larger.
+def mann_whitney_p_value(better_samples, worse_samples):
+    combined = sorted(
+        [(value, False) for value in better_samples] + [(value, True) for value in worse_samples]
+    )
+    count = len(combined)
+    worse_rank_sum = 0.0
+    tie_sum = 0.0
+    start = 0
+    while start < count:
+        end = start
+        while (end + 1 < count) and (combined[end + 1][0] == combined[start][0]):
+            end += 1
+        tie_count = end - start + 1
+        tie_sum += tie_count * tie_count * tie_count - tie_count
+        worse_count = sum(1 for (_, worse) in combined[start : end + 1] if worse)
+        worse_rank_sum += ((start + end) / 2.0 + 1) * worse_count
+        start = end + 1
+
+    n_better = len(better_samples)
+    n_worse = len(worse_samples)
+    u_worse = worse_rank_sum - n_worse * (n_worse + 1) / 2.0
+    variance = n_better * n_worse / 12.0 * ((count + 1) - tie_sum / (count * (count - 1)))
+    if variance <= 0.0:
+        return 1.0
+
+    z = (u_worse - n_better * n_worse / 2.0 - 0.5) / math.sqrt(variance)
+    return 0.5 * math.erfc(z / math.sqrt(2.0))
+
+
+#  Return the p-value of the current result being worse than the baseline, or
+#  None when either entry has too few samples for the test.
+#
+#  @param base_bench Baseline benchmark entry.
+#  @param cur_bench Current benchmark entry.
+def worse_p_value(base_bench, cur_bench):
+    base_samples = base_bench.get("samples", [])
+    cur_samples = cur_bench.get("samples", [])
+    if min(len(base_samples), len(cur_samples)) < MIN_SAMPLES:
+        return None
+
+    if base_bench.get("higher_is_better", False):
+        return mann_whitney_p_value(cur_samples, base_samples)
+
+    return mann_whitney_p_value(base_samples, cur_samples)
+
+
+def compare_results(baseline, current, metric, threshold, alpha=0.01):
+    regressions = []
+    print("%-44s %14s %14s %9s %8s" % ("benchmark", "baseline", "current", "worse %", "p-value"))
+    for name, base_bench in baseline.items():
+        cur_bench = current.get(name)
+        if cur_bench is None:
+            print("%-44s %14.6g %14s" % (name, metric_value(base_bench, metric), "missing"))
+            continue
+
+        change = percent_worse(base_bench, cur_bench, metric)
+        p_value = worse_p_value(base_bench, cur_bench)
+        flag = ""
+        if (change > threshold) and ((p_value is None) or (p_value < alpha)):
+            flag = "  REGRESSION"
+            regressions.append(name)
+
+        p_text = "-" if p_value is None else "%.4f" % p_value
+        print(
+            "%-44s %14.6g %14.6g %+8.1f %8s%s"
+            % (
+                name,
+                metric_value(base_bench, metric),
+                metric_value(cur_bench, metric),
+                change,
+                p_text,
+                flag,
+            )
+        )
+
+    for name in current:
+        if name not in baseline:
+            print("%-44s %14s %14.6g" % (name, "new", metric_value(current[name], metric)))
+
+    return regressions
+
+
+if __name__ == "__main__":
+    args = setup_arguments().parse_args()
+    regressions = compare_results(
+        load_results(args.baseline),
+        load_results(args.current),
+        args.metric,
+        args.threshold,
+        args.alpha,
+    )
+
+    if regressions:
+        print("%d benchmark(s) regressed by more than %.1f%%" % (len(regressions), args.threshold))
+        sys.exit(1)
@@ -0,0 +1,153 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+#  fpix_quantum_benchmark.py
+#
+#  Compare FPIX simulation time with strict round-robin stepping and with
+#  larger step quanta.
+#
+#  Each test ELF is simulated with every step quantum. For every run the
+#  script records the simulation time, the number of sim-thread turns and the
+#  number of steps run ahead, as logged by the simulate loop. The results are
+#  written in the format read by compare_benchmarks.py, and the speedup of
+#  each quantum over quantum 1 is printed.
+#
+#  Example:
+#    fpix_quantum_benchmark.py --quanta 1,8,64 --output quanta.json \
+#        test1.Default.ELF test2.Default.ELF
+
+import argparse
+import json
+import os
+import platform
+import re
+import subprocess
+import sys
+
+from throughput_benchmark import summarize
+
+REPO_ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+
+SIMULATED_PATTERN = re.compile(
+    r"Simulated (\d+) cpu\(s\) in ([0-9.e+-]+) seconds, step quantum (\d+), "
+    r"(\d+) turns, (\d+) steps run ahead"
+)
+
+
+def setup_arguments():
+    arg_parser = argparse.ArgumentParser(
+        description="Compare FPIX simulation time across step quanta"
+    )
+    arg_parser.add_argument(
+        "--fpix",
+        default=os.path.join(REPO_ROOT, "fpix", "bin", "fpix_riscv"),
+        help="FPIX executable, defaults to fpix/bin/fpix_riscv in this repository",
+    )
+    arg_parser.add_argument(
+        "--fpix-args",
+        default="",
+        help="extra FPIX command line options, eg, the configuration file",
+    )
+    arg_parser.add_argument(
+        "--quanta",
+        default="1,4,16,64",
+        help="comma separated step quanta, defaults to 1,4,16,64",
+    )
+    arg_parser.add_argument(
+        "--repeat",
+        type=int,
+        default=3,
+        help="number of runs per test and quantum, defaults to 3",
+    )
+    arg_parser.add_argument("--output", help="write the results to this file")
+    arg_parser.add_argument("tests", nargs="+", help="test ELF files to simulate")
+    return arg_parser
+
+
+#  Run FPIX once and return its measurements, or None if it failed.
+#
+#  @param cmd FPIX command line.
+def run_fpix(cmd):
+    proc = subprocess.run(
+        cmd, stdout=subprocess.PIPE, stderr=subprocess.STDOUT, universal_newlines=True
+    )
+    match = SIMULATED_PATTERN.search(proc.stdout)
+    if (proc.returncode != 0) or (match is None):
+        return None
+
+    return {
+        "simulate_seconds": float(match.group(2)),
+        "turns": int(match.group(4)),
+        "run_ahead_steps": int(match.group(5)),
+    }
+
+
+def run_tests(args):
+    quanta = [int(quantum) for quantum in args.quanta.split(",")]
+    benchmarks = []
+    failures = []
+    for test_path in args.tests:
+        test_name = os.path.basename(test_path)
+        median_times = {}
+        for quantum in quanta:
+            runs = []
+            for repeat_index in range(args.repeat):
+                cmd = [args.fpix] + args.fpix_args.split() + ["-q", str(quantum), test_path]
+                result = run_fpix(cmd)
+                if result is None:
+                    failures.append("%s.q%d.%d" % (test_name, quantum, repeat_index))
+                    continue
+                runs.append(result)
+
+            if not runs:
+                print("%-40s quantum %4d failed" % (test_name, quantum))
+                continue
+
+            for metric_name in sorted(runs[0]):
+                bench = {"name": "%s/q%d/%s" % (test_name, quantum, metric_name)}
+                bench.update(summarize([run[metric_name] for run in runs]))
+                benchmarks.append(bench)
+                if metric_name == "simulate_seconds":
+                    median_times[quantum] = bench["median"]
+
+            speedup = ""
+            if (1 in median_times) and (median_times[quantum] > 0.0):
+                speedup = "%6.2fx" % (median_times[1] / median_times[quantum])
+            print(
+                "%-40s quantum %4d %10.3f s %10d turns %s"
+                % (test_name, quantum, median_times[quantum], runs[0]["turns"], speedup)
+            )
+
+    return (benchmarks, failures)
+
+
+if __name__ == "__main__":
+    args = setup_arguments().parse_args()
+    benchmarks, failures = run_tests(args)
+
+    if args.output:
+        results = {
+            "suite": "fpix_quantum",
+            "host": platform.node(),
+            "benchmarks": benchmarks,
+            "failures": failures,
+        }
+        with open(args.output, "w") as output_file:
+            json.dump(results, output_file, indent=2)
+
+    if failures:
+        print("%d run(s) failed" % len(failures))
+    sys.exit(1 if failures else 0)
@@ -0,0 +1,323 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+#  throughput_benchmark.py
+#
+#  Measure end-to-end generation throughput on a fixed corpus of templates
+#  from tests/riscv.
+#
+#  Each corpus entry is generated with fixed seeds, with and without the ISS.
+#  For every run the script records:
+#    - the generated instruction count and instructions per second;
+#    - the peak RSS of the generator process;
+#    - the startup time;
+#    - the time spent in each generation phase.
+#  The startup time is the time until the template starts generating. It
+#  covers process start, architecture data loading, template import and
+#  thread creation.
+#  The phase times come from the "{Logger::Phase}" markers in the generator
+#  output.
+#
+#  The results are written in the format read by compare_benchmarks.py.
+#  Store a run on a given machine as its baseline, and compare later runs
+#  against it. The absolute numbers only compare within the same machine and
+#  build type.
+#
+#  Example:
+#    throughput_benchmark.py --output baseline.json
+#    ... apply change, rebuild ...
+#    throughput_benchmark.py --output current.json --baseline baseline.json
+
+import argparse
+import json
+import math
+import os
+import platform
+import re
+import subprocess
+import sys
+import time
+
+from compare_benchmarks import compare_results, load_results
+
+REPO_ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+
+# Fixed template corpus. Template paths are relative to the repository. The
+# generator arguments are appended to the command line of every run.
+CORPUS = [
+    {
+        "name": "integer",
+        "template": "tests/riscv/performance/rv64gc_throughput_force.py",
+        "args": [],
+    },
+    {
+        "name": "rvv",
+        "template": "tests/riscv/performance/rvv_throughput_force.py",
+        "args": [],
+    },
+    {
+        "name": "paging",
+        "template": "tests/riscv/paging/paging_loadstore_force.py",
+        "args": ["--options", "PrivilegeLevel=1"],
+    },
+    {
+        "name": "exception",
+        "template": "tests/riscv/exception_handlers/ecall_ebreak_force.py",
+        "args": [
+            "--max-instr",
+            "5000",
+            "--options",
+            "PrivilegeLevel=1,DelegateExceptions=1,PagingDisabled=1",
+        ],
+    },
+    {
+        "name": "multi_hart",
+        "template": "tests/riscv/multiprocessing/multiprocessing_broad_random_instructions_force.py",
+        "args": ["--num-cores", "2", "--num-threads", "2"],
+    },
+]
+
+MODES = {"noiss": ["--noiss"], "iss": []}
+# Seeds the whole corpus generates with in either mode, keep them fixed so
+# results stay comparable across versions.
+DEFAULT_SEEDS = ["0x2", "0x4", "0xa"]
+
+PHASE_PATTERN = re.compile(r'\{Logger::Phase\} entering phase "(\w+)" at ([0-9.]+) s')
+INSTR_COUNT_PATTERN = re.compile(r"Total Instructions Generated: (\d+)")
+
+
+def setup_arguments():
+    arg_parser = argparse.ArgumentParser(
+        description="Measure end-to-end generation throughput on a fixed template corpus"
+    )
+    arg_parser.add_argument(
+        "--force-path",
+        default=os.environ.get("FORCE_PATH", REPO_ROOT),
+        help="FORCE installation to benchmark, defaults to $FORCE_PATH or this repository",
+    )
+    arg_parser.add_argument(
+        "--work-dir",
+        default="throughput_runs",
+        help="directory the generator runs in, defaults to ./throughput_runs",
+    )
+    arg_parser.add_argument(
+        "--seeds",
+        default=",".join(DEFAULT_SEEDS),
+        help="comma separated seeds, defaults to %s" % ",".join(DEFAULT_SEEDS),
+    )
+    arg_parser.add_argument(
+        "--modes",
+        default="noiss,iss",
+        help="comma separated simulation modes out of noiss and iss, defaults to both",
+    )
+    arg_parser.add_argument(
+        "--repeat",
+        type=int,
+        default=1,
+        help="number of runs per seed, defaults to 1",
+    )
+    arg_parser.add_argument(
+        "--filter",
+        default="",
+        help="only run corpus entries whose name contains this substring",
+    )
+    arg_parser.add_argument("--output", help="write the results to this file")
+    arg_parser.add_argument("--baseline", help="compare the results with this baseline file")
+    arg_parser.add_argument(
+        "--threshold",
+        type=float,
+        default=10.0,
+        help="percentage change treated as a regression, defaults to 10",
+    )
+    return arg_parser
+
+
+#  Run the generator once and return its measurements, or None if it failed.
+#
+#  @param force_path FORCE root directory.
+#  @param run_dir Directory to run the generator in.
+#  @param cmd Generator command line.
+def run_generator(force_path, run_dir, cmd):
+    os.makedirs(run_dir, exist_ok=True)
+    env = dict(os.environ, FORCE_PATH=force_path)
+    phases = []
+    instr_count = 0
+
+    start_time = time.perf_counter()
+    with open(os.path.join(run_dir, "gen.log"), "w") as log_file:
+        # Phase markers are flushed by the generator, so the output is
+        # streamed instead of collected at exit.
+        proc = subprocess.Popen(
+            cmd,
+            cwd=run_dir,
+            env=env,
+            stdout=subprocess.PIPE,
+            stderr=subprocess.STDOUT,
+            universal_newlines=True,
+        )
+        for line in proc.stdout:
+            log_file.write(line)
+            phase_match = PHASE_PATTERN.search(line)
+            if phase_match:
+                phases.append((phase_match.group(1), float(phase_match.group(2))))
+                continue
+
+            count_match = INSTR_COUNT_PATTERN.search(line)
+            if count_match:
+                instr_count = int(count_match.group(1))
+
+        proc.stdout.close()
+        (_, status, rusage) = os.wait4(proc.pid, 0)
+    wall_time = time.perf_counter() - start_time
+    proc.returncode = os.WEXITSTATUS(status) if os.WIFEXITED(status) else -1
+
+    if (proc.returncode != 0) or (not phases):
+        return None
+
+    result = {
+        "wall_seconds": wall_time,
+        "instructions": instr_count,
+        "instructions_per_second": instr_count / wall_time,
+        "peak_rss_mb": rusage.ru_maxrss / 1024.0,
+    }
+    phase_times = dict(phases)
+    if "init" in phase_times:
+        result["startup_seconds"] = phase_times["init"]
+
+    # Each phase lasts until the next marker, the last one until the process
+    # exits.
+    phase_ends = [phase_time for (_, phase_time) in phases[1:]] + [wall_time]
+    for ((phase_name, phase_time), phase_end) in zip(phases, phase_ends):
+        result["phase_%s_seconds" % phase_name] = phase_end - phase_time
+
+    return result
+
+
+#  Return summary statistics of a list of samples.
+#
+#  @param samples Measured values.
+def summarize(samples):
+    samples = sorted(samples)
+    count = len(samples)
+    mean = sum(samples) / count
+    if count > 1:
+        stddev = math.sqrt(sum((x - mean) ** 2 for x in samples) / (count - 1))
+    else:
+        stddev = 0.0
+
+    mid = count // 2
+    median = samples[mid] if count % 2 else (samples[mid - 1] + samples[mid]) / 2
+    return {
+        "repetitions": count,
+        "min": samples[0],
+        "max": samples[-1],
+        "median": median,
+        "mean": mean,
+        "stddev": stddev,
+        "samples": samples,
+    }
+
+
+def run_corpus(args):
+    seeds = args.seeds.split(",")
+    modes = args.modes.split(",")
+    benchmarks = []
+    failures = []
+    for entry in CORPUS:
+        if args.filter not in entry["name"]:
+            continue
+
+        for mode in modes:
+            runs = []
+            for seed in seeds:
+                for repeat_index in range(args.repeat):
+                    run_name = "%s.%s.%s.%d" % (entry["name"], mode, seed, repeat_index)
+                    cmd = [
+                        os.path.join(args.force_path, "bin", "friscv"),
+                        "-t",
+                        os.path.join(REPO_ROOT, entry["template"]),
+                        "-s",
+                        seed,
+                    ]
+                    cmd += entry["args"] + MODES[mode]
+                    result = run_generator(
+                        args.force_path, os.path.join(args.work_dir, run_name), cmd
+                    )
+                    if result is None:
+                        failures.append(run_name)
+                        print("%-32s failed" % run_name)
+                        continue
+
+                    print(
+                        "%-32s %8d instr %8.3f s %10.1f instr/s %8.1f MB"
+                        % (
+                            run_name,
+                            result["instructions"],
+                            result["wall_seconds"],
+                            result["instructions_per_second"],
+                            result["peak_rss_mb"],
+                        )
+                    )
+                    runs.append(result)
+
+            if not runs:
+                continue
+
+            metric_names = sorted(set().union(*runs))
+            for metric_name in metric_names:
+                samples = [run[metric_name] for run in runs if metric_name in run]
+                bench = {"name": "%s/%s/%s" % (entry["name"], mode, metric_name)}
+                bench.update(summarize(samples))
+                if metric_name in ("instructions", "instructions_per_second"):
+                    bench["higher_is_better"] = True
+                benchmarks.append(bench)
+
+    return (benchmarks, failures)
+
+
+if __name__ == "__main__":
+    args = setup_arguments().parse_args()
+    args.force_path = os.path.abspath(args.force_path)
+    (benchmarks, failures) = run_corpus(args)
+
+    results = {
+        "suite": "throughput",
+        "host": platform.node(),
+        "seeds": args.seeds.split(","),
+        "benchmarks": benchmarks,
+        "failures": failures,
+    }
+    if args.output:
+        with open(args.output, "w") as output_file:
+            json.dump(results, output_file, indent=2)
+
+    exit_code = 0
+    if args.baseline:
+        current = {bench["name"]: bench for bench in benchmarks}
+        regressions = compare_results(
+            load_results(args.baseline), current, "best", args.threshold
+        )
+        if regressions:
+            print(
+                "%d benchmark(s) regressed by more than %.1f%%"
+                % (len(regressions), args.threshold)
+            )
+            exit_code = 1
+
+    if failures:
+        print("%d run(s) failed, see gen.log in their run directories" % len(failures))
+
+    sys.exit(exit_code)
@@ -402,6 +402,7 @@ enum_classes_details = [
             ("MemAttrArch", 4),
             ("MemAttrImpl", 5),
             ("AliasPageId", 6),
+            ("PreferredPA", 7),
         ],
     ],
     [
@@ -519,6 +520,7 @@ enum_classes_details = [
             ("AddressShortage", 1 << 12),
             ("RecordingState", 1 << 13),
             ("RestoreStateLoop", 1 << 14),
+            ("NoBnt", 1 << 15),
         ],
     ],
     [
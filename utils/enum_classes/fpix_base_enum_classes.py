@@ -57,6 +57,8 @@ enum_classes_details = [
             ("PLUGIN", 13),
             ("PLUGINS_OPTIONS", 14),
             ("AUTO_INIT_MEM_OPT", 15),
+            ("STEP_QUANTUM_OPT", 16),
+            ("ASYNC_PLUGINS_OPT", 17),
         ],
     ],
     [
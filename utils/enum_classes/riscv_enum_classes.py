@@ -167,6 +167,13 @@ enum_classes_details = [
             ("FlatMap", 4),
             ("MatchedHandler", 5),
             ("SkipBootCode", 6),
+            ("LazyAddressSolving", 7),
+            ("AddressSolvingThreads", 8),
+            ("SchedulingQuantum", 9),
+            ("MemoryReport", 10),
+            ("MemoryReportInterval", 11),
+            ("CompactionInterval", 12),
+            ("ExceptionRecordLimit", 13),
         ],
     ],
     [
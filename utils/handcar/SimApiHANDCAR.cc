@@ -19,6 +19,7 @@
 #include <cstring>
 #include <iostream>
 
+#include "Enums.h"
 #include "GenException.h"
 
 PICKY_IGNORE_BLOCK_START
@@ -100,6 +101,66 @@ namespace {
     return (regVal & mask);
   }
 
+  thread_local vector<SimRegisterWrite> stRegisterWriteBatch; //!< Register writes batched for write_simulator_registers.
+
+  // Fill in the Handcar register category, index and offset of a register write, return false if it can only be written by name.
+  bool get_register_write_entry(const RegisterWrite& rWrite, SimRegisterWrite& rEntry)
+  {
+    rEntry.index = rWrite.mRegisterId & 0xfffffff;
+    rEntry.offset = 0;
+    rEntry.value = rWrite.mValue;
+    rEntry.mask = rWrite.mMask;
+
+    switch (ERegisterType(rWrite.mRegisterId >> 28)) {
+    case ERegisterType::SysReg:
+      rEntry.category = 0;
+      return true;
+    case ERegisterType::GPR:
+      rEntry.category = 1;
+      return true;
+    case ERegisterType::FPR:
+      rEntry.category = 2;
+      return true;
+    case ERegisterType::VECREG:
+      rEntry.category = 3;
+      rEntry.offset = rWrite.mSubIndex * sizeof(uint64);
+      return true;
+    default:
+      return false;
+    }
+  }
+
+  // Return true if the RISC-V instruction neither accesses memory nor is a system instruction, ie, it only changes state of its own cpu.
+  bool instruction_is_local(uint32 encoding)
+  {
+    uint32 quadrant = encoding & 0x3;
+    uint32 funct3 = (encoding >> 13) & 0x7;
+
+    switch (quadrant) {
+    case 0: // compressed loads and stores, except c.addi4spn
+      return (funct3 == 0) and ((encoding & 0xffff) != 0);
+    case 1: // compressed integer computation and control transfer
+      return true;
+    case 2: // compressed stack pointer relative loads and stores, and c.ebreak
+      return ((funct3 == 0) or (funct3 == 4)) and ((encoding & 0xffff) != 0x9002);
+    default:
+      break;
+    }
+
+    switch (encoding & 0x7f) {
+    case 0x03: // LOAD
+    case 0x07: // LOAD-FP
+    case 0x0f: // MISC-MEM
+    case 0x23: // STORE
+    case 0x27: // STORE-FP
+    case 0x2f: // AMO
+    case 0x73: // SYSTEM
+      return false;
+    default:
+      return true;
+    }
+  }
+
 }
 
 //!< simulator calls these C functions:
@@ -424,6 +485,90 @@ namespace Force {
     }
   }
 
+  //!< write a batch of simulator registers with a single call when the simulator supports it...
+
+  void SimApiHANDCAR::WriteRegisters(uint32 CpuID, const RegisterWrite* pWrites, uint32 count)
+  {
+    if (nullptr == mpSimDllAPI->write_simulator_registers) {
+      SimAPI::WriteRegisters(CpuID, pWrites, count);
+      return;
+    }
+
+    stRegisterWriteBatch.clear();
+    for (uint32 i = 0; i < count; ++ i) {
+      const RegisterWrite& reg_write = pWrites[i];
+      SimRegisterWrite entry;
+      if (not get_register_write_entry(reg_write, entry)) {
+        // registers such as the PC are only known by name; write the batch so far first to keep the order.
+        WriteRegisterBatch(CpuID);
+        WriteRegister(CpuID, reg_write.mpName, reg_write.mValue, reg_write.mMask);
+        continue;
+      }
+
+      std::cout << "[SimApiHANDCAR::WriteRegisters] " << reg_write.mpName << std::hex << " 0x" << reg_write.mValue << "/0x" << reg_write.mMask << std::dec << std::endl;
+      if (mOfsApiTrace.is_open()) {
+        char tbuf[1024];
+        sprintf(tbuf,"  sim_api.write_simulator_register(0x%x,\"%s\", 0x%llx, 0x%llx);\n",
+                CpuID,reg_write.mpName,(unsigned long long) reg_write.mValue,(unsigned long long) reg_write.mMask);
+        mOfsApiTrace << tbuf << std::endl;
+      }
+      stRegisterWriteBatch.push_back(entry);
+    }
+    WriteRegisterBatch(CpuID);
+  }
+
+  void SimApiHANDCAR::WriteRegisterBatch(uint32 CpuID)
+  {
+    if (stRegisterWriteBatch.empty()) {
+      return;
+    }
+
+    int errorcode = mpSimDllAPI->write_simulator_registers(CpuID, stRegisterWriteBatch.data(), stRegisterWriteBatch.size());
+    if (0 != errorcode) {
+      stringstream err_stream;
+      err_stream << "Error code: " << errorcode << ", Problems writing a batch of " << dec << stRegisterWriteBatch.size() << " simulator registers. CPU ID: " << hex << CpuID << "\n";
+      throw SimulationError(err_stream.str());
+    }
+    stRegisterWriteBatch.clear();
+  }
+
+  //!< decode the next instruction of the cpu to tell whether stepping it stays local to the cpu...
+
+  bool SimApiHANDCAR::NextInstructionIsLocal(uint32 cpuId)
+  {
+    if (nullptr == mpSimDllAPI->translate_virtual_address) {
+      return false;
+    }
+
+    uint64 pc = 0;
+    uint64 mask = 0;
+    ReadRegister(cpuId, "PC", &pc, &mask);
+    uint64_t va = pc;
+    uint64_t pa = 0;
+    uint64_t mem_attrs = 0;
+    if (0 != mpSimDllAPI->translate_virtual_address(cpuId, &va, 2, &pa, &mem_attrs)) {
+      return false; // the fetch faults
+    }
+
+    uint8_t bytes[4] = {0, 0, 0, 0};
+    if (0 != mpSimDllAPI->read_simulator_memory(cpuId, &pa, 2, bytes)) {
+      return false;
+    }
+    if ((bytes[0] & 0x3) == 0x3) {
+      // the second half of a 32-bit instruction on the next page may need a translation of its own.
+      if ((pa & 0xfff) > 0xffc) {
+        return false;
+      }
+      uint64_t pa_high = pa + 2;
+      if (0 != mpSimDllAPI->read_simulator_memory(cpuId, &pa_high, 2, bytes + 2)) {
+        return false;
+      }
+    }
+
+    uint32 encoding = bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (uint32(bytes[3]) << 24);
+    return instruction_is_local(encoding);
+  }
+
   //!< standard step method...
 
   void SimApiHANDCAR::Step(uint32 cpuid, vector<RegUpdate> &rRegUpdates, vector<MemUpdate> &rMemUpdates, vector<MmuEvent> &rMmuEvents, vector<ExceptionUpdate> &rExceptUpdates)
@@ -54,6 +54,9 @@ namespace Force {
     //!< write simulator register. mask indicates which bits to write...
     void WriteRegister(uint32 CpuID,const char *regname,uint64 rval,uint64 rmask) override;
 
+    //!< write a batch of simulator registers, in one simulator call when the simulator supports it...
+    void WriteRegisters(uint32 CpuID, const RegisterWrite* pWrites, uint32 count) override;
+
     //!< step instruction for specified cpu; returns after simulator step complete, with all updates.
     void Step(uint32 cpuid,std::vector<RegUpdate> &rRegUpdates,std::vector<MemUpdate> &rMemUpdates,
 	      std::vector<MmuEvent> &rMmuEvents, std::vector<ExceptionUpdate> &rExceptUpdates) override;
@@ -63,11 +66,16 @@ namespace Force {
     void EnterSpeculativeMode(uint32 cpuId) override; //!< The CPU thread enters speculative mode.
     void LeaveSpeculativeMode(uint32 cpuId) override; //!< The CPU thread leaves speculative mode.
     void RecordExceptionUpdate(const SimException *pException) override; //!< Record exception update.
+    bool NextInstructionIsLocal(uint32 cpuId) override; //!< Return true if the next instruction of the cpu neither accesses memory nor is a system instruction.
 
     ASSIGNMENT_OPERATOR_ABSENT(SimApiHANDCAR);
     COPY_CONSTRUCTOR_ABSENT(SimApiHANDCAR);
+#ifdef UNIT_TEST
+    SimDllApi* GetSimDllApi() { return mpSimDllAPI; } //!< Return the simulator entry points, for tests to install stubs.
+#endif
   private:
     std::string BuildHandcarConfigurationString(const ApiSimConfig& rConfig);
+    void WriteRegisterBatch(uint32 CpuID); //!< Write the batched register writes to the simulator and clear the batch.
   private:
     SimDllApi * mpSimDllAPI;       //!< Simulator shared object APIs.
   };
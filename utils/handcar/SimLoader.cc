@@ -88,6 +88,14 @@ int open_sim_dll(const char *sim_dll_path,struct SimDllApi *api_ptrs) {
    if ( CheckSimOp("write_simulator_register") )
      return -1;
 
+   // batch register writes are optional, simulators without them are written one register at a time...
+   (*api_ptrs).write_simulator_registers = (int (*)(uint32_t, const SimRegisterWrite*, uint32_t)) dlsym(my_sim_lib,"write_simulator_registers");
+   dlerror();
+
+   // address translation is optional, without it no instruction is known to be local to its cpu...
+   (*api_ptrs).translate_virtual_address = (int (*)(int, const uint64_t*, int, uint64_t*, uint64_t*)) dlsym(my_sim_lib,"translate_virtual_address");
+   dlerror();
+
    (*api_ptrs).step_simulator = (int (*)(int, int, int)) dlsym(my_sim_lib, "step_simulator");
    if ( CheckSimOp("step_simulator") )
      return -1;
@@ -21,6 +21,15 @@
 
 // The Iss simulator is to be loaded dynamically. All function addresses can then be set...
 
+//!< register write passed to write_simulator_registers, laid out as RegisterWriteEntry in handcar_cosim_wrapper.h...
+struct SimRegisterWrite {
+  uint32_t category; //!< 0 for CSR, 1 for XPR, 2 for FPR, 3 for VECR.
+  uint32_t index;    //!< Register number within the category.
+  uint32_t offset;   //!< Byte offset into a VECR register.
+  uint64_t value;    //!< Value to write.
+  uint64_t mask;     //!< Mask of the bits to write.
+};
+
 struct SimDllApi {
   void *sim_lib;  //!<   pointer to simulator DLL
 
@@ -37,12 +46,14 @@ struct SimDllApi {
   int  (*partial_read_large_register)(int, const char*, uint8_t*, uint32_t, uint32_t);
   int  (*partial_write_large_register)(int, const char*, const uint8_t*, uint32_t, uint32_t);
   int  (*write_simulator_register)( uint32_t target_id, const char* registerName, uint64_t value, uint64_t mask);
+  int  (*write_simulator_registers)(uint32_t target_id, const SimRegisterWrite* pWrites, uint32_t count); //!< optional, NULL if the simulator does not provide it.
+  int  (*translate_virtual_address)(int target_id, const uint64_t* vaddr, int intent, uint64_t* paddr, uint64_t* memattrs); //!< optional, NULL if the simulator does not provide it.
   int  (*step_simulator)(int target_id, int num_steps, int stx_failed);
   bool (*inject_simulator_events)(uint32_t, uint32_t);
 
   SimDllApi() : sim_lib(NULL),initialize_simulator(NULL),terminate_simulator(NULL),
        get_simulator_version(NULL),get_disassembly(NULL),get_disassembly_for_target(NULL),read_simulator_memory(NULL),write_simulator_memory(NULL),
-       read_simulator_register(NULL),partial_read_large_register(NULL),partial_write_large_register(NULL),write_simulator_register(NULL), step_simulator(NULL), inject_simulator_events(NULL) {};
+       read_simulator_register(NULL),partial_read_large_register(NULL),partial_write_large_register(NULL),write_simulator_register(NULL), write_simulator_registers(NULL), translate_virtual_address(NULL), step_simulator(NULL), inject_simulator_events(NULL) {};
 
   
   // other simulator functions as they become available...
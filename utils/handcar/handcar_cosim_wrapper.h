@@ -245,6 +245,36 @@ int write_simulator_register(int target_id, const char* reg_name, const uint8_t*
 //
 int write_simulator_register_fpix( uint32_t target_id, const char* registerName, uint64_t value, uint64_t mask); 
 
+// RegisterWriteEntry struct: one register write passed to write_simulator_registers
+//
+//      uint32_t category -- register category: 0 for CSR, 1 for XPR, 2 for FPR, 3 for VECR
+//      uint32_t index -- register number within the category, the CSR address for a CSR
+//      uint32_t offset -- byte offset into a VECR register of the 8 bytes to write, ignored for other categories
+//      uint64_t value -- the value to write
+//      uint64_t mask -- high bits are relevant parts of the supplied value
+//
+struct RegisterWriteEntry {
+  uint32_t category;
+  uint32_t index;
+  uint32_t offset;
+  uint64_t value;
+  uint64_t mask;
+};
+
+// write_simulator_registers function: for the given target_id, write a batch of registers identified by category and index, in order, without looking them up by name
+//
+//  inputs:
+//      uint32_t target_id -- the processor id
+//      const RegisterWriteEntry* pWrites -- array of register writes
+//      uint32_t count -- number of entries in pWrites
+//
+//  returns:
+//      0 -- success
+//      1 -- one or more of the pointer arguments to this function are null
+//      3 -- an entry has an unknown category or could not be written; the entries before it were written
+//
+int write_simulator_registers(uint32_t target_id, const struct RegisterWriteEntry* pWrites, uint32_t count);
+
 bool inject_simulator_events(uint32_t cpuid, uint32_t events){return false;} //!< inject events into simulator
 
 // translate_virtual_address function: given a target_id(procid), virtual address, intent attempt to translate that address into a physical address and load the relevant PMP information into memattrs
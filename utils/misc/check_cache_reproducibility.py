@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+#  check_cache_reproducibility.py
+#
+#  Check that a generator code cache produces the same tests whether it is
+#  hit or missed.
+#
+#  Each template is generated with each seed twice: with an empty cache
+#  directory (cold) and again with the same directory (warm). The cold and
+#  warm runs must produce the same assembly file, ELF file, memory image and
+#  registers image, and the same generated instruction count. Lines starting with "$" hold the command line and the time stamp
+#  and are not compared.
+#
+#  The cache options are handlers_cache and boot_cache. Give several --cache
+#  arguments to enable several caches together. The run without the cache is
+#  not compared: handlers_cache generates the handlers with random values of
+#  their own and boot_cache generates the boot code from templates, so their
+#  tests differ from the ones generated without them.
+#
+#  Example:
+#    check_cache_reproducibility.py --cache handlers_cache \
+#      -t tests/riscv/APIs/GenData_test_force.py -s 0x2 -s 0x3
+
+import argparse
+import filecmp
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+REPO_ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), "..", ".."))
+
+DEFAULT_TEMPLATES = [
+    "tests/riscv/APIs/GenData_test_force.py",
+    "tests/riscv/thread_group/thread_group_basic_force.py",
+]
+
+
+def run_generator(args, template, seed, run_dir, options):
+    os.makedirs(run_dir)
+    cmd = [args.generator, "-t", os.path.join(REPO_ROOT, template), "-s", seed, "--img"]
+    cmd += ["--noiss", "-C", str(args.num_cores), "-T", str(args.num_threads)]
+    if options:
+        cmd += ["--options", ",".join(options)]
+    with open(os.path.join(run_dir, "gen.log"), "w") as log_file:
+        status = subprocess.call(cmd, cwd=run_dir, stdout=log_file, stderr=subprocess.STDOUT)
+    if status != 0:
+        raise RuntimeError("%s failed, see %s" % (" ".join(cmd), run_dir))
+
+
+def instruction_count(run_dir):
+    with open(os.path.join(run_dir, "gen.log")) as log_file:
+        counts = re.findall(r"Thread Instructions Generated: (\d+)", log_file.read())
+    return sum(int(count) for count in counts)
+
+
+def output_files(run_dir):
+    return sorted(name for name in os.listdir(run_dir) if name != "gen.log")
+
+
+def same_output(file_a, file_b):
+    if file_a.endswith(".ELF"):
+        return filecmp.cmp(file_a, file_b, shallow=False)
+    with open(file_a) as text_a, open(file_b) as text_b:
+        lines_a = [line for line in text_a if not line.startswith("$")]
+        lines_b = [line for line in text_b if not line.startswith("$")]
+    return lines_a == lines_b
+
+
+#  Return a list of differences between the reference run and another run.
+def compare_runs(ref_dir, run_dir):
+    differences = []
+    if output_files(ref_dir) != output_files(run_dir):
+        differences.append("output files %s" % output_files(run_dir))
+    for name in output_files(ref_dir):
+        run_file = os.path.join(run_dir, name)
+        if os.path.exists(run_file) and not same_output(os.path.join(ref_dir, name), run_file):
+            differences.append(name)
+    if instruction_count(ref_dir) != instruction_count(run_dir):
+        differences.append(
+            "instruction count %d instead of %d"
+            % (instruction_count(run_dir), instruction_count(ref_dir))
+        )
+    return differences
+
+
+def check_template(args, template, seed, work_dir):
+    tag = "%s_%s" % (os.path.basename(template).replace(".py", ""), seed)
+    cache_options = [
+        "%s=%s" % (cache, os.path.join(work_dir, tag + "_" + cache)) for cache in args.cache
+    ]
+    for name in ("cold", "warm"):
+        run_generator(args, template, seed, os.path.join(work_dir, tag, name), cache_options)
+
+    differences = compare_runs(
+        os.path.join(work_dir, tag, "cold"), os.path.join(work_dir, tag, "warm")
+    )
+    if differences:
+        print("FAIL %s seed %s warm vs cold: %s" % (template, seed, ", ".join(differences)))
+        return False
+
+    print("PASS %s seed %s" % (template, seed))
+    return True
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument(
+        "--cache",
+        action="append",
+        choices=["handlers_cache", "boot_cache"],
+        required=True,
+        help="cache option to check, may be repeated",
+    )
+    parser.add_argument("-t", "--template", action="append", help="template, repeatable")
+    parser.add_argument("-s", "--seed", action="append", help="seed, repeatable")
+    parser.add_argument("-C", "--num-cores", type=int, default=1)
+    parser.add_argument("-T", "--num-threads", type=int, default=1)
+    parser.add_argument(
+        "--generator",
+        default=os.path.join(os.environ.get("FORCE_PATH", REPO_ROOT), "bin", "friscv"),
+        help="generator executable",
+    )
+    parser.add_argument("--keep", action="store_true", help="keep the run directories")
+    args = parser.parse_args()
+
+    templates = args.template if args.template else DEFAULT_TEMPLATES
+    seeds = args.seed if args.seed else ["0x2", "0x3"]
+    work_dir = tempfile.mkdtemp(prefix="cache_check_")
+    try:
+        results = [
+            check_template(args, template, seed, work_dir)
+            for template in templates
+            for seed in seeds
+        ]
+    finally:
+        if args.keep:
+            print("Run directories kept in %s" % work_dir)
+        else:
+            shutil.rmtree(work_dir)
+    return 0 if all(results) else 1
+
+
+if __name__ == "__main__":
+    sys.exit(main())
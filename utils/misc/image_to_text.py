@@ -0,0 +1,156 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) [2020] Futurewei Technologies, Inc.
+#
+# FORCE-RISCV is licensed under the Apache License, Version 2.0
+#  (the "License"); you may not use this file except in compliance
+#  with the License.  You may obtain a copy of the License at
+#
+#  http://www.apache.org/licenses/LICENSE-2.0
+#
+# THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES
+# OF ANY KIND, EITHER EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO
+# NON-INFRINGEMENT, MERCHANTABILITY OR FIT FOR A PARTICULAR PURPOSE.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+#
+
+import argparse
+import struct
+import sys
+
+#  Layout of the binary image files written by --binary-img, see
+#  base/inc/BinaryImage.h.
+MAGIC = b"FRCIMAGE"
+VERSION = 3
+BYTE_ORDER_MARK = 0x01020304
+BYTE_ORDER_OFFSET = 12
+HEADER_FORMAT = "8sIIIIIIQQQQ"
+SECTION_FORMAT = "QQQII"
+REGISTER_FORMAT = "QQIIIIII"
+
+
+#  The header, the tables and the register values are in the byte order of
+#  the writing host, given by the byte order mark in the header.
+def read_byte_order(data):
+    (mark,) = struct.unpack_from("<I", data, BYTE_ORDER_OFFSET)
+    if mark == BYTE_ORDER_MARK:
+        return "<"
+    if mark == 0x04030201:
+        return ">"
+    return None
+
+
+def read_table(data, offset, count, entry_format):
+    entry_size = struct.calcsize(entry_format)
+    return [struct.unpack_from(entry_format, data, offset + i * entry_size) for i in range(count)]
+
+
+def memory_to_text(data, head, section_table):
+    lines = [head, "# Initializations  Memory"]
+    for address, data_offset, size, data_type, _ in section_table:
+        section = data[data_offset : data_offset + size]
+        text = "%s %016x %4d " % (chr(data_type), address, size)
+        if size > 32:
+            text += "\n  "
+        for i, byte in enumerate(section[:-1], 1):
+            text += "%02x" % byte
+            if i % 32 == 0:
+                text += "\n  "
+            elif i % 8 == 0:
+                text += "_"
+        text += "%02x" % section[-1]
+        lines.append(text)
+    return lines
+
+
+def registers_to_text(data, byte_order, head, register_table):
+    lines = [head]
+    current_thread = None
+    for entry in register_table:
+        (
+            name_offset,
+            values_offset,
+            thread_id,
+            flag,
+            name_size,
+            value_count,
+            value_size,
+            _,
+        ) = entry
+        if thread_id != current_thread:
+            lines.append("# Thread %d Registers Initializations" % thread_id)
+            lines.append("T %d" % thread_id)
+            current_thread = thread_id
+
+        name = data[name_offset : name_offset + name_size].decode()
+        values = struct.unpack_from("%s%dQ" % (byte_order, value_count), data, values_offset)
+        value_text = "".join("%0*x" % (value_size * 2, value) for value in values)
+        lines.append("%s %-14s %s" % (chr(flag), name, value_text))
+    return lines
+
+
+def image_to_text(image_path):
+    with open(image_path, "rb") as image_file:
+        data = image_file.read()
+
+    byte_order = read_byte_order(data)
+    if byte_order is None:
+        raise ValueError("%s is not a version %d binary image" % (image_path, VERSION))
+
+    (
+        magic,
+        version,
+        _,
+        head_size,
+        section_count,
+        register_count,
+        _,
+        section_table_offset,
+        register_table_offset,
+        file_size,
+        _,
+    ) = struct.unpack_from(byte_order + HEADER_FORMAT, data, 0)
+    if magic != MAGIC or version != VERSION or file_size != len(data):
+        raise ValueError("%s is not a version %d binary image" % (image_path, VERSION))
+
+    header_size = struct.calcsize(byte_order + HEADER_FORMAT)
+    head = data[header_size : header_size + head_size].decode()
+    if register_count > 0:
+        register_table = read_table(
+            data, register_table_offset, register_count, byte_order + REGISTER_FORMAT
+        )
+        return registers_to_text(data, byte_order, head, register_table)
+
+    section_table = read_table(
+        data, section_table_offset, section_count, byte_order + SECTION_FORMAT
+    )
+    return memory_to_text(data, head, section_table)
+
+
+def setup_arguments():
+    arg_parser = argparse.ArgumentParser(
+        description="Convert a binary image file written with --binary-img to the text image format"
+    )
+    arg_parser.add_argument("image", help="binary memory or registers image file")
+    arg_parser.add_argument(
+        "-o",
+        "--output",
+        help="text image file to write, defaults to standard output",
+        default=None,
+    )
+    return arg_parser
+
+
+def main():
+    args = setup_arguments().parse_args()
+    text = "\n".join(image_to_text(args.image)) + "\n"
+    if args.output is None:
+        sys.stdout.write(text)
+    else:
+        with open(args.output, "w") as output_file:
+            output_file.write(text)
+
+
+if __name__ == "__main__":
+    main()